@@ -88,7 +88,7 @@ void MCP23008::acknowledge_interrupt ( uint8_t &pin, uint8_t &values ) {
 }
 
 uint8_t MCP23008::read_register ( uint8_t reg ) {
-    char data[] = {reg};
+    char data[] = {char(reg)};
     if ( 0 != i2c->write ( i2c_address, data, 1 ) )
     {
         //error ( "MCP23008::read_register: Missing ACK for write\n" );
@@ -107,7 +107,7 @@ uint8_t MCP23008::read_register ( uint8_t reg ) {
 }
 
 void MCP23008::write_register ( uint8_t reg, uint8_t value ) {
-    char data[] = {reg, value};
+    char data[] = {char(reg), char(value)};
     if ( 0 != i2c->write ( i2c_address, data, 2 ) )
     {
         //error ( "MCP23008::write_register: Missing ACK for write\n" );
@@ -1,5 +1,5 @@
-#include "mbed.h"
-using namespace mbed;
+#pragma once
+#include "i2cBus.h"
 
 // From https://os.mbed.com/users/dewyatt/code/MCP23008/docs/tip/classMCP23008.html
 
@@ -150,7 +150,7 @@ public:
 
     inline bool isError() {return m_error;}
 
-    void setI2C(I2C* i) { i2c = i; }
+    void setI2C(I2cBus* i) { i2c = i; }
     void reset ();
 
 private:
@@ -158,7 +158,7 @@ private:
     void write_register ( uint8_t reg, uint8_t value );
     void write_mask ( uint8_t reg, uint8_t mask, bool value );
 
-    I2C* i2c;
+    I2cBus* i2c;
     uint8_t i2c_address;
     bool m_error;
 };
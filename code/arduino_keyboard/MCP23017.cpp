@@ -0,0 +1,72 @@
+#include "MCP23017.hpp"
+
+namespace {
+const uint8_t MCP23017_ADDRESS  = 0x20;
+
+/* MCP23017 registers, with IOCON.BANK = 0 (the default) the registers of port A and port B are interleaved */
+const uint8_t IODIRA            = 0x00;
+const uint8_t IPOLA             = 0x02;
+const uint8_t GPPUA             = 0x0C;
+const uint8_t GPIOA             = 0x12;
+const uint8_t OLATB             = 0x15;
+};
+
+MCP23017::MCP23017 (uint8_t address )
+        : i2c_address ( (MCP23017_ADDRESS | address) << 1 ) {
+    if ( address > 7 )
+        error ( "MCP23017::MCP23017: address is out of range, must be <= 7\n" );
+}
+
+void MCP23017::set_input_pins ( uint16_t pins ) {
+    uint16_t value = read_register ( IODIRA );
+    if (m_error) return;
+
+    write_register ( IODIRA, value | pins );
+}
+
+uint16_t MCP23017::read_inputs () {
+    return read_register ( GPIOA );
+}
+
+void MCP23017::set_pullups ( uint16_t values ) {
+    write_register ( GPPUA, values );
+}
+
+// The address pointer is incremented after each byte (IOCON.SEQOP = 0, the default), so the register of port B is transferred right after the one of port A.
+uint16_t MCP23017::read_register ( uint8_t reg ) {
+    char data[] = {char(reg), 0};
+    if ( 0 != i2c->write ( i2c_address, data, 1 ) )
+    {
+        m_error = true;
+        return 0;
+    }
+
+    if ( 0 != i2c->read ( i2c_address, data, 2 ) )
+    {
+        m_error = true;
+        return 0;
+    }
+
+    return uint8_t(data[0]) | (uint8_t(data[1]) << 8);
+}
+
+void MCP23017::write_register ( uint8_t reg, uint16_t value ) {
+    char data[] = {char(reg), char(value), char(value >> 8)};
+    if ( 0 != i2c->write ( i2c_address, data, 3 ) )
+    {
+        m_error = true;
+        return;
+    }
+}
+
+void MCP23017::reset ( ) {
+    m_error = false;
+    write_register ( IODIRA, 0xFFFF );
+    if (m_error) return;
+
+    for ( uint8_t reg = IPOLA; reg < OLATB; reg += 2 )
+    {
+        write_register ( reg, 0 );
+        if (m_error) return;
+    }
+}
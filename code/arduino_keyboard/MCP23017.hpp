@@ -0,0 +1,57 @@
+#pragma once
+#include "i2cBus.h"
+
+/** MCP23017 class
+ *
+ * Allow access to an I2C connected MCP23017 16-bit I/O extender chip, in the same way as MCP23008.
+ * The two 8-bit ports are accessed together: port A is the low byte and port B the high byte of each value.
+ *
+ */
+class MCP23017 {
+public:
+    enum Pin {
+        Pin_A_All = 0x00FF,
+        Pin_B_All = 0xFF00,
+        Pin_All = 0xFFFF
+    };
+
+    /** Constructor
+     *
+     * @param address The hardware address of the MCP23017. This is the 3-bit
+     * value that is physically set via A0, A1, and A2.
+     */
+    MCP23017 (uint8_t address);
+
+    /** Set pins to input mode, in addition to the previously set.
+     *
+     * @param pins A bitmask of pins to set to input mode.
+     */
+    void set_input_pins ( uint16_t pins );
+
+    /** Read from the input pins of both ports, in a single transaction.
+     *
+     * @returns A bitmask of the current state of the input pins.
+     */
+    uint16_t read_inputs ();
+
+    /** Enable and disable the internal pull-up resistors for input pins.
+     *
+     * A 1 bit enables the 100 kΩ pull-up resistor for the corresponding input pin.
+     *
+     * @param values A bitmask indicating which pull-up resistors should be enabled/disabled.
+     */
+    void set_pullups ( uint16_t values );
+
+    inline bool isError() {return m_error;}
+
+    void setI2C(I2cBus* i) { i2c = i; }
+    void reset ();
+
+private:
+    uint16_t read_register ( uint8_t reg );
+    void write_register ( uint8_t reg, uint16_t value );
+
+    I2cBus* i2c;
+    uint8_t i2c_address;
+    bool m_error;
+};
@@ -3,23 +3,72 @@
 #include "input.h"
 #include "PluggableUSBHID.h"
 #include "Keyboard.h"
-#include "KeyConfig.h"
+#include "keymap.h"
 #include "event.h"
+#include "perf.h"
+#include "storage.h"
+#include "debounce.h"
+#include "telemetry.h"
+#include "heatmap.h"
+#include "power.h"
+#include "settings.h"
+#include "control.h"
+#include "replay.h"
+#include "bench.h"
+#include "recorder.h"
+#include "deadline.h"
+#include "pipeline.h"
+#include "frameSync.h"
+#include <stdio.h>
 
 
 
 class LayerTracker {
 public:
+  /// A key holding the layer 'i' was pressed (d = +1) or released (d = -1).
   inline void delta(LayerBit i, int8_t d) {
     if (i > 0) {
       m_count[i - 1] += d;
+      update();
+    }
+  }
 
-      // Update mask.
-      m_mask = 0;
-      for (uint8_t i = 0, p = 1; i < 8; ++i, p = p << 1) {
-        m_mask = m_mask | (m_count[i] > 0 ? p : 0);
+  /// Switch the layer 'i' on or off, see LAYER_TOGGLE.
+  inline void toggle(LayerBit i) {
+    if (i > 0) {
+      m_toggled ^= LAYER_MASK(i);
+      update();
+    }
+  }
+
+  /// A one-shot key of the layer 'i' was pressed or released, see LAYER_ONE_SHOT.
+  inline void oneShot(LayerBit i, bool isPressed) {
+    if (i > 0) {
+      if (isPressed) {
+        m_oneShotCandidates |= LAYER_MASK(i);
+      } else if (m_oneShotCandidates & LAYER_MASK(i)) {
+        // No other key was pressed while it was held.
+        m_oneShotCandidates &= ~LAYER_MASK(i);
+        m_oneShot |= LAYER_MASK(i);
       }
+      delta(i, isPressed ? +1 : -1);
+    }
+  }
+
+  /// A key that is not a layer key was pressed or released. Return true if this changed the active layers.
+  inline bool key(bool isPressed) {
+    if (isPressed) {
+      // The one-shot keys currently held are used as normal layer keys, and the active one-shot layers are used by this key.
+      m_oneShotCandidates = 0;
+      if (m_oneShot != 0) m_oneShotUsed = true;
+      return false;
     }
+
+    if (!m_oneShotUsed) return false;
+    m_oneShot = 0;
+    m_oneShotUsed = false;
+    update();
+    return true;
   }
 
   inline uint8_t mask() {
@@ -27,13 +76,34 @@ public:
   }
 
 private:
+  inline void update() {
+    m_mask = m_toggled | m_oneShot;
+    for (uint8_t i = 0, p = 1; i < 8; ++i, p = p << 1) {
+      m_mask = m_mask | (m_count[i] > 0 ? p : 0);
+    }
+  }
+
   int8_t m_count[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  /// Layers switched on by a LAYER_TOGGLE key.
+  uint8_t m_toggled = 0;
+  /// Layers kept active by a released LAYER_ONE_SHOT key.
+  uint8_t m_oneShot = 0;
+  /// Layers of the LAYER_ONE_SHOT keys held while no other key was pressed.
+  uint8_t m_oneShotCandidates = 0;
+  /// True if a key was pressed while m_oneShot was active, the one-shot layers end when it is released.
+  bool m_oneShotUsed = false;
   uint8_t m_mask = 0;
 };
 
 /// The queue of input event that are yet to be processed.
 EventQueue s_events;
 
+/// For each switch, its state in the last event added to s_events. It differs from Input::isPressed() while an edge of that switch did not fit in the queue.
+bool s_queuedState[NUM_LINES][NUM_COLUMNS];
+
+/// True if some edges did not fit in s_events and are still to be added, see loop().
+bool s_hasDroppedEdges = false;
+
 /// For each switch on the physical keyboard, track if that switch is currently pressed.
 /// Instead of being a bool, we use a counter where "count = 0" mean the switch is not pressed and "count > 0" mean the switch is pressed. We do that so we can do some tricks where we force enable some of the switches momentarely by adding 1 without having to worry about if the switch was already pressed.
 uint8_t s_currentPressCount[NUM_LINES][NUM_COLUMNS];
@@ -44,6 +114,58 @@ LayerTracker s_layerTracker;
 /// Additional key that is forced to be in the output even if the switch is causing that key to be held. This is reset on layer changes.
 Key s_forcedKey = Key::NONE;
 
+/// Position of the "on release" key currently being held for KEY_PRESS_LENGTH by a simulated tap, or {-1, -1} if there is none.
+/// While a tap is being held, no other event is processed, but the switches keep being scanned.
+Pos s_tapPos = Pos{ -1, -1 };
+
+/// Time at which the simulated tap in s_tapPos was pressed, in micro-seconds.
+unsigned long s_tapTime = 0;
+
+/// Time of the last press of a key that is neither an "on release" key nor a layer key, in micro-seconds, see TypingStreakStage.
+unsigned long s_lastTypedTime = 0;
+
+/// For each "on release" key resolved as a tap by TypingStreakStage, the time of its press, until its release is dropped. 0 for the other keys.
+unsigned long s_streakPressTime[NUM_LINES][NUM_COLUMNS];
+
+#if REPLAY_LOG
+/// True while a reference trace is replayed. Keyboard states are then built but not sent to the USB host.
+bool s_replaying = false;
+
+/// Sum of the latencies recorded during the current replay, in micro-seconds.
+unsigned long long s_replayLatencyTotal = 0;
+
+/// Time spent building keyboard states during the current replay, in micro-seconds.
+unsigned long s_replayReportTime = 0;
+
+/// Time spent processing events during the current replay, in micro-seconds.
+unsigned long s_replayCpuTime = 0;
+
+/// Number of edges fed to the event queue during the current replay.
+uint32_t s_replayEdges = 0;
+
+/// Digest of the distinct keyboard states built during the current replay, see Replay.
+uint32_t s_replayDigest = 0;
+
+/// Last keyboard state added to s_replayDigest.
+uint8_t s_replayState[KEYBOARD_STATE_SIZE];
+
+/// The corpus trace being replayed, whose typed keys are checked by replayCheckTyped(). Null while replaying other traces.
+const CorpusTrace* s_replayCorpus = nullptr;
+
+/// Index in the typed keys of s_replayCorpus of the next key that should be typed.
+uint16_t s_replayNextTyped = 0;
+
+/// During the current replay, keys typed as expected, keys that should have been typed but were not, and keys typed that should not have been.
+uint32_t s_replayTyped = 0;
+uint32_t s_replayMissing = 0;
+uint32_t s_replayExtra = 0;
+#endif
+
+#if BENCH_LOG
+/// True while sendCurrentKeyPress() is benchmarked. Keyboard states are then built but not sent to the USB host.
+bool s_benchmarking = false;
+#endif
+
 /// Add 'keys' to the output.
 inline void addK(const K& keys) {
   if (keys.m_key0 != Key::NONE) KeyboardOutput::add(keys.m_key0);
@@ -51,17 +173,58 @@ inline void addK(const K& keys) {
   if (keys.m_mediaKey != MediaKey::NONE) KeyboardOutput::add(keys.m_mediaKey);
 }
 
-/// Send all the key pressed to the USB bus given the current state of the keyboard.
-void sendCurrentKeyPress();
-void sendCurrentKeyPress() {
+/// Record the time between a key edge at 'edgeTime' and the keyboard state it produced at 'current'.
+inline void recordLatency(unsigned long edgeTime, unsigned long current) {
+  Perf::record(Perf::HISTOGRAM_KEY_LATENCY, current - edgeTime);
+#if REPLAY_LOG
+  s_replayLatencyTotal += current - edgeTime;
+#endif
+}
+
+#if REPLAY_LOG
+/// Compare the keys that appear in the keyboard state 'state', since the previous one, with the keys that s_replayCorpus should type.
+///
+/// A key that is not the next expected one is searched up to REPLAY_CORPUS_LOOKAHEAD keys ahead: if found, the keys skipped were missing, otherwise it is an extra key.
+void replayCheckTyped(const uint8_t* state) {
+  if (s_replayCorpus == nullptr) return;
+  const CorpusTrace& corpus = *s_replayCorpus;
+
+  for (int i = 1; i <= 6; ++i) {
+    uint8_t key = state[i];
+    if (key == 0 || memchr(s_replayState + 1, key, 6) != nullptr) continue;
+
+    uint16_t typed = (state[0] << 8) | key;
+    int skipped = 0;
+    while (skipped < REPLAY_CORPUS_LOOKAHEAD && s_replayNextTyped + skipped < corpus.m_numTyped && corpus.m_typed[s_replayNextTyped + skipped] != typed) ++skipped;
+
+    if (skipped < REPLAY_CORPUS_LOOKAHEAD && s_replayNextTyped + skipped < corpus.m_numTyped) {
+      s_replayTyped++;
+      s_replayMissing += skipped;
+      s_replayNextTyped += skipped + 1;
+    } else {
+      s_replayExtra++;
+    }
+  }
+}
+#endif
+
+/// Send all the key pressed to the USB bus given the current state of the keyboard, at time 'current'.
+void sendCurrentKeyPress(unsigned long current);
+void sendCurrentKeyPress(unsigned long current) {
+#if REPLAY_LOG
+  unsigned long replayStart = micros();
+#endif
+
   // Start by resetting the output.
   KeyboardOutput::releaseAll();
 
   // Get the switch to key mapping for the current active layer.
-  K(*currentLayer)
-  [12] = s_keyMaps[s_layerTracker.mask()];
+  const K(*currentLayer)
+  [NUM_COLUMNS] = Keymap::tables().m_layers[s_layerTracker.mask()];
+#if DEBUG_LOG
   debugPrint("\tLayer mask: ");
   debugPrintln(s_layerTracker.mask());
+#endif
 
   // Add the key associated to every active switch.
   for (int line = 0; line < NUM_LINES; ++line) {
@@ -78,192 +241,285 @@ void sendCurrentKeyPress() {
     addK(s_forcedKey);
   }
 
-  // HACK: If layer 1 is enabled and no key is currently pressed, we press shift. This is because physical shift key is associated to a layer, but if we are not pressing any key on that layer we want shift to be pressed.
-  // TODO: improve this code to be more generic.
-  if (!KeyboardOutput::isAnyKeyPressed() && s_layerTracker.mask() == 1) {
-    addK(Key::SHIFT);
-    debugPrintln("\tAdding shift");
+  // If no key is pressed, we press the idle key of the active layers. This is how the physical shift key, which selects the shift layer, still acts as shift for the keys of other layers.
+  if (!KeyboardOutput::isAnyKeyPressed()) {
+    addK(Keymap::tables().m_idleKeys[s_layerTracker.mask()]);
   }
 
+#if BENCH_LOG
+  if (s_benchmarking) return;
+#endif
+
   // Send to the USB bus.
+#if REPLAY_LOG
+  if (s_replaying) {
+    s_replayReportTime += micros() - replayStart;
+
+    uint8_t state[KEYBOARD_STATE_SIZE];
+    KeyboardOutput::getState(state);
+    if (memcmp(state, s_replayState, sizeof(state)) != 0) {
+      replayCheckTyped(state);
+      memcpy(s_replayState, state, sizeof(state));
+      s_replayDigest = Storage::crc32(state, sizeof(state), s_replayDigest);
+    }
+  } else {
+    KeyboardOutput::send();
+    Recorder::record(Recorder::ENTRY_REPORT, s_layerTracker.mask(), 0, current);
+  }
+#else
   KeyboardOutput::send();
+  Recorder::record(Recorder::ENTRY_REPORT, s_layerTracker.mask(), 0, current);
+#endif
+  Perf::count(Perf::COUNTER_REPORTS_SENT);
 }
 
 
 
-void setup() {
-#if ANY_LOG
-  Serial.begin(9600);
-#endif
+/// Swap a key press with the release of another key that follows it within OVERLAP_REMOVAL_TIME, see OVERLAP_REMOVAL.
+/// It runs before the debouncing so that if a bounce happened at the same time of another key press/release, the bounce events become successive in the event queue.
+struct OverlapRemovalStage {
+  static inline Pipeline::Result process(const Event& event, Pipeline::Context& context) {
+    unsigned long overlapTime = Settings::get(Settings::SETTING_OVERLAP_REMOVAL_TIME);
 
-  Input::init();
+    // If the event is not old enough, we have to wait before we can evalulate if there are any overlap removal to be done
+    if (context.m_current - event.m_time < overlapTime) return Pipeline::RESULT_WAIT;
 
-  for (int line = 0; line < NUM_LINES; ++line) {
-    for (int column = 0; column < NUM_COLUMNS; ++column) {
-      s_currentPressCount[line][column] = 0;
+    // We look at the next event. We swap the two event if the following conditions are met:
+    //  - The current event is a key press
+    //  - The next event is a key release
+    //  - The two event are for different keys (otherwise we will swap ordinary key taps).
+    //  - The time between them is lower than the overlap removal time
+    EventQueue::Iterator nextIt = s_events.next(s_events.begin());
+    if (nextIt != s_events.end()) {
+      const Event& nextEvent = s_events[nextIt];
+
+      if (nextEvent.m_time - event.m_time < overlapTime && event.m_isPressed && !nextEvent.m_isPressed && event.m_pos != nextEvent.m_pos) {
+        ON_DEBUG_LOG(debugPrint("Swap events to remove overlap\n"));
+        // 'event' refers to the front of the queue, so the next stages see the swapped event.
+        Event currEventCopy = event;
+        s_events[s_events.begin()] = nextEvent;
+        s_events[nextIt] = currEventCopy;
+      }
     }
+    return Pipeline::RESULT_NEXT;
   }
-}
+};
 
-#if PERF_LOG
-unsigned long perf_min = -1;
-unsigned long perf_max = 0;
-unsigned long perf_total = 0;
-int perf_count = 0;
-static const int perf_countTotal = 1000;
-#endif
+/// Cancel an event with the opposite edge of its key that follows it within the debounce time of the key.
+/// The way we do debouncing is we wait any event to be older than the debounce time of its key before processing to check if we can cancel it.
+struct DebounceStage {
+  static inline Pipeline::Result process(const Event& event, Pipeline::Context& context) {
+    unsigned long debounceTime = Debounce::time(event.m_pos);
 
-void loop() {
-#if PERF_LOG
-  unsigned long perf_start = micros();
-#endif
+    // If the event is not old enough, we have to wait a bit and pull the switches to check if we need to debounce.
+    if (context.m_current - event.m_time < debounceTime) return Pipeline::RESULT_WAIT;
 
-  // We refresh the input.
-  Input::step();
+    // We look at future event and see if we have an event in the queue that match this key with an opposite state withing the debouncing time frame.
+    for (EventQueue::Iterator it : s_events) {
+      // We are outside the debouncing time frame, we can stop looking for events.
+      if (s_events[it].m_time - event.m_time > debounceTime) {
+        break;
+      }
 
-  // We add an event in the event queue for each key that have changed state.
-  ON_DEBUG(bool anyNewEvent = false);
-  for (int line = 0; line < NUM_LINES; ++line) {
-    for (int column = 0; column < NUM_COLUMNS; ++column) {
+      // If the event is for the same key and with the opposite state, we have can debounce.
+      if (s_events[it].m_pos == event.m_pos && s_events[it].m_isPressed != event.m_isPressed) {
+        ON_DEBUG_LOG(debugPrint("Cancel key\n"));
+        Debounce::recordBounce(event.m_pos, s_events[it].m_time - event.m_time);
+        Telemetry::recordBounce(event.m_pos, s_events[it].m_time - event.m_time);
+        unsigned long bounce = s_events[it].m_time - event.m_time;
+        Recorder::record(Recorder::ENTRY_BOUNCE, event.m_pos, bounce > 0xFFFF ? 0xFFFF : bounce, s_events[it].m_time);
 
-      if (Input::hasChanged(line, column)) {
-        Event& event = s_events.emplaceBack();
-        event.m_pos = Pos{ line, column };
-        event.m_isPressed = Input::isPressed(line, column);
-        event.m_time = micros();
+        // We remove the current event and the opposite one.
+        s_events.popFront();
+        s_events.remove(it);
 
-        ON_DEBUG(anyNewEvent = true);
+#if DEBUG_LOG
+        debugPrintln("Debounced a key, event queue:");
+        s_events.print("\t");
+#endif
+        return Pipeline::RESULT_DONE;
       }
     }
+    return Pipeline::RESULT_NEXT;
   }
+};
 
-#if DEBUG_LOG
-  if (anyNewEvent) {
-    debugPrintln("new events added to queue:");
-    s_events.print("\t");
+/// Update the active layers with the press or release of the key at 'pos', and reset the keys pressed if they changed.
+inline void updateLayers(const Pos& pos, bool isPressed) {
+  LayerBit layer = Keymap::tables().m_layerKeys[pos.m_line][pos.m_column];
+  bool layerChanged = true;
+  if (layer != LAYER_NONE) {
+    switch (Keymap::tables().m_layerActivations[pos.m_line][pos.m_column]) {
+      case LAYER_MOMENTARY: s_layerTracker.delta(layer, isPressed ? +1 : -1); break;
+      case LAYER_TOGGLE:
+        if (isPressed) s_layerTracker.toggle(layer);
+        break;
+      case LAYER_ONE_SHOT: s_layerTracker.oneShot(layer, isPressed); break;
+    }
+  } else {
+    layerChanged = s_layerTracker.key(isPressed);
   }
-#endif
 
-  // Now we are going to process the every event in the queue that we can.
-  unsigned long current = micros();
-  while (!s_events.isEmpty()) {
-    const Event& event = s_events.peek();
-
-    //// Overlap removal.
-    //// We do overlap removal before debouncing so that if a bounce happened at the same time of another key press/release, then we swap thing in the queue that make the bounce event successive in the event queue.
-    //{
-    //  // If the event is not old enough, we have to wait before we can evalulate if there are any overlap removal to be done
-    //  if (current - event.m_time < OVERLAP_REMOVAL_TIME) break;
-    //
-    //  // We look at the next event. We swap the two event if the following conditions are met:
-    //  //  - The current event is a key press
-    //  //  - The next event is a key release
-    //  //  - The two event are for different keys (otherwise we will swap ordinary key taps).
-    //  //  - The time between them is lower than OVERLAP_REMOVAL_TIME
-    //  EventQueue::Iterator nextIt = s_events.next(s_events.begin());
-    //  if (nextIt != s_events.end()) {
-    //    const Event& nextEvent = s_events[nextIt];
-    //
-    //    if (nextEvent.m_time - event.m_time < OVERLAP_REMOVAL_TIME && event.m_isPressed && !nextEvent.m_isPressed && event.m_pos != nextEvent.m_pos) {
-    //      debugPrint("Swap events to remove overlap\n");
-    //      Event currEventCopy = event;
-    //      s_events[s_events.begin()] = nextEvent;
-    //      s_events[nextIt] = currEventCopy;
-    //    }
-    //  }
-    //}
-
-    // Debouncing.
-    // The way we do debouncing is we wait any event to be older than DEBOUNCE_TIME before processing to check if we can cancel it.
-    {
-      // If the event is not old enough, we have to wait a bit and pull the switches to check if we need to debounce.
-      if (current - event.m_time < DEBOUNCE_TIME) break;
-
-      // We look at future event and see if we have an event in the queue that match this key with an opposite state withing the debouncing time frame.
-      bool debounced = false;
-      for (EventQueue::Iterator it : s_events) {
-        // We are outside the debouncing time frame, we can stop looking for events.
-        if (s_events[it].m_time - event.m_time > DEBOUNCE_TIME) {
-          break;
-        }
+  if (layerChanged) {
+    // Reset button presses when layer change.
+    for (int line = 0; line < NUM_LINES; ++line) {
+      for (int column = 0; column < NUM_COLUMNS; ++column) {
+        if (Keymap::tables().m_immuneToReset[line][column]) continue;  // Except key that are immune to reset.
+        s_currentPressCount[line][column] = 0;
+      }
+    }
 
-        // If the event is for the same key and with the opposite state, we have can debounce.
-        if (s_events[it].m_pos == event.m_pos && s_events[it].m_isPressed != event.m_isPressed) {
-          debugPrint("Cancel key\n");
+    // Reset the forced key.
+    s_forcedKey = Key::NONE;
+  }
+}
 
-          // We remove the current event and the opposite one.
-          s_events.popFront();
-          s_events.remove(it);
-          debounced = true;
-          break;
-        }
-      }
+/// Resolve an "on release" key as a tap at its press when it comes within SETTING_TYPING_STREAK_TIME of the press of a regular key, instead of waiting for its release.
+///
+/// Only keys whose tap types something in the active layers are resolved this way. A layer key resolved as a tap that is still held when another key is pressed was meant
+/// to select its layer: the layer is selected at that press, and the key is released like any layer key. Its tap was already sent, it counts as a misfire.
+struct TypingStreakStage {
+  static inline Pipeline::Result process(const Event& event, Pipeline::Context& context) {
+    const Pos& pos = event.m_pos;
+    if (event.m_isPressed && Settings::get(Settings::SETTING_TYPING_STREAK_TIME) != 0) selectHeldLayers(pos);
 
-#if DEBUG_LOG
-      if (debounced) {
-        debugPrintln("Debounced a key, event queue:");
-        s_events.print("\t");
-      }
-#endif
+    if (!Keymap::tables().m_onRelease[pos.m_line][pos.m_column]) {
+      if (event.m_isPressed && Keymap::tables().m_layerKeys[pos.m_line][pos.m_column] == LAYER_NONE) s_lastTypedTime = event.m_time;
+      return Pipeline::RESULT_NEXT;
+    }
+
+    unsigned long& pressTime = s_streakPressTime[pos.m_line][pos.m_column];
+    if (!event.m_isPressed) {
+      if (pressTime == 0) return Pipeline::RESULT_NEXT;
 
-      // We debounced the current event, go to the next event in the main event processing loop.
-      if (debounced) continue;
+      // The key was already tapped at its press, its release only ends the streak tap.
+      Debounce::recordEdge(pos, event.m_time);
+      Telemetry::recordRelease(pos, event.m_time);
+      if (event.m_time - pressTime >= Settings::get(Settings::SETTING_MAX_HOLD_TIME)) Perf::count(Perf::COUNTER_STREAK_MISFIRES);
+      pressTime = 0;
+      s_events.popFront();
+      return Pipeline::RESULT_DONE;
     }
 
-    // We process "on release" key presses.
-    // "on release" key presses are key that trigger an output if they when they are relased if:
-    //   - They were released within MAX_HOLD_TIME of being pressed
-    //   - No other key was pressed in between, but other key release are acceptable.
-    // Typically this is for keys that are associated with layer changes, but output a character when being tapped.
-    if (onRelease[event.m_pos.m_line][event.m_pos.m_column] && event.m_isPressed) {
-      // We have a key press for a "on release" key.
-
-      // Look up if we can find the event for releasing the current key.
-      bool foundRelease = false;
-      EventQueue::Iterator releaseIndex;
-      // And look if we pressed another key.
-      bool foundAnotherPress = false;
-      for (EventQueue::Iterator it = s_events.next(s_events.begin()); it != s_events.end(); ++it) {
-        if (s_events[it].m_pos == event.m_pos && !s_events[it].m_isPressed) {
-          foundRelease = true;
-          releaseIndex = it;
-          break;
-        }
+    // With a streak time of 0 the difference is never lower.
+    if (event.m_time - s_lastTypedTime >= Settings::get(Settings::SETTING_TYPING_STREAK_TIME)) return Pipeline::RESULT_NEXT;
 
-        if (s_events[it].m_pos != event.m_pos && s_events[it].m_isPressed) {
-          foundAnotherPress = true;
-          break;
-        }
-      }
+    // A key that only selects a layer has nothing to tap.
+    const K& tap = Keymap::tables().m_layers[s_layerTracker.mask()][pos.m_line][pos.m_column];
+    if (tap.m_key0 == Key::NONE && tap.m_key1 == Key::NONE && tap.m_mediaKey == MediaKey::NONE) return Pipeline::RESULT_NEXT;
 
-      if (!foundAnotherPress) {
-        if (foundRelease) {
-          // We found the release event, and there was no press in between. If the two events are within the MAX_HOLD_TIME, we execute the "on release" behavior
-          if (s_events[releaseIndex].m_time - event.m_time < MAX_HOLD_TIME) {
-            debugPrintln("Press and release key");
+    ON_DEBUG_LOG(debugPrintln("Tap key of a typing streak"));
+    unsigned long current = context.m_current;
+    Debounce::recordEdge(pos, event.m_time);
+    Telemetry::recordPress(pos, event.m_time);
+    Heatmap::recordPress(s_layerTracker.mask(), pos, event.m_time);
+    Recorder::record(Recorder::ENTRY_TAP, pos, 0xFFFF, event.m_time);
+    Perf::count(Perf::COUNTER_STREAK_TAPS);
 
-            s_currentPressCount[event.m_pos.m_line][event.m_pos.m_column]++;
-            sendCurrentKeyPress();
+    // Tapped like in OnReleaseStage. The streak goes on, e.g. for a space between two words.
+    s_currentPressCount[pos.m_line][pos.m_column]++;
+    s_tapPos = pos;
+    s_tapTime = current;
+    sendCurrentKeyPress(current);
+    recordLatency(event.m_time, current);
+    Perf::record(Perf::HISTOGRAM_TAP_LATENCY, current - event.m_time);
+    context.m_reportBudget--;
 
-            delay(KEY_PRESS_LENGTH);  // milliseconds
+    // 0 marks the keys that were not tapped by a streak.
+    pressTime = event.m_time != 0 ? event.m_time : 1;
+    s_lastTypedTime = event.m_time;
+    s_events.popFront();
+    return Pipeline::RESULT_DONE;
+  }
 
-            s_currentPressCount[event.m_pos.m_line][event.m_pos.m_column]--;
-            sendCurrentKeyPress();
-          }
+  /// Select the layer of the layer keys tapped by a streak that are still held, at the press of the key at 'pos'.
+  static inline void selectHeldLayers(const Pos& pos) {
+    for (int8_t line = 0; line < NUM_LINES; ++line) {
+      for (int8_t column = 0; column < NUM_COLUMNS; ++column) {
+        unsigned long& pressTime = s_streakPressTime[line][column];
+        if (pressTime == 0 || Pos{ line, column } == pos || Keymap::tables().m_layerKeys[line][column] == LAYER_NONE) continue;
 
-          // Remove the two events from the queue and go to the next event.
-          s_events.popFront();
-          s_events.remove(releaseIndex);
-          continue;
-        } else {
-          // We have not found any other key press and we don't have found the release event, we don't know what to do yet, pull for more events.
-          break;
-        }
-      } else {
-        // Another key was pressed before we released the current one. We don't execute the "on release" behavior, continue execution normally.
+        // Its release now goes through the other stages, which release the layer.
+        ON_DEBUG_LOG(debugPrintln("Select the layer of a key tapped by a typing streak"));
+        Perf::count(Perf::COUNTER_STREAK_MISFIRES);
+        pressTime = 0;
+        updateLayers(Pos{ line, column }, true);
       }
     }
+  }
+};
+
+/// Process the "on release" key presses.
+/// "on release" key presses are key that trigger an output if they when they are relased if:
+///   - They were released within MAX_HOLD_TIME of being pressed
+///   - No other key was pressed in between, but other key release are acceptable.
+/// Typically this is for keys that are associated with layer changes, but output a character when being tapped.
+struct OnReleaseStage {
+  static inline Pipeline::Result process(const Event& event, Pipeline::Context& context) {
+    if (!Keymap::tables().m_onRelease[event.m_pos.m_line][event.m_pos.m_column] || !event.m_isPressed) return Pipeline::RESULT_NEXT;
 
+    // We have a key press for a "on release" key.
+    unsigned long current = context.m_current;
+
+    // Look up if we can find the event for releasing the current key.
+    bool foundRelease = false;
+    EventQueue::Iterator releaseIndex;
+    // And look if we pressed another key.
+    bool foundAnotherPress = false;
+    for (EventQueue::Iterator it = s_events.next(s_events.begin()); it != s_events.end(); ++it) {
+      if (s_events[it].m_pos == event.m_pos && !s_events[it].m_isPressed) {
+        foundRelease = true;
+        releaseIndex = it;
+        break;
+      }
+
+      if (s_events[it].m_pos != event.m_pos && s_events[it].m_isPressed) {
+        foundAnotherPress = true;
+        break;
+      }
+    }
+
+    if (foundAnotherPress) {
+      // Another key was pressed before we released the current one. We don't execute the "on release" behavior, continue execution normally.
+      Recorder::record(Recorder::ENTRY_HOLD, event.m_pos, 0xFFFF, current);
+      return Pipeline::RESULT_NEXT;
+    }
+
+    // We have not found any other key press and we don't have found the release event, we don't know what to do yet, pull for more events.
+    if (!foundRelease) return Pipeline::RESULT_WAIT;
+
+    // We found the release event, and there was no press in between. If the two events are within the MAX_HOLD_TIME, we execute the "on release" behavior
+    Debounce::recordEdge(event.m_pos, event.m_time);
+    Debounce::recordEdge(event.m_pos, s_events[releaseIndex].m_time);
+    Telemetry::recordPress(event.m_pos, event.m_time);
+    Telemetry::recordRelease(event.m_pos, s_events[releaseIndex].m_time);
+    Heatmap::recordPress(s_layerTracker.mask(), event.m_pos, event.m_time);
+    unsigned long hold = s_events[releaseIndex].m_time - event.m_time;
+    bool isTap = hold < Settings::get(Settings::SETTING_MAX_HOLD_TIME);
+    Recorder::record(isTap ? Recorder::ENTRY_TAP : Recorder::ENTRY_HOLD, event.m_pos, hold / 1000 > 0xFFFE ? 0xFFFE : hold / 1000, s_events[releaseIndex].m_time);
+    if (isTap) {
+      ON_DEBUG_LOG(debugPrintln("Press and release key"));
+
+      // The key is released by a later iteration once KEY_PRESS_LENGTH has elapsed, so that we don't stop scanning while it is held.
+      s_currentPressCount[event.m_pos.m_line][event.m_pos.m_column]++;
+      s_tapPos = event.m_pos;
+      s_tapTime = current;
+      sendCurrentKeyPress(current);
+      recordLatency(s_events[releaseIndex].m_time, current);
+      Perf::record(Perf::HISTOGRAM_TAP_LATENCY, current - event.m_time);
+      context.m_reportBudget--;
+    }
+
+    // Remove the two events from the queue and go to the next event.
+    s_events.popFront();
+    s_events.remove(releaseIndex);
+    return Pipeline::RESULT_DONE;
+  }
+};
+
+/// Update the press count of the key of the event.
+struct PressCountStage {
+  static inline Pipeline::Result process(const Event& event, Pipeline::Context&) {
 #if DEBUG_LOG
     debugPrint("processing event ");
     debugPrint(s_events.begin().m_index);
@@ -272,42 +528,46 @@ void loop() {
     debugPrintln();
 #endif
 
-    // Update the press count for that key.
+    Debounce::recordEdge(event.m_pos, event.m_time);
+
     uint8_t& pressCount = s_currentPressCount[event.m_pos.m_line][event.m_pos.m_column];
     if (event.m_isPressed) {
       pressCount++;
+      Telemetry::recordPress(event.m_pos, event.m_time);
+      Heatmap::recordPress(s_layerTracker.mask(), event.m_pos, event.m_time);
     } else {
       if (pressCount > 0) pressCount--;
+      Telemetry::recordRelease(event.m_pos, event.m_time);
     }
+    return Pipeline::RESULT_NEXT;
+  }
+};
 
-    // If this key has a "forced key" associated wit it, we grab it.
-    {
-      K(*currentLayer)
-      [12] = s_keyMaps[s_layerTracker.mask()];
-      Key forced = currentLayer[event.m_pos.m_line][event.m_pos.m_column].m_forcedKey;
-      if (forced != Key::NONE) {
-        s_forcedKey = forced;
-      }
+/// If the key of the event has a "forced key" associated wit it, we grab it.
+struct ForcedKeyStage {
+  static inline Pipeline::Result process(const Event& event, Pipeline::Context&) {
+    const K(*currentLayer)
+    [NUM_COLUMNS] = Keymap::tables().m_layers[s_layerTracker.mask()];
+    Key forced = currentLayer[event.m_pos.m_line][event.m_pos.m_column].m_forcedKey;
+    if (forced != Key::NONE) {
+      s_forcedKey = forced;
     }
+    return Pipeline::RESULT_NEXT;
+  }
+};
 
-    // Update the the layer (if any change).
-    LayerBit layer = s_layerKeys[event.m_pos.m_line][event.m_pos.m_column];
-    if (layer != LAYER_NONE) {
-      s_layerTracker.delta(layer, event.m_isPressed ? +1 : -1);
-
-      // Reset button presses when layer change.
-      for (int line = 0; line < NUM_LINES; ++line) {
-        for (int column = 0; column < NUM_COLUMNS; ++column) {
-          if (immuneToReset[line][column]) continue;  // Except key that are immune to reset.
-          s_currentPressCount[line][column] = 0;
-        }
-      }
-
-      // Reset the forced key.
-      s_forcedKey = Key::NONE;
-    }
+/// Update the the layer (if any change).
+struct LayerStage {
+  static inline Pipeline::Result process(const Event& event, Pipeline::Context&) {
+    updateLayers(event.m_pos, event.m_isPressed);
+    return Pipeline::RESULT_NEXT;
+  }
+};
 
-#ifdef DEBUG_LOG
+/// Output the current state of key pressed to the USB host.
+struct ReportStage {
+  static inline Pipeline::Result process(const Event& event, Pipeline::Context& context) {
+#if DEBUG_LOG
     debugPrintln("Current press count:");
     for (int line = 0; line < NUM_LINES; ++line) {
       debugPrint("\t");
@@ -319,16 +579,430 @@ void loop() {
     }
 #endif
 
-    // Output the current state of key pressed to the USB host.
-    debugPrintln("Send event:");
-    sendCurrentKeyPress();
+    ON_DEBUG_LOG(debugPrintln("Send event:"));
+    sendCurrentKeyPress(context.m_current);
+    recordLatency(event.m_time, context.m_current);
+    context.m_reportBudget--;
+    return Pipeline::RESULT_NEXT;
+  }
+};
 
+/// The stages processing each event, in order. The optional ones are selected in config.h.
+typedef Pipeline::Chain<
+  Pipeline::StageIf<OVERLAP_REMOVAL, OverlapRemovalStage>,
+  DebounceStage,
+  Pipeline::StageIf<ON_RELEASE_KEYS, TypingStreakStage>,
+  Pipeline::StageIf<ON_RELEASE_KEYS, OnReleaseStage>,
+  PressCountStage,
+  Pipeline::StageIf<FORCED_KEYS, ForcedKeyStage>,
+  LayerStage,
+  ReportStage>
+  EventPipeline;
 
-    s_events.popFront();
+/// Process the events in the queue that can be processed at time 'current', within the budget of one iteration of the main loop.
+void processEvents(unsigned long current) {
+  int eventBudget = MAX_EVENTS_PER_LOOP;
+  Pipeline::Context context = { current, MAX_REPORTS_PER_LOOP };
+
+  // Release the simulated tap once it has been held long enough.
+  if (s_tapPos.m_line >= 0 && current - s_tapTime >= Settings::get(Settings::SETTING_KEY_PRESS_LENGTH) * 1000UL) {
+    s_currentPressCount[s_tapPos.m_line][s_tapPos.m_column]--;
+    s_tapPos = Pos{ -1, -1 };
+    sendCurrentKeyPress(current);
+    context.m_reportBudget--;
+  }
+
+  while (!s_events.isEmpty() && s_tapPos.m_line < 0) {
+    if (eventBudget == 0 || context.m_reportBudget == 0) {
+      // Leave the remaining events for the next iteration.
+      Perf::count(Perf::COUNTER_BUDGET_EXHAUSTED);
+      break;
+    }
+
+    Pipeline::Result result = EventPipeline::process(s_events.peek(), context);
+    if (result == Pipeline::RESULT_WAIT) break;
+
+    // The event went through every stage.
+    if (result == Pipeline::RESULT_NEXT) s_events.popFront();
+    eventBudget--;
+    Perf::count(Perf::COUNTER_EVENTS_PROCESSED);
+  }
+}
+
+
+#if REPLAY_LOG
+/// Start measuring a new set of replays.
+void replayBegin() {
+  Perf::reset();
+  s_replayLatencyTotal = 0;
+  s_replayReportTime = 0;
+  s_replayCpuTime = 0;
+  s_replayEdges = 0;
+  s_replayDigest = 0;
+  memset(s_replayState, 0, sizeof(s_replayState));
+  s_replayNextTyped = 0;
+  s_replayTyped = 0;
+  s_replayMissing = 0;
+  s_replayExtra = 0;
+}
+
+/// Replay 'trace' 'repeat' times through processEvents() under a virtual clock.
+void replay(const Trace& trace, int repeat) {
+  // Start from an idle keyboard that has not learned anything, so that the results do not depend on the history of this keyboard.
+  while (!s_events.isEmpty()) s_events.popFront();
+  for (int line = 0; line < NUM_LINES; ++line) {
+    for (int column = 0; column < NUM_COLUMNS; ++column) {
+      s_currentPressCount[line][column] = 0;
+      s_streakPressTime[line][column] = 0;
+    }
+  }
+  s_lastTypedTime = 0;
+  s_layerTracker = LayerTracker();
+  s_forcedKey = Key::NONE;
+  s_tapPos = Pos{ -1, -1 };
+  Debounce::reset();
+  s_replaying = true;
+
+  // Each repetition starts one second after the last edge of the previous one.
+  unsigned long period = trace.m_edges[trace.m_numEdges - 1].m_time + 1000000;
+  unsigned long lastTime = (repeat - 1) * period + trace.m_edges[trace.m_numEdges - 1].m_time;
+  uint32_t numEdges = uint32_t(trace.m_numEdges) * repeat;
+  uint32_t next = 0;
+
+  // The virtual clock stops after the last edge once everything has been processed, or after a second if the trace leaves a key held.
+  unsigned long now = 0;
+  for (; next < numEdges || ((!s_events.isEmpty() || s_tapPos.m_line >= 0) && now - lastTime < 1000000); now += REPLAY_SCAN_PERIOD) {
+    // Add the edges that happened since the previous scan, with their exact time.
+    while (next < numEdges) {
+      const TraceEdge& edge = trace.m_edges[next % trace.m_numEdges];
+      unsigned long time = (next / trace.m_numEdges) * period + edge.m_time;
+      if (time > now) break;
+
+      // Like the live keyboard, edges are lost while the queue is full.
+      ++next;
+      if (s_events.isFull()) {
+        Perf::count(Perf::COUNTER_EVENTS_DROPPED);
+        continue;
+      }
+
+      Event& event = s_events.emplaceBack();
+      event.m_pos = edge.m_pos;
+      event.m_isPressed = edge.m_isPressed;
+      event.m_time = time;
+    }
+
+    unsigned long start = micros();
+    processEvents(now);
+    s_replayCpuTime += micros() - start;
+    Perf::record(Perf::HISTOGRAM_QUEUE_DEPTH, s_events.size());
+  }
+
+  s_replaying = false;
+  s_replayEdges += numEdges;
+}
+
+/// Write in the debug output the results of the replays since replayBegin(), and whether their digest is 'expectedDigest'.
+void replayEnd(const char* name, uint32_t expectedDigest) {
+  uint32_t events = Perf::counter(Perf::COUNTER_EVENTS_PROCESSED);
+  uint32_t reports = Perf::counter(Perf::COUNTER_REPORTS_SENT);
+  uint32_t latencies = 0;
+  for (int i = 0; i < PERF_HISTOGRAM_BUCKETS; ++i) latencies += Perf::bucket(Perf::HISTOGRAM_KEY_LATENCY, i);
+
+  debugPrint("replay ");
+  debugPrint(name);
+  debugPrint(": edges=");
+  debugPrint(s_replayEdges);
+  debugPrint(" events=");
+  debugPrint(events);
+  debugPrint(" reports=");
+  debugPrint(reports);
+  debugPrint(" cpu=");
+  debugPrint(s_replayCpuTime);
+  debugPrint("us report_cpu=");
+  debugPrint(s_replayReportTime);
+  debugPrint("us ns_per_event=");
+  debugPrint(events > 0 ? (unsigned long)(s_replayCpuTime * 1000ULL / events) : 0);
+  debugPrint(" events_per_s=");
+  debugPrint(s_replayCpuTime > 0 ? (unsigned long)(events * 1000000ULL / s_replayCpuTime) : 0);
+  debugPrint(" latency_avg=");
+  debugPrint(latencies > 0 ? (unsigned long)(s_replayLatencyTotal / latencies) : 0);
+  debugPrint("us latency_max=");
+  debugPrint(Perf::maximum(Perf::HISTOGRAM_KEY_LATENCY));
+  debugPrint("us digest=");
+  Serial.print(s_replayDigest, HEX);
+
+  // The reference digests are those of the compiled-in keymap with the default settings.
+  if (Keymap::sequence() != 0) {
+    debugPrintln(" (not checked, a keymap image is active)");
+  } else if (s_replayDigest == expectedDigest) {
+    debugPrintln(" ok");
+  } else {
+    debugPrint(" DIFFERS from ");
+    Serial.println(expectedDigest, HEX);
+  }
+}
+
+/// Replay the corpus trace 'corpus' once, and write in the debug output whether it typed its text.
+void replayCorpus(const CorpusTrace& corpus) {
+  replayBegin();
+  s_replayCorpus = &corpus;
+  replay(corpus.m_trace, 1);
+  s_replayCorpus = nullptr;
+  s_replayMissing += corpus.m_numTyped - s_replayNextTyped;
+
+  uint32_t latencies = 0;
+  for (int i = 0; i < PERF_HISTOGRAM_BUCKETS; ++i) latencies += Perf::bucket(Perf::HISTOGRAM_KEY_LATENCY, i);
+
+  debugPrint("corpus ");
+  debugPrint(corpus.m_trace.m_name);
+  debugPrint(": wpm=");
+  debugPrint(corpus.m_wpm);
+  debugPrint(" chars=");
+  debugPrint(corpus.m_numTyped);
+  debugPrint(" typed=");
+  debugPrint(s_replayTyped);
+  debugPrint(" missing=");
+  debugPrint(s_replayMissing);
+  debugPrint(" extra=");
+  debugPrint(s_replayExtra);
+  debugPrint(" dropped=");
+  debugPrint(Perf::counter(Perf::COUNTER_EVENTS_DROPPED));
+  debugPrint(" queue_max=");
+  debugPrint(Perf::maximum(Perf::HISTOGRAM_QUEUE_DEPTH));
+  debugPrint(" latency_avg=");
+  debugPrint(latencies > 0 ? (unsigned long)(s_replayLatencyTotal / latencies) : 0);
+  debugPrint("us latency_max=");
+  debugPrint(Perf::maximum(Perf::HISTOGRAM_KEY_LATENCY));
+  debugPrintln(s_replayMissing == 0 && s_replayExtra == 0 ? "us ok" : "us DEGRADED");
+}
+
+/// Replay all the reference traces and the random traces, then restore the state that they modified.
+void replayAll() {
+  // The reference digests are for the default settings, not the ones saved on this keyboard.
+  Settings::reset();
+
+  for (int id = 0; id < Replay::NUM_TRACES; ++id) {
+    const Trace& trace = Replay::trace(Replay::TraceId(id));
+    replayBegin();
+    replay(trace, REPLAY_REPEAT);
+    replayEnd(trace.m_name, Replay::referenceDigest(Replay::TraceId(id)));
+  }
+
+  static TraceEdge edges[REPLAY_FUZZ_EDGES];
+  replayBegin();
+  for (uint32_t seed = 1; seed <= REPLAY_FUZZ_TRACES; ++seed) {
+    uint16_t numEdges = Replay::generate(seed, edges, REPLAY_FUZZ_EDGES);
+    replay(Trace{ "fuzz", edges, numEdges }, 1);
+  }
+  replayEnd("fuzz", Replay::fuzzDigest());
+
+  // The corpus traces are typed with the compiled-in keymap.
+  if (Keymap::sequence() == 0) {
+    for (int index = 0; index < Replay::numCorpusTraces(); ++index) replayCorpus(Replay::corpusTrace(index));
+  }
+
+  // The traces went through the debouncing, the telemetry, the heatmap and the recorder like real key presses, forget what they learned.
+  Debounce::init();
+  Telemetry::init();
+  Heatmap::init();
+  Recorder::reset();
+  Settings::init();
+  Perf::reset();
+}
+#endif
+
+#if BENCH_LOG
+/// Run every benchmark, see Bench.
+void benchAll() {
+  Bench::runPrimitives();
+
+  // A layer key pressed and released.
+  {
+    LayerTracker tracker;
+    // Read the mask after each change, so that the changes are not optimized out.
+    volatile uint8_t mask;
+    unsigned long start = micros();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS / 2; ++i) {
+      tracker.delta(LAYER_FUNCTION, +1);
+      mask = tracker.mask();
+      tracker.delta(LAYER_FUNCTION, -1);
+      mask = tracker.mask();
+    }
+    (void)mask;
+    Bench::report("layer_tracker_delta", BENCH_ITERATIONS / 2 * 2, micros() - start);
+  }
+
+  // Keyboard states built with 0 to 10 keys held.
+  s_benchmarking = true;
+  for (int held = 0; held <= 10; ++held) {
+    for (int key = 0; key < NUM_LINES * NUM_COLUMNS; ++key) {
+      s_currentPressCount[key / NUM_COLUMNS][key % NUM_COLUMNS] = key < held ? 1 : 0;
+    }
+
+    unsigned long start = micros();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i) {
+      sendCurrentKeyPress(0);
+    }
+    unsigned long elapsed = micros() - start;
+
+    char name[32];
+    snprintf(name, sizeof(name), "send_current_key_press_%d", held);
+    Bench::report(name, BENCH_ITERATIONS, elapsed);
+  }
+  s_benchmarking = false;
+
+  // Leave the keyboard released, as after setup().
+  for (int key = 0; key < NUM_LINES * NUM_COLUMNS; ++key) {
+    s_currentPressCount[key / NUM_COLUMNS][key % NUM_COLUMNS] = 0;
+  }
+  KeyboardOutput::releaseAll();
+  Perf::reset();
+}
+#endif
+
+void setup() {
+#if ANY_LOG
+  Serial.begin(9600);
+#endif
+
+  Storage::init();
+  Settings::init();
+  Recorder::init();
+  Keymap::init();
+  Debounce::init();
+  Telemetry::init();
+  Heatmap::init();
+  Input::init();
+
+  for (int line = 0; line < NUM_LINES; ++line) {
+    for (int column = 0; column < NUM_COLUMNS; ++column) {
+      s_currentPressCount[line][column] = 0;
+      s_queuedState[line][column] = false;
+    }
+  }
+  s_hasDroppedEdges = false;
+
+#if REPLAY_LOG
+  replayAll();
+#endif
+#if BENCH_LOG
+  benchAll();
+#endif
+
+#if SOF_SYNC
+  FrameSync::init();
+#endif
+
+  // Started last, the replays and the benchmarks take much longer than an iteration of the main loop.
+  Deadline::init();
+}
+
+#if PERF_LOG
+unsigned long perf_min = -1;
+unsigned long perf_max = 0;
+unsigned long perf_total = 0;
+int perf_count = 0;
+static const int perf_countTotal = 1000;
+#endif
+
+void loop() {
+#if SPLIT_ROLE == SPLIT_SECONDARY
+  // This half only scans its switches, Input::step() sends their state to the primary half.
+  Deadline::lap(Deadline::STAGE_SCAN, micros());
+  Input::step();
+  if (Deadline::hasStalled(Deadline::STAGE_SCAN)) Input::reset();
+  Deadline::end(micros());
+  return;
+#endif
+
+  // While the USB host is suspended, this sleeps until the next scan.
+  Power::step();
+
+#if SOF_SYNC
+  // If the scan after this one would miss the next poll of the USB host, this one is delayed to end just before it.
+  unsigned long scanStart = FrameSync::align(micros());
+#endif
+
+#if PERF_LOG
+  unsigned long perf_start = micros();
+#endif
+
+  Deadline::lap(Deadline::STAGE_USB, micros());
+
+  // Push any report that the USB endpoint could not take yet.
+  KeyboardOutput::step();
+
+  // We refresh the input. If the scan got stuck, e.g. on an I2C transaction, only the input hardware is reset.
+  Deadline::enter(Deadline::STAGE_SCAN);
+  Input::step();
+  if (Deadline::hasStalled(Deadline::STAGE_SCAN)) Input::reset();
+  Deadline::enter(Deadline::STAGE_EVENTS);
+
+  // We add an event in the event queue for each key that have changed state. An edge that did not fit in the queue is not lost: Input already moved to the new state, so
+  // the difference between that state and the one last queued is added once there is room again.
+  ON_DEBUG(bool anyNewEvent = false);
+  bool hasDroppedEdges = false;
+  for (int line = 0; line < NUM_LINES; ++line) {
+    for (int column = 0; column < NUM_COLUMNS; ++column) {
+      if (!Input::hasChanged(line, column) && !s_hasDroppedEdges) continue;
+
+      // A switch that went back to the state last queued, e.g. a bounce while the queue was full, has nothing to add.
+      bool isPressed = Input::isPressed(line, column);
+      if (isPressed == s_queuedState[line][column]) continue;
+
+      if (s_events.isFull()) {
+        // Only the new edges are counted, not the ones still waiting for room.
+        if (Input::hasChanged(line, column)) {
+          Perf::count(Perf::COUNTER_EVENTS_DROPPED);
+          Recorder::record(Recorder::ENTRY_DROPPED, Pos{ line, column }, isPressed, micros());
+        }
+        hasDroppedEdges = true;
+        continue;
+      }
+
+      Event& event = s_events.emplaceBack();
+      event.m_pos = Pos{ line, column };
+      event.m_isPressed = isPressed;
+      event.m_time = micros();
+      s_queuedState[line][column] = isPressed;
+      Recorder::record(Recorder::ENTRY_EDGE, event.m_pos, event.m_isPressed, event.m_time);
+      if (event.m_isPressed) Power::keyPressed();
+
+      ON_DEBUG(anyNewEvent = true);
+    }
   }
+  s_hasDroppedEdges = hasDroppedEdges;
+
+#if DEBUG_LOG
+  if (anyNewEvent) {
+    debugPrintln("new events added to queue:");
+    s_events.print("\t");
+  }
+#endif
+
+  // Now we are going to process the every event in the queue that we can, within the budget of this iteration.
+  unsigned long current = micros();
+  processEvents(current);
+  ON_SOF_SYNC(FrameSync::scanned(scanStart, micros()));
+
+  // Flash writes and the control channel can take time, only do them when there is nothing to process.
+  if (s_events.isEmpty() && s_tapPos.m_line < 0) {
+    Deadline::lap(Deadline::STAGE_MAINTENANCE, micros());
+    Debounce::step(current);
+    Heatmap::step(current);
+    Control::step();
+
+    // A new keymap only takes effect while no layer is active, otherwise the layer keys currently held would not be released from the right layer.
+    if (s_layerTracker.mask() == 0) Keymap::swap();
+  }
+
+  Perf::count(Perf::COUNTER_LOOPS);
+  Perf::record(Perf::HISTOGRAM_QUEUE_DEPTH, s_events.size());
+  Deadline::end(micros());
 
 #if PERF_LOG
   unsigned long total = micros() - perf_start;
+  Perf::record(Perf::HISTOGRAM_LOOP_TIME, total);
 
   perf_min = min(perf_min, total);
   perf_max = max(perf_max, total);
@@ -343,6 +1017,7 @@ void loop() {
     Serial.print("us avg=");
     Serial.print(avg);
     Serial.println("us");
+    Perf::print();
 
     perf_min = -1;
     perf_max = 0;
@@ -0,0 +1,121 @@
+#include "bench.h"
+#if BENCH_LOG
+#include "event.h"
+#include "input.h"
+#include "keyboard.h"
+#include "recorder.h"
+
+/// Namespace containing all the implementation details of the benchmarks.
+namespace BenchImpl {
+
+/// The queue used by the benchmarks, separate from the one of the main sketch.
+EventQueue s_queue;
+
+/// Written with the results of the work done by the benchmarks, so that the work is not optimized out.
+volatile uint32_t s_sink = 0;
+
+/// Number of events in the queue for the benchmark of removals.
+static const int QUEUE_DEPTH = 16;
+
+/// Events pushed and popped right away, the common case while typing.
+void benchQueueFifo() {
+  unsigned long start = micros();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i) {
+    Event& event = s_queue.emplaceBack();
+    event.m_pos = Pos{ 0, 0 };
+    event.m_isPressed = true;
+    event.m_time = i;
+    s_queue.popFront();
+  }
+  Bench::report("event_queue_fifo", BENCH_ITERATIONS, micros() - start);
+}
+
+/// Every other event removed out of order, then the queue walked and drained through the removed events, like the "on release" keys do.
+void benchQueueTombstones() {
+  uint32_t operations = 0;
+  uint32_t visited = 0;
+  unsigned long start = micros();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS / QUEUE_DEPTH; ++i) {
+    for (int j = 0; j < QUEUE_DEPTH; ++j) {
+      Event& event = s_queue.emplaceBack();
+      event.m_pos = Pos{ 0, int8_t(j % NUM_COLUMNS) };
+      event.m_isPressed = j % 2 == 0;
+      event.m_time = j;
+    }
+    // next() skips the removed event, so the live event after it is stepped over before the next removal.
+    EventQueue::Iterator it = s_queue.next(s_queue.begin());
+    while (it != s_queue.end()) {
+      s_queue.remove(it);
+      it = s_queue.next(it);
+      if (it != s_queue.end()) it = s_queue.next(it);
+    }
+    for (EventQueue::Iterator it = s_queue.begin(); it != s_queue.end(); it = s_queue.next(it)) {
+      visited += s_queue[it].m_isPressed;
+    }
+    while (!s_queue.isEmpty()) s_queue.remove(s_queue.begin());
+    operations += QUEUE_DEPTH;
+  }
+  Bench::report("event_queue_tombstones", operations, micros() - start);
+  s_sink = visited;
+}
+
+/// A full keyboard state built from scratch, as sendCurrentKeyPress() does.
+void benchKeyboardAdd() {
+  static const Key keys[] = { Key::SHIFT, Key::CTRL, Key::A, Key::B, Key::C, Key::D, Key::E, Key::F };
+  static const int numKeys = sizeof(keys) / sizeof(keys[0]);
+
+  unsigned long start = micros();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS / numKeys; ++i) {
+    KeyboardOutput::releaseAll();
+    for (int j = 0; j < numKeys; ++j) KeyboardOutput::add(keys[j]);
+  }
+  Bench::report("keyboard_add", BENCH_ITERATIONS / numKeys * numKeys, micros() - start);
+  KeyboardOutput::releaseAll();
+}
+
+/// Four switches changing state on every scan, the update of the switch states from the inputs read by Input::step().
+void benchInputUpdate() {
+  static const InputFrame changing = 0x0F0F;
+
+  unsigned long start = micros();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i) {
+    Input::update(i % 2 == 0 ? changing : 0);
+  }
+  Bench::report("input_update", BENCH_ITERATIONS, micros() - start);
+
+  // Release everything, then forget that it changed.
+  Input::update(0);
+  Input::update(0);
+}
+
+/// Entries added to the post-mortem trace, which is always on and must stay well under a micro-second per entry.
+void benchRecorder() {
+  unsigned long start = micros();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; ++i) {
+    Recorder::record(Recorder::ENTRY_EDGE, uint8_t(i % (NUM_LINES * NUM_COLUMNS)), i & 1, i);
+  }
+  Bench::report("recorder_record", BENCH_ITERATIONS, micros() - start);
+
+  Recorder::reset();
+}
+}
+
+void Bench::report(const char* name, uint32_t iterations, unsigned long elapsed) {
+  Serial.print("bench ");
+  Serial.print(name);
+  Serial.print(": iterations=");
+  Serial.print(iterations);
+  Serial.print(" ns_per_op=");
+  Serial.println(iterations == 0 ? 0 : uint32_t(uint64_t(elapsed) * 1000 / iterations));
+}
+
+void Bench::runPrimitives() {
+  using namespace BenchImpl;
+
+  benchQueueFifo();
+  benchQueueTombstones();
+  benchKeyboardAdd();
+  benchInputUpdate();
+  benchRecorder();
+}
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+#include "config.h"
+#include <stdint.h>
+
+/// Micro-benchmarks of the hot primitives, run at startup when BENCH_LOG is enabled.
+///
+/// Each benchmark writes a line "bench <name>: iterations=<n> ns_per_op=<time>" in the debug output. tools/bench_compare.cpp compares these lines with the baselines recorded from a previous run, so that a primitive that got slower is caught before it ships.
+/// The benchmarks of the event processing itself, which lives in the main sketch, are run by benchAll().
+/// On Linux, tools/bench_host.cpp runs them all through the host build of the sketch, whose baselines are committed.
+namespace Bench {
+
+/// Write the result of the benchmark 'name', that ran 'iterations' operations in 'elapsed' micro-seconds.
+void report(const char* name, uint32_t iterations, unsigned long elapsed);
+
+/// Run the benchmarks of the event queue, KeyboardOutput::add(), Input::update() and Recorder::record(). The keyboard output and the switch states are left released, and the live trace of the recorder is restarted.
+void runPrimitives();
+}
@@ -0,0 +1,184 @@
+#pragma once
+#include "config.h"
+#include "pos.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+
+// Wiring of the boards built with MCP I/O expanders, shared by the MCP23008 and MCP23017 input backends.
+// It is counted in ports of 8 pins: an MCP23008 has one port, an MCP23017 has two, where port A is the first one.
+
+/// Description of a board with 'NumPorts' ports of MCP I/O expanders.
+///
+/// Everything that differs between the versions of the board is here, the input backends only read s_board. The descriptions are checked by the static_asserts below when the firmware is built.
+template <int NumPorts>
+struct McpBoard {
+  static const int NUM_PORTS = NumPorts;
+
+  /// Hardware address of the MCP23008 of each port.
+  uint8_t m_mcp23008Addresses[NumPorts];
+
+  /// Hardware address of the MCP23017 of each pair of ports.
+  uint8_t m_mcp23017Addresses[NumPorts / 2];
+
+  /// Highest frequency of the I2C bus that the wiring was designed for, in Hz. The bus starts there and slows down on errors, see I2cClock.
+  uint32_t m_i2cFrequency;
+
+  /// Indicate which key coordinates each pin of each port is responsible for. m_portToPos[i][j] is the key location for the j-th pin of the i-th port, {-1, -1} if there is no switch.
+  Pos m_portToPos[NumPorts][8];
+};
+
+static constexpr McpBoard<8> s_boardVersion1 = {
+  { 0, 1, 2, 3, 4, 5, 6, 7 },
+  { 0, 1, 2, 3 },
+  400000,
+  {
+    { Pos{ 0, 6 }, Pos{ 1, 6 }, Pos{ 2, 6 }, Pos{ 3, 6 }, Pos{ 4, 6 }, Pos{ 4, 7 }, Pos{ 3, 7 }, Pos{ 2, 7 } },
+    { Pos{ 0, 7 }, Pos{ 1, 7 }, Pos{ 4, 8 }, Pos{ 3, 8 }, Pos{ 2, 8 }, Pos{ 1, 8 }, Pos{ 0, 8 }, Pos{ 4, 9 } },
+    { Pos{ 3, 9 }, Pos{ 2, 9 }, Pos{ 1, 9 }, Pos{ 4, 10 }, Pos{ 3, 10 }, Pos{ 0, 9 }, Pos{ 2, 10 }, Pos{ 1, 10 } },
+    { Pos{ 4, 11 }, Pos{ 3, 11 }, Pos{ 2, 11 }, Pos{ 0, 10 }, Pos{ 1, 11 }, Pos{ 0, 11 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
+    { Pos{ 0, 0 }, Pos{ 1, 0 }, Pos{ 2, 0 }, Pos{ 3, 0 }, Pos{ 4, 0 }, Pos{ 4, 1 }, Pos{ 3, 1 }, Pos{ 2, 1 } },
+    { Pos{ 0, 1 }, Pos{ 1, 1 }, Pos{ 4, 2 }, Pos{ 3, 2 }, Pos{ 2, 2 }, Pos{ 1, 2 }, Pos{ 0, 2 }, Pos{ 4, 3 } },
+    { Pos{ 3, 3 }, Pos{ 2, 3 }, Pos{ 1, 3 }, Pos{ 4, 4 }, Pos{ 3, 4 }, Pos{ 0, 3 }, Pos{ 2, 4 }, Pos{ 1, 4 } },
+    { Pos{ 4, 5 }, Pos{ 3, 5 }, Pos{ 2, 5 }, Pos{ 0, 4 }, Pos{ 1, 5 }, Pos{ 0, 5 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
+  },
+};
+
+static constexpr McpBoard<6> s_boardVersion2 = {
+  { 0, 1, 2, 4, 5, 6 },
+  { 0, 1, 2 },
+  1000000,
+  {
+    { Pos{ 4, 8 }, Pos{ 4, 7 }, Pos{ 4, 6 }, Pos{ 3, 7 }, Pos{ 3, 6 }, Pos{ 2, 6 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
+    { Pos{ 2, 7 }, Pos{ 3, 8 }, Pos{ 2, 8 }, Pos{ 1, 8 }, Pos{ 1, 7 }, Pos{ 1, 6 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
+    { Pos{ 3, 9 }, Pos{ 3, 10 }, Pos{ 2, 10 }, Pos{ 1, 10 }, Pos{ 1, 9 }, Pos{ 2, 9 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
+
+    { Pos{ 4, 3 }, Pos{ 4, 4 }, Pos{ 4, 5 }, Pos{ 3, 4 }, Pos{ 3, 5 }, Pos{ 2, 5 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
+    { Pos{ 2, 4 }, Pos{ 3, 3 }, Pos{ 2, 3 }, Pos{ 1, 3 }, Pos{ 1, 4 }, Pos{ 1, 5 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
+    { Pos{ 3, 2 }, Pos{ 3, 1 }, Pos{ 2, 1 }, Pos{ 1, 1 }, Pos{ 1, 2 }, Pos{ 2, 2 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
+  },
+};
+
+/// The description of the board for each VERSION.
+template <int Version>
+struct BoardOfVersion;
+
+template <>
+struct BoardOfVersion<1> {
+  typedef McpBoard<8> Board;
+  static constexpr const Board& get() { return s_boardVersion1; }
+};
+
+template <>
+struct BoardOfVersion<2> {
+  typedef McpBoard<6> Board;
+  static constexpr const Board& get() { return s_boardVersion2; }
+};
+
+/// The board this firmware is built for.
+typedef BoardOfVersion<VERSION>::Board Board;
+static constexpr const Board& s_board = BoardOfVersion<VERSION>::get();
+
+#define NUM_MCP_PORTS (Board::NUM_PORTS)
+
+/// Handles of type 'Chip' for the chips at 'N' addresses.
+template <class Chip, int N>
+struct ChipArray {
+  Chip m_chips[N];
+
+  Chip& operator[](int index) { return m_chips[index]; }
+};
+
+/// Make the handles of type 'Chip' for the chips at 'addresses', e.g. from s_board.m_mcp23008Addresses.
+template <class Chip, int N>
+ChipArray<Chip, N> makeChips(const uint8_t (&addresses)[N]);
+
+/// Call 'function' with each index from 'Index' to 'End' - 1 and stop at the first call returning false. Return false if a call did.
+///
+/// The calls are unrolled, so that the scan of each chip is specialized for its index.
+template <int Index, int End>
+struct Unrolled {
+  template <class Function>
+  static inline bool all(Function function) {
+    return function(Index) && Unrolled<Index + 1, End>::all(function);
+  }
+};
+
+template <int End>
+struct Unrolled<End, End> {
+  template <class Function>
+  static inline bool all(Function) {
+    return true;
+  }
+};
+
+/// Namespace containing all the implementation details of the board descriptions.
+namespace BoardImpl {
+
+/// Whether every pin of 'board' has no switch or a switch inside the keymap.
+template <int NumPorts>
+constexpr bool fitsKeymap(const McpBoard<NumPorts>& board) {
+  for (int port = 0; port < NumPorts; ++port) {
+    for (int pin = 0; pin < 8; ++pin) {
+      const Pos& pos = board.m_portToPos[port][pin];
+      bool isNone = pos.m_line == -1 && pos.m_column == -1;
+      bool isInside = pos.m_line >= 0 && pos.m_line < NUM_LINES && pos.m_column >= 0 && pos.m_column < NUM_COLUMNS;
+      if (!isNone && !isInside) return false;
+    }
+  }
+  return true;
+}
+
+/// Whether no two pins of 'board' have the same switch.
+template <int NumPorts>
+constexpr bool hasUniquePositions(const McpBoard<NumPorts>& board) {
+  for (int i = 0; i < NumPorts * 8; ++i) {
+    const Pos& a = board.m_portToPos[i / 8][i % 8];
+    if (a.m_line < 0) continue;
+    for (int j = i + 1; j < NumPorts * 8; ++j) {
+      const Pos& b = board.m_portToPos[j / 8][j % 8];
+      if (a.m_line == b.m_line && a.m_column == b.m_column) return false;
+    }
+  }
+  return true;
+}
+
+/// Whether the 'count' addresses in 'addresses' are distinct and can be set with the 3 address pins of an MCP.
+constexpr bool hasValidAddresses(const uint8_t* addresses, int count) {
+  for (int i = 0; i < count; ++i) {
+    if (addresses[i] > 7) return false;
+    for (int j = i + 1; j < count; ++j) {
+      if (addresses[i] == addresses[j]) return false;
+    }
+  }
+  return true;
+}
+
+/// Whether 'frequency' is between the standard mode and the Fast-mode Plus of I2C, the highest the RP2040 supports.
+constexpr bool hasValidFrequency(uint32_t frequency) {
+  return frequency >= 100000 && frequency <= 1000000;
+}
+
+/// Whether 'board' passes every check above.
+template <int NumPorts>
+constexpr bool isValid(const McpBoard<NumPorts>& board) {
+  return fitsKeymap(board) && hasUniquePositions(board) && hasValidAddresses(board.m_mcp23008Addresses, NumPorts)
+         && hasValidAddresses(board.m_mcp23017Addresses, NumPorts / 2) && hasValidFrequency(board.m_i2cFrequency);
+}
+
+/// See makeChips().
+template <class Chip, int N, size_t... I>
+ChipArray<Chip, N> makeChips(const uint8_t (&addresses)[N], std::index_sequence<I...>) {
+  return ChipArray<Chip, N>{ { Chip(addresses[I])... } };
+}
+}
+
+static_assert(BoardImpl::isValid(s_boardVersion1), "the description of the board version 1 is invalid");
+static_assert(BoardImpl::isValid(s_boardVersion2), "the description of the board version 2 is invalid");
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+template <class Chip, int N>
+ChipArray<Chip, N> makeChips(const uint8_t (&addresses)[N]) {
+  return BoardImpl::makeChips<Chip>(addresses, std::make_index_sequence<N>());
+}
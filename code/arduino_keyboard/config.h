@@ -8,29 +8,188 @@
 #define I2C_RESET_LOG 0
 // If enabled, the program will write in the debug output data about performance.
 #define PERF_LOG 0
+// If enabled, the program will replay the reference traces of replay.h at startup and write the benchmark results in the debug output.
+#define REPLAY_LOG 0
+// If enabled, the program will time the hot primitives at startup and write the results in the debug output, see bench.h.
+// It can be set on the command line, as the host build of the benchmarks does, see tools/bench_host.cpp.
+#ifndef BENCH_LOG
+#define BENCH_LOG 0
+#endif
 
-#define ANY_LOG DEBUG_LOG || I2C_RESET_LOG || PERF_LOG
+#define ANY_LOG DEBUG_LOG || I2C_RESET_LOG || PERF_LOG || REPLAY_LOG || BENCH_LOG
 
 
-// Version of the board, define what MCPs are available.
+// Version of the board, define what MCPs are available, see board.h.
 #define VERSION 2
 
+// Hardware used to read the switches, see inputBackend.h:
+//   INPUT_BACKEND_MCP23008: MCP23008 I/O expanders on the I2C bus, as described in board.h.
+//   INPUT_BACKEND_MCP23017: MCP23017 I/O expanders on the I2C bus, each one replacing two MCP23008 of board.h and read in a single transaction.
+//     On a split keyboard each half must have whole chips, that is a multiple of 4 ports in board.h: VERSION 1 can be split with it, but not VERSION 2 whose 3 chips would put one across the halves.
+//   INPUT_BACKEND_MATRIX: a matrix of switches wired directly to the micro-controller, with a pin for each line and each column.
+// It can be set on the command line, as the host tests of the backends do.
+#define INPUT_BACKEND_MCP23008 0
+#define INPUT_BACKEND_MCP23017 1
+#define INPUT_BACKEND_MATRIX 2
+#ifndef INPUT_BACKEND
+#define INPUT_BACKEND INPUT_BACKEND_MCP23008
+#endif
+
+// The I2C clock of the MCP backends steps down when a chip fails this many reads within a window of I2C_ERROR_WINDOW scans, see i2cClock.h.
+#define I2C_ERROR_THRESHOLD 3
+#define I2C_ERROR_WINDOW 1000 // scans
+
+// Highest clock of the I2C bus of the MCP backends, lowered to the one of the board if above it. Can be changed at runtime, see settings.h.
+#define I2C_FREQUENCY 1000000 // Hz
+
+// An I2C transfer of the MCP backends that did not complete within this time fails, as if the chip did not answer, see timedI2c.h. The longest transfer, 3 bytes at
+// 100 kHz, takes about 300 micro-seconds.
+#define I2C_TRANSFER_TIMEOUT 500 // micro-seconds
+
+// After this many windows of scans without errors, the I2C clock steps up again. A step up with any error in its first window is undone and doubles this wait, up to 8 times.
+#define I2C_PROBE_WINDOWS 60
+
+// Pins of the lines and columns of the matrix, for INPUT_BACKEND_MATRIX. Lines are driven low one at a time and columns read low when the switch is pressed.
+#define MATRIX_LINE_PINS p2, p3, p4, p5, p6
+#define MATRIX_COLUMN_PINS p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21
+
+// Time between driving a line of the matrix low and reading the columns.
+#define MATRIX_SETTLE_TIME 5 // micro-seconds
+
+// Role of this board in a split keyboard, where each half has its own micro-controller linked to the other through the TRRS jack:
+//   SPLIT_NONE: the keyboard is in one piece.
+//   SPLIT_PRIMARY: the half connected to the USB host. It scans its own chips and receives the state of the other half.
+//   SPLIT_SECONDARY: the other half. It only scans its chips and sends their state to the primary half, see splitProtocol.h.
+#define SPLIT_NONE 0
+#define SPLIT_PRIMARY 1
+#define SPLIT_SECONDARY 2
+// It can be set on the command line, as tests/split_link_test.cpp does.
+#ifndef SPLIT_ROLE
+#define SPLIT_ROLE SPLIT_NONE
+#endif
+
+// Pins and speed of the UART link between the two halves of a split keyboard.
+#define SPLIT_TX_PIN p0
+#define SPLIT_RX_PIN p1
+#define SPLIT_BAUD 1000000
+
+// Number of bytes received from the other half that can wait to be processed by the main loop, a power of two. Each byte takes 10 bits on the link, so 256 bytes last 2.5 ms at 1 Mbaud.
+#define SPLIT_RX_BUFFER_SIZE 256 // bytes
+
+// The secondary half sends its state at least this often, so that the primary half can tell that the link is up.
+#define SPLIT_HEARTBEAT_TIME 10000 // micro-seconds
+
+// If the primary half does not receive anything for this amount of time, the link is considered down and the keys of the secondary half are released.
+#define SPLIT_TIMEOUT 50000 // micro-seconds
+
 // Number of line/colums in the virtual matrix of keys. they are not necessarly all mapped to real keys on the board.
 #define NUM_LINES 5
 #define NUM_COLUMNS 12
 
 // Sequence of press-release or release-press under this time are ignored. Very short presses can be caused by the mecanical switch "bouncing", causing erroneous presses
+// This is the debounce time of keys that have not learned their own yet.
 #define DEBOUNCE_TIME 10000 // micro-seconds
 
+// Each key learns its own debounce time from the bounces observed on its switch, within these bounds.
+#define DEBOUNCE_MIN_TIME 2000 // micro-seconds
+#define DEBOUNCE_MAX_TIME 20000 // micro-seconds
+
+// The learned debounce times are saved in flash once they changed and no key was pressed or released for this amount of time, so that the write never stalls typing.
+#define DEBOUNCE_SAVE_DELAY 60000000 // micro-seconds
+
+// The usage heatmap is saved in flash once no key was pressed for this amount of time, so that the write never stalls typing.
+#define HEATMAP_SAVE_DELAY 300000000 // micro-seconds
+
+// Number of entries in the ring of the post-mortem trace, see recorder.h. Must be a power of two, each entry takes 8 bytes of RAM.
+#define RECORDER_SIZE 2048
+
+// Section of the post-mortem trace, that must not be cleared at startup so that the trace survives a reset.
+#define RECORDER_SECTION ".uninitialized_data"
+
+// If enabled, the flash records are kept in RAM by EmulatedFlash instead of the flash of the micro-controller, so that the storage and the settings can run on Linux, see flashEmulation.h.
+// Both can be set on the command line, as the host tests of the settings do.
+#ifndef FLASH_EMULATION
+#define FLASH_EMULATION 0
+#endif
+#ifndef FLASH_EMULATION_SIZE
+#define FLASH_EMULATION_SIZE 65536 // bytes
+#endif
+
+// Stages of the processing of the events that can be left out of the build, see EventPipeline in arduino_keyboard.ino. A disabled stage costs nothing.
+// If enabled, any combinaison of key that are simultaneously held for less than OVERLAP_REMOVAL_TIME will be ignored. This delays every event by OVERLAP_REMOVAL_TIME.
+#define OVERLAP_REMOVAL 0
+// If enabled, the "on release" keys of the keymap are supported, see MAX_HOLD_TIME. A keymap without such keys can disable it.
+#define ON_RELEASE_KEYS 1
+// If enabled, the forced keys of the keymap are supported. A keymap without such keys can disable it.
+#define FORCED_KEYS 1
+
 // Any combinaison of key that are simultaneously held for less than this amount of time will be ignored.
 #define OVERLAP_REMOVAL_TIME 100000 // micro-seconds
 
 // For "on release" keys (i.e., for key that are both used as layer and standard key), this is the maximum hold time for the key to be considered a standard press rather than a layer selection.
 #define MAX_HOLD_TIME 500000 // micro-seconds
 
+// An "on release" key pressed less than this amount of time after the press of a regular key is resolved as a tap right away, without waiting for its release, so that it does not lag while typing.
+// Only keys that type something when tapped are resolved this way, and a layer key still held when another key is pressed selects its layer, after its tap. 0 disables
+// the typing streak. It can be set on the command line, as the host replay does to check the digests of the streak, see tools/replay_bench.cpp.
+#ifndef TYPING_STREAK_TIME
+#define TYPING_STREAK_TIME 0 // micro-seconds
+#endif
+
 // When the code simulate a single instantaneous key press, this is how long the key is hold for the computer to read.
 #define KEY_PRESS_LENGTH 50 // milli-seconds
 
+// If enabled, the main loop times its scans so that one ends just before each poll of the USB host, measured from the start of frame interrupt, see frameSync.h.
+// It can be set on the command line, as the host simulation of the alignment does, see tools/sof_sim.cpp.
+#ifndef SOF_SYNC
+#define SOF_SYNC 1
+#endif
+
+// Time kept between the end of a scan aligned on a poll of the USB host and the poll.
+#define SOF_SYNC_MARGIN 50 // micro-seconds
+
+// The USB bus is considered suspended by the host when no start of frame was seen for this amount of time. The host sends one every milli-second while the bus is active.
+#define USB_SUSPEND_TIME 5000 // micro-seconds
+
+// While the USB host suspends the bus, the switches are only scanned once per this period and the micro-controller sleeps in between.
+#define SUSPEND_SCAN_PERIOD 20 // milli-seconds
+
+// The hardware watchdog resets the board if an iteration of the main loop does not complete within this amount of time. The post-mortem trace survives the reset, see recorder.h.
+#define WATCHDOG_TIMEOUT 500 // milli-seconds
+
+// An iteration of the main loop that takes longer than this is recorded as a stall with the stage and the chip it was stuck in, see deadline.h.
+#define LOOP_DEADLINE 5000 // micro-seconds
+
+// Deadline of the flash writes and of the control channel, which run while nothing is typed. An erase stalls the execution for tens of milli-seconds.
+#define MAINTENANCE_DEADLINE 200000 // micro-seconds
+
+// Maximum number of events taken from the event queue in a single iteration of the main loop. Remaining events are left in the queue for the next iteration, so that the switches keep being scanned during bursts of events.
+#define MAX_EVENTS_PER_LOOP 8
+
+// Maximum number of USB reports sent in a single iteration of the main loop.
+#define MAX_REPORTS_PER_LOOP 2
+
+// Number of keyboard states that can wait to be sent to the USB host. When full, consecutive states are merged when the host cannot tell, see ReportFifo.
+#define REPORT_FIFO_SIZE 8
+
+// When replaying a trace, the virtual time between two scans of the switches. This is about the time taken by one iteration of the main loop.
+#define REPLAY_SCAN_PERIOD 1000 // micro-seconds
+
+// When replaying a trace, number of times the trace is repeated to get stable timings.
+#define REPLAY_REPEAT 20
+
+// When replaying, number of random traces generated to check the event processing against the reference digests of replay.cpp, and maximum number of edges in each.
+#define REPLAY_FUZZ_TRACES 200
+#define REPLAY_FUZZ_EDGES 400
+
+// When replaying a corpus trace, how many keys ahead of the next expected one a typed key is searched in the text before it counts as an extra key.
+#define REPLAY_CORPUS_LOOKAHEAD 4
+
+// Number of operations timed by each benchmark of BENCH_LOG. It can be set on the command line, the host needs more operations to be timed with micros().
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 10000
+#endif
+
 #if ANY_LOG
 #include <Arduino.h>
 #define debugPrint(x) Serial.print(x)
@@ -40,4 +199,18 @@
 #define debugPrint(x)
 #define debugPrintln(x)
 #define ON_DEBUG(x)
-#endif
\ No newline at end of file
+#endif
+
+// Only for the messages about how each event is processed, so that the other logs are not flooded and do not slow down the event processing.
+#if DEBUG_LOG
+#define ON_DEBUG_LOG(x) x
+#else
+#define ON_DEBUG_LOG(x)
+#endif
+
+// Only for the calls that feed the frame synchronization, see SOF_SYNC.
+#if SOF_SYNC
+#define ON_SOF_SYNC(x) x
+#else
+#define ON_SOF_SYNC(x)
+#endif
@@ -0,0 +1,200 @@
+#include "control.h"
+#include "controlProtocol.h"
+#include "debounce.h"
+#include "heatmap.h"
+#include "keyboard.h"
+#include "keymap.h"
+#include "perf.h"
+#include "recorder.h"
+#include "settings.h"
+#include <string.h>
+
+/// Namespace containing all the implementation details of the control channel.
+namespace ControlImpl {
+
+/// An answer is waiting for room in the USB output.
+bool s_answerPending = false;
+
+/// The answer being built or waiting to be sent.
+uint8_t s_answer[CONTROL_REPORT_SIZE];
+
+/// Read a little endian integer.
+inline uint32_t read32(const uint8_t* data) {
+  return data[0] | (data[1] << 8) | (data[2] << 16) | (uint32_t(data[3]) << 24);
+}
+
+/// Write a little endian integer.
+inline void write32(uint8_t* data, uint32_t value) {
+  data[0] = value;
+  data[1] = value >> 8;
+  data[2] = value >> 16;
+  data[3] = value >> 24;
+}
+
+/// Copy a name at the end of the answer, truncated to fit.
+inline void writeName(uint8_t* data, const char* name) {
+  size_t room = s_answer + CONTROL_REPORT_SIZE - data - 1;
+  strncpy((char*)data, name, room);
+  data[room] = 0;
+}
+
+/// Build in s_answer the answer to 'request'.
+void process(const uint8_t* request) {
+  memset(s_answer, 0, sizeof(s_answer));
+  s_answer[0] = request[0];
+  s_answer[1] = CONTROL_OK;
+  uint8_t* payload = s_answer + 2;
+
+  switch (request[0]) {
+    case CONTROL_PING:
+      payload[0] = CONTROL_PROTOCOL_VERSION;
+      break;
+
+    case CONTROL_READ_COUNTER:
+      if (request[1] >= Perf::NUM_COUNTERS) {
+        s_answer[1] = CONTROL_INVALID_ARGUMENT;
+        break;
+      }
+      write32(payload, Perf::counter(Perf::Counter(request[1])));
+      writeName(payload + 4, Perf::name(Perf::Counter(request[1])));
+      break;
+
+    case CONTROL_HISTOGRAM_INFO:
+      if (request[1] >= Perf::NUM_HISTOGRAMS) {
+        s_answer[1] = CONTROL_INVALID_ARGUMENT;
+        break;
+      }
+      write32(payload, Perf::maximum(Perf::Histogram(request[1])));
+      payload[4] = PERF_HISTOGRAM_BUCKETS;
+      writeName(payload + 5, Perf::name(Perf::Histogram(request[1])));
+      break;
+
+    case CONTROL_READ_HISTOGRAM: {
+      if (request[1] >= Perf::NUM_HISTOGRAMS || request[2] >= PERF_HISTOGRAM_BUCKETS) {
+        s_answer[1] = CONTROL_INVALID_ARGUMENT;
+        break;
+      }
+      int count = PERF_HISTOGRAM_BUCKETS - request[2];
+      if (count > CONTROL_BUCKETS_PER_ANSWER) count = CONTROL_BUCKETS_PER_ANSWER;
+      payload[0] = count;
+      for (int i = 0; i < count; ++i) {
+        write32(payload + 1 + 4 * i, Perf::bucket(Perf::Histogram(request[1]), request[2] + i));
+      }
+      break;
+    }
+
+    case CONTROL_RESET_PERF:
+      Perf::reset();
+      break;
+
+    case CONTROL_GET_SETTING: {
+      if (request[1] >= Settings::NUM_SETTINGS) {
+        s_answer[1] = CONTROL_INVALID_ARGUMENT;
+        break;
+      }
+      Settings::Setting setting = Settings::Setting(request[1]);
+      write32(payload, Settings::get(setting));
+      write32(payload + 4, Settings::minimum(setting));
+      write32(payload + 8, Settings::maximum(setting));
+      writeName(payload + 12, Settings::name(setting));
+      break;
+    }
+
+    case CONTROL_SET_SETTING: {
+      if (request[1] >= Settings::NUM_SETTINGS || !Settings::set(Settings::Setting(request[1]), read32(request + 2))) {
+        s_answer[1] = CONTROL_INVALID_ARGUMENT;
+        break;
+      }
+      // The learned debounce times are relative to the default one, start learning again.
+      if (request[1] == Settings::SETTING_DEBOUNCE_TIME) Debounce::reset();
+      break;
+    }
+
+    case CONTROL_SAVE_SETTINGS:
+      if (!Settings::save()) s_answer[1] = CONTROL_INVALID_ARGUMENT;
+      break;
+
+    case CONTROL_KEYMAP_WRITE: {
+      uint32_t offset = request[1] | (request[2] << 8);
+      uint8_t length = request[3];
+      if (length > CONTROL_KEYMAP_CHUNK_SIZE || !Keymap::write(offset, request + 4, length)) {
+        s_answer[1] = CONTROL_INVALID_ARGUMENT;
+      }
+      break;
+    }
+
+    case CONTROL_KEYMAP_COMMIT:
+      if (!Keymap::commit()) s_answer[1] = CONTROL_INVALID_ARGUMENT;
+      break;
+
+    case CONTROL_KEYMAP_INFO:
+      write32(payload, Keymap::sequence());
+      payload[4] = KEYMAP_VERSION & 0xFF;
+      payload[5] = KEYMAP_VERSION >> 8;
+      write32(payload + 6, sizeof(KeymapImage));
+      break;
+
+    case CONTROL_READ_HEATMAP: {
+      static const int numKeys = NUM_LINES * NUM_COLUMNS;
+      if (request[1] >= NUM_LAYER_MASKS || request[2] >= numKeys) {
+        s_answer[1] = CONTROL_INVALID_ARGUMENT;
+        break;
+      }
+      int count = numKeys - request[2];
+      if (count > CONTROL_HEATMAP_KEYS_PER_ANSWER) count = CONTROL_HEATMAP_KEYS_PER_ANSWER;
+      payload[0] = count;
+      for (int i = 0; i < count; ++i) {
+        int key = request[2] + i;
+        write32(payload + 1 + 4 * i, Heatmap::presses(request[1], Pos{ key / NUM_COLUMNS, key % NUM_COLUMNS }));
+      }
+      break;
+    }
+
+    case CONTROL_READ_RECORDER: {
+      uint32_t first = request[2] | (request[3] << 8);
+      if (request[1] > Recorder::SOURCE_LIVE) {
+        s_answer[1] = CONTROL_INVALID_ARGUMENT;
+        break;
+      }
+      Recorder::Source source = Recorder::Source(request[1]);
+      int size = Recorder::size(source);
+      int count = first < uint32_t(size) ? size - first : 0;
+      if (count > CONTROL_RECORDER_ENTRIES_PER_ANSWER) count = CONTROL_RECORDER_ENTRIES_PER_ANSWER;
+      write32(payload, Recorder::resets(source));
+      payload[4] = size & 0xFF;
+      payload[5] = size >> 8;
+      payload[6] = count;
+      for (int i = 0; i < count; ++i) {
+        const Recorder::Entry& entry = Recorder::entry(source, first + i);
+        uint8_t* data = payload + 7 + 8 * i;
+        write32(data, entry.m_time);
+        data[4] = entry.m_type;
+        data[5] = entry.m_key;
+        data[6] = entry.m_value & 0xFF;
+        data[7] = entry.m_value >> 8;
+      }
+      break;
+    }
+
+    default:
+      s_answer[1] = CONTROL_UNKNOWN_COMMAND;
+      break;
+  }
+}
+}
+
+void Control::step() {
+  using namespace ControlImpl;
+
+  // Wait for the previous answer to be taken before reading another request.
+  if (s_answerPending) {
+    s_answerPending = !KeyboardOutput::sendControl(s_answer);
+    return;
+  }
+
+  uint8_t request[CONTROL_REPORT_SIZE];
+  if (!KeyboardOutput::receiveControl(request)) return;
+
+  process(request);
+  s_answerPending = !KeyboardOutput::sendControl(s_answer);
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include "config.h"
+
+/// The control channel, used by the USB host to read the performance counters and change the settings at runtime.
+///
+/// The protocol is described in controlProtocol.h.
+namespace Control {
+
+/// Answer the pending request from the host, if any. Only call it when the keyboard is idle, so that it never delays a key press.
+void step();
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <stdint.h>
+
+// Protocol of the control channel, shared by the firmware and the host tools.
+//
+// The host writes a request in an output report with the ID CONTROL_REPORT_ID. Once the keyboard is idle it answers with an input report with the same ID.
+// Both reports carry CONTROL_REPORT_SIZE bytes after the report ID. Byte 0 is the command, byte 1 of the answer is a ControlStatus, the rest depends on the command.
+// Integers are little endian, names are zero terminated.
+
+/// Report ID of the control channel.
+#define CONTROL_REPORT_ID 5
+
+/// Size of a request or answer, without the report ID.
+#define CONTROL_REPORT_SIZE 32
+
+/// Version of the protocol, returned by CONTROL_PING.
+#define CONTROL_PROTOCOL_VERSION 1
+
+/// Report ID of the per-key telemetry feature report, see Telemetry::fillPage().
+#define TELEMETRY_REPORT_ID 4
+
+/// Number of keys described in one page of the telemetry report.
+#define TELEMETRY_KEYS_PER_PAGE 7
+
+/// Size in bytes of one page of the telemetry report, without the report ID.
+#define TELEMETRY_PAGE_SIZE (2 + TELEMETRY_KEYS_PER_PAGE * 8)
+
+enum ControlCommand : uint8_t {
+  /// Request: nothing. Answer: protocol version (1 byte).
+  CONTROL_PING = 1,
+
+  /// Request: counter index (1 byte). Answer: value (4 bytes), name.
+  CONTROL_READ_COUNTER = 2,
+
+  /// Request: histogram index (1 byte). Answer: maximum (4 bytes), number of buckets (1 byte), name.
+  CONTROL_HISTOGRAM_INFO = 3,
+
+  /// Request: histogram index (1 byte), first bucket (1 byte). Answer: number of buckets returned (1 byte), buckets (4 bytes each).
+  CONTROL_READ_HISTOGRAM = 4,
+
+  /// Request: nothing. Answer: nothing. Clear all counters and histograms.
+  CONTROL_RESET_PERF = 5,
+
+  /// Request: setting index (1 byte). Answer: value (4 bytes), minimum (4 bytes), maximum (4 bytes), name.
+  CONTROL_GET_SETTING = 6,
+
+  /// Request: setting index (1 byte), value (4 bytes). Answer: nothing.
+  CONTROL_SET_SETTING = 7,
+
+  /// Request: offset (2 bytes), length (1 byte), data (up to CONTROL_KEYMAP_CHUNK_SIZE bytes). Answer: nothing.
+  /// Copy a part of a keymap image in the staging buffer of the keyboard.
+  CONTROL_KEYMAP_WRITE = 8,
+
+  /// Request: nothing. Answer: nothing.
+  /// Check the image in the staging buffer and store it in flash. It becomes active as soon as no layer key is held.
+  CONTROL_KEYMAP_COMMIT = 9,
+
+  /// Request: nothing. Answer: sequence number of the active image (4 bytes, 0 for the compiled-in keymap), supported image version (2 bytes), image size (4 bytes).
+  CONTROL_KEYMAP_INFO = 10,
+
+  /// Request: layer mask (1 byte), first key index (1 byte), where the key index is line * NUM_COLUMNS + column. Answer: number of keys returned (1 byte), presses (4 bytes each).
+  /// Read the usage heatmap, see Heatmap.
+  CONTROL_READ_HEATMAP = 11,
+
+  /// Request: source (1 byte, a Recorder::Source), first entry index (2 bytes). Answer: resets since power on (4 bytes), number of entries (2 bytes), number of entries returned (1 byte), entries (8 bytes each).
+  /// Read the post-mortem trace, see Recorder. Each entry is: time in micro-seconds (4 bytes), type (1 byte), key (1 byte), value (2 bytes).
+  CONTROL_READ_RECORDER = 12,
+
+  /// Request: nothing. Answer: nothing.
+  /// Store the current settings in flash, they are loaded at the next start.
+  CONTROL_SAVE_SETTINGS = 13,
+};
+
+enum ControlStatus : uint8_t {
+  CONTROL_OK = 0,
+  /// The command is not known by the firmware.
+  CONTROL_UNKNOWN_COMMAND = 1,
+  /// An index or a value in the request is out of range.
+  CONTROL_INVALID_ARGUMENT = 2,
+};
+
+/// Largest amount of data in one CONTROL_KEYMAP_WRITE request.
+#define CONTROL_KEYMAP_CHUNK_SIZE (CONTROL_REPORT_SIZE - 4)
+
+/// Number of histogram buckets that fit in one CONTROL_READ_HISTOGRAM answer.
+#define CONTROL_BUCKETS_PER_ANSWER ((CONTROL_REPORT_SIZE - 3) / 4)
+
+/// Number of keys that fit in one CONTROL_READ_HEATMAP answer.
+#define CONTROL_HEATMAP_KEYS_PER_ANSWER ((CONTROL_REPORT_SIZE - 3) / 4)
+
+/// Number of trace entries that fit in one CONTROL_READ_RECORDER answer.
+#define CONTROL_RECORDER_ENTRIES_PER_ANSWER ((CONTROL_REPORT_SIZE - 9) / 8)
@@ -0,0 +1,1454 @@
+#pragma once
+#include "replay.h"
+
+// Generated by code/tools/corpus_trace.cpp from 300 characters of tools/corpus.txt, do not edit.
+// Options: --dwell 90000 --bounce 3000 --bounce-rate 0.1 --seed 1
+
+namespace ReplayImpl {
+
+static const TraceEdge s_corpus60[] = {
+  { 0, { 4, 4 }, true }, { 30374, { 2, 9 }, true }, { 99861, { 2, 9 }, false }, { 134803, { 4, 4 }, false },
+  { 266660, { 1, 3 }, true }, { 335993, { 1, 3 }, false }, { 484139, { 4, 5 }, true }, { 589565, { 4, 5 }, false },
+  { 716026, { 3, 3 }, true }, { 716405, { 3, 3 }, false }, { 716580, { 3, 3 }, true }, { 717056, { 3, 3 }, false },
+  { 717266, { 3, 3 }, true }, { 813709, { 3, 3 }, false }, { 890322, { 2, 9 }, true }, { 991114, { 2, 9 }, false },
+  { 1085122, { 1, 1 }, true }, { 1191790, { 1, 1 }, false }, { 1208170, { 3, 4 }, true }, { 1300644, { 3, 4 }, false },
+  { 1300806, { 3, 4 }, true }, { 1300962, { 3, 4 }, false }, { 1301127, { 3, 4 }, true }, { 1301312, { 3, 4 }, false },
+  { 1383742, { 1, 8 }, true }, { 1483754, { 1, 8 }, false }, { 1620126, { 1, 3 }, true }, { 1723213, { 1, 3 }, false },
+  { 1849276, { 1, 4 }, true }, { 1922040, { 1, 4 }, false }, { 2061468, { 4, 5 }, true }, { 2142751, { 4, 5 }, false },
+  { 2233167, { 1, 3 }, true }, { 2307007, { 1, 3 }, false }, { 2353892, { 2, 2 }, true }, { 2463227, { 2, 2 }, false },
+  { 2574012, { 1, 5 }, true }, { 2652406, { 1, 5 }, false }, { 2735109, { 4, 5 }, true }, { 2842695, { 4, 5 }, false },
+  { 2886418, { 1, 7 }, true }, { 2968391, { 1, 7 }, false }, { 3154228, { 3, 7 }, true }, { 3257382, { 3, 7 }, false },
+  { 3319547, { 4, 5 }, true }, { 3426851, { 4, 5 }, false }, { 3503493, { 1, 9 }, true }, { 3619253, { 1, 9 }, false },
+  { 3740537, { 1, 7 }, true }, { 3852729, { 1, 7 }, false }, { 3929895, { 1, 5 }, true }, { 4040787, { 1, 5 }, false },
+  { 4198209, { 1, 8 }, true }, { 4274326, { 1, 8 }, false }, { 4422135, { 2, 9 }, true }, { 4509623, { 2, 9 }, false },
+  { 4693661, { 4, 5 }, true }, { 4784401, { 4, 5 }, false }, { 4946281, { 2, 1 }, true }, { 5060464, { 2, 1 }, false },
+  { 5120994, { 1, 7 }, true }, { 5209694, { 1, 7 }, false }, { 5388296, { 1, 3 }, true }, { 5479394, { 1, 3 }, false },
+  { 5546062, { 4, 5 }, true }, { 5614057, { 4, 5 }, false }, { 5765893, { 2, 9 }, true }, { 5830999, { 2, 9 }, false },
+  { 5909307, { 4, 5 }, true }, { 5964059, { 1, 5 }, true }, { 6040221, { 1, 5 }, false }, { 6040328, { 1, 5 }, true },
+  { 6040444, { 1, 5 }, false }, { 6040515, { 1, 5 }, true }, { 6040575, { 1, 5 }, false }, { 6040678, { 1, 5 }, true },
+  { 6040739, { 1, 5 }, false }, { 6063231, { 4, 5 }, false }, { 6091528, { 1, 9 }, true }, { 6206878, { 1, 9 }, false },
+  { 6229151, { 3, 7 }, true }, { 6331452, { 3, 7 }, false }, { 6473259, { 4, 5 }, true }, { 6585958, { 4, 5 }, false },
+  { 6648207, { 1, 7 }, true }, { 6745317, { 1, 7 }, false }, { 6885271, { 1, 5 }, true }, { 7001560, { 1, 5 }, false },
+  { 7036443, { 1, 8 }, true }, { 7037056, { 1, 8 }, false }, { 7037568, { 1, 8 }, true }, { 7146023, { 1, 8 }, false },
+  { 7238137, { 2, 9 }, true }, { 7317729, { 2, 9 }, false }, { 7446429, { 1, 8 }, true }, { 7510268, { 1, 8 }, false },
+  { 7577944, { 2, 2 }, true }, { 7672188, { 2, 2 }, false }, { 7790684, { 1, 3 }, true }, { 7904049, { 1, 3 }, false },
+  { 7994237, { 4, 5 }, true }, { 8072391, { 4, 5 }, false }, { 8255607, { 1, 5 }, true }, { 8365094, { 1, 5 }, false },
+  { 8464375, { 1, 9 }, true }, { 8533378, { 1, 9 }, false }, { 8741327, { 1, 7 }, true }, { 8834538, { 1, 7 }, false },
+  { 8965308, { 1, 5 }, true }, { 9073489, { 1, 5 }, false }, { 9107260, { 1, 3 }, true }, { 9107362, { 1, 3 }, false },
+  { 9107543, { 1, 3 }, true }, { 9107850, { 1, 3 }, false }, { 9107967, { 1, 3 }, true }, { 9219317, { 1, 3 }, false },
+  { 9262273, { 4, 5 }, true }, { 9355389, { 4, 5 }, false }, { 9525338, { 2, 9 }, true }, { 9605695, { 2, 9 }, false },
+  { 9780835, { 1, 1 }, true }, { 9874582, { 1, 1 }, false }, { 9918837, { 4, 5 }, true }, { 9992365, { 4, 5 }, false },
+  { 10143472, { 2, 7 }, true }, { 10259033, { 2, 7 }, false }, { 10259434, { 2, 7 }, true }, { 10259604, { 2, 7 }, false },
+  { 10259852, { 2, 7 }, true }, { 10260349, { 2, 7 }, false }, { 10260426, { 2, 7 }, true }, { 10260807, { 2, 7 }, false },
+  { 10355668, { 1, 9 }, true }, { 10456572, { 1, 9 }, false }, { 10456652, { 1, 9 }, true }, { 10457534, { 1, 9 }, false },
+  { 10494571, { 1, 7 }, true }, { 10605907, { 1, 7 }, false }, { 10618362, { 1, 4 }, true }, { 10690361, { 1, 4 }, false },
+  { 10846382, { 3, 7 }, true }, { 10927285, { 3, 7 }, false }, { 11027640, { 1, 3 }, true }, { 11117912, { 1, 3 }, false },
+  { 11165331, { 1, 3 }, true }, { 11165518, { 1, 3 }, false }, { 11165794, { 1, 3 }, true }, { 11165946, { 1, 3 }, false },
+  { 11166004, { 1, 3 }, true }, { 11273891, { 1, 3 }, false }, { 11311202, { 3, 9 }, true }, { 11420481, { 3, 9 }, false },
+  { 11567448, { 4, 5 }, true }, { 11672654, { 4, 5 }, false }, { 11690215, { 1, 8 }, true }, { 11773994, { 1, 8 }, false },
+  { 11954789, { 2, 9 }, true }, { 12034527, { 2, 9 }, false }, { 12192492, { 4, 5 }, true }, { 12299025, { 4, 5 }, false },
+  { 12400260, { 2, 3 }, true }, { 12510112, { 2, 3 }, false }, { 12660929, { 1, 9 }, true }, { 12755934, { 1, 9 }, false },
+  { 12917276, { 1, 8 }, true }, { 13023218, { 1, 8 }, false }, { 13188331, { 1, 5 }, true }, { 13188579, { 1, 5 }, false },
+  { 13188707, { 1, 5 }, true }, { 13265147, { 1, 5 }, false }, { 13351149, { 4, 5 }, true }, { 13427215, { 4, 5 }, false },
+  { 13474039, { 2, 2 }, true }, { 13581675, { 2, 2 }, false }, { 13738202, { 1, 7 }, true }, { 13738270, { 1, 7 }, false },
+  { 13738432, { 1, 7 }, true }, { 13738647, { 1, 7 }, false }, { 13739011, { 1, 7 }, true }, { 13739187, { 1, 7 }, false },
+  { 13739512, { 1, 7 }, true }, { 13801896, { 1, 7 }, false }, { 13999375, { 1, 8 }, true }, { 14077081, { 1, 8 }, false },
+  { 14240786, { 3, 4 }, true }, { 14356242, { 3, 4 }, false }, { 14487413, { 1, 4 }, true }, { 14550528, { 1, 4 }, false },
+  { 14727582, { 1, 3 }, true }, { 14727839, { 1, 3 }, false }, { 14727928, { 1, 3 }, true }, { 14837325, { 1, 3 }, false },
+  { 14980739, { 4, 5 }, true }, { 15088459, { 4, 5 }, false }, { 15222276, { 2, 9 }, true }, { 15317447, { 2, 9 }, false },
+  { 15485511, { 1, 1 }, true }, { 15564449, { 1, 1 }, false }, { 15625541, { 4, 5 }, true }, { 15722726, { 4, 5 }, false },
+  { 15903737, { 2, 4 }, true }, { 16013278, { 2, 4 }, false }, { 16117256, { 1, 4 }, true }, { 16212463, { 1, 4 }, false },
+  { 16279540, { 1, 1 }, true }, { 16388247, { 1, 1 }, false }, { 16483846, { 1, 10 }, true }, { 16586935, { 1, 10 }, false },
+  { 16619518, { 1, 10 }, true }, { 16707123, { 1, 10 }, false }, { 16839409, { 1, 3 }, true }, { 16938688, { 1, 3 }, false },
+  { 16983981, { 4, 5 }, true }, { 17058849, { 4, 5 }, false }, { 17228977, { 2, 2 }, true }, { 17331046, { 2, 2 }, false },
+  { 17461321, { 1, 1 }, true }, { 17534417, { 1, 1 }, false }, { 17634655, { 3, 7 }, true }, { 17701218, { 3, 7 }, false },
+  { 17701366, { 3, 7 }, true }, { 17701603, { 3, 7 }, false }, { 17701886, { 3, 7 }, true }, { 17701992, { 3, 7 }, false },
+  { 17788277, { 2, 2 }, true }, { 17865038, { 2, 2 }, false }, { 17952060, { 4, 5 }, true }, { 18057482, { 4, 5 }, false },
+  { 18218157, { 1, 10 }, true }, { 18313476, { 1, 10 }, false }, { 18495788, { 1, 3 }, true }, { 18595204, { 1, 3 }, false },
+  { 18702021, { 1, 4 }, true }, { 18814922, { 1, 4 }, false }, { 18952964, { 2, 3 }, true }, { 19053535, { 2, 3 }, false },
+  { 19138923, { 1, 4 }, true }, { 19211526, { 1, 4 }, false }, { 19274927, { 1, 3 }, true }, { 19345270, { 1, 3 }, false },
+  { 19440255, { 4, 5 }, true }, { 19539483, { 4, 5 }, false }, { 19689484, { 1, 7 }, true }, { 19797792, { 1, 7 }, false },
+  { 19913204, { 3, 7 }, true }, { 20012143, { 3, 7 }, false }, { 20161895, { 1, 3 }, true }, { 20258270, { 1, 3 }, false },
+  { 20305615, { 4, 5 }, true }, { 20393270, { 4, 5 }, false }, { 20444249, { 2, 2 }, true }, { 20560189, { 2, 2 }, false },
+  { 20605900, { 1, 3 }, true }, { 20606118, { 1, 3 }, false }, { 20606382, { 1, 3 }, true }, { 20606657, { 1, 3 }, false },
+  { 20606957, { 1, 3 }, true }, { 20708284, { 1, 3 }, false }, { 20762225, { 1, 7 }, true }, { 20839939, { 1, 7 }, false },
+  { 20840123, { 1, 7 }, true }, { 20840497, { 1, 7 }, false }, { 20840644, { 1, 7 }, true }, { 20841007, { 1, 7 }, false },
+  { 20841376, { 1, 7 }, true }, { 20841586, { 1, 7 }, false }, { 20940005, { 2, 9 }, true }, { 21056815, { 2, 9 }, false },
+  { 21065278, { 1, 3 }, true }, { 21136466, { 1, 3 }, false }, { 21294583, { 4, 5 }, true }, { 21401899, { 4, 5 }, false },
+  { 21522643, { 1, 5 }, true }, { 21623742, { 1, 5 }, false }, { 21648819, { 1, 9 }, true }, { 21736217, { 1, 9 }, false },
+  { 21795360, { 1, 7 }, true }, { 21898493, { 1, 7 }, false }, { 21935768, { 3, 3 }, true }, { 22039567, { 3, 3 }, false },
+  { 22068394, { 2, 6 }, true }, { 22172514, { 2, 6 }, false }, { 22243713, { 1, 3 }, true }, { 22326474, { 1, 3 }, false },
+  { 22439940, { 3, 8 }, true }, { 22543095, { 3, 8 }, false }, { 22543148, { 3, 8 }, true }, { 22543262, { 3, 8 }, false },
+  { 22543332, { 3, 8 }, true }, { 22543426, { 3, 8 }, false }, { 22697345, { 4, 6 }, true }, { 22762688, { 4, 6 }, false },
+  { 22775639, { 4, 4 }, true }, { 22842339, { 2, 1 }, true }, { 22931640, { 2, 1 }, false }, { 22949189, { 4, 4 }, false },
+  { 23006401, { 1, 7 }, true }, { 23100854, { 1, 7 }, false }, { 23161471, { 1, 1 }, true }, { 23252714, { 1, 1 }, false },
+  { 23356171, { 3, 7 }, true }, { 23461510, { 3, 7 }, false }, { 23604217, { 2, 3 }, true }, { 23697885, { 2, 3 }, false },
+  { 23846575, { 4, 5 }, true }, { 23912864, { 4, 5 }, false }, { 24064852, { 1, 9 }, true }, { 24150120, { 1, 9 }, false },
+  { 24266935, { 3, 7 }, true }, { 24357919, { 3, 7 }, false }, { 24357972, { 3, 7 }, true }, { 24358184, { 3, 7 }, false },
+  { 24358337, { 3, 7 }, true }, { 24358575, { 3, 7 }, false }, { 24358675, { 3, 7 }, true }, { 24358938, { 3, 7 }, false },
+  { 24545709, { 4, 5 }, true }, { 24648121, { 4, 5 }, false }, { 24673390, { 1, 5 }, true }, { 24765072, { 1, 5 }, false },
+  { 24765171, { 1, 5 }, true }, { 24765233, { 1, 5 }, false }, { 24765339, { 1, 5 }, true }, { 24765391, { 1, 5 }, false },
+  { 24765506, { 1, 5 }, true }, { 24765605, { 1, 5 }, false }, { 24827108, { 1, 1 }, true }, { 24901755, { 1, 1 }, false },
+  { 25044962, { 1, 10 }, true }, { 25114869, { 1, 10 }, false }, { 25291071, { 1, 3 }, true }, { 25401739, { 1, 3 }, false },
+  { 25539452, { 4, 5 }, true }, { 25640279, { 4, 5 }, false }, { 25801517, { 3, 4 }, true }, { 25890536, { 3, 4 }, false },
+  { 26015786, { 1, 8 }, true }, { 26078847, { 1, 8 }, false }, { 26201229, { 1, 5 }, true }, { 26280769, { 1, 5 }, false },
+  { 26401851, { 1, 3 }, true }, { 26487803, { 1, 3 }, false }, { 26616159, { 3, 9 }, true }, { 26715898, { 3, 9 }, false },
+  { 26865176, { 4, 5 }, true }, { 26947117, { 4, 5 }, false }, { 27010565, { 2, 9 }, true }, { 27100126, { 2, 9 }, false },
+  { 27195337, { 1, 3 }, true }, { 27274764, { 1, 3 }, false }, { 27274827, { 1, 3 }, true }, { 27275098, { 1, 3 }, false },
+  { 27275324, { 1, 3 }, true }, { 27275502, { 1, 3 }, false }, { 27325910, { 2, 2 }, true }, { 27429684, { 2, 2 }, false },
+  { 27464352, { 4, 5 }, true }, { 27578725, { 4, 5 }, false }, { 27612167, { 2, 3 }, true }, { 27700498, { 2, 3 }, false },
+  { 27868399, { 1, 9 }, true }, { 27971896, { 1, 9 }, false }, { 28052100, { 1, 8 }, true }, { 28120174, { 1, 8 }, false },
+  { 28258499, { 2, 5 }, true }, { 28258625, { 2, 5 }, false }, { 28258712, { 2, 5 }, true }, { 28258803, { 2, 5 }, false },
+  { 28258901, { 2, 5 }, true }, { 28258957, { 2, 5 }, false }, { 28259108, { 2, 5 }, true }, { 28351619, { 2, 5 }, false },
+  { 28392373, { 1, 5 }, true }, { 28497826, { 1, 5 }, false }, { 28660091, { 2, 2 }, true }, { 28756185, { 2, 2 }, false },
+  { 28756543, { 2, 2 }, true }, { 28757027, { 2, 2 }, false }, { 28793070, { 4, 5 }, true }, { 28906435, { 4, 5 }, false },
+  { 28963337, { 2, 2 }, true }, { 29036163, { 2, 2 }, false }, { 29136058, { 1, 3 }, true }, { 29204168, { 1, 3 }, false },
+  { 29262245, { 4, 5 }, true }, { 29348453, { 4, 5 }, false }, { 29421594, { 3, 3 }, true }, { 29506149, { 3, 3 }, false },
+  { 29668326, { 2, 6 }, true }, { 29736082, { 2, 6 }, false }, { 29940506, { 1, 3 }, true }, { 30022527, { 1, 3 }, false },
+  { 30184927, { 3, 4 }, true }, { 30281138, { 3, 4 }, false }, { 30391332, { 1, 1 }, true }, { 30459932, { 1, 1 }, false },
+  { 30569681, { 1, 7 }, true }, { 30569910, { 1, 7 }, false }, { 30570721, { 1, 7 }, true }, { 30655741, { 1, 7 }, false },
+  { 30747543, { 3, 3 }, true }, { 30858451, { 3, 3 }, false }, { 30905049, { 2, 6 }, true }, { 30998348, { 2, 6 }, false },
+  { 31076722, { 1, 3 }, true }, { 31192937, { 1, 3 }, false }, { 31258272, { 3, 7 }, true }, { 31258481, { 3, 7 }, false },
+  { 31258771, { 3, 7 }, true }, { 31258892, { 3, 7 }, false }, { 31259014, { 3, 7 }, true }, { 31259288, { 3, 7 }, false },
+  { 31259452, { 3, 7 }, true }, { 31327100, { 3, 7 }, false }, { 31399589, { 1, 5 }, true }, { 31502770, { 1, 5 }, false },
+  { 31624590, { 4, 5 }, true }, { 31727272, { 4, 5 }, false }, { 31850967, { 4, 4 }, true }, { 31878242, { 3, 10 }, true },
+  { 31970051, { 3, 10 }, false }, { 31970281, { 3, 10 }, true }, { 31970639, { 3, 10 }, false }, { 31971044, { 3, 10 }, true },
+  { 31971111, { 3, 10 }, false }, { 31971319, { 3, 10 }, true }, { 31971729, { 3, 10 }, false }, { 31987922, { 4, 4 }, false },
+  { 32077997, { 4, 5 }, true }, { 32147027, { 4, 5 }, false }, { 32225944, { 1, 7 }, true }, { 32317790, { 1, 7 }, false },
+  { 32460169, { 3, 7 }, true }, { 32547796, { 3, 7 }, false }, { 32548277, { 3, 7 }, true }, { 32548625, { 3, 7 }, false },
+  { 32548839, { 3, 7 }, true }, { 32549197, { 3, 7 }, false }, { 32622778, { 1, 3 }, true }, { 32689091, { 1, 3 }, false },
+  { 32828511, { 4, 5 }, true }, { 32919864, { 4, 5 }, false }, { 32972249, { 1, 5 }, true }, { 32972381, { 1, 5 }, false },
+  { 32972557, { 1, 5 }, true }, { 32972655, { 1, 5 }, false }, { 32972784, { 1, 5 }, true }, { 33036894, { 1, 5 }, false },
+  { 33036991, { 1, 5 }, true }, { 33037132, { 1, 5 }, false }, { 33037182, { 1, 5 }, true }, { 33037234, { 1, 5 }, false },
+  { 33037291, { 1, 5 }, true }, { 33037429, { 1, 5 }, false }, { 33115830, { 1, 9 }, true }, { 33115991, { 1, 9 }, false },
+  { 33116471, { 1, 9 }, true }, { 33116903, { 1, 9 }, false }, { 33117263, { 1, 9 }, true }, { 33220499, { 1, 9 }, false },
+  { 33305692, { 1, 7 }, true }, { 33306013, { 1, 7 }, false }, { 33306317, { 1, 7 }, true }, { 33306508, { 1, 7 }, false },
+  { 33306641, { 1, 7 }, true }, { 33417034, { 1, 7 }, false }, { 33417362, { 1, 7 }, true }, { 33418231, { 1, 7 }, false },
+  { 33522541, { 3, 3 }, true }, { 33589785, { 3, 3 }, false }, { 33702579, { 2, 6 }, true }, { 33816307, { 2, 6 }, false },
+  { 33958664, { 1, 3 }, true }, { 34045643, { 1, 3 }, false }, { 34214763, { 4, 5 }, true }, { 34321580, { 4, 5 }, false },
+  { 34346575, { 1, 3 }, true }, { 34415404, { 1, 3 }, false }, { 34511079, { 2, 2 }, true }, { 34575996, { 2, 2 }, false },
+  { 34726607, { 1, 5 }, true }, { 34823811, { 1, 5 }, false }, { 34861647, { 4, 5 }, true }, { 34949940, { 4, 5 }, false },
+  { 35104611, { 1, 3 }, true }, { 35207974, { 1, 3 }, false }, { 35256892, { 3, 7 }, true }, { 35351148, { 3, 7 }, false },
+  { 35531727, { 2, 4 }, true }, { 35531988, { 2, 4 }, false }, { 35532446, { 2, 4 }, true }, { 35600991, { 2, 4 }, false },
+  { 35795596, { 1, 9 }, true }, { 35876192, { 1, 9 }, false }, { 36027666, { 3, 7 }, true }, { 36129107, { 3, 7 }, false },
+  { 36256366, { 3, 3 }, true }, { 36347091, { 3, 3 }, false }, { 36422088, { 1, 3 }, true }, { 36527014, { 1, 3 }, false },
+  { 36527529, { 1, 3 }, true }, { 36527622, { 1, 3 }, false }, { 36581851, { 1, 3 }, true }, { 36696433, { 1, 3 }, false },
+  { 36805735, { 4, 5 }, true }, { 36889027, { 4, 5 }, false }, { 36930606, { 1, 1 }, true }, { 37013489, { 1, 1 }, false },
+  { 37201594, { 3, 4 }, true }, { 37312725, { 3, 4 }, false }, { 37381053, { 1, 1 }, true }, { 37459487, { 1, 1 }, false },
+  { 37622208, { 3, 7 }, true }, { 37622469, { 3, 7 }, false }, { 37622797, { 3, 7 }, true }, { 37622991, { 3, 7 }, false },
+  { 37623126, { 3, 7 }, true }, { 37623362, { 3, 7 }, false }, { 37623527, { 3, 7 }, true }, { 37713612, { 3, 7 }, false },
+  { 37747689, { 1, 5 }, true }, { 37835515, { 1, 5 }, false }, { 38011278, { 4, 5 }, true }, { 38099711, { 4, 5 }, false },
+  { 38271833, { 2, 1 }, true }, { 38272054, { 2, 1 }, false }, { 38272207, { 2, 1 }, true }, { 38272320, { 2, 1 }, false },
+  { 38272531, { 2, 1 }, true }, { 38348755, { 2, 1 }, false }, { 38475839, { 1, 7 }, true }, { 38542851, { 1, 7 }, false },
+  { 38596110, { 1, 3 }, true }, { 38681408, { 1, 3 }, false }, { 38804081, { 4, 5 }, true }, { 38911036, { 4, 5 }, false },
+  { 38962179, { 2, 9 }, true }, { 39027471, { 2, 9 }, false }, { 39160008, { 1, 1 }, true }, { 39236374, { 1, 1 }, false },
+  { 39294573, { 4, 5 }, true }, { 39379314, { 4, 5 }, false }, { 39415346, { 1, 10 }, true }, { 39531372, { 1, 10 }, false },
+  { 39659140, { 1, 4 }, true }, { 39722799, { 1, 4 }, false }, { 39803719, { 1, 3 }, true }, { 39870104, { 1, 3 }, false },
+  { 39870270, { 1, 3 }, true }, { 39870531, { 1, 3 }, false }, { 39870717, { 1, 3 }, true }, { 39870949, { 1, 3 }, false },
+  { 40016294, { 3, 3 }, true }, { 40087747, { 3, 3 }, false }, { 40262344, { 1, 3 }, true }, { 40332781, { 1, 3 }, false },
+  { 40525700, { 2, 3 }, true }, { 40618501, { 2, 3 }, false }, { 40714198, { 1, 3 }, true }, { 40714359, { 1, 3 }, false },
+  { 40714456, { 1, 3 }, true }, { 40783509, { 1, 3 }, false }, { 40909986, { 3, 7 }, true }, { 41014212, { 3, 7 }, false },
+  { 41037340, { 1, 5 }, true }, { 41151290, { 1, 5 }, false }, { 41269847, { 1, 3 }, true }, { 41334280, { 1, 3 }, false },
+  { 41442732, { 4, 5 }, true }, { 41557634, { 4, 5 }, false }, { 41603918, { 2, 2 }, true }, { 41703225, { 2, 2 }, false },
+  { 41739380, { 1, 9 }, true }, { 41850677, { 1, 9 }, false }, { 41883893, { 1, 8 }, true }, { 41974398, { 1, 8 }, false },
+  { 42099533, { 1, 5 }, true }, { 42181609, { 1, 5 }, false }, { 42366279, { 4, 5 }, true }, { 42450469, { 4, 5 }, false },
+  { 42542827, { 1, 4 }, true }, { 42543038, { 1, 4 }, false }, { 42543283, { 1, 4 }, true }, { 42543553, { 1, 4 }, false },
+  { 42543652, { 1, 4 }, true }, { 42543842, { 1, 4 }, false }, { 42544144, { 1, 4 }, true }, { 42649528, { 1, 4 }, false },
+  { 42716205, { 1, 3 }, true }, { 42716501, { 1, 3 }, false }, { 42716877, { 1, 3 }, true }, { 42807415, { 1, 3 }, false },
+  { 42861829, { 2, 9 }, true }, { 42969105, { 2, 9 }, false }, { 43097622, { 1, 1 }, true }, { 43180481, { 1, 1 }, false },
+  { 43331389, { 3, 3 }, true }, { 43414947, { 3, 3 }, false }, { 43532629, { 2, 6 }, true }, { 43638508, { 2, 6 }, false },
+  { 43638582, { 2, 6 }, true }, { 43638643, { 2, 6 }, false }, { 43638705, { 2, 6 }, true }, { 43638796, { 2, 6 }, false },
+  { 43755973, { 1, 3 }, true }, { 43870008, { 1, 3 }, false }, { 43885837, { 1, 3 }, true }, { 43885908, { 1, 3 }, false },
+  { 43886122, { 1, 3 }, true }, { 43886259, { 1, 3 }, false }, { 43886316, { 1, 3 }, true }, { 43886411, { 1, 3 }, false },
+  { 43886560, { 1, 3 }, true }, { 43968459, { 1, 3 }, false }, { 43968769, { 1, 3 }, true }, { 43968892, { 1, 3 }, false },
+  { 43969149, { 1, 3 }, true }, { 43969417, { 1, 3 }, false }, { 44138995, { 3, 8 }, true }, { 44235747, { 3, 8 }, false },
+  { 44235825, { 3, 8 }, true }, { 44236015, { 3, 8 }, false }, { 44269933, { 4, 6 }, true }, { 44353403, { 4, 6 }, false },
+  { 44459958, { 4, 4 }, true }, { 44490640, { 1, 3 }, true }, { 44594907, { 1, 3 }, false }, { 44632225, { 4, 4 }, false },
+  { 44766571, { 2, 2 }, true }, { 44873999, { 2, 2 }, false }, { 44886797, { 1, 5 }, true }, { 44955038, { 1, 5 }, false },
+  { 45087145, { 4, 5 }, true }, { 45131809, { 1, 10 }, true }, { 45216735, { 1, 10 }, false }, { 45237958, { 4, 5 }, false },
+  { 45336506, { 3, 3 }, true }, { 45336897, { 3, 3 }, false }, { 45337004, { 3, 3 }, true }, { 45337198, { 3, 3 }, false },
+  { 45337563, { 3, 3 }, true }, { 45337681, { 3, 3 }, false }, { 45337908, { 3, 3 }, true }, { 45419737, { 3, 3 }, false },
+  { 45526058, { 1, 3 }, true }, { 45601018, { 1, 3 }, false }, { 45701243, { 4, 5 }, true }, { 45790889, { 4, 5 }, false },
+  { 45876478, { 2, 1 }, true }, { 45988887, { 2, 1 }, false }, { 46040400, { 1, 7 }, true }, { 46118269, { 1, 7 }, false },
+  { 46168740, { 1, 3 }, true }, { 46257363, { 1, 3 }, false }, { 46411455, { 4, 5 }, true }, { 46487526, { 4, 5 }, false },
+  { 46690056, { 2, 9 }, true }, { 46781922, { 2, 9 }, false }, { 46846956, { 1, 3 }, true }, { 46951481, { 1, 3 }, false },
+  { 47084571, { 4, 5 }, true }, { 47193177, { 4, 5 }, false }, { 47352505, { 3, 3 }, true }, { 47444583, { 3, 3 }, false },
+  { 47444775, { 3, 3 }, true }, { 47445353, { 3, 3 }, false }, { 47445586, { 3, 3 }, true }, { 47445967, { 3, 3 }, false },
+  { 47589667, { 2, 9 }, true }, { 47704348, { 2, 9 }, false }, { 47816390, { 1, 1 }, true }, { 47900259, { 1, 1 }, false },
+  { 48003258, { 3, 4 }, true }, { 48115919, { 3, 4 }, false }, { 48248885, { 1, 8 }, true }, { 48344573, { 1, 8 }, false },
+  { 48436783, { 1, 3 }, true }, { 48437012, { 1, 3 }, false }, { 48437087, { 1, 3 }, true }, { 48437313, { 1, 3 }, false },
+  { 48437382, { 1, 3 }, true }, { 48437553, { 1, 3 }, false }, { 48437753, { 1, 3 }, true }, { 48538530, { 1, 3 }, false },
+  { 48684863, { 1, 4 }, true }, { 48800939, { 1, 4 }, false }, { 48801296, { 1, 4 }, true }, { 48802111, { 1, 4 }, false },
+  { 48884141, { 4, 5 }, true }, { 48967124, { 4, 5 }, false }, { 49031959, { 1, 5 }, true }, { 49120102, { 1, 5 }, false },
+  { 49120219, { 1, 5 }, true }, { 49120277, { 1, 5 }, false }, { 49120338, { 1, 5 }, true }, { 49120412, { 1, 5 }, false },
+  { 49120475, { 1, 5 }, true }, { 49120572, { 1, 5 }, false }, { 49235116, { 1, 8 }, true }, { 49349802, { 1, 8 }, false },
+  { 49469679, { 1, 3 }, true }, { 49543445, { 1, 3 }, false }, { 49732644, { 3, 7 }, true }, { 49822198, { 3, 7 }, false },
+  { 49822445, { 3, 7 }, true }, { 49822526, { 3, 7 }, false }, { 49822856, { 3, 7 }, true }, { 49823187, { 3, 7 }, false },
+  { 49823512, { 3, 7 }, true }, { 49823678, { 3, 7 }, false }, { 49968345, { 1, 5 }, true }, { 50039369, { 1, 5 }, false },
+  { 50135949, { 4, 5 }, true }, { 50205550, { 4, 5 }, false }, { 50358234, { 4, 5 }, true }, { 50390984, { 3, 7 }, true },
+  { 50460163, { 3, 7 }, false }, { 50476319, { 4, 5 }, false }, { 50493281, { 4, 5 }, true }, { 50515805, { 3, 8 }, true },
+  { 50613159, { 3, 8 }, false }, { 50613246, { 3, 8 }, true }, { 50613365, { 3, 8 }, false }, { 50613475, { 3, 8 }, true },
+  { 50613604, { 3, 8 }, false }, { 50687761, { 4, 7 }, true }, { 50786537, { 4, 7 }, false }, { 50800571, { 4, 5 }, false },
+  { 50928630, { 4, 5 }, true }, { 51025227, { 4, 5 }, false }, { 51187762, { 2, 10 }, true }, { 51272708, { 2, 10 }, false },
+  { 51357713, { 1, 9 }, true }, { 51424838, { 1, 9 }, false }, { 51485832, { 1, 5 }, true }, { 51590458, { 1, 5 }, false },
+  { 51756685, { 2, 2 }, true }, { 51865225, { 2, 2 }, false }, { 52016052, { 4, 5 }, true }, { 52087060, { 4, 5 }, false },
+  { 52234231, { 1, 10 }, true }, { 52317286, { 1, 10 }, false }, { 52400350, { 1, 1 }, true }, { 52483761, { 1, 1 }, false },
+  { 52581669, { 1, 4 }, true }, { 52688637, { 1, 4 }, false }, { 52688791, { 1, 4 }, true }, { 52688989, { 1, 4 }, false },
+  { 52689147, { 1, 4 }, true }, { 52689424, { 1, 4 }, false }, { 52689704, { 1, 4 }, true }, { 52690030, { 1, 4 }, false },
+  { 52806492, { 4, 5 }, true }, { 52917311, { 4, 5 }, false }, { 52959464, { 2, 10 }, true }, { 53042499, { 2, 10 }, false },
+  { 53129522, { 1, 8 }, true }, { 53228277, { 1, 8 }, false }, { 53342698, { 3, 7 }, true }, { 53422651, { 3, 7 }, false },
+  { 53541069, { 1, 7 }, true }, { 53610557, { 1, 7 }, false }, { 53725995, { 1, 5 }, true }, { 53816539, { 1, 5 }, false },
+  { 53980597, { 1, 3 }, true }, { 54052274, { 1, 3 }, false }, { 54193325, { 4, 5 }, true }, { 54282956, { 4, 4 }, true },
+  { 54283328, { 4, 5 }, false }, { 54314023, { 3, 9 }, true }, { 54385713, { 3, 9 }, false }, { 54414886, { 4, 4 }, false },
+  { 54553127, { 4, 5 }, true }, { 54644944, { 4, 5 }, false }, { 54660846, { 4, 4 }, true }, { 54709651, { 1, 3 }, true },
+  { 54824624, { 1, 3 }, false }, { 54858857, { 4, 4 }, false }, { 54967498, { 1, 5 }, true }, { 55065897, { 1, 5 }, false },
+  { 55193952, { 4, 5 }, true }, { 55284883, { 4, 5 }, false }, { 55377634, { 4, 5 }, true }, { 55418184, { 3, 8 }, true },
+  { 55509586, { 3, 8 }, false }, { 55523698, { 4, 5 }, false }, { 55543735, { 4, 5 }, true }, { 55579701, { 4, 7 }, true },
+  { 55695061, { 4, 7 }, false }, { 55733171, { 4, 5 }, false }, { 55748642, { 4, 5 }, true }, { 55802151, { 4, 7 }, true },
+  { 55891042, { 4, 7 }, false }, { 55917211, { 4, 5 }, false }, { 55989076, { 4, 5 }, true }, { 56100627, { 4, 5 }, false },
+  { 56188706, { 4, 4 }, true }, { 56251778, { 3, 8 }, true }, { 56353395, { 3, 8 }, false }, { 56376989, { 4, 4 }, false },
+  { 56497549, { 4, 5 }, true }, { 56579902, { 4, 5 }, false }, { 56700615, { 4, 4 }, true }, { 56758457, { 2, 9 }, true },
+  { 56859311, { 2, 9 }, false }, { 56882017, { 4, 4 }, false }, { 56893169, { 1, 3 }, true }, { 56964692, { 1, 3 }, false },
+  { 57104221, { 2, 2 }, true }, { 57214822, { 2, 2 }, false }, { 57259484, { 4, 5 }, true }, { 57345181, { 4, 5 }, false },
+  { 57494716, { 3, 3 }, true }, { 57587848, { 3, 3 }, false }, { 57727488, { 1, 9 }, true }, { 57800560, { 1, 9 }, false },
+  { 57887893, { 3, 7 }, true }, { 57966824, { 3, 7 }, false }, { 58118087, { 1, 5 }, true }, { 58203175, { 1, 5 }, false },
+  { 58354410, { 1, 1 }, true }, { 58446291, { 1, 1 }, false }, { 58599379, { 3, 3 }, true }, { 58600040, { 3, 3 }, false },
+  { 58600140, { 3, 3 }, true }, { 58675016, { 3, 3 }, false }, { 58728423, { 1, 5 }, true }, { 58842163, { 1, 5 }, false },
+  { 58842285, { 1, 5 }, true }, { 58842410, { 1, 5 }, false }, { 58842545, { 1, 5 }, true }, { 58842626, { 1, 5 }, false },
+  { 58953736, { 2, 2 }, true }, { 59051400, { 2, 2 }, false }, { 59124235, { 4, 5 }, true }, { 59212134, { 4, 5 }, false },
+  { 59307834, { 1, 4 }, true }, { 59376652, { 1, 4 }, false }, { 59550384, { 1, 3 }, true }, { 59634313, { 1, 3 }, false },
+  { 59813907, { 3, 5 }, true }, { 59905212, { 3, 5 }, false },
+};
+
+static const uint16_t s_corpus60Typed[] = {
+  0x020F, 0x0008, 0x002C, 0x0006, 0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0008,
+  0x0016, 0x0017, 0x002C, 0x0018, 0x0011, 0x002C, 0x0012, 0x0018, 0x0017, 0x000C, 0x000F, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0021, 0x0012, 0x0011, 0x002C, 0x0018, 0x0017, 0x000C,
+  0x000F, 0x000C, 0x0016, 0x0008, 0x002C, 0x0017, 0x0012, 0x0018, 0x0017, 0x0008, 0x002C, 0x000F,
+  0x0014, 0x002C, 0x000D, 0x0012, 0x0018, 0x0015, 0x0011, 0x0008, 0x0008, 0x0010, 0x002C, 0x000C,
+  0x000F, 0x002C, 0x0007, 0x0012, 0x000C, 0x0017, 0x002C, 0x0016, 0x0018, 0x000C, 0x0019, 0x0015,
+  0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0009, 0x0015, 0x0014, 0x0013, 0x0013, 0x0008, 0x002C,
+  0x0016, 0x0014, 0x0011, 0x0016, 0x002C, 0x0013, 0x0008, 0x0015, 0x0007, 0x0015, 0x0008, 0x002C,
+  0x0018, 0x0011, 0x0008, 0x002C, 0x0016, 0x0008, 0x0018, 0x000F, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x0236, 0x0028, 0x0204, 0x0018, 0x0014, 0x0011, 0x0007, 0x002C,
+  0x0012, 0x0011, 0x002C, 0x0017, 0x0014, 0x0013, 0x0008, 0x002C, 0x0019, 0x000C, 0x0017, 0x0008,
+  0x0010, 0x002C, 0x000F, 0x0008, 0x0016, 0x002C, 0x0007, 0x0012, 0x000C, 0x000A, 0x0017, 0x0016,
+  0x002C, 0x0016, 0x0008, 0x002C, 0x0006, 0x000B, 0x0008, 0x0019, 0x0014, 0x0018, 0x0006, 0x000B,
+  0x0008, 0x0011, 0x0017, 0x002C, 0x0037, 0x002C, 0x0018, 0x0011, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x002C, 0x0008, 0x0016, 0x0017, 0x002C, 0x0008, 0x0011, 0x0009,
+  0x0012, 0x0011, 0x0006, 0x0008, 0x0008, 0x002C, 0x0014, 0x0019, 0x0014, 0x0011, 0x0017, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0013, 0x0015, 0x0008, 0x0006, 0x0008,
+  0x0007, 0x0008, 0x0011, 0x0017, 0x0008, 0x002C, 0x0016, 0x0012, 0x000C, 0x0017, 0x002C, 0x0015,
+  0x0008, 0x000F, 0x0014, 0x0006, 0x000B, 0x0008, 0x0008, 0x0236, 0x0028, 0x0208, 0x0016, 0x0017,
+  0x0056, 0x0006, 0x0008, 0x002C, 0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0008, 0x002C, 0x0006,
+  0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0017, 0x000C, 0x0008, 0x0011, 0x0017,
+  0x002C, 0x0059, 0x005A, 0x0062, 0x002C, 0x0033, 0x0012, 0x0017, 0x0016, 0x002C, 0x0013, 0x0014,
+  0x0015, 0x002C, 0x0033, 0x000C, 0x0011, 0x0018, 0x0017, 0x0008, 0x002C, 0x0210, 0x002C, 0x0208,
+  0x0017, 0x002C, 0x005A, 0x0062, 0x0062, 0x002C, 0x0038, 0x002C, 0x020F, 0x0008, 0x0016, 0x002C,
+  0x0006, 0x0012, 0x0011, 0x0017, 0x0014, 0x0006, 0x0017, 0x0016, 0x002C, 0x0015, 0x0008, 0x0005,
+};
+
+static const TraceEdge s_corpus100[] = {
+  { 0, { 4, 4 }, true }, { 65988, { 2, 9 }, true }, { 66088, { 2, 9 }, false }, { 66304, { 2, 9 }, true },
+  { 66357, { 2, 9 }, false }, { 66587, { 2, 9 }, true }, { 66667, { 2, 9 }, false }, { 66927, { 2, 9 }, true },
+  { 150222, { 2, 9 }, false }, { 180209, { 4, 4 }, false }, { 199451, { 1, 3 }, true }, { 301607, { 1, 3 }, false },
+  { 338239, { 4, 5 }, true }, { 431143, { 4, 5 }, false }, { 459955, { 3, 3 }, true }, { 534722, { 3, 3 }, false },
+  { 565077, { 2, 9 }, true }, { 677850, { 2, 9 }, false }, { 718856, { 1, 1 }, true }, { 801644, { 1, 1 }, false },
+  { 871913, { 3, 4 }, true }, { 948026, { 3, 4 }, false }, { 1013213, { 1, 8 }, true }, { 1078207, { 1, 8 }, false },
+  { 1157882, { 1, 3 }, true }, { 1249840, { 1, 3 }, false }, { 1276990, { 1, 4 }, true }, { 1392351, { 1, 4 }, false },
+  { 1396308, { 4, 5 }, true }, { 1470945, { 1, 3 }, true }, { 1471012, { 1, 3 }, false }, { 1471096, { 1, 3 }, true },
+  { 1471158, { 1, 3 }, false }, { 1471212, { 1, 3 }, true }, { 1471306, { 1, 3 }, false }, { 1471394, { 1, 3 }, true },
+  { 1509028, { 4, 5 }, false }, { 1586649, { 1, 3 }, false }, { 1634602, { 2, 2 }, true }, { 1726438, { 1, 5 }, true },
+  { 1742032, { 2, 2 }, false }, { 1812975, { 1, 5 }, false }, { 1874437, { 4, 5 }, true }, { 1985491, { 4, 5 }, false },
+  { 1986419, { 1, 7 }, true }, { 2059659, { 3, 7 }, true }, { 2070965, { 1, 7 }, false }, { 2175373, { 3, 7 }, false },
+  { 2220532, { 4, 5 }, true }, { 2311138, { 1, 9 }, true }, { 2328464, { 4, 5 }, false }, { 2328720, { 4, 5 }, true },
+  { 2329122, { 4, 5 }, false }, { 2329384, { 4, 5 }, true }, { 2329607, { 4, 5 }, false }, { 2329878, { 4, 5 }, true },
+  { 2330271, { 4, 5 }, false }, { 2383918, { 1, 7 }, true }, { 2386380, { 1, 9 }, false }, { 2466501, { 1, 7 }, false },
+  { 2537825, { 1, 5 }, true }, { 2622215, { 1, 8 }, true }, { 2640733, { 1, 5 }, false }, { 2723039, { 2, 9 }, true },
+  { 2727288, { 1, 8 }, false }, { 2818073, { 2, 9 }, false }, { 2888696, { 4, 5 }, true }, { 2991226, { 4, 5 }, false },
+  { 3052760, { 2, 1 }, true }, { 3152389, { 2, 1 }, false }, { 3194586, { 1, 7 }, true }, { 3273543, { 1, 7 }, false },
+  { 3359631, { 1, 3 }, true }, { 3442750, { 1, 3 }, false }, { 3460566, { 4, 5 }, true }, { 3560898, { 4, 5 }, false },
+  { 3582290, { 2, 9 }, true }, { 3665418, { 2, 9 }, false }, { 3676434, { 4, 5 }, true }, { 3702982, { 1, 5 }, true },
+  { 3771585, { 1, 5 }, false }, { 3794444, { 4, 5 }, false }, { 3816841, { 1, 9 }, true }, { 3884522, { 1, 9 }, false },
+  { 3889914, { 3, 7 }, true }, { 3969773, { 3, 7 }, false }, { 3973223, { 4, 5 }, true }, { 4082541, { 4, 5 }, false },
+  { 4096553, { 1, 7 }, true }, { 4161453, { 1, 7 }, false }, { 4249178, { 1, 5 }, true }, { 4313184, { 1, 5 }, false },
+  { 4361668, { 1, 8 }, true }, { 4435615, { 1, 8 }, false }, { 4527680, { 2, 9 }, true }, { 4604620, { 2, 9 }, false },
+  { 4676737, { 1, 8 }, true }, { 4772078, { 1, 8 }, false }, { 4820340, { 2, 2 }, true }, { 4907574, { 2, 2 }, false },
+  { 4951090, { 1, 3 }, true }, { 5017391, { 1, 3 }, false }, { 5056373, { 4, 5 }, true }, { 5123201, { 4, 5 }, false },
+  { 5220325, { 1, 5 }, true }, { 5300544, { 1, 9 }, true }, { 5315659, { 1, 5 }, false }, { 5374649, { 1, 7 }, true },
+  { 5406709, { 1, 9 }, false }, { 5462999, { 1, 5 }, true }, { 5466119, { 1, 7 }, false }, { 5550373, { 1, 5 }, false },
+  { 5594658, { 1, 3 }, true }, { 5687820, { 1, 3 }, false }, { 5740416, { 4, 5 }, true }, { 5844019, { 4, 5 }, false },
+  { 5844624, { 4, 5 }, true }, { 5845242, { 4, 5 }, false }, { 5845683, { 4, 5 }, true }, { 5846315, { 4, 5 }, false },
+  { 5860722, { 2, 9 }, true }, { 5969318, { 2, 9 }, false }, { 5990926, { 1, 1 }, true }, { 6086818, { 1, 1 }, false },
+  { 6136457, { 4, 5 }, true }, { 6213565, { 4, 5 }, false }, { 6245053, { 2, 7 }, true }, { 6334318, { 1, 9 }, true },
+  { 6348485, { 2, 7 }, false }, { 6441381, { 1, 7 }, true }, { 6443176, { 1, 9 }, false }, { 6516644, { 1, 4 }, true },
+  { 6546638, { 1, 7 }, false }, { 6632933, { 1, 4 }, false }, { 6671323, { 3, 7 }, true }, { 6781699, { 3, 7 }, false },
+  { 6792682, { 1, 3 }, true }, { 6886383, { 1, 3 }, false }, { 6901211, { 1, 3 }, true }, { 6968319, { 1, 3 }, false },
+  { 7049647, { 3, 9 }, true }, { 7143242, { 3, 9 }, false }, { 7201650, { 4, 5 }, true }, { 7284821, { 4, 5 }, false },
+  { 7341292, { 1, 8 }, true }, { 7417365, { 2, 9 }, true }, { 7430181, { 1, 8 }, false }, { 7489406, { 4, 5 }, true },
+  { 7510619, { 2, 9 }, false }, { 7578428, { 2, 3 }, true }, { 7583247, { 4, 5 }, false }, { 7682163, { 2, 3 }, false },
+  { 7699136, { 1, 9 }, true }, { 7815618, { 1, 9 }, false }, { 7848823, { 1, 8 }, true }, { 7923786, { 1, 8 }, false },
+  { 8003537, { 1, 5 }, true }, { 8079067, { 1, 5 }, false }, { 8166143, { 4, 5 }, true }, { 8274201, { 4, 5 }, false },
+  { 8284392, { 2, 2 }, true }, { 8371637, { 2, 2 }, false }, { 8429149, { 1, 7 }, true }, { 8514352, { 1, 7 }, false },
+  { 8537129, { 1, 8 }, true }, { 8612365, { 3, 4 }, true }, { 8620836, { 1, 8 }, false }, { 8721627, { 3, 4 }, false },
+  { 8737271, { 1, 4 }, true }, { 8810087, { 1, 4 }, false }, { 8810164, { 1, 4 }, true }, { 8810686, { 1, 4 }, false },
+  { 8872085, { 1, 3 }, true }, { 8950459, { 1, 3 }, false }, { 9010147, { 4, 5 }, true }, { 9010214, { 4, 5 }, false },
+  { 9010412, { 4, 5 }, true }, { 9010628, { 4, 5 }, false }, { 9010973, { 4, 5 }, true }, { 9011177, { 4, 5 }, false },
+  { 9011560, { 4, 5 }, true }, { 9091263, { 2, 9 }, true }, { 9101282, { 4, 5 }, false }, { 9172651, { 2, 9 }, false },
+  { 9251723, { 1, 1 }, true }, { 9361037, { 1, 1 }, false }, { 9382473, { 4, 5 }, true }, { 9484478, { 4, 5 }, false },
+  { 9513524, { 2, 4 }, true }, { 9588850, { 1, 4 }, true }, { 9611969, { 2, 4 }, false }, { 9698635, { 1, 4 }, false },
+  { 9720483, { 1, 1 }, true }, { 9819159, { 1, 1 }, false }, { 9880866, { 1, 10 }, true }, { 9957695, { 1, 10 }, false },
+  { 10026257, { 1, 10 }, true }, { 10102471, { 1, 10 }, false }, { 10102602, { 1, 10 }, true }, { 10102654, { 1, 10 }, false },
+  { 10171828, { 1, 3 }, true }, { 10253811, { 1, 3 }, false }, { 10291003, { 4, 5 }, true }, { 10387684, { 4, 5 }, false },
+  { 10440979, { 2, 2 }, true }, { 10556473, { 2, 2 }, false }, { 10573993, { 1, 1 }, true }, { 10647911, { 1, 1 }, false },
+  { 10707358, { 3, 7 }, true }, { 10816642, { 2, 2 }, true }, { 10822381, { 3, 7 }, false }, { 10905725, { 2, 2 }, false },
+  { 10921447, { 4, 5 }, true }, { 10985693, { 4, 5 }, false }, { 11033797, { 1, 10 }, true }, { 11033900, { 1, 10 }, false },
+  { 11033953, { 1, 10 }, true }, { 11034012, { 1, 10 }, false }, { 11034069, { 1, 10 }, true }, { 11110085, { 1, 3 }, true },
+  { 11130315, { 1, 10 }, false }, { 11195021, { 1, 3 }, false }, { 11229771, { 1, 4 }, true }, { 11339882, { 1, 4 }, false },
+  { 11345923, { 2, 3 }, true }, { 11346058, { 2, 3 }, false }, { 11346263, { 2, 3 }, true }, { 11413913, { 2, 3 }, false },
+  { 11465655, { 1, 4 }, true }, { 11530938, { 1, 4 }, false }, { 11578662, { 1, 3 }, true }, { 11670020, { 1, 3 }, false },
+  { 11670165, { 1, 3 }, true }, { 11670324, { 1, 3 }, false }, { 11717464, { 4, 5 }, true }, { 11828376, { 4, 5 }, false },
+  { 11882242, { 1, 7 }, true }, { 11952311, { 1, 7 }, false }, { 11982178, { 3, 7 }, true }, { 12062374, { 3, 7 }, false },
+  { 12080291, { 1, 3 }, true }, { 12190636, { 1, 3 }, false }, { 12216315, { 4, 5 }, true }, { 12302064, { 4, 5 }, false },
+  { 12348434, { 2, 2 }, true }, { 12436314, { 2, 2 }, false }, { 12514061, { 1, 3 }, true }, { 12601317, { 1, 3 }, false },
+  { 12615166, { 1, 7 }, true }, { 12697057, { 1, 7 }, false }, { 12762103, { 2, 9 }, true }, { 12836585, { 2, 9 }, false },
+  { 12836681, { 2, 9 }, true }, { 12836884, { 2, 9 }, false }, { 12837081, { 2, 9 }, true }, { 12837475, { 2, 9 }, false },
+  { 12903492, { 1, 3 }, true }, { 12972767, { 1, 3 }, false }, { 13052324, { 4, 5 }, true }, { 13123814, { 4, 5 }, false },
+  { 13133495, { 1, 5 }, true }, { 13134042, { 1, 5 }, false }, { 13134730, { 1, 5 }, true }, { 13234766, { 1, 5 }, false },
+  { 13267623, { 1, 9 }, true }, { 13370544, { 1, 9 }, false }, { 13394864, { 1, 7 }, true }, { 13482733, { 1, 7 }, false },
+  { 13508221, { 3, 3 }, true }, { 13609667, { 2, 6 }, true }, { 13624539, { 3, 3 }, false }, { 13691918, { 2, 6 }, false },
+  { 13733614, { 1, 3 }, true }, { 13805777, { 3, 8 }, true }, { 13829922, { 1, 3 }, false }, { 13885847, { 4, 6 }, true },
+  { 13899499, { 3, 8 }, false }, { 13913565, { 4, 4 }, true }, { 13960122, { 4, 6 }, false }, { 13973027, { 2, 1 }, true },
+  { 14037479, { 4, 4 }, false }, { 14047479, { 1, 7 }, true }, { 14086756, { 2, 1 }, false }, { 14143306, { 1, 7 }, false },
+  { 14150555, { 1, 1 }, true }, { 14216636, { 1, 1 }, false }, { 14257799, { 3, 7 }, true }, { 14331705, { 3, 7 }, false },
+  { 14348596, { 2, 3 }, true }, { 14415953, { 2, 3 }, false }, { 14422099, { 4, 5 }, true }, { 14507919, { 4, 5 }, false },
+  { 14538413, { 1, 9 }, true }, { 14650899, { 1, 9 }, false }, { 14699146, { 3, 7 }, true }, { 14800994, { 3, 7 }, false },
+  { 14843144, { 4, 5 }, true }, { 14910310, { 4, 5 }, false }, { 14960510, { 1, 5 }, true }, { 15044218, { 1, 5 }, false },
+  { 15108934, { 1, 1 }, true }, { 15190464, { 1, 1 }, false }, { 15213605, { 1, 10 }, true }, { 15213688, { 1, 10 }, false },
+  { 15213778, { 1, 10 }, true }, { 15213865, { 1, 10 }, false }, { 15213916, { 1, 10 }, true }, { 15213967, { 1, 10 }, false },
+  { 15214048, { 1, 10 }, true }, { 15309449, { 1, 10 }, false }, { 15311959, { 1, 3 }, true }, { 15384393, { 1, 3 }, false },
+  { 15454291, { 4, 5 }, true }, { 15537430, { 4, 5 }, false }, { 15576644, { 3, 4 }, true }, { 15653427, { 1, 8 }, true },
+  { 15674696, { 3, 4 }, false }, { 15741718, { 1, 8 }, false }, { 15768694, { 1, 5 }, true }, { 15872279, { 1, 5 }, false },
+  { 15891611, { 1, 3 }, true }, { 15967339, { 3, 9 }, true }, { 15967444, { 3, 9 }, false }, { 15967561, { 3, 9 }, true },
+  { 16001702, { 1, 3 }, false }, { 16031416, { 3, 9 }, false }, { 16071484, { 4, 5 }, true }, { 16071818, { 4, 5 }, false },
+  { 16072267, { 4, 5 }, true }, { 16144515, { 2, 9 }, true }, { 16186736, { 4, 5 }, false }, { 16207866, { 2, 9 }, false },
+  { 16207922, { 2, 9 }, true }, { 16208079, { 2, 9 }, false }, { 16208344, { 2, 9 }, true }, { 16208531, { 2, 9 }, false },
+  { 16208673, { 2, 9 }, true }, { 16208730, { 2, 9 }, false }, { 16246636, { 1, 3 }, true }, { 16314317, { 1, 3 }, false },
+  { 16355912, { 2, 2 }, true }, { 16428527, { 4, 5 }, true }, { 16448409, { 2, 2 }, false }, { 16527279, { 4, 5 }, false },
+  { 16559686, { 2, 3 }, true }, { 16653285, { 2, 3 }, false }, { 16664238, { 1, 9 }, true }, { 16736837, { 1, 8 }, true },
+  { 16758044, { 1, 9 }, false }, { 16804560, { 1, 8 }, false }, { 16898083, { 2, 5 }, true }, { 16975741, { 2, 5 }, false },
+  { 16994508, { 1, 5 }, true }, { 17094335, { 1, 5 }, false }, { 17141460, { 2, 2 }, true }, { 17235013, { 2, 2 }, false },
+  { 17264164, { 4, 5 }, true }, { 17357772, { 2, 2 }, true }, { 17365371, { 4, 5 }, false }, { 17443718, { 1, 3 }, true },
+  { 17459767, { 2, 2 }, false }, { 17524817, { 1, 3 }, false }, { 17535125, { 4, 5 }, true }, { 17623424, { 3, 3 }, true },
+  { 17634658, { 4, 5 }, false }, { 17634955, { 4, 5 }, true }, { 17635363, { 4, 5 }, false }, { 17635772, { 4, 5 }, true },
+  { 17635851, { 4, 5 }, false }, { 17636030, { 4, 5 }, true }, { 17636084, { 4, 5 }, false }, { 17705682, { 3, 3 }, false },
+  { 17719758, { 2, 6 }, true }, { 17783437, { 2, 6 }, false }, { 17878648, { 1, 3 }, true }, { 17966562, { 3, 4 }, true },
+  { 17987467, { 1, 3 }, false }, { 18060017, { 3, 4 }, false }, { 18065922, { 1, 1 }, true }, { 18149011, { 1, 1 }, false },
+  { 18180317, { 1, 7 }, true }, { 18257736, { 1, 7 }, false }, { 18336665, { 3, 3 }, true }, { 18413174, { 2, 6 }, true },
+  { 18438341, { 3, 3 }, false }, { 18526971, { 2, 6 }, false }, { 18576564, { 1, 3 }, true }, { 18644154, { 1, 3 }, false },
+  { 18705623, { 3, 7 }, true }, { 18803892, { 3, 7 }, false }, { 18836131, { 1, 5 }, true }, { 18901097, { 1, 5 }, false },
+  { 18969118, { 4, 5 }, true }, { 19014954, { 4, 4 }, true }, { 19053791, { 4, 5 }, false }, { 19067795, { 3, 10 }, true },
+  { 19139421, { 3, 10 }, false }, { 19140081, { 4, 4 }, false }, { 19150081, { 4, 5 }, true }, { 19254249, { 4, 5 }, false },
+  { 19263315, { 1, 7 }, true }, { 19351756, { 1, 7 }, false }, { 19379543, { 3, 7 }, true }, { 19488156, { 3, 7 }, false },
+  { 19488243, { 3, 7 }, true }, { 19488312, { 3, 7 }, false }, { 19488402, { 3, 7 }, true }, { 19488503, { 3, 7 }, false },
+  { 19534006, { 1, 3 }, true }, { 19601210, { 1, 3 }, false }, { 19635331, { 4, 5 }, true }, { 19723075, { 4, 5 }, false },
+  { 19737504, { 1, 5 }, true }, { 19822003, { 1, 5 }, false }, { 19879790, { 1, 9 }, true }, { 19962854, { 1, 9 }, false },
+  { 19963938, { 1, 7 }, true }, { 20067376, { 1, 7 }, false }, { 20093963, { 3, 3 }, true }, { 20182150, { 3, 3 }, false },
+  { 20193692, { 2, 6 }, true }, { 20272667, { 2, 6 }, false }, { 20340636, { 1, 3 }, true }, { 20422132, { 1, 3 }, false },
+  { 20455530, { 4, 5 }, true }, { 20552062, { 4, 5 }, false }, { 20602956, { 1, 3 }, true }, { 20603060, { 1, 3 }, false },
+  { 20603173, { 1, 3 }, true }, { 20603239, { 1, 3 }, false }, { 20603363, { 1, 3 }, true }, { 20677163, { 1, 3 }, false },
+  { 20751956, { 2, 2 }, true }, { 20855564, { 1, 5 }, true }, { 20862392, { 2, 2 }, false }, { 20961076, { 1, 5 }, false },
+  { 20997158, { 4, 5 }, true }, { 20997436, { 4, 5 }, false }, { 20998169, { 4, 5 }, true }, { 21086199, { 4, 5 }, false },
+  { 21145331, { 1, 3 }, true }, { 21145491, { 1, 3 }, false }, { 21145625, { 1, 3 }, true }, { 21237846, { 3, 7 }, true },
+  { 21241141, { 1, 3 }, false }, { 21321981, { 3, 7 }, false }, { 21367332, { 2, 4 }, true }, { 21464699, { 2, 4 }, false },
+  { 21470927, { 1, 9 }, true }, { 21563775, { 1, 9 }, false }, { 21581465, { 3, 7 }, true }, { 21667665, { 3, 7 }, false },
+  { 21667840, { 3, 7 }, true }, { 21667937, { 3, 7 }, false }, { 21718311, { 3, 3 }, true }, { 21786278, { 3, 3 }, false },
+  { 21855442, { 1, 3 }, true }, { 21921849, { 1, 3 }, false }, { 21921963, { 1, 3 }, true }, { 21922159, { 1, 3 }, false },
+  { 21979694, { 1, 3 }, true }, { 22077870, { 1, 3 }, false }, { 22134731, { 4, 5 }, true }, { 22228814, { 4, 5 }, false },
+  { 22259747, { 1, 1 }, true }, { 22361648, { 1, 1 }, false }, { 22381269, { 3, 4 }, true }, { 22482001, { 3, 4 }, false },
+  { 22500078, { 1, 1 }, true }, { 22611200, { 1, 1 }, false }, { 22651970, { 3, 7 }, true }, { 22755384, { 3, 7 }, false },
+  { 22801520, { 1, 5 }, true }, { 22871361, { 1, 5 }, false }, { 22898099, { 4, 5 }, true }, { 22966168, { 4, 5 }, false },
+  { 22995106, { 2, 1 }, true }, { 23087255, { 1, 7 }, true }, { 23108438, { 2, 1 }, false }, { 23168050, { 1, 7 }, false },
+  { 23190175, { 1, 3 }, true }, { 23264412, { 1, 3 }, false }, { 23343241, { 4, 5 }, true }, { 23343733, { 4, 5 }, false },
+  { 23344604, { 4, 5 }, true }, { 23436411, { 4, 5 }, false }, { 23489288, { 2, 9 }, true }, { 23489521, { 2, 9 }, false },
+  { 23489621, { 2, 9 }, true }, { 23489774, { 2, 9 }, false }, { 23489996, { 2, 9 }, true }, { 23490234, { 2, 9 }, false },
+  { 23490520, { 2, 9 }, true }, { 23592668, { 1, 1 }, true }, { 23603836, { 2, 9 }, false }, { 23677436, { 1, 1 }, false },
+  { 23732967, { 4, 5 }, true }, { 23817893, { 1, 10 }, true }, { 23849517, { 4, 5 }, false }, { 23918029, { 1, 10 }, false },
+  { 23923846, { 1, 4 }, true }, { 23987075, { 1, 4 }, false }, { 23987570, { 1, 4 }, true }, { 23987951, { 1, 4 }, false },
+  { 23988022, { 1, 4 }, true }, { 23988350, { 1, 4 }, false }, { 23988541, { 1, 4 }, true }, { 23988886, { 1, 4 }, false },
+  { 24062135, { 1, 3 }, true }, { 24131339, { 1, 3 }, false }, { 24131421, { 1, 3 }, true }, { 24131514, { 1, 3 }, false },
+  { 24131631, { 1, 3 }, true }, { 24131700, { 1, 3 }, false }, { 24193207, { 3, 3 }, true }, { 24281209, { 3, 3 }, false },
+  { 24305902, { 1, 3 }, true }, { 24380206, { 2, 3 }, true }, { 24417801, { 1, 3 }, false }, { 24477073, { 2, 3 }, false },
+  { 24517632, { 1, 3 }, true }, { 24517713, { 1, 3 }, false }, { 24517786, { 1, 3 }, true }, { 24517862, { 1, 3 }, false },
+  { 24517919, { 1, 3 }, true }, { 24601180, { 1, 3 }, false }, { 24602245, { 3, 7 }, true }, { 24678420, { 3, 7 }, false },
+  { 24732048, { 1, 5 }, true }, { 24732686, { 1, 5 }, false }, { 24732909, { 1, 5 }, true }, { 24817339, { 1, 5 }, false },
+  { 24845459, { 1, 3 }, true }, { 24845574, { 1, 3 }, false }, { 24845639, { 1, 3 }, true }, { 24845730, { 1, 3 }, false },
+  { 24845781, { 1, 3 }, true }, { 24942369, { 4, 5 }, true }, { 24947804, { 1, 3 }, false }, { 25009079, { 4, 5 }, false },
+  { 25070001, { 2, 2 }, true }, { 25144711, { 1, 9 }, true }, { 25165766, { 2, 2 }, false }, { 25230304, { 1, 9 }, false },
+  { 25281119, { 1, 8 }, true }, { 25345518, { 1, 8 }, false }, { 25432152, { 1, 5 }, true }, { 25432847, { 1, 5 }, false },
+  { 25433452, { 1, 5 }, true }, { 25527530, { 4, 5 }, true }, { 25529587, { 1, 5 }, false }, { 25605263, { 4, 5 }, false },
+  { 25672630, { 1, 4 }, true }, { 25749853, { 1, 3 }, true }, { 25787600, { 1, 4 }, false }, { 25788228, { 1, 4 }, true },
+  { 25789554, { 1, 4 }, false }, { 25857360, { 1, 3 }, false }, { 25899324, { 2, 9 }, true }, { 25982948, { 2, 9 }, false },
+  { 25983381, { 2, 9 }, true }, { 25983944, { 2, 9 }, false }, { 26020433, { 1, 1 }, true }, { 26106007, { 3, 3 }, true },
+  { 26121485, { 1, 1 }, false }, { 26187055, { 3, 3 }, false }, { 26246243, { 2, 6 }, true }, { 26348610, { 2, 6 }, false },
+  { 26397177, { 1, 3 }, true }, { 26397251, { 1, 3 }, false }, { 26397320, { 1, 3 }, true }, { 26397420, { 1, 3 }, false },
+  { 26397504, { 1, 3 }, true }, { 26510287, { 1, 3 }, false }, { 26530982, { 1, 3 }, true }, { 26625849, { 1, 3 }, false },
+  { 26625926, { 1, 3 }, true }, { 26625988, { 1, 3 }, false }, { 26626098, { 1, 3 }, true }, { 26626219, { 1, 3 }, false },
+  { 26682423, { 3, 8 }, true }, { 26771742, { 3, 8 }, false }, { 26787341, { 4, 6 }, true }, { 26856609, { 4, 6 }, false },
+  { 26899670, { 4, 4 }, true }, { 26923165, { 1, 3 }, true }, { 27003452, { 1, 3 }, false }, { 27030133, { 4, 4 }, false },
+  { 27071288, { 2, 2 }, true }, { 27161546, { 1, 5 }, true }, { 27171514, { 2, 2 }, false }, { 27244555, { 4, 5 }, true },
+  { 27246444, { 1, 5 }, false }, { 27284889, { 1, 10 }, true }, { 27285065, { 1, 10 }, false }, { 27285144, { 1, 10 }, true },
+  { 27352617, { 4, 5 }, false }, { 27359243, { 1, 10 }, false }, { 27362617, { 3, 3 }, true }, { 27475156, { 3, 3 }, false },
+  { 27526290, { 1, 3 }, true }, { 27642724, { 1, 3 }, false }, { 27681820, { 4, 5 }, true }, { 27772673, { 4, 5 }, false },
+  { 27829627, { 2, 1 }, true }, { 27903405, { 2, 1 }, false }, { 27909179, { 1, 7 }, true }, { 27972759, { 1, 7 }, false },
+  { 27982334, { 1, 3 }, true }, { 28089273, { 1, 3 }, false }, { 28089384, { 1, 3 }, true }, { 28089567, { 1, 3 }, false },
+  { 28107585, { 4, 5 }, true }, { 28219438, { 4, 5 }, false }, { 28251196, { 2, 9 }, true }, { 28251435, { 2, 9 }, false },
+  { 28251562, { 2, 9 }, true }, { 28251691, { 2, 9 }, false }, { 28251960, { 2, 9 }, true }, { 28252083, { 2, 9 }, false },
+  { 28252313, { 2, 9 }, true }, { 28343382, { 2, 9 }, false }, { 28349770, { 1, 3 }, true }, { 28448596, { 1, 3 }, false },
+  { 28516067, { 4, 5 }, true }, { 28615254, { 4, 5 }, false }, { 28615332, { 4, 5 }, true }, { 28615576, { 4, 5 }, false },
+  { 28615900, { 4, 5 }, true }, { 28616486, { 4, 5 }, false }, { 28658916, { 3, 3 }, true }, { 28730663, { 3, 3 }, false },
+  { 28754317, { 2, 9 }, true }, { 28832289, { 1, 1 }, true }, { 28854842, { 2, 9 }, false }, { 28929093, { 1, 1 }, false },
+  { 28987437, { 3, 4 }, true }, { 29099520, { 3, 4 }, false }, { 29105875, { 1, 8 }, true }, { 29209084, { 1, 8 }, false },
+  { 29271838, { 1, 3 }, true }, { 29271890, { 1, 3 }, false }, { 29271968, { 1, 3 }, true }, { 29272020, { 1, 3 }, false },
+  { 29272113, { 1, 3 }, true }, { 29272165, { 1, 3 }, false }, { 29272254, { 1, 3 }, true }, { 29354993, { 1, 4 }, true },
+  { 29383477, { 1, 3 }, false }, { 29454944, { 1, 4 }, false }, { 29457918, { 4, 5 }, true }, { 29560483, { 1, 5 }, true },
+  { 29573187, { 4, 5 }, false }, { 29633536, { 1, 5 }, false }, { 29659800, { 1, 8 }, true }, { 29760835, { 1, 3 }, true },
+  { 29761505, { 1, 8 }, false }, { 29836645, { 3, 7 }, true }, { 29860205, { 1, 3 }, false }, { 29910893, { 3, 7 }, false },
+  { 29962658, { 1, 5 }, true }, { 30056703, { 1, 5 }, false }, { 30111755, { 4, 5 }, true }, { 30180840, { 4, 5 }, false },
+  { 30190840, { 4, 5 }, true }, { 30191139, { 4, 5 }, false }, { 30191311, { 4, 5 }, true }, { 30191535, { 4, 5 }, false },
+  { 30191866, { 4, 5 }, true }, { 30192128, { 4, 5 }, false }, { 30192564, { 4, 5 }, true }, { 30236998, { 3, 7 }, true },
+  { 30321618, { 3, 8 }, true }, { 30347238, { 3, 7 }, false }, { 30408815, { 3, 8 }, false }, { 30468025, { 4, 7 }, true },
+  { 30558816, { 4, 7 }, false }, { 30573253, { 4, 5 }, false }, { 30611518, { 4, 5 }, true }, { 30702583, { 4, 5 }, false },
+  { 30702779, { 4, 5 }, true }, { 30703342, { 4, 5 }, false }, { 30703404, { 4, 5 }, true }, { 30703757, { 4, 5 }, false },
+  { 30769824, { 2, 10 }, true }, { 30853963, { 1, 9 }, true }, { 30871288, { 2, 10 }, false }, { 30969847, { 1, 9 }, false },
+  { 31011529, { 1, 5 }, true }, { 31097168, { 1, 5 }, false }, { 31097268, { 1, 5 }, true }, { 31097395, { 1, 5 }, false },
+  { 31097618, { 1, 5 }, true }, { 31097778, { 1, 5 }, false }, { 31097955, { 1, 5 }, true }, { 31098107, { 1, 5 }, false },
+  { 31125791, { 2, 2 }, true }, { 31230967, { 2, 2 }, false }, { 31290458, { 4, 5 }, true }, { 31399494, { 4, 5 }, false },
+  { 31446210, { 1, 10 }, true }, { 31446273, { 1, 10 }, false }, { 31446367, { 1, 10 }, true }, { 31446465, { 1, 10 }, false },
+  { 31446543, { 1, 10 }, true }, { 31510333, { 1, 10 }, false }, { 31588637, { 1, 1 }, true }, { 31696122, { 1, 1 }, false },
+  { 31724542, { 1, 4 }, true }, { 31792890, { 1, 4 }, false }, { 31792984, { 1, 4 }, true }, { 31793477, { 1, 4 }, false },
+  { 31793701, { 1, 4 }, true }, { 31793948, { 1, 4 }, false }, { 31794205, { 1, 4 }, true }, { 31794362, { 1, 4 }, false },
+  { 31853456, { 4, 5 }, true }, { 31919074, { 4, 5 }, false }, { 31969229, { 2, 10 }, true }, { 32055195, { 1, 8 }, true },
+  { 32056873, { 2, 10 }, false }, { 32057007, { 2, 10 }, true }, { 32057742, { 2, 10 }, false }, { 32122900, { 1, 8 }, false },
+  { 32207592, { 3, 7 }, true }, { 32286789, { 3, 7 }, false }, { 32344823, { 1, 7 }, true }, { 32436786, { 1, 7 }, false },
+  { 32444784, { 1, 5 }, true }, { 32445104, { 1, 5 }, false }, { 32445319, { 1, 5 }, true }, { 32560544, { 1, 5 }, false },
+  { 32580377, { 1, 3 }, true }, { 32661456, { 1, 3 }, false }, { 32689612, { 4, 5 }, true }, { 32753752, { 4, 5 }, false },
+  { 32765587, { 4, 4 }, true }, { 32827616, { 3, 9 }, true }, { 32918986, { 3, 9 }, false }, { 32923718, { 4, 4 }, false },
+  { 32933718, { 4, 5 }, true }, { 32998571, { 4, 4 }, true }, { 33013063, { 4, 5 }, false }, { 33049231, { 1, 3 }, true },
+  { 33119892, { 4, 4 }, false }, { 33129892, { 1, 5 }, true }, { 33153408, { 1, 3 }, false }, { 33207591, { 1, 5 }, false },
+  { 33207934, { 1, 5 }, true }, { 33208500, { 1, 5 }, false }, { 33209769, { 4, 5 }, true }, { 33246411, { 4, 5 }, false },
+  { 33256411, { 4, 5 }, true }, { 33256746, { 4, 5 }, false }, { 33257191, { 4, 5 }, true }, { 33257341, { 4, 5 }, false },
+  { 33257729, { 4, 5 }, true }, { 33285429, { 3, 8 }, true }, { 33285497, { 3, 8 }, false }, { 33285560, { 3, 8 }, true },
+  { 33285681, { 3, 8 }, false }, { 33285799, { 3, 8 }, true }, { 33400261, { 3, 8 }, false }, { 33447751, { 4, 7 }, true },
+  { 33536731, { 4, 7 }, false }, { 33552034, { 4, 7 }, true }, { 33622015, { 4, 7 }, false }, { 33650661, { 4, 5 }, false },
+  { 33705968, { 4, 5 }, true }, { 33774815, { 4, 5 }, false }, { 33794513, { 4, 4 }, true }, { 33856206, { 3, 8 }, true },
+  { 33929543, { 4, 4 }, false }, { 33934783, { 3, 8 }, false }, { 33939543, { 4, 5 }, true }, { 34053591, { 4, 5 }, false },
+  { 34054282, { 4, 4 }, true }, { 34092144, { 2, 9 }, true }, { 34157135, { 2, 9 }, false }, { 34171920, { 4, 4 }, false },
+  { 34181920, { 1, 3 }, true }, { 34262034, { 1, 3 }, false }, { 34327949, { 2, 2 }, true }, { 34443451, { 2, 2 }, false },
+  { 34456513, { 4, 5 }, true }, { 34542619, { 4, 5 }, false }, { 34580196, { 3, 3 }, true }, { 34664379, { 3, 3 }, false },
+  { 34726701, { 1, 9 }, true }, { 34801027, { 1, 9 }, false }, { 34889933, { 3, 7 }, true }, { 34998830, { 3, 7 }, false },
+  { 35046836, { 1, 5 }, true }, { 35125055, { 1, 5 }, false }, { 35205626, { 1, 1 }, true }, { 35313044, { 3, 3 }, true },
+  { 35313366, { 3, 3 }, false }, { 35313448, { 3, 3 }, true }, { 35313699, { 3, 3 }, false }, { 35313821, { 3, 3 }, true },
+  { 35316584, { 1, 1 }, false }, { 35391265, { 1, 5 }, true }, { 35391506, { 1, 5 }, false }, { 35391729, { 1, 5 }, true },
+  { 35391924, { 1, 5 }, false }, { 35392057, { 1, 5 }, true }, { 35399638, { 3, 3 }, false }, { 35400254, { 3, 3 }, true },
+  { 35400632, { 3, 3 }, false }, { 35480826, { 1, 5 }, false }, { 35481011, { 1, 5 }, true }, { 35481257, { 1, 5 }, false },
+  { 35481476, { 1, 5 }, true }, { 35481654, { 1, 5 }, false }, { 35481907, { 1, 5 }, true }, { 35481981, { 1, 5 }, false },
+  { 35558386, { 2, 2 }, true }, { 35656096, { 4, 5 }, true }, { 35656766, { 4, 5 }, false }, { 35656928, { 4, 5 }, true },
+  { 35669919, { 2, 2 }, false }, { 35728762, { 4, 5 }, false }, { 35746127, { 1, 4 }, true }, { 35847363, { 1, 4 }, false },
+  { 35852481, { 1, 3 }, true }, { 35955711, { 1, 3 }, false }, { 35988648, { 3, 5 }, true }, { 35988964, { 3, 5 }, false },
+  { 35989135, { 3, 5 }, true }, { 35989219, { 3, 5 }, false }, { 35989367, { 3, 5 }, true }, { 35989587, { 3, 5 }, false },
+  { 35989662, { 3, 5 }, true }, { 36074001, { 3, 5 }, false },
+};
+
+static const uint16_t s_corpus100Typed[] = {
+  0x020F, 0x0008, 0x002C, 0x0006, 0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0008,
+  0x0016, 0x0017, 0x002C, 0x0018, 0x0011, 0x002C, 0x0012, 0x0018, 0x0017, 0x000C, 0x000F, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0021, 0x0012, 0x0011, 0x002C, 0x0018, 0x0017, 0x000C,
+  0x000F, 0x000C, 0x0016, 0x0008, 0x002C, 0x0017, 0x0012, 0x0018, 0x0017, 0x0008, 0x002C, 0x000F,
+  0x0014, 0x002C, 0x000D, 0x0012, 0x0018, 0x0015, 0x0011, 0x0008, 0x0008, 0x0010, 0x002C, 0x000C,
+  0x000F, 0x002C, 0x0007, 0x0012, 0x000C, 0x0017, 0x002C, 0x0016, 0x0018, 0x000C, 0x0019, 0x0015,
+  0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0009, 0x0015, 0x0014, 0x0013, 0x0013, 0x0008, 0x002C,
+  0x0016, 0x0014, 0x0011, 0x0016, 0x002C, 0x0013, 0x0008, 0x0015, 0x0007, 0x0015, 0x0008, 0x002C,
+  0x0018, 0x0011, 0x0008, 0x002C, 0x0016, 0x0008, 0x0018, 0x000F, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x0236, 0x0028, 0x0204, 0x0018, 0x0014, 0x0011, 0x0007, 0x002C,
+  0x0012, 0x0011, 0x002C, 0x0017, 0x0014, 0x0013, 0x0008, 0x002C, 0x0019, 0x000C, 0x0017, 0x0008,
+  0x0010, 0x002C, 0x000F, 0x0008, 0x0016, 0x002C, 0x0007, 0x0012, 0x000C, 0x000A, 0x0017, 0x0016,
+  0x002C, 0x0016, 0x0008, 0x002C, 0x0006, 0x000B, 0x0008, 0x0019, 0x0014, 0x0018, 0x0006, 0x000B,
+  0x0008, 0x0011, 0x0017, 0x002C, 0x0037, 0x002C, 0x0018, 0x0011, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x002C, 0x0008, 0x0016, 0x0017, 0x002C, 0x0008, 0x0011, 0x0009,
+  0x0012, 0x0011, 0x0006, 0x0008, 0x0008, 0x002C, 0x0014, 0x0019, 0x0014, 0x0011, 0x0017, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0013, 0x0015, 0x0008, 0x0006, 0x0008,
+  0x0007, 0x0008, 0x0011, 0x0017, 0x0008, 0x002C, 0x0016, 0x0012, 0x000C, 0x0017, 0x002C, 0x0015,
+  0x0008, 0x000F, 0x0014, 0x0006, 0x000B, 0x0008, 0x0008, 0x0236, 0x0028, 0x0208, 0x0016, 0x0017,
+  0x0056, 0x0006, 0x0008, 0x002C, 0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0008, 0x002C, 0x0006,
+  0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0017, 0x000C, 0x0008, 0x0011, 0x0017,
+  0x002C, 0x0059, 0x005A, 0x0062, 0x002C, 0x0033, 0x0012, 0x0017, 0x0016, 0x002C, 0x0013, 0x0014,
+  0x0015, 0x002C, 0x0033, 0x000C, 0x0011, 0x0018, 0x0017, 0x0008, 0x002C, 0x0210, 0x002C, 0x0208,
+  0x0017, 0x002C, 0x005A, 0x0062, 0x0062, 0x002C, 0x0038, 0x002C, 0x020F, 0x0008, 0x0016, 0x002C,
+  0x0006, 0x0012, 0x0011, 0x0017, 0x0014, 0x0006, 0x0017, 0x0016, 0x002C, 0x0015, 0x0008, 0x0005,
+};
+
+static const TraceEdge s_corpus140[] = {
+  { 0, { 4, 4 }, true }, { 167, { 4, 4 }, false }, { 328, { 4, 4 }, true }, { 382, { 4, 4 }, false },
+  { 477, { 4, 4 }, true }, { 562, { 4, 4 }, false }, { 704, { 4, 4 }, true }, { 53388, { 2, 9 }, true },
+  { 53561, { 2, 9 }, false }, { 53799, { 2, 9 }, true }, { 102515, { 4, 4 }, false }, { 112515, { 1, 3 }, true },
+  { 112756, { 1, 3 }, false }, { 112957, { 1, 3 }, true }, { 151925, { 2, 9 }, false }, { 176908, { 4, 5 }, true },
+  { 181573, { 1, 3 }, false }, { 252835, { 4, 5 }, false }, { 288386, { 3, 3 }, true }, { 357154, { 3, 3 }, false },
+  { 362760, { 2, 9 }, true }, { 414810, { 1, 1 }, true }, { 459636, { 2, 9 }, false }, { 459693, { 2, 9 }, true },
+  { 459775, { 2, 9 }, false }, { 459899, { 2, 9 }, true }, { 459960, { 2, 9 }, false }, { 460040, { 2, 9 }, true },
+  { 460156, { 2, 9 }, false }, { 490247, { 3, 4 }, true }, { 502464, { 1, 1 }, false }, { 563115, { 1, 8 }, true },
+  { 606587, { 3, 4 }, false }, { 615480, { 1, 3 }, true }, { 668385, { 1, 8 }, false }, { 719511, { 1, 3 }, false },
+  { 735142, { 1, 4 }, true }, { 835335, { 4, 5 }, true }, { 842706, { 1, 4 }, false }, { 903186, { 1, 3 }, true },
+  { 909988, { 4, 5 }, false }, { 998001, { 1, 3 }, false }, { 1015499, { 2, 2 }, true }, { 1091214, { 2, 2 }, false },
+  { 1104328, { 1, 5 }, true }, { 1194988, { 1, 5 }, false }, { 1210314, { 4, 5 }, true }, { 1291806, { 1, 7 }, true },
+  { 1310105, { 4, 5 }, false }, { 1363493, { 3, 7 }, true }, { 1398502, { 1, 7 }, false }, { 1456858, { 4, 5 }, true },
+  { 1478573, { 3, 7 }, false }, { 1535439, { 4, 5 }, false }, { 1554692, { 1, 9 }, true }, { 1652186, { 1, 7 }, true },
+  { 1656636, { 1, 9 }, false }, { 1708604, { 1, 5 }, true }, { 1738772, { 1, 7 }, false }, { 1795238, { 1, 5 }, false },
+  { 1807300, { 1, 8 }, true }, { 1888338, { 2, 9 }, true }, { 1917869, { 1, 8 }, false }, { 1995382, { 2, 9 }, false },
+  { 1995448, { 2, 9 }, true }, { 1995564, { 2, 9 }, false }, { 1995657, { 2, 9 }, true }, { 1995718, { 2, 9 }, false },
+  { 1995789, { 2, 9 }, true }, { 1995867, { 2, 9 }, false }, { 1998263, { 4, 5 }, true }, { 1998669, { 4, 5 }, false },
+  { 1998841, { 4, 5 }, true }, { 2082958, { 2, 1 }, true }, { 2113388, { 4, 5 }, false }, { 2174150, { 1, 7 }, true },
+  { 2182844, { 2, 1 }, false }, { 2237237, { 1, 3 }, true }, { 2252235, { 1, 7 }, false }, { 2252296, { 1, 7 }, true },
+  { 2252367, { 1, 7 }, false }, { 2252457, { 1, 7 }, true }, { 2252539, { 1, 7 }, false }, { 2302238, { 1, 3 }, false },
+  { 2318528, { 4, 5 }, true }, { 2379821, { 2, 9 }, true }, { 2387453, { 4, 5 }, false }, { 2433623, { 4, 5 }, true },
+  { 2452821, { 2, 9 }, false }, { 2494216, { 1, 5 }, true }, { 2551161, { 4, 5 }, false }, { 2561161, { 1, 9 }, true },
+  { 2603769, { 1, 5 }, false }, { 2669345, { 3, 7 }, true }, { 2669823, { 1, 9 }, false }, { 2748404, { 3, 7 }, false },
+  { 2764761, { 4, 5 }, true }, { 2819333, { 1, 7 }, true }, { 2831064, { 4, 5 }, false }, { 2888580, { 1, 7 }, false },
+  { 2897745, { 1, 5 }, true }, { 2993739, { 1, 8 }, true }, { 3010690, { 1, 5 }, false }, { 3080022, { 2, 9 }, true },
+  { 3088051, { 1, 8 }, false }, { 3147195, { 1, 8 }, true }, { 3174472, { 2, 9 }, false }, { 3206886, { 2, 2 }, true },
+  { 3230389, { 1, 8 }, false }, { 3304448, { 2, 2 }, false }, { 3311514, { 1, 3 }, true }, { 3415686, { 1, 3 }, false },
+  { 3431510, { 4, 5 }, true }, { 3497731, { 1, 5 }, true }, { 3514085, { 4, 5 }, false }, { 3573817, { 1, 5 }, false },
+  { 3614689, { 1, 9 }, true }, { 3703990, { 1, 7 }, true }, { 3704182, { 1, 7 }, false }, { 3704363, { 1, 7 }, true },
+  { 3720828, { 1, 9 }, false }, { 3760877, { 1, 5 }, true }, { 3787426, { 1, 7 }, false }, { 3822025, { 1, 3 }, true },
+  { 3847541, { 1, 5 }, false }, { 3904008, { 4, 5 }, true }, { 3935404, { 1, 3 }, false }, { 3990192, { 2, 9 }, true },
+  { 4004837, { 4, 5 }, false }, { 4053120, { 1, 1 }, true }, { 4092995, { 2, 9 }, false }, { 4126564, { 1, 1 }, false },
+  { 4138413, { 4, 5 }, true }, { 4219441, { 4, 5 }, false }, { 4247447, { 2, 7 }, true }, { 4339513, { 2, 7 }, false },
+  { 4361888, { 1, 9 }, true }, { 4362223, { 1, 9 }, false }, { 4362381, { 1, 9 }, true }, { 4362673, { 1, 9 }, false },
+  { 4363001, { 1, 9 }, true }, { 4429036, { 1, 7 }, true }, { 4432268, { 1, 9 }, false }, { 4490839, { 1, 4 }, true },
+  { 4544006, { 1, 7 }, false }, { 4544095, { 1, 7 }, true }, { 4544183, { 1, 7 }, false }, { 4544256, { 1, 7 }, true },
+  { 4544372, { 1, 7 }, false }, { 4565569, { 3, 7 }, true }, { 4566515, { 1, 4 }, false }, { 4622409, { 1, 3 }, true },
+  { 4682042, { 3, 7 }, false }, { 4693458, { 1, 3 }, false }, { 4736238, { 1, 3 }, true }, { 4796695, { 3, 9 }, true },
+  { 4833177, { 1, 3 }, false }, { 4894030, { 3, 9 }, false }, { 4895140, { 4, 5 }, true }, { 4966473, { 4, 5 }, false },
+  { 5001297, { 1, 8 }, true }, { 5065590, { 1, 8 }, false }, { 5087136, { 2, 9 }, true }, { 5164147, { 2, 9 }, false },
+  { 5164323, { 2, 9 }, true }, { 5164434, { 2, 9 }, false }, { 5188639, { 4, 5 }, true }, { 5284054, { 2, 3 }, true },
+  { 5300858, { 4, 5 }, false }, { 5340470, { 1, 9 }, true }, { 5368118, { 2, 3 }, false }, { 5368359, { 2, 3 }, true },
+  { 5368945, { 2, 3 }, false }, { 5369473, { 2, 3 }, true }, { 5369672, { 2, 3 }, false }, { 5400538, { 1, 8 }, true },
+  { 5412638, { 1, 9 }, false }, { 5499327, { 1, 8 }, false }, { 5513159, { 1, 5 }, true }, { 5576819, { 1, 5 }, false },
+  { 5576897, { 1, 5 }, true }, { 5576977, { 1, 5 }, false }, { 5577067, { 1, 5 }, true }, { 5577132, { 1, 5 }, false },
+  { 5577193, { 1, 5 }, true }, { 5577258, { 1, 5 }, false }, { 5630817, { 4, 5 }, true }, { 5630978, { 4, 5 }, false },
+  { 5631125, { 4, 5 }, true }, { 5631405, { 4, 5 }, false }, { 5631459, { 4, 5 }, true }, { 5722457, { 4, 5 }, false },
+  { 5723617, { 2, 2 }, true }, { 5825257, { 2, 2 }, false }, { 5827537, { 1, 7 }, true }, { 5891867, { 1, 8 }, true },
+  { 5943083, { 1, 7 }, false }, { 5954490, { 3, 4 }, true }, { 5989962, { 1, 8 }, false }, { 6045192, { 1, 4 }, true },
+  { 6051365, { 3, 4 }, false }, { 6051697, { 3, 4 }, true }, { 6052014, { 3, 4 }, false }, { 6148040, { 1, 4 }, false },
+  { 6150637, { 1, 3 }, true }, { 6227868, { 4, 5 }, true }, { 6229224, { 1, 3 }, false }, { 6312167, { 4, 5 }, false },
+  { 6329733, { 2, 9 }, true }, { 6404636, { 2, 9 }, false }, { 6444370, { 1, 1 }, true }, { 6510015, { 1, 1 }, false },
+  { 6516801, { 4, 5 }, true }, { 6589781, { 2, 4 }, true }, { 6630242, { 4, 5 }, false }, { 6656365, { 2, 4 }, false },
+  { 6700558, { 1, 4 }, true }, { 6767984, { 1, 1 }, true }, { 6789125, { 1, 4 }, false }, { 6858410, { 1, 10 }, true },
+  { 6858642, { 1, 10 }, false }, { 6858919, { 1, 10 }, true }, { 6873533, { 1, 1 }, false }, { 6917021, { 1, 10 }, false },
+  { 6927021, { 1, 10 }, true }, { 6995301, { 1, 10 }, false }, { 6995607, { 1, 10 }, true }, { 6995698, { 1, 10 }, false },
+  { 6995791, { 1, 10 }, true }, { 6995985, { 1, 10 }, false }, { 7039897, { 1, 3 }, true }, { 7126877, { 1, 3 }, false },
+  { 7149432, { 4, 5 }, true }, { 7226689, { 2, 2 }, true }, { 7228534, { 4, 5 }, false }, { 7323307, { 2, 2 }, false },
+  { 7327869, { 1, 1 }, true }, { 7397375, { 1, 1 }, false }, { 7403698, { 3, 7 }, true }, { 7465647, { 2, 2 }, true },
+  { 7489906, { 3, 7 }, false }, { 7532643, { 4, 5 }, true }, { 7560490, { 2, 2 }, false }, { 7587118, { 1, 10 }, true },
+  { 7620034, { 4, 5 }, false }, { 7665619, { 1, 10 }, false }, { 7685558, { 1, 3 }, true }, { 7762277, { 1, 4 }, true },
+  { 7767078, { 1, 3 }, false }, { 7845648, { 2, 3 }, true }, { 7860283, { 1, 4 }, false }, { 7930863, { 1, 4 }, true },
+  { 7943341, { 2, 3 }, false }, { 7998567, { 1, 3 }, true }, { 7998670, { 1, 3 }, false }, { 7998968, { 1, 3 }, true },
+  { 8024086, { 1, 4 }, false }, { 8088271, { 1, 3 }, false }, { 8112854, { 4, 5 }, true }, { 8175945, { 1, 7 }, true },
+  { 8195407, { 4, 5 }, false }, { 8264298, { 1, 7 }, false }, { 8287317, { 3, 7 }, true }, { 8371360, { 1, 3 }, true },
+  { 8395521, { 3, 7 }, false }, { 8460986, { 4, 5 }, true }, { 8469094, { 1, 3 }, false }, { 8543929, { 4, 5 }, false },
+  { 8574254, { 2, 2 }, true }, { 8647496, { 2, 2 }, false }, { 8647601, { 2, 2 }, true }, { 8647762, { 2, 2 }, false },
+  { 8650428, { 1, 3 }, true }, { 8728133, { 1, 7 }, true }, { 8728206, { 1, 7 }, false }, { 8728264, { 1, 7 }, true },
+  { 8728323, { 1, 7 }, false }, { 8728387, { 1, 7 }, true }, { 8728452, { 1, 7 }, false }, { 8728545, { 1, 7 }, true },
+  { 8744898, { 1, 3 }, false }, { 8781185, { 2, 9 }, true }, { 8810028, { 1, 7 }, false }, { 8891454, { 1, 3 }, true },
+  { 8897016, { 2, 9 }, false }, { 8968239, { 1, 3 }, false }, { 8970632, { 4, 5 }, true }, { 9040587, { 1, 5 }, true },
+  { 9066992, { 4, 5 }, false }, { 9133756, { 1, 9 }, true }, { 9139059, { 1, 5 }, false }, { 9236436, { 1, 7 }, true },
+  { 9245117, { 1, 9 }, false }, { 9323375, { 1, 7 }, false }, { 9331062, { 3, 3 }, true }, { 9399940, { 3, 3 }, false },
+  { 9415284, { 2, 6 }, true }, { 9475082, { 1, 3 }, true }, { 9495846, { 2, 6 }, false }, { 9548579, { 1, 3 }, false },
+  { 9562317, { 3, 8 }, true }, { 9623985, { 4, 6 }, true }, { 9636790, { 4, 4 }, true }, { 9667214, { 3, 8 }, false },
+  { 9685427, { 2, 1 }, true }, { 9728939, { 4, 4 }, false }, { 9738939, { 1, 7 }, true }, { 9739875, { 4, 6 }, false },
+  { 9765584, { 2, 1 }, false }, { 9828739, { 1, 7 }, false }, { 9842550, { 1, 1 }, true }, { 9842886, { 1, 1 }, false },
+  { 9843407, { 1, 1 }, true }, { 9906400, { 3, 7 }, true }, { 9924762, { 1, 1 }, false }, { 9964400, { 2, 3 }, true },
+  { 9985911, { 3, 7 }, false }, { 10054681, { 4, 5 }, true }, { 10068216, { 2, 3 }, false }, { 10113198, { 1, 9 }, true },
+  { 10144421, { 4, 5 }, false }, { 10190418, { 1, 9 }, false }, { 10232974, { 3, 7 }, true }, { 10307493, { 4, 5 }, true },
+  { 10335571, { 3, 7 }, false }, { 10403776, { 4, 5 }, false }, { 10409046, { 1, 5 }, true }, { 10476190, { 1, 5 }, false },
+  { 10476268, { 1, 5 }, true }, { 10476348, { 1, 5 }, false }, { 10476401, { 1, 5 }, true }, { 10476472, { 1, 5 }, false },
+  { 10476527, { 1, 5 }, true }, { 10476583, { 1, 5 }, false }, { 10523584, { 1, 1 }, true }, { 10591431, { 1, 1 }, false },
+  { 10597920, { 1, 10 }, true }, { 10674006, { 1, 3 }, true }, { 10684109, { 1, 10 }, false }, { 10779405, { 1, 3 }, false },
+  { 10791240, { 4, 5 }, true }, { 10886406, { 3, 4 }, true }, { 10896187, { 4, 5 }, false }, { 10981066, { 3, 4 }, false },
+  { 10993781, { 1, 8 }, true }, { 11105150, { 1, 8 }, false }, { 11111879, { 1, 5 }, true }, { 11111932, { 1, 5 }, false },
+  { 11112003, { 1, 5 }, true }, { 11112095, { 1, 5 }, false }, { 11112185, { 1, 5 }, true }, { 11112245, { 1, 5 }, false },
+  { 11112332, { 1, 5 }, true }, { 11174676, { 1, 3 }, true }, { 11205990, { 1, 5 }, false }, { 11239856, { 1, 3 }, false },
+  { 11252508, { 3, 9 }, true }, { 11321653, { 4, 5 }, true }, { 11328030, { 3, 9 }, false }, { 11422295, { 2, 9 }, true },
+  { 11422388, { 2, 9 }, false }, { 11422540, { 2, 9 }, true }, { 11422692, { 2, 9 }, false }, { 11422844, { 2, 9 }, true },
+  { 11430575, { 4, 5 }, false }, { 11537089, { 2, 9 }, false }, { 11540124, { 1, 3 }, true }, { 11606879, { 1, 3 }, false },
+  { 11635044, { 2, 2 }, true }, { 11700420, { 2, 2 }, false }, { 11744797, { 4, 5 }, true }, { 11823509, { 4, 5 }, false },
+  { 11834402, { 2, 3 }, true }, { 11912300, { 1, 9 }, true }, { 11938033, { 2, 3 }, false }, { 11978850, { 1, 9 }, false },
+  { 11979402, { 1, 9 }, true }, { 11979955, { 1, 9 }, false }, { 12021265, { 1, 8 }, true }, { 12127445, { 2, 5 }, true },
+  { 12129477, { 1, 8 }, false }, { 12211763, { 2, 5 }, false }, { 12231112, { 1, 5 }, true }, { 12332247, { 1, 5 }, false },
+  { 12342822, { 2, 2 }, true }, { 12433310, { 2, 2 }, false }, { 12456753, { 4, 5 }, true }, { 12559151, { 4, 5 }, false },
+  { 12573131, { 2, 2 }, true }, { 12671828, { 2, 2 }, false }, { 12675249, { 1, 3 }, true }, { 12764246, { 1, 3 }, false },
+  { 12793635, { 4, 5 }, true }, { 12873568, { 3, 3 }, true }, { 12892403, { 4, 5 }, false }, { 12892476, { 4, 5 }, true },
+  { 12892550, { 4, 5 }, false }, { 12892800, { 4, 5 }, true }, { 12893076, { 4, 5 }, false }, { 12939105, { 2, 6 }, true },
+  { 12953198, { 3, 3 }, false }, { 13009377, { 1, 3 }, true }, { 13042613, { 2, 6 }, false }, { 13096643, { 1, 3 }, false },
+  { 13096775, { 1, 3 }, true }, { 13096914, { 1, 3 }, false }, { 13097036, { 1, 3 }, true }, { 13097103, { 1, 3 }, false },
+  { 13097270, { 1, 3 }, true }, { 13097407, { 1, 3 }, false }, { 13117358, { 3, 4 }, true }, { 13117431, { 3, 4 }, false },
+  { 13117574, { 3, 4 }, true }, { 13117730, { 3, 4 }, false }, { 13117816, { 3, 4 }, true }, { 13230593, { 3, 4 }, false },
+  { 13235679, { 1, 1 }, true }, { 13326249, { 1, 7 }, true }, { 13332868, { 1, 1 }, false }, { 13396702, { 1, 7 }, false },
+  { 13445879, { 3, 3 }, true }, { 13535782, { 2, 6 }, true }, { 13553962, { 3, 3 }, false }, { 13606579, { 1, 3 }, true },
+  { 13624155, { 2, 6 }, false }, { 13712623, { 1, 3 }, false }, { 13724514, { 3, 7 }, true }, { 13789816, { 3, 7 }, false },
+  { 13805196, { 1, 5 }, true }, { 13869264, { 4, 5 }, true }, { 13872378, { 1, 5 }, false }, { 13893810, { 4, 4 }, true },
+  { 13922629, { 3, 10 }, true }, { 13947966, { 4, 5 }, false }, { 14032019, { 4, 4 }, false }, { 14035031, { 3, 10 }, false },
+  { 14042019, { 4, 5 }, true }, { 14098007, { 1, 7 }, true }, { 14156826, { 4, 5 }, false }, { 14173082, { 3, 7 }, true },
+  { 14191403, { 1, 7 }, false }, { 14253639, { 3, 7 }, false }, { 14271382, { 1, 3 }, true }, { 14352837, { 4, 5 }, true },
+  { 14353086, { 4, 5 }, false }, { 14353252, { 4, 5 }, true }, { 14353525, { 4, 5 }, false }, { 14353741, { 4, 5 }, true },
+  { 14384536, { 1, 3 }, false }, { 14410490, { 1, 5 }, true }, { 14449091, { 4, 5 }, false }, { 14449225, { 4, 5 }, true },
+  { 14449324, { 4, 5 }, false }, { 14449505, { 4, 5 }, true }, { 14449581, { 4, 5 }, false }, { 14449642, { 4, 5 }, true },
+  { 14449816, { 4, 5 }, false }, { 14514807, { 1, 5 }, false }, { 14526957, { 1, 9 }, true }, { 14601221, { 1, 7 }, true },
+  { 14618622, { 1, 9 }, false }, { 14653479, { 3, 3 }, true }, { 14702508, { 1, 7 }, false }, { 14741083, { 3, 3 }, false },
+  { 14741278, { 3, 3 }, true }, { 14741357, { 2, 6 }, true }, { 14741383, { 3, 3 }, false }, { 14741556, { 3, 3 }, true },
+  { 14741626, { 3, 3 }, false }, { 14741852, { 3, 3 }, true }, { 14742133, { 3, 3 }, false }, { 14819375, { 1, 3 }, true },
+  { 14823364, { 2, 6 }, false }, { 14900447, { 4, 5 }, true }, { 14921790, { 1, 3 }, false }, { 14959819, { 1, 3 }, true },
+  { 14959965, { 1, 3 }, false }, { 14960098, { 1, 3 }, true }, { 14960234, { 1, 3 }, false }, { 14960388, { 1, 3 }, true },
+  { 14960468, { 1, 3 }, false }, { 14960592, { 1, 3 }, true }, { 14991612, { 4, 5 }, false }, { 15034479, { 2, 2 }, true },
+  { 15047342, { 1, 3 }, false }, { 15125957, { 2, 2 }, false }, { 15129934, { 1, 5 }, true }, { 15187044, { 4, 5 }, true },
+  { 15187126, { 4, 5 }, false }, { 15187367, { 4, 5 }, true }, { 15187503, { 4, 5 }, false }, { 15187594, { 4, 5 }, true },
+  { 15235314, { 1, 5 }, false }, { 15259853, { 4, 5 }, false }, { 15270438, { 1, 3 }, true }, { 15344089, { 3, 7 }, true },
+  { 15344580, { 1, 3 }, false }, { 15414271, { 3, 7 }, false }, { 15438773, { 2, 4 }, true }, { 15518606, { 2, 4 }, false },
+  { 15551892, { 1, 9 }, true }, { 15610619, { 3, 7 }, true }, { 15624788, { 1, 9 }, false }, { 15697036, { 3, 7 }, false },
+  { 15709193, { 3, 3 }, true }, { 15786606, { 3, 3 }, false }, { 15801555, { 1, 3 }, true }, { 15849288, { 1, 3 }, false },
+  { 15859288, { 1, 3 }, true }, { 15963606, { 4, 5 }, true }, { 15963720, { 4, 5 }, false }, { 15964093, { 4, 5 }, true },
+  { 15971971, { 1, 3 }, false }, { 15972120, { 1, 3 }, true }, { 15972225, { 1, 3 }, false }, { 15972288, { 1, 3 }, true },
+  { 15972359, { 1, 3 }, false }, { 16020685, { 1, 1 }, true }, { 16050179, { 4, 5 }, false }, { 16109755, { 1, 1 }, false },
+  { 16124411, { 3, 4 }, true }, { 16124490, { 3, 4 }, false }, { 16124584, { 3, 4 }, true }, { 16124692, { 3, 4 }, false },
+  { 16124829, { 3, 4 }, true }, { 16124883, { 3, 4 }, false }, { 16125010, { 3, 4 }, true }, { 16197044, { 1, 1 }, true },
+  { 16223768, { 3, 4 }, false }, { 16280797, { 3, 7 }, true }, { 16307225, { 1, 1 }, false }, { 16364285, { 1, 5 }, true },
+  { 16374704, { 3, 7 }, false }, { 16430412, { 4, 5 }, true }, { 16470806, { 1, 5 }, false }, { 16522643, { 2, 1 }, true },
+  { 16527391, { 4, 5 }, false }, { 16610759, { 1, 7 }, true }, { 16626374, { 2, 1 }, false }, { 16675512, { 1, 3 }, true },
+  { 16708892, { 1, 7 }, false }, { 16765054, { 1, 3 }, false }, { 16765229, { 1, 3 }, true }, { 16765403, { 1, 3 }, false },
+  { 16765581, { 1, 3 }, true }, { 16765738, { 1, 3 }, false }, { 16765853, { 1, 3 }, true }, { 16765996, { 1, 3 }, false },
+  { 16783321, { 4, 5 }, true }, { 16845963, { 2, 9 }, true }, { 16895412, { 4, 5 }, false }, { 16946733, { 2, 9 }, false },
+  { 16961110, { 1, 1 }, true }, { 17063084, { 4, 5 }, true }, { 17063336, { 4, 5 }, false }, { 17063603, { 4, 5 }, true },
+  { 17063765, { 4, 5 }, false }, { 17063976, { 4, 5 }, true }, { 17066427, { 1, 1 }, false }, { 17121640, { 1, 10 }, true },
+  { 17135908, { 4, 5 }, false }, { 17136057, { 4, 5 }, true }, { 17136205, { 4, 5 }, false }, { 17205390, { 1, 4 }, true },
+  { 17210510, { 1, 10 }, false }, { 17269532, { 1, 4 }, false }, { 17320295, { 1, 3 }, true }, { 17396218, { 3, 3 }, true },
+  { 17414345, { 1, 3 }, false }, { 17469727, { 3, 3 }, false }, { 17502437, { 1, 3 }, true }, { 17583947, { 1, 3 }, false },
+  { 17611762, { 2, 3 }, true }, { 17702834, { 2, 3 }, false }, { 17723379, { 1, 3 }, true }, { 17811941, { 1, 3 }, false },
+  { 17833232, { 3, 7 }, true }, { 17897367, { 3, 7 }, false }, { 17918219, { 1, 5 }, true }, { 17998364, { 1, 5 }, false },
+  { 18007724, { 1, 3 }, true }, { 18078078, { 1, 3 }, false }, { 18114692, { 4, 5 }, true }, { 18176450, { 2, 2 }, true },
+  { 18197396, { 4, 5 }, false }, { 18264527, { 1, 9 }, true }, { 18281076, { 2, 2 }, false }, { 18330524, { 1, 9 }, false },
+  { 18365146, { 1, 8 }, true }, { 18432945, { 1, 5 }, true }, { 18446790, { 1, 8 }, false }, { 18489991, { 4, 5 }, true },
+  { 18530754, { 1, 5 }, false }, { 18595934, { 4, 5 }, false }, { 18606496, { 1, 4 }, true }, { 18606604, { 1, 4 }, false },
+  { 18606747, { 1, 4 }, true }, { 18661526, { 1, 3 }, true }, { 18661645, { 1, 3 }, false }, { 18661893, { 1, 3 }, true },
+  { 18693654, { 1, 4 }, false }, { 18770096, { 2, 9 }, true }, { 18771460, { 1, 3 }, false }, { 18850716, { 2, 9 }, false },
+  { 18862286, { 1, 1 }, true }, { 18937881, { 1, 1 }, false }, { 18966344, { 3, 3 }, true }, { 19018326, { 2, 6 }, true },
+  { 19060136, { 3, 3 }, false }, { 19101216, { 2, 6 }, false }, { 19101307, { 2, 6 }, true }, { 19101371, { 2, 6 }, false },
+  { 19101550, { 2, 6 }, true }, { 19101643, { 2, 6 }, false }, { 19121834, { 1, 3 }, true }, { 19206928, { 1, 3 }, false },
+  { 19237025, { 1, 3 }, true }, { 19237301, { 1, 3 }, false }, { 19237388, { 1, 3 }, true }, { 19306421, { 1, 3 }, false },
+  { 19340349, { 3, 8 }, true }, { 19340911, { 3, 8 }, false }, { 19341518, { 3, 8 }, true }, { 19427392, { 4, 6 }, true },
+  { 19454446, { 4, 4 }, true }, { 19456527, { 3, 8 }, false }, { 19481612, { 1, 3 }, true }, { 19504728, { 4, 6 }, false },
+  { 19531754, { 4, 4 }, false }, { 19531854, { 4, 4 }, true }, { 19532037, { 4, 4 }, false }, { 19532091, { 4, 4 }, true },
+  { 19532217, { 4, 4 }, false }, { 19541754, { 2, 2 }, true }, { 19541888, { 2, 2 }, false }, { 19541975, { 2, 2 }, true },
+  { 19542109, { 2, 2 }, false }, { 19542211, { 2, 2 }, true }, { 19565693, { 1, 3 }, false }, { 19622835, { 1, 5 }, true },
+  { 19638817, { 2, 2 }, false }, { 19659224, { 4, 5 }, true }, { 19691257, { 1, 10 }, true }, { 19727012, { 1, 5 }, false },
+  { 19758943, { 4, 5 }, false }, { 19768943, { 3, 3 }, true }, { 19769583, { 3, 3 }, false }, { 19770549, { 3, 3 }, true },
+  { 19771679, { 1, 10 }, false }, { 19840637, { 3, 3 }, false }, { 19881951, { 1, 3 }, true }, { 19989990, { 1, 3 }, false },
+  { 19992187, { 4, 5 }, true }, { 20091825, { 4, 5 }, false }, { 20091926, { 4, 5 }, true }, { 20092090, { 4, 5 }, false },
+  { 20092142, { 4, 5 }, true }, { 20092220, { 4, 5 }, false }, { 20092325, { 4, 5 }, true }, { 20092512, { 4, 5 }, false },
+  { 20095741, { 2, 1 }, true }, { 20095808, { 2, 1 }, false }, { 20095864, { 2, 1 }, true }, { 20095919, { 2, 1 }, false },
+  { 20095988, { 2, 1 }, true }, { 20096062, { 2, 1 }, false }, { 20096168, { 2, 1 }, true }, { 20162867, { 1, 7 }, true },
+  { 20207253, { 2, 1 }, false }, { 20207330, { 2, 1 }, true }, { 20207413, { 2, 1 }, false }, { 20207471, { 2, 1 }, true },
+  { 20207581, { 2, 1 }, false }, { 20207662, { 2, 1 }, true }, { 20207751, { 2, 1 }, false }, { 20260926, { 1, 3 }, true },
+  { 20262142, { 1, 7 }, false }, { 20331370, { 1, 3 }, false }, { 20351515, { 4, 5 }, true }, { 20427077, { 4, 5 }, false },
+  { 20470613, { 2, 9 }, true }, { 20537937, { 1, 3 }, true }, { 20538301, { 1, 3 }, false }, { 20538575, { 1, 3 }, true },
+  { 20573925, { 2, 9 }, false }, { 20614586, { 4, 5 }, true }, { 20627369, { 1, 3 }, false }, { 20694591, { 4, 5 }, false },
+  { 20708495, { 3, 3 }, true }, { 20709245, { 3, 3 }, false }, { 20709663, { 3, 3 }, true }, { 20789882, { 3, 3 }, false },
+  { 20792357, { 2, 9 }, true }, { 20849792, { 1, 1 }, true }, { 20870688, { 2, 9 }, false }, { 20930334, { 3, 4 }, true },
+  { 20954173, { 1, 1 }, false }, { 20954242, { 1, 1 }, true }, { 20954536, { 1, 1 }, false }, { 20954810, { 1, 1 }, true },
+  { 20955063, { 1, 1 }, false }, { 21008516, { 3, 4 }, false }, { 21038814, { 1, 8 }, true }, { 21092312, { 1, 3 }, true },
+  { 21092455, { 1, 3 }, false }, { 21092529, { 1, 3 }, true }, { 21092687, { 1, 3 }, false }, { 21092784, { 1, 3 }, true },
+  { 21092916, { 1, 3 }, false }, { 21093090, { 1, 3 }, true }, { 21120345, { 1, 8 }, false }, { 21156284, { 1, 4 }, true },
+  { 21156366, { 1, 4 }, false }, { 21156460, { 1, 4 }, true }, { 21156528, { 1, 4 }, false }, { 21156605, { 1, 4 }, true },
+  { 21200969, { 1, 3 }, false }, { 21247766, { 4, 5 }, true }, { 21247873, { 4, 5 }, false }, { 21247995, { 4, 5 }, true },
+  { 21248089, { 4, 5 }, false }, { 21248346, { 4, 5 }, true }, { 21259177, { 1, 4 }, false }, { 21302155, { 1, 5 }, true },
+  { 21337319, { 4, 5 }, false }, { 21359538, { 1, 8 }, true }, { 21379944, { 1, 5 }, false }, { 21447531, { 1, 3 }, true },
+  { 21452631, { 1, 8 }, false }, { 21507290, { 3, 7 }, true }, { 21511535, { 1, 3 }, false }, { 21511643, { 1, 3 }, true },
+  { 21511747, { 1, 3 }, false }, { 21511812, { 1, 3 }, true }, { 21511927, { 1, 3 }, false }, { 21512053, { 1, 3 }, true },
+  { 21512207, { 1, 3 }, false }, { 21566149, { 1, 5 }, true }, { 21582414, { 3, 7 }, false }, { 21632865, { 1, 5 }, false },
+  { 21679765, { 4, 5 }, true }, { 21733684, { 4, 5 }, false }, { 21743684, { 4, 5 }, true }, { 21792491, { 3, 7 }, true },
+  { 21879450, { 3, 8 }, true }, { 21879667, { 3, 8 }, false }, { 21879869, { 3, 8 }, true }, { 21880342, { 3, 8 }, false },
+  { 21880425, { 3, 8 }, true }, { 21897697, { 3, 7 }, false }, { 21964775, { 3, 8 }, false }, { 21987885, { 4, 7 }, true },
+  { 22036947, { 4, 5 }, false }, { 22037018, { 4, 5 }, true }, { 22037215, { 4, 5 }, false }, { 22037335, { 4, 5 }, true },
+  { 22037406, { 4, 5 }, false }, { 22037506, { 4, 5 }, true }, { 22037644, { 4, 5 }, false }, { 22046947, { 4, 5 }, true },
+  { 22074763, { 4, 7 }, false }, { 22074980, { 4, 7 }, true }, { 22075103, { 4, 7 }, false }, { 22075657, { 4, 7 }, true },
+  { 22076376, { 4, 7 }, false }, { 22140380, { 2, 10 }, true }, { 22149668, { 4, 5 }, false }, { 22212828, { 2, 10 }, false },
+  { 22225096, { 1, 9 }, true }, { 22225369, { 1, 9 }, false }, { 22225795, { 1, 9 }, true }, { 22307468, { 1, 5 }, true },
+  { 22313496, { 1, 9 }, false }, { 22375133, { 2, 2 }, true }, { 22375183, { 2, 2 }, false }, { 22375277, { 2, 2 }, true },
+  { 22375354, { 2, 2 }, false }, { 22375415, { 2, 2 }, true }, { 22375505, { 2, 2 }, false }, { 22375604, { 2, 2 }, true },
+  { 22414376, { 1, 5 }, false }, { 22414455, { 1, 5 }, true }, { 22414589, { 1, 5 }, false }, { 22452932, { 4, 5 }, true },
+  { 22463021, { 2, 2 }, false }, { 22521408, { 1, 10 }, true }, { 22550008, { 4, 5 }, false }, { 22594445, { 1, 1 }, true },
+  { 22603594, { 1, 10 }, false }, { 22679138, { 1, 1 }, false }, { 22685653, { 1, 4 }, true }, { 22685746, { 1, 4 }, false },
+  { 22685818, { 1, 4 }, true }, { 22685891, { 1, 4 }, false }, { 22685955, { 1, 4 }, true }, { 22686038, { 1, 4 }, false },
+  { 22686103, { 1, 4 }, true }, { 22761043, { 4, 5 }, true }, { 22789633, { 1, 4 }, false }, { 22829930, { 4, 5 }, false },
+  { 22870997, { 2, 10 }, true }, { 22945066, { 1, 8 }, true }, { 22985305, { 2, 10 }, false }, { 23028982, { 1, 8 }, false },
+  { 23034637, { 3, 7 }, true }, { 23096015, { 1, 7 }, true }, { 23105819, { 3, 7 }, false }, { 23149016, { 1, 5 }, true },
+  { 23162884, { 1, 7 }, false }, { 23221429, { 1, 5 }, false }, { 23232048, { 1, 3 }, true }, { 23317992, { 1, 3 }, false },
+  { 23350331, { 4, 5 }, true }, { 23382308, { 4, 4 }, true }, { 23382430, { 4, 4 }, false }, { 23382576, { 4, 4 }, true },
+  { 23382760, { 4, 4 }, false }, { 23382988, { 4, 4 }, true }, { 23443302, { 4, 5 }, false }, { 23445786, { 3, 9 }, true },
+  { 23520639, { 3, 9 }, false }, { 23531138, { 4, 4 }, false }, { 23541138, { 4, 5 }, true }, { 23617614, { 4, 4 }, true },
+  { 23647562, { 4, 5 }, false }, { 23647906, { 4, 5 }, true }, { 23648143, { 4, 5 }, false }, { 23657294, { 1, 3 }, true },
+  { 23712441, { 4, 4 }, false }, { 23722441, { 1, 5 }, true }, { 23722589, { 1, 5 }, false }, { 23722687, { 1, 5 }, true },
+  { 23751084, { 1, 3 }, false }, { 23803110, { 1, 5 }, false }, { 23809849, { 4, 5 }, true }, { 23886765, { 4, 5 }, false },
+  { 23896765, { 4, 5 }, true }, { 23896891, { 4, 5 }, false }, { 23897063, { 4, 5 }, true }, { 23897134, { 4, 5 }, false },
+  { 23897247, { 4, 5 }, true }, { 23897329, { 4, 5 }, false }, { 23897494, { 4, 5 }, true }, { 23922414, { 3, 8 }, true },
+  { 24000384, { 4, 7 }, true }, { 24028403, { 3, 8 }, false }, { 24049726, { 4, 7 }, false }, { 24059726, { 4, 7 }, true },
+  { 24128214, { 4, 7 }, false }, { 24153754, { 4, 5 }, false }, { 24163754, { 4, 5 }, true }, { 24198963, { 4, 4 }, true },
+  { 24228828, { 3, 8 }, true }, { 24229081, { 3, 8 }, false }, { 24229383, { 3, 8 }, true }, { 24267912, { 4, 5 }, false },
+  { 24277236, { 4, 4 }, false }, { 24287236, { 4, 5 }, true }, { 24287675, { 4, 5 }, false }, { 24288079, { 4, 5 }, true },
+  { 24301428, { 3, 8 }, false }, { 24308813, { 4, 4 }, true }, { 24368707, { 2, 9 }, true }, { 24373688, { 4, 5 }, false },
+  { 24469128, { 2, 9 }, false }, { 24477645, { 4, 4 }, false }, { 24487645, { 1, 3 }, true }, { 24554541, { 2, 2 }, true },
+  { 24604078, { 1, 3 }, false }, { 24622704, { 4, 5 }, true }, { 24640537, { 2, 2 }, false }, { 24693933, { 3, 3 }, true },
+  { 24702007, { 4, 5 }, false }, { 24770579, { 3, 3 }, false }, { 24771069, { 3, 3 }, true }, { 24771261, { 3, 3 }, false },
+  { 24786457, { 1, 9 }, true }, { 24847097, { 3, 7 }, true }, { 24896715, { 1, 9 }, false }, { 24936282, { 1, 5 }, true },
+  { 24956445, { 3, 7 }, false }, { 25007319, { 1, 1 }, true }, { 25048652, { 1, 5 }, false }, { 25100991, { 3, 3 }, true },
+  { 25104203, { 1, 1 }, false }, { 25180058, { 3, 3 }, false }, { 25213329, { 1, 5 }, true }, { 25294608, { 2, 2 }, true },
+  { 25294709, { 2, 2 }, false }, { 25294806, { 2, 2 }, true }, { 25294876, { 2, 2 }, false }, { 25294973, { 2, 2 }, true },
+  { 25295051, { 2, 2 }, false }, { 25295104, { 2, 2 }, true }, { 25313909, { 1, 5 }, false }, { 25384614, { 2, 2 }, false },
+  { 25402464, { 4, 5 }, true }, { 25477554, { 4, 5 }, false }, { 25482971, { 1, 4 }, true }, { 25560676, { 1, 4 }, false },
+  { 25575770, { 1, 3 }, true }, { 25663342, { 1, 3 }, false }, { 25693441, { 3, 5 }, true }, { 25806474, { 3, 5 }, false },
+};
+
+static const uint16_t s_corpus140Typed[] = {
+  0x020F, 0x0008, 0x002C, 0x0006, 0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0008,
+  0x0016, 0x0017, 0x002C, 0x0018, 0x0011, 0x002C, 0x0012, 0x0018, 0x0017, 0x000C, 0x000F, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0021, 0x0012, 0x0011, 0x002C, 0x0018, 0x0017, 0x000C,
+  0x000F, 0x000C, 0x0016, 0x0008, 0x002C, 0x0017, 0x0012, 0x0018, 0x0017, 0x0008, 0x002C, 0x000F,
+  0x0014, 0x002C, 0x000D, 0x0012, 0x0018, 0x0015, 0x0011, 0x0008, 0x0008, 0x0010, 0x002C, 0x000C,
+  0x000F, 0x002C, 0x0007, 0x0012, 0x000C, 0x0017, 0x002C, 0x0016, 0x0018, 0x000C, 0x0019, 0x0015,
+  0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0009, 0x0015, 0x0014, 0x0013, 0x0013, 0x0008, 0x002C,
+  0x0016, 0x0014, 0x0011, 0x0016, 0x002C, 0x0013, 0x0008, 0x0015, 0x0007, 0x0015, 0x0008, 0x002C,
+  0x0018, 0x0011, 0x0008, 0x002C, 0x0016, 0x0008, 0x0018, 0x000F, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x0236, 0x0028, 0x0204, 0x0018, 0x0014, 0x0011, 0x0007, 0x002C,
+  0x0012, 0x0011, 0x002C, 0x0017, 0x0014, 0x0013, 0x0008, 0x002C, 0x0019, 0x000C, 0x0017, 0x0008,
+  0x0010, 0x002C, 0x000F, 0x0008, 0x0016, 0x002C, 0x0007, 0x0012, 0x000C, 0x000A, 0x0017, 0x0016,
+  0x002C, 0x0016, 0x0008, 0x002C, 0x0006, 0x000B, 0x0008, 0x0019, 0x0014, 0x0018, 0x0006, 0x000B,
+  0x0008, 0x0011, 0x0017, 0x002C, 0x0037, 0x002C, 0x0018, 0x0011, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x002C, 0x0008, 0x0016, 0x0017, 0x002C, 0x0008, 0x0011, 0x0009,
+  0x0012, 0x0011, 0x0006, 0x0008, 0x0008, 0x002C, 0x0014, 0x0019, 0x0014, 0x0011, 0x0017, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0013, 0x0015, 0x0008, 0x0006, 0x0008,
+  0x0007, 0x0008, 0x0011, 0x0017, 0x0008, 0x002C, 0x0016, 0x0012, 0x000C, 0x0017, 0x002C, 0x0015,
+  0x0008, 0x000F, 0x0014, 0x0006, 0x000B, 0x0008, 0x0008, 0x0236, 0x0028, 0x0208, 0x0016, 0x0017,
+  0x0056, 0x0006, 0x0008, 0x002C, 0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0008, 0x002C, 0x0006,
+  0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0017, 0x000C, 0x0008, 0x0011, 0x0017,
+  0x002C, 0x0059, 0x005A, 0x0062, 0x002C, 0x0033, 0x0012, 0x0017, 0x0016, 0x002C, 0x0013, 0x0014,
+  0x0015, 0x002C, 0x0033, 0x000C, 0x0011, 0x0018, 0x0017, 0x0008, 0x002C, 0x0210, 0x002C, 0x0208,
+  0x0017, 0x002C, 0x005A, 0x0062, 0x0062, 0x002C, 0x0038, 0x002C, 0x020F, 0x0008, 0x0016, 0x002C,
+  0x0006, 0x0012, 0x0011, 0x0017, 0x0014, 0x0006, 0x0017, 0x0016, 0x002C, 0x0015, 0x0008, 0x0005,
+};
+
+static const TraceEdge s_corpus180[] = {
+  { 0, { 4, 4 }, true }, { 42906, { 2, 9 }, true }, { 74016, { 4, 4 }, false }, { 84016, { 1, 3 }, true },
+  { 129336, { 4, 5 }, true }, { 150219, { 2, 9 }, false }, { 186477, { 1, 3 }, false }, { 214278, { 3, 3 }, true },
+  { 218002, { 4, 5 }, false }, { 218100, { 4, 5 }, true }, { 218202, { 4, 5 }, false }, { 218271, { 4, 5 }, true },
+  { 218350, { 4, 5 }, false }, { 273268, { 2, 9 }, true }, { 306173, { 3, 3 }, false }, { 349919, { 1, 1 }, true },
+  { 388637, { 2, 9 }, false }, { 417711, { 3, 4 }, true }, { 461470, { 1, 1 }, false }, { 494414, { 1, 8 }, true },
+  { 495041, { 1, 8 }, false }, { 495358, { 1, 8 }, true }, { 496175, { 3, 4 }, false }, { 559519, { 1, 3 }, true },
+  { 580702, { 1, 8 }, false }, { 609000, { 1, 4 }, true }, { 668090, { 4, 5 }, true }, { 673098, { 1, 4 }, false },
+  { 674362, { 1, 3 }, false }, { 729964, { 1, 3 }, true }, { 760230, { 4, 5 }, false }, { 774559, { 2, 2 }, true },
+  { 812459, { 1, 3 }, false }, { 821112, { 1, 5 }, true }, { 848803, { 2, 2 }, false }, { 874607, { 4, 5 }, true },
+  { 918771, { 1, 5 }, false }, { 923092, { 1, 7 }, true }, { 971142, { 4, 5 }, false }, { 997377, { 3, 7 }, true },
+  { 1036916, { 1, 7 }, false }, { 1036987, { 1, 7 }, true }, { 1037186, { 1, 7 }, false }, { 1037419, { 1, 7 }, true },
+  { 1037550, { 1, 7 }, false }, { 1037673, { 1, 7 }, true }, { 1037779, { 1, 7 }, false }, { 1049242, { 4, 5 }, true },
+  { 1049306, { 4, 5 }, false }, { 1049383, { 4, 5 }, true }, { 1049439, { 4, 5 }, false }, { 1049521, { 4, 5 }, true },
+  { 1049597, { 4, 5 }, false }, { 1049670, { 4, 5 }, true }, { 1097784, { 3, 7 }, false }, { 1128872, { 4, 5 }, false },
+  { 1141523, { 1, 9 }, true }, { 1185409, { 1, 7 }, true }, { 1229986, { 1, 9 }, false }, { 1260034, { 1, 5 }, true },
+  { 1294434, { 1, 7 }, false }, { 1325907, { 1, 8 }, true }, { 1332780, { 1, 5 }, false }, { 1393431, { 2, 9 }, true },
+  { 1394148, { 1, 8 }, false }, { 1467194, { 2, 9 }, false }, { 1477144, { 4, 5 }, true }, { 1536626, { 2, 1 }, true },
+  { 1584015, { 4, 5 }, false }, { 1602001, { 1, 7 }, true }, { 1602367, { 1, 7 }, false }, { 1602444, { 1, 7 }, true },
+  { 1602687, { 1, 7 }, false }, { 1602864, { 1, 7 }, true }, { 1650646, { 2, 1 }, false }, { 1653712, { 1, 3 }, true },
+  { 1689878, { 1, 7 }, false }, { 1700013, { 4, 5 }, true }, { 1744578, { 4, 5 }, false }, { 1753339, { 2, 9 }, true },
+  { 1753541, { 2, 9 }, false }, { 1753839, { 2, 9 }, true }, { 1753926, { 2, 9 }, false }, { 1754243, { 2, 9 }, true },
+  { 1754521, { 2, 9 }, false }, { 1754578, { 4, 5 }, true }, { 1754645, { 2, 9 }, true }, { 1761254, { 1, 3 }, false },
+  { 1798308, { 1, 5 }, true }, { 1842061, { 2, 9 }, false }, { 1847789, { 4, 5 }, false }, { 1857789, { 1, 9 }, true },
+  { 1913693, { 1, 5 }, false }, { 1932264, { 1, 9 }, false }, { 1940508, { 3, 7 }, true }, { 2006447, { 4, 5 }, true },
+  { 2006529, { 4, 5 }, false }, { 2006597, { 4, 5 }, true }, { 2006679, { 4, 5 }, false }, { 2006733, { 4, 5 }, true },
+  { 2042660, { 3, 7 }, false }, { 2082869, { 4, 5 }, false }, { 2090763, { 1, 7 }, true }, { 2132626, { 1, 5 }, true },
+  { 2191977, { 1, 7 }, false }, { 2199978, { 1, 5 }, false }, { 2225224, { 1, 8 }, true }, { 2314226, { 1, 8 }, false },
+  { 2317328, { 2, 9 }, true }, { 2317762, { 2, 9 }, false }, { 2318048, { 2, 9 }, true }, { 2318265, { 2, 9 }, false },
+  { 2318336, { 2, 9 }, true }, { 2382947, { 1, 8 }, true }, { 2412737, { 2, 9 }, false }, { 2460087, { 2, 2 }, true },
+  { 2487520, { 1, 8 }, false }, { 2537672, { 2, 2 }, false }, { 2543073, { 1, 3 }, true }, { 2590276, { 4, 5 }, true },
+  { 2590340, { 4, 5 }, false }, { 2590473, { 4, 5 }, true }, { 2613313, { 1, 3 }, false }, { 2636992, { 1, 5 }, true },
+  { 2655223, { 4, 5 }, false }, { 2700177, { 1, 9 }, true }, { 2725966, { 1, 5 }, false }, { 2764322, { 1, 7 }, true },
+  { 2769153, { 1, 9 }, false }, { 2836333, { 1, 5 }, true }, { 2836583, { 1, 5 }, false }, { 2836837, { 1, 5 }, true },
+  { 2836900, { 1, 5 }, false }, { 2837145, { 1, 5 }, true }, { 2849508, { 1, 7 }, false }, { 2849805, { 1, 7 }, true },
+  { 2850009, { 1, 7 }, false }, { 2850157, { 1, 7 }, true }, { 2850333, { 1, 7 }, false }, { 2908052, { 1, 3 }, true },
+  { 2944384, { 1, 5 }, false }, { 2977788, { 4, 5 }, true }, { 2999892, { 1, 3 }, false }, { 3065699, { 2, 9 }, true },
+  { 3094352, { 4, 5 }, false }, { 3127590, { 1, 1 }, true }, { 3140263, { 2, 9 }, false }, { 3202320, { 4, 5 }, true },
+  { 3203180, { 1, 1 }, false }, { 3246060, { 2, 7 }, true }, { 3273441, { 4, 5 }, false }, { 3304126, { 1, 9 }, true },
+  { 3352784, { 2, 7 }, false }, { 3369348, { 1, 7 }, true }, { 3382348, { 1, 9 }, false }, { 3417702, { 1, 4 }, true },
+  { 3465687, { 3, 7 }, true }, { 3465821, { 3, 7 }, false }, { 3465966, { 3, 7 }, true }, { 3466155, { 3, 7 }, false },
+  { 3466272, { 3, 7 }, true }, { 3466402, { 3, 7 }, false }, { 3466468, { 3, 7 }, true }, { 3478558, { 1, 7 }, false },
+  { 3530087, { 1, 4 }, false }, { 3544091, { 3, 7 }, false }, { 3556846, { 1, 3 }, true }, { 3556923, { 1, 3 }, false },
+  { 3556974, { 1, 3 }, true }, { 3618058, { 1, 3 }, false }, { 3628058, { 1, 3 }, true }, { 3708687, { 3, 9 }, true },
+  { 3712232, { 1, 3 }, false }, { 3712307, { 1, 3 }, true }, { 3712402, { 1, 3 }, false }, { 3782684, { 4, 5 }, true },
+  { 3820763, { 3, 9 }, false }, { 3848593, { 1, 8 }, true }, { 3882855, { 4, 5 }, false }, { 3911505, { 2, 9 }, true },
+  { 3917944, { 1, 8 }, false }, { 3952910, { 4, 5 }, true }, { 3994003, { 2, 3 }, true }, { 4002004, { 2, 9 }, false },
+  { 4002071, { 2, 9 }, true }, { 4002378, { 2, 9 }, false }, { 4002834, { 2, 9 }, true }, { 4002996, { 2, 9 }, false },
+  { 4054091, { 4, 5 }, false }, { 4054189, { 4, 5 }, true }, { 4054346, { 4, 5 }, false }, { 4057844, { 1, 9 }, true },
+  { 4083340, { 2, 3 }, false }, { 4108950, { 1, 8 }, true }, { 4134614, { 1, 9 }, false }, { 4134759, { 1, 9 }, true },
+  { 4134822, { 1, 9 }, false }, { 4190891, { 1, 5 }, true }, { 4191048, { 1, 8 }, false }, { 4244717, { 4, 5 }, true },
+  { 4279461, { 1, 5 }, false }, { 4331276, { 4, 5 }, false }, { 4332582, { 2, 2 }, true }, { 4400278, { 2, 2 }, false },
+  { 4420781, { 1, 7 }, true }, { 4490413, { 1, 8 }, true }, { 4514805, { 1, 7 }, false }, { 4577740, { 3, 4 }, true },
+  { 4580833, { 1, 8 }, false }, { 4662128, { 1, 4 }, true }, { 4668457, { 3, 4 }, false }, { 4668684, { 3, 4 }, true },
+  { 4669084, { 3, 4 }, false }, { 4669569, { 3, 4 }, true }, { 4669623, { 3, 4 }, false }, { 4738467, { 1, 3 }, true },
+  { 4756114, { 1, 4 }, false }, { 4779600, { 4, 5 }, true }, { 4779716, { 4, 5 }, false }, { 4779787, { 4, 5 }, true },
+  { 4840942, { 2, 9 }, true }, { 4848003, { 1, 3 }, false }, { 4848169, { 1, 3 }, true }, { 4848330, { 1, 3 }, false },
+  { 4853907, { 4, 5 }, false }, { 4928692, { 1, 1 }, true }, { 4929076, { 1, 1 }, false }, { 4929716, { 1, 1 }, true },
+  { 4956205, { 2, 9 }, false }, { 5019277, { 4, 5 }, true }, { 5024721, { 1, 1 }, false }, { 5069292, { 2, 4 }, true },
+  { 5122821, { 1, 4 }, true }, { 5134119, { 4, 5 }, false }, { 5153454, { 2, 4 }, false }, { 5198544, { 1, 4 }, false },
+  { 5210968, { 1, 1 }, true }, { 5303628, { 1, 10 }, true }, { 5312828, { 1, 1 }, false }, { 5365816, { 1, 10 }, false },
+  { 5375816, { 1, 10 }, true }, { 5455508, { 1, 3 }, true }, { 5456333, { 1, 10 }, false }, { 5522683, { 4, 5 }, true },
+  { 5546283, { 1, 3 }, false }, { 5584451, { 2, 2 }, true }, { 5635406, { 4, 5 }, false }, { 5659615, { 1, 1 }, true },
+  { 5694427, { 2, 2 }, false }, { 5723202, { 1, 1 }, false }, { 5735847, { 3, 7 }, true }, { 5799572, { 2, 2 }, true },
+  { 5827593, { 3, 7 }, false }, { 5848617, { 4, 5 }, true }, { 5898945, { 2, 2 }, false }, { 5917204, { 1, 10 }, true },
+  { 5951980, { 4, 5 }, false }, { 5975714, { 1, 3 }, true }, { 5996798, { 1, 10 }, false }, { 6050865, { 1, 4 }, true },
+  { 6071741, { 1, 3 }, false }, { 6134927, { 2, 3 }, true }, { 6145548, { 1, 4 }, false }, { 6196779, { 1, 4 }, true },
+  { 6198307, { 2, 3 }, false }, { 6198913, { 2, 3 }, true }, { 6199873, { 2, 3 }, false }, { 6251781, { 1, 3 }, true },
+  { 6295122, { 4, 5 }, true }, { 6295240, { 1, 4 }, false }, { 6338899, { 1, 7 }, true }, { 6360812, { 1, 3 }, false },
+  { 6362377, { 4, 5 }, false }, { 6362461, { 4, 5 }, true }, { 6362571, { 4, 5 }, false }, { 6388957, { 3, 7 }, true },
+  { 6432162, { 1, 7 }, false }, { 6461588, { 3, 7 }, false }, { 6479276, { 1, 3 }, true }, { 6519655, { 4, 5 }, true },
+  { 6578691, { 2, 2 }, true }, { 6588446, { 1, 3 }, false }, { 6588573, { 1, 3 }, true }, { 6588691, { 1, 3 }, false },
+  { 6596512, { 4, 5 }, false }, { 6666902, { 1, 3 }, true }, { 6682092, { 2, 2 }, false }, { 6711404, { 1, 7 }, true },
+  { 6711611, { 1, 7 }, false }, { 6712219, { 1, 7 }, true }, { 6749620, { 1, 3 }, false }, { 6784249, { 2, 9 }, true },
+  { 6789141, { 1, 7 }, false }, { 6846500, { 1, 3 }, true }, { 6858009, { 2, 9 }, false }, { 6887665, { 4, 5 }, true },
+  { 6935277, { 1, 3 }, false }, { 6971852, { 4, 5 }, false }, { 6978026, { 1, 5 }, true }, { 7029609, { 1, 9 }, true },
+  { 7070950, { 1, 7 }, true }, { 7076854, { 1, 5 }, false }, { 7101818, { 1, 9 }, false }, { 7160880, { 3, 3 }, true },
+  { 7173364, { 1, 7 }, false }, { 7207726, { 2, 6 }, true }, { 7231992, { 3, 3 }, false }, { 7290482, { 1, 3 }, true },
+  { 7313534, { 2, 6 }, false }, { 7383025, { 3, 8 }, true }, { 7404433, { 1, 3 }, false }, { 7464567, { 4, 4 }, true },
+  { 7471442, { 4, 6 }, true }, { 7495249, { 3, 8 }, false }, { 7520378, { 2, 1 }, true }, { 7565210, { 4, 4 }, false },
+  { 7575210, { 1, 7 }, true }, { 7575959, { 4, 6 }, false }, { 7630105, { 2, 1 }, false }, { 7650226, { 1, 1 }, true },
+  { 7662197, { 1, 7 }, false }, { 7691086, { 3, 7 }, true }, { 7757191, { 1, 1 }, false }, { 7779100, { 2, 3 }, true },
+  { 7792319, { 3, 7 }, false }, { 7837180, { 4, 5 }, true }, { 7856599, { 2, 3 }, false }, { 7856723, { 2, 3 }, true },
+  { 7856851, { 2, 3 }, false }, { 7857130, { 2, 3 }, true }, { 7857660, { 2, 3 }, false }, { 7906400, { 4, 5 }, false },
+  { 7927470, { 1, 9 }, true }, { 7997652, { 3, 7 }, true }, { 8031049, { 1, 9 }, false }, { 8031103, { 1, 9 }, true },
+  { 8031158, { 1, 9 }, false }, { 8031243, { 1, 9 }, true }, { 8031340, { 1, 9 }, false }, { 8042603, { 4, 5 }, true },
+  { 8089176, { 3, 7 }, false }, { 8116704, { 4, 5 }, false }, { 8125846, { 1, 5 }, true }, { 8170355, { 1, 1 }, true },
+  { 8240836, { 1, 5 }, false }, { 8243281, { 1, 10 }, true }, { 8258265, { 1, 1 }, false }, { 8327354, { 1, 3 }, true },
+  { 8351612, { 1, 10 }, false }, { 8391253, { 1, 3 }, false }, { 8394704, { 4, 5 }, true }, { 8466762, { 4, 5 }, false },
+  { 8476008, { 3, 4 }, true }, { 8531590, { 1, 8 }, true }, { 8554909, { 3, 4 }, false }, { 8618924, { 1, 5 }, true },
+  { 8625574, { 1, 8 }, false }, { 8668359, { 1, 3 }, true }, { 8688136, { 1, 5 }, false }, { 8761177, { 3, 9 }, true },
+  { 8770519, { 1, 3 }, false }, { 8846586, { 4, 5 }, true }, { 8854640, { 3, 9 }, false }, { 8919480, { 2, 9 }, true },
+  { 8934854, { 4, 5 }, false }, { 8999498, { 1, 3 }, true }, { 9011544, { 2, 9 }, false }, { 9078130, { 1, 3 }, false },
+  { 9083211, { 2, 2 }, true }, { 9160103, { 2, 2 }, false }, { 9164380, { 4, 5 }, true }, { 9217667, { 2, 3 }, true },
+  { 9230872, { 4, 5 }, false }, { 9289427, { 2, 3 }, false }, { 9307230, { 1, 9 }, true }, { 9383125, { 1, 9 }, false },
+  { 9383235, { 1, 9 }, true }, { 9383334, { 1, 9 }, false }, { 9383428, { 1, 9 }, true }, { 9383489, { 1, 9 }, false },
+  { 9384469, { 1, 8 }, true }, { 9460229, { 2, 5 }, true }, { 9493083, { 1, 8 }, false }, { 9531079, { 1, 5 }, true },
+  { 9560070, { 2, 5 }, false }, { 9613276, { 2, 2 }, true }, { 9638612, { 1, 5 }, false }, { 9678829, { 4, 5 }, true },
+  { 9706318, { 2, 2 }, false }, { 9751233, { 2, 2 }, true }, { 9789320, { 4, 5 }, false }, { 9827616, { 2, 2 }, false },
+  { 9833803, { 1, 3 }, true }, { 9908359, { 1, 3 }, false }, { 9914609, { 4, 5 }, true }, { 9981258, { 3, 3 }, true },
+  { 10000105, { 4, 5 }, false }, { 10060954, { 2, 6 }, true }, { 10068664, { 3, 3 }, false }, { 10118156, { 1, 3 }, true },
+  { 10169040, { 2, 6 }, false }, { 10171127, { 3, 4 }, true }, { 10223511, { 1, 1 }, true }, { 10231795, { 1, 3 }, false },
+  { 10282053, { 3, 4 }, false }, { 10303187, { 1, 7 }, true }, { 10335374, { 1, 1 }, false }, { 10357125, { 3, 3 }, true },
+  { 10368375, { 1, 7 }, false }, { 10437053, { 2, 6 }, true }, { 10447545, { 3, 3 }, false }, { 10501578, { 2, 6 }, false },
+  { 10525665, { 1, 3 }, true }, { 10566102, { 3, 7 }, true }, { 10596584, { 1, 3 }, false }, { 10650096, { 1, 5 }, true },
+  { 10667595, { 3, 7 }, false }, { 10697923, { 4, 5 }, true }, { 10720564, { 4, 4 }, true }, { 10747897, { 1, 5 }, false },
+  { 10769126, { 3, 10 }, true }, { 10791470, { 4, 5 }, false }, { 10831066, { 4, 4 }, false }, { 10831168, { 4, 4 }, true },
+  { 10831273, { 4, 4 }, false }, { 10831428, { 4, 4 }, true }, { 10831624, { 4, 4 }, false }, { 10831766, { 4, 4 }, true },
+  { 10831897, { 4, 4 }, false }, { 10841066, { 4, 5 }, true }, { 10847792, { 3, 10 }, false }, { 10897791, { 1, 7 }, true },
+  { 10912957, { 4, 5 }, false }, { 10970177, { 3, 7 }, true }, { 10981097, { 1, 7 }, false }, { 11020430, { 1, 3 }, true },
+  { 11087130, { 3, 7 }, false }, { 11098560, { 4, 5 }, true }, { 11134395, { 1, 3 }, false }, { 11159121, { 1, 5 }, true },
+  { 11184871, { 4, 5 }, false }, { 11221642, { 1, 9 }, true }, { 11256287, { 1, 5 }, false }, { 11267243, { 1, 7 }, true },
+  { 11290852, { 1, 9 }, false }, { 11307939, { 3, 3 }, true }, { 11375971, { 3, 3 }, false }, { 11380679, { 1, 7 }, false },
+  { 11381674, { 2, 6 }, true }, { 11447744, { 1, 3 }, true }, { 11492318, { 2, 6 }, false }, { 11528793, { 4, 5 }, true },
+  { 11543830, { 1, 3 }, false }, { 11610131, { 1, 3 }, true }, { 11636679, { 4, 5 }, false }, { 11692275, { 1, 3 }, false },
+  { 11696143, { 2, 2 }, true }, { 11757979, { 1, 5 }, true }, { 11758161, { 1, 5 }, false }, { 11758237, { 1, 5 }, true },
+  { 11758336, { 1, 5 }, false }, { 11758494, { 1, 5 }, true }, { 11758671, { 1, 5 }, false }, { 11758835, { 1, 5 }, true },
+  { 11782549, { 2, 2 }, false }, { 11835622, { 4, 5 }, true }, { 11855420, { 1, 5 }, false }, { 11900785, { 1, 3 }, true },
+  { 11905989, { 4, 5 }, false }, { 11959096, { 3, 7 }, true }, { 11967161, { 1, 3 }, false }, { 12042335, { 2, 4 }, true },
+  { 12066410, { 3, 7 }, false }, { 12066910, { 3, 7 }, true }, { 12067220, { 3, 7 }, false }, { 12099886, { 1, 9 }, true },
+  { 12156081, { 2, 4 }, false }, { 12182950, { 3, 7 }, true }, { 12213514, { 1, 9 }, false }, { 12259829, { 3, 3 }, true },
+  { 12284080, { 3, 7 }, false }, { 12325735, { 1, 3 }, true }, { 12366850, { 3, 3 }, false }, { 12389747, { 1, 3 }, false },
+  { 12399747, { 1, 3 }, true }, { 12479367, { 4, 5 }, true }, { 12501931, { 1, 3 }, false }, { 12501987, { 1, 3 }, true },
+  { 12502075, { 1, 3 }, false }, { 12502150, { 1, 3 }, true }, { 12502207, { 1, 3 }, false }, { 12502285, { 1, 3 }, true },
+  { 12502350, { 1, 3 }, false }, { 12552638, { 1, 1 }, true }, { 12575412, { 4, 5 }, false }, { 12575507, { 4, 5 }, true },
+  { 12575600, { 4, 5 }, false }, { 12575683, { 4, 5 }, true }, { 12575744, { 4, 5 }, false }, { 12630688, { 3, 4 }, true },
+  { 12648913, { 1, 1 }, false }, { 12693365, { 1, 1 }, true }, { 12694022, { 1, 1 }, false }, { 12694238, { 1, 1 }, true },
+  { 12746543, { 3, 4 }, false }, { 12755969, { 3, 7 }, true }, { 12756369, { 3, 7 }, false }, { 12756475, { 3, 7 }, true },
+  { 12780548, { 1, 1 }, false }, { 12832995, { 1, 5 }, true }, { 12855188, { 3, 7 }, false }, { 12903603, { 4, 5 }, true },
+  { 12928808, { 1, 5 }, false }, { 12955706, { 2, 1 }, true }, { 13007422, { 4, 5 }, false }, { 13008027, { 1, 7 }, true },
+  { 13041806, { 2, 1 }, false }, { 13068784, { 1, 3 }, true }, { 13118661, { 1, 7 }, false }, { 13136819, { 4, 5 }, true },
+  { 13138776, { 1, 3 }, false }, { 13220228, { 2, 9 }, true }, { 13238603, { 4, 5 }, false }, { 13299617, { 2, 9 }, false },
+  { 13300809, { 1, 1 }, true }, { 13347032, { 4, 5 }, true }, { 13394385, { 1, 1 }, false }, { 13399082, { 1, 10 }, true },
+  { 13448078, { 4, 5 }, false }, { 13472584, { 1, 10 }, false }, { 13486622, { 1, 4 }, true }, { 13551178, { 1, 4 }, false },
+  { 13552336, { 1, 3 }, true }, { 13609610, { 3, 3 }, true }, { 13610069, { 3, 3 }, false }, { 13610516, { 3, 3 }, true },
+  { 13648731, { 1, 3 }, false }, { 13671621, { 1, 3 }, true }, { 13696081, { 3, 3 }, false }, { 13696281, { 3, 3 }, true },
+  { 13696752, { 3, 3 }, false }, { 13723990, { 2, 3 }, true }, { 13724681, { 2, 3 }, false }, { 13725163, { 2, 3 }, true },
+  { 13725222, { 2, 3 }, false }, { 13725341, { 2, 3 }, true }, { 13761349, { 1, 3 }, false }, { 13771349, { 1, 3 }, true },
+  { 13822611, { 2, 3 }, false }, { 13835546, { 1, 3 }, false }, { 13838640, { 3, 7 }, true }, { 13927948, { 1, 5 }, true },
+  { 13954037, { 3, 7 }, false }, { 13985507, { 1, 3 }, true }, { 14033428, { 1, 5 }, false }, { 14070853, { 4, 5 }, true },
+  { 14081955, { 1, 3 }, false }, { 14161518, { 2, 2 }, true }, { 14173287, { 4, 5 }, false }, { 14233046, { 1, 9 }, true },
+  { 14275588, { 2, 2 }, false }, { 14285412, { 1, 8 }, true }, { 14285658, { 1, 8 }, false }, { 14285755, { 1, 8 }, true },
+  { 14285888, { 1, 8 }, false }, { 14286171, { 1, 8 }, true }, { 14286420, { 1, 8 }, false }, { 14286609, { 1, 8 }, true },
+  { 14323441, { 1, 9 }, false }, { 14350173, { 1, 5 }, true }, { 14394957, { 1, 8 }, false }, { 14430255, { 4, 5 }, true },
+  { 14430332, { 4, 5 }, false }, { 14430415, { 4, 5 }, true }, { 14432649, { 1, 5 }, false }, { 14432737, { 1, 5 }, true },
+  { 14432878, { 1, 5 }, false }, { 14432970, { 1, 5 }, true }, { 14433024, { 1, 5 }, false }, { 14433134, { 1, 5 }, true },
+  { 14433213, { 1, 5 }, false }, { 14492423, { 1, 4 }, true }, { 14492551, { 1, 4 }, false }, { 14492694, { 1, 4 }, true },
+  { 14492838, { 1, 4 }, false }, { 14492933, { 1, 4 }, true }, { 14493093, { 1, 4 }, false }, { 14493239, { 1, 4 }, true },
+  { 14542662, { 4, 5 }, false }, { 14550334, { 1, 3 }, true }, { 14571411, { 1, 4 }, false }, { 14601009, { 2, 9 }, true },
+  { 14642283, { 1, 3 }, false }, { 14675095, { 1, 1 }, true }, { 14712027, { 2, 9 }, false }, { 14733075, { 3, 3 }, true },
+  { 14782383, { 1, 1 }, false }, { 14784349, { 2, 6 }, true }, { 14830881, { 3, 3 }, false }, { 14857405, { 2, 6 }, false },
+  { 14862117, { 1, 3 }, true }, { 14906508, { 1, 3 }, false }, { 14916508, { 1, 3 }, true }, { 14998051, { 3, 8 }, true },
+  { 15024285, { 1, 3 }, false }, { 15067984, { 3, 8 }, false }, { 15078612, { 4, 6 }, true }, { 15087689, { 4, 4 }, true },
+  { 15118918, { 1, 3 }, true }, { 15152881, { 4, 4 }, false }, { 15154963, { 4, 6 }, false }, { 15162881, { 2, 2 }, true },
+  { 15222522, { 1, 5 }, true }, { 15232892, { 1, 3 }, false }, { 15258638, { 4, 5 }, true }, { 15267150, { 2, 2 }, false },
+  { 15267670, { 2, 2 }, true }, { 15268261, { 2, 2 }, false }, { 15289109, { 1, 10 }, true }, { 15325206, { 1, 5 }, false },
+  { 15352258, { 1, 10 }, false }, { 15368017, { 4, 5 }, false }, { 15378017, { 3, 3 }, true }, { 15444443, { 1, 3 }, true },
+  { 15473929, { 3, 3 }, false }, { 15503916, { 4, 5 }, true }, { 15510904, { 1, 3 }, false }, { 15560764, { 2, 1 }, true },
+  { 15585461, { 4, 5 }, false }, { 15622639, { 1, 7 }, true }, { 15636598, { 2, 1 }, false }, { 15696046, { 1, 3 }, true },
+  { 15736102, { 1, 7 }, false }, { 15781129, { 4, 5 }, true }, { 15788261, { 1, 3 }, false }, { 15861042, { 2, 9 }, true },
+  { 15891785, { 4, 5 }, false }, { 15915742, { 1, 3 }, true }, { 15915799, { 1, 3 }, false }, { 15915851, { 1, 3 }, true },
+  { 15915954, { 1, 3 }, false }, { 15916034, { 1, 3 }, true }, { 15961051, { 4, 5 }, true }, { 15964040, { 2, 9 }, false },
+  { 15982172, { 1, 3 }, false }, { 16031464, { 4, 5 }, false }, { 16044130, { 3, 3 }, true }, { 16136637, { 2, 9 }, true },
+  { 16159347, { 3, 3 }, false }, { 16202229, { 2, 9 }, false }, { 16213981, { 1, 1 }, true }, { 16278355, { 1, 1 }, false },
+  { 16299807, { 3, 4 }, true }, { 16361090, { 1, 8 }, true }, { 16377183, { 3, 4 }, false }, { 16431410, { 1, 3 }, true },
+  { 16448493, { 1, 8 }, false }, { 16523380, { 1, 3 }, false }, { 16523461, { 1, 3 }, true }, { 16523558, { 1, 3 }, false },
+  { 16523639, { 1, 3 }, true }, { 16523735, { 1, 3 }, false }, { 16524640, { 1, 4 }, true }, { 16524720, { 1, 4 }, false },
+  { 16524966, { 1, 4 }, true }, { 16603213, { 4, 5 }, true }, { 16636931, { 1, 4 }, false }, { 16667810, { 1, 5 }, true },
+  { 16667979, { 1, 5 }, false }, { 16668111, { 1, 5 }, true }, { 16668291, { 1, 5 }, false }, { 16668445, { 1, 5 }, true },
+  { 16668584, { 1, 5 }, false }, { 16668748, { 1, 5 }, true }, { 16711057, { 4, 5 }, false }, { 16737244, { 1, 5 }, false },
+  { 16737354, { 1, 5 }, true }, { 16737555, { 1, 5 }, false }, { 16753629, { 1, 8 }, true }, { 16817510, { 1, 3 }, true },
+  { 16859842, { 1, 8 }, false }, { 16907835, { 3, 7 }, true }, { 16913339, { 1, 3 }, false }, { 16958390, { 1, 5 }, true },
+  { 16994838, { 3, 7 }, false }, { 17020389, { 4, 5 }, true }, { 17056139, { 1, 5 }, false }, { 17057515, { 4, 5 }, false },
+  { 17067515, { 4, 5 }, true }, { 17097300, { 3, 7 }, true }, { 17162550, { 3, 7 }, false }, { 17171198, { 3, 8 }, true },
+  { 17224864, { 4, 7 }, true }, { 17225106, { 4, 7 }, false }, { 17225742, { 4, 7 }, true }, { 17273376, { 3, 8 }, false },
+  { 17275641, { 4, 5 }, false }, { 17285641, { 4, 5 }, true }, { 17307146, { 4, 7 }, false }, { 17359895, { 2, 10 }, true },
+  { 17383661, { 4, 5 }, false }, { 17383782, { 4, 5 }, true }, { 17383873, { 4, 5 }, false }, { 17404049, { 1, 9 }, true },
+  { 17404147, { 1, 9 }, false }, { 17404269, { 1, 9 }, true }, { 17404320, { 1, 9 }, false }, { 17404371, { 1, 9 }, true },
+  { 17474069, { 2, 10 }, false }, { 17476410, { 1, 5 }, true }, { 17497704, { 1, 9 }, false }, { 17555878, { 2, 2 }, true },
+  { 17566025, { 1, 5 }, false }, { 17566192, { 1, 5 }, true }, { 17566379, { 1, 5 }, false }, { 17566528, { 1, 5 }, true },
+  { 17566654, { 1, 5 }, false }, { 17566742, { 1, 5 }, true }, { 17566929, { 1, 5 }, false }, { 17611622, { 4, 5 }, true },
+  { 17640373, { 2, 2 }, false }, { 17677850, { 1, 10 }, true }, { 17694506, { 4, 5 }, false }, { 17740998, { 1, 10 }, false },
+  { 17751737, { 1, 1 }, true }, { 17811105, { 1, 4 }, true }, { 17859655, { 1, 1 }, false }, { 17872986, { 4, 5 }, true },
+  { 17876516, { 1, 4 }, false }, { 17945074, { 2, 10 }, true }, { 17987706, { 4, 5 }, false }, { 17992092, { 1, 8 }, true },
+  { 17992439, { 1, 8 }, false }, { 17992706, { 1, 8 }, true }, { 17993092, { 1, 8 }, false }, { 17993498, { 1, 8 }, true },
+  { 18053863, { 2, 10 }, false }, { 18074818, { 3, 7 }, true }, { 18101687, { 1, 8 }, false }, { 18150129, { 3, 7 }, false },
+  { 18166004, { 1, 7 }, true }, { 18214478, { 1, 5 }, true }, { 18256813, { 1, 3 }, true }, { 18257239, { 1, 7 }, false },
+  { 18295234, { 1, 5 }, false }, { 18295399, { 1, 5 }, true }, { 18295479, { 1, 5 }, false }, { 18295590, { 1, 5 }, true },
+  { 18295687, { 1, 5 }, false }, { 18295781, { 1, 5 }, true }, { 18295833, { 1, 5 }, false }, { 18299835, { 4, 5 }, true },
+  { 18311659, { 4, 4 }, true }, { 18323254, { 1, 3 }, false }, { 18344264, { 3, 9 }, true }, { 18365253, { 4, 5 }, false },
+  { 18389181, { 4, 4 }, false }, { 18399181, { 4, 5 }, true }, { 18439219, { 3, 9 }, false }, { 18439798, { 3, 9 }, true },
+  { 18439926, { 3, 9 }, false }, { 18441856, { 4, 4 }, true }, { 18463919, { 4, 5 }, false }, { 18479153, { 1, 3 }, true },
+  { 18560951, { 4, 4 }, false }, { 18570951, { 1, 5 }, true }, { 18576890, { 1, 3 }, false }, { 18622827, { 4, 5 }, true },
+  { 18642827, { 4, 5 }, false }, { 18652827, { 4, 5 }, true }, { 18671442, { 1, 5 }, false }, { 18678499, { 3, 8 }, true },
+  { 18762171, { 4, 7 }, true }, { 18780484, { 3, 8 }, false }, { 18832396, { 4, 7 }, false }, { 18850602, { 4, 7 }, true },
+  { 18905021, { 4, 5 }, false }, { 18915021, { 4, 5 }, true }, { 18927447, { 4, 7 }, false }, { 18930631, { 4, 4 }, true },
+  { 18956273, { 3, 8 }, true }, { 18991206, { 4, 5 }, false }, { 19028993, { 4, 4 }, false }, { 19038993, { 4, 5 }, true },
+  { 19058279, { 4, 4 }, true }, { 19063841, { 3, 8 }, false }, { 19093932, { 2, 9 }, true }, { 19143880, { 4, 5 }, false },
+  { 19159333, { 2, 9 }, false }, { 19164951, { 4, 4 }, false }, { 19174951, { 1, 3 }, true }, { 19237758, { 2, 2 }, true },
+  { 19265811, { 1, 3 }, false }, { 19307917, { 4, 5 }, true }, { 19325286, { 2, 2 }, false }, { 19373001, { 3, 3 }, true },
+  { 19386813, { 4, 5 }, false }, { 19462101, { 1, 9 }, true }, { 19471864, { 3, 3 }, false }, { 19532425, { 3, 7 }, true },
+  { 19577935, { 1, 9 }, false }, { 19610963, { 3, 7 }, false }, { 19618847, { 1, 5 }, true }, { 19663086, { 1, 1 }, true },
+  { 19703963, { 3, 3 }, true }, { 19724585, { 1, 5 }, false }, { 19768923, { 1, 1 }, false }, { 19772047, { 3, 3 }, false },
+  { 19796785, { 1, 5 }, true }, { 19848940, { 2, 2 }, true }, { 19873132, { 1, 5 }, false }, { 19930381, { 4, 5 }, true },
+  { 19952920, { 2, 2 }, false }, { 19982329, { 1, 4 }, true }, { 19982456, { 1, 4 }, false }, { 19982538, { 1, 4 }, true },
+  { 19982599, { 1, 4 }, false }, { 19982752, { 1, 4 }, true }, { 19982811, { 1, 4 }, false }, { 19982958, { 1, 4 }, true },
+  { 20014166, { 4, 5 }, false }, { 20023576, { 1, 3 }, true }, { 20094985, { 1, 4 }, false }, { 20102315, { 3, 5 }, true },
+  { 20122432, { 1, 3 }, false }, { 20165925, { 3, 5 }, false },
+};
+
+static const uint16_t s_corpus180Typed[] = {
+  0x020F, 0x0008, 0x002C, 0x0006, 0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0008,
+  0x0016, 0x0017, 0x002C, 0x0018, 0x0011, 0x002C, 0x0012, 0x0018, 0x0017, 0x000C, 0x000F, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0021, 0x0012, 0x0011, 0x002C, 0x0018, 0x0017, 0x000C,
+  0x000F, 0x000C, 0x0016, 0x0008, 0x002C, 0x0017, 0x0012, 0x0018, 0x0017, 0x0008, 0x002C, 0x000F,
+  0x0014, 0x002C, 0x000D, 0x0012, 0x0018, 0x0015, 0x0011, 0x0008, 0x0008, 0x0010, 0x002C, 0x000C,
+  0x000F, 0x002C, 0x0007, 0x0012, 0x000C, 0x0017, 0x002C, 0x0016, 0x0018, 0x000C, 0x0019, 0x0015,
+  0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0009, 0x0015, 0x0014, 0x0013, 0x0013, 0x0008, 0x002C,
+  0x0016, 0x0014, 0x0011, 0x0016, 0x002C, 0x0013, 0x0008, 0x0015, 0x0007, 0x0015, 0x0008, 0x002C,
+  0x0018, 0x0011, 0x0008, 0x002C, 0x0016, 0x0008, 0x0018, 0x000F, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x0236, 0x0028, 0x0204, 0x0018, 0x0014, 0x0011, 0x0007, 0x002C,
+  0x0012, 0x0011, 0x002C, 0x0017, 0x0014, 0x0013, 0x0008, 0x002C, 0x0019, 0x000C, 0x0017, 0x0008,
+  0x0010, 0x002C, 0x000F, 0x0008, 0x0016, 0x002C, 0x0007, 0x0012, 0x000C, 0x000A, 0x0017, 0x0016,
+  0x002C, 0x0016, 0x0008, 0x002C, 0x0006, 0x000B, 0x0008, 0x0019, 0x0014, 0x0018, 0x0006, 0x000B,
+  0x0008, 0x0011, 0x0017, 0x002C, 0x0037, 0x002C, 0x0018, 0x0011, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x002C, 0x0008, 0x0016, 0x0017, 0x002C, 0x0008, 0x0011, 0x0009,
+  0x0012, 0x0011, 0x0006, 0x0008, 0x0008, 0x002C, 0x0014, 0x0019, 0x0014, 0x0011, 0x0017, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0013, 0x0015, 0x0008, 0x0006, 0x0008,
+  0x0007, 0x0008, 0x0011, 0x0017, 0x0008, 0x002C, 0x0016, 0x0012, 0x000C, 0x0017, 0x002C, 0x0015,
+  0x0008, 0x000F, 0x0014, 0x0006, 0x000B, 0x0008, 0x0008, 0x0236, 0x0028, 0x0208, 0x0016, 0x0017,
+  0x0056, 0x0006, 0x0008, 0x002C, 0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0008, 0x002C, 0x0006,
+  0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0017, 0x000C, 0x0008, 0x0011, 0x0017,
+  0x002C, 0x0059, 0x005A, 0x0062, 0x002C, 0x0033, 0x0012, 0x0017, 0x0016, 0x002C, 0x0013, 0x0014,
+  0x0015, 0x002C, 0x0033, 0x000C, 0x0011, 0x0018, 0x0017, 0x0008, 0x002C, 0x0210, 0x002C, 0x0208,
+  0x0017, 0x002C, 0x005A, 0x0062, 0x0062, 0x002C, 0x0038, 0x002C, 0x020F, 0x0008, 0x0016, 0x002C,
+  0x0006, 0x0012, 0x0011, 0x0017, 0x0014, 0x0006, 0x0017, 0x0016, 0x002C, 0x0015, 0x0008, 0x0005,
+};
+
+static const TraceEdge s_corpus220[] = {
+  { 0, { 4, 4 }, true }, { 43961, { 2, 9 }, true }, { 68272, { 4, 4 }, false }, { 68967, { 4, 4 }, true },
+  { 69762, { 4, 4 }, false }, { 78272, { 1, 3 }, true }, { 119864, { 2, 9 }, false }, { 137987, { 4, 5 }, true },
+  { 160583, { 1, 3 }, false }, { 198412, { 3, 3 }, true }, { 244439, { 4, 5 }, false }, { 261270, { 2, 9 }, true },
+  { 268886, { 3, 3 }, false }, { 298398, { 1, 1 }, true }, { 331973, { 3, 4 }, true }, { 357871, { 2, 9 }, false },
+  { 363751, { 1, 1 }, false }, { 398011, { 3, 4 }, false }, { 407505, { 1, 8 }, true }, { 471409, { 1, 8 }, false },
+  { 472356, { 1, 3 }, true }, { 523126, { 1, 4 }, true }, { 585655, { 1, 3 }, false }, { 589527, { 1, 4 }, false },
+  { 592625, { 4, 5 }, true }, { 659721, { 1, 3 }, true }, { 700813, { 4, 5 }, false }, { 724655, { 2, 2 }, true },
+  { 732819, { 1, 3 }, false }, { 797613, { 1, 5 }, true }, { 832315, { 2, 2 }, false }, { 863524, { 1, 5 }, false },
+  { 867066, { 4, 5 }, true }, { 919135, { 1, 7 }, true }, { 961679, { 4, 5 }, false }, { 967142, { 3, 7 }, true },
+  { 982303, { 1, 7 }, false }, { 1031305, { 4, 5 }, true }, { 1075412, { 3, 7 }, false }, { 1089096, { 1, 9 }, true },
+  { 1134367, { 1, 7 }, true }, { 1137033, { 4, 5 }, false }, { 1180904, { 1, 9 }, false }, { 1181879, { 1, 5 }, true },
+  { 1214611, { 1, 7 }, false }, { 1218697, { 1, 8 }, true }, { 1253284, { 1, 5 }, false }, { 1276643, { 2, 9 }, true },
+  { 1276775, { 2, 9 }, false }, { 1277131, { 2, 9 }, true }, { 1277532, { 2, 9 }, false }, { 1277795, { 2, 9 }, true },
+  { 1322318, { 1, 8 }, false }, { 1325964, { 4, 5 }, true }, { 1368996, { 2, 1 }, true }, { 1370183, { 2, 9 }, false },
+  { 1403706, { 1, 7 }, true }, { 1439657, { 1, 3 }, true }, { 1441288, { 4, 5 }, false }, { 1459856, { 2, 1 }, false },
+  { 1502617, { 1, 7 }, false }, { 1512876, { 4, 5 }, true }, { 1555149, { 1, 3 }, false }, { 1565362, { 2, 9 }, true },
+  { 1570093, { 4, 5 }, false }, { 1580093, { 4, 5 }, true }, { 1635961, { 1, 5 }, true }, { 1649160, { 2, 9 }, false },
+  { 1678456, { 4, 5 }, false }, { 1688456, { 1, 9 }, true }, { 1739506, { 1, 5 }, false }, { 1756301, { 3, 7 }, true },
+  { 1761235, { 1, 9 }, false }, { 1803941, { 4, 5 }, true }, { 1838532, { 1, 7 }, true }, { 1870241, { 3, 7 }, false },
+  { 1870634, { 3, 7 }, true }, { 1870694, { 3, 7 }, false }, { 1870960, { 3, 7 }, true }, { 1871185, { 3, 7 }, false },
+  { 1871392, { 3, 7 }, true }, { 1871776, { 3, 7 }, false }, { 1910438, { 4, 5 }, false }, { 1914887, { 1, 5 }, true },
+  { 1937246, { 1, 7 }, false }, { 1983702, { 1, 5 }, false }, { 1985171, { 1, 8 }, true }, { 2041866, { 2, 9 }, true },
+  { 2073740, { 1, 8 }, false }, { 2109966, { 1, 8 }, true }, { 2126574, { 2, 9 }, false }, { 2150563, { 2, 2 }, true },
+  { 2188450, { 1, 8 }, false }, { 2204782, { 1, 3 }, true }, { 2232948, { 2, 2 }, false }, { 2258094, { 4, 5 }, true },
+  { 2291763, { 1, 3 }, false }, { 2333062, { 1, 5 }, true }, { 2368161, { 1, 9 }, true }, { 2373341, { 4, 5 }, false },
+  { 2410561, { 1, 5 }, false }, { 2421561, { 1, 7 }, true }, { 2449332, { 1, 9 }, false }, { 2496367, { 1, 5 }, true },
+  { 2516013, { 1, 7 }, false }, { 2560389, { 1, 3 }, true }, { 2597586, { 1, 5 }, false }, { 2636308, { 4, 5 }, true },
+  { 2655956, { 1, 3 }, false }, { 2670824, { 2, 9 }, true }, { 2707360, { 1, 1 }, true }, { 2712986, { 4, 5 }, false },
+  { 2744897, { 4, 5 }, true }, { 2754704, { 2, 9 }, false }, { 2785033, { 1, 1 }, false }, { 2813089, { 2, 7 }, true },
+  { 2845209, { 4, 5 }, false }, { 2875671, { 1, 9 }, true }, { 2877067, { 2, 7 }, false }, { 2937282, { 1, 7 }, true },
+  { 2955489, { 1, 9 }, false }, { 2970772, { 1, 4 }, true }, { 3035092, { 1, 7 }, false }, { 3043161, { 3, 7 }, true },
+  { 3043237, { 3, 7 }, false }, { 3043723, { 3, 7 }, true }, { 3043960, { 3, 7 }, false }, { 3044396, { 3, 7 }, true },
+  { 3075700, { 1, 4 }, false }, { 3075955, { 1, 4 }, true }, { 3076065, { 1, 4 }, false }, { 3076313, { 1, 4 }, true },
+  { 3076420, { 1, 4 }, false }, { 3076647, { 1, 4 }, true }, { 3076703, { 1, 3 }, true }, { 3076872, { 1, 4 }, false },
+  { 3136145, { 1, 3 }, false }, { 3146145, { 1, 3 }, true }, { 3154826, { 3, 7 }, false }, { 3155146, { 3, 7 }, true },
+  { 3155586, { 3, 7 }, false }, { 3156197, { 3, 7 }, true }, { 3156562, { 3, 7 }, false }, { 3220472, { 3, 9 }, true },
+  { 3262574, { 1, 3 }, false }, { 3290323, { 4, 5 }, true }, { 3321043, { 3, 9 }, false }, { 3331532, { 1, 8 }, true },
+  { 3385714, { 2, 9 }, true }, { 3407102, { 4, 5 }, false }, { 3412666, { 1, 8 }, false }, { 3442762, { 4, 5 }, true },
+  { 3469223, { 2, 9 }, false }, { 3508058, { 2, 3 }, true }, { 3516905, { 4, 5 }, false }, { 3581621, { 1, 9 }, true },
+  { 3613846, { 2, 3 }, false }, { 3645638, { 1, 8 }, true }, { 3674662, { 1, 9 }, false }, { 3694667, { 1, 5 }, true },
+  { 3731313, { 1, 8 }, false }, { 3731887, { 4, 5 }, true }, { 3779556, { 1, 5 }, false }, { 3787709, { 2, 2 }, true },
+  { 3798445, { 4, 5 }, false }, { 3798580, { 4, 5 }, true }, { 3798680, { 4, 5 }, false }, { 3798855, { 4, 5 }, true },
+  { 3798965, { 4, 5 }, false }, { 3842703, { 1, 7 }, true }, { 3854611, { 2, 2 }, false }, { 3890982, { 1, 8 }, true },
+  { 3951439, { 1, 7 }, false }, { 3953732, { 3, 4 }, true }, { 3979136, { 1, 8 }, false }, { 4009255, { 1, 4 }, true },
+  { 4036547, { 3, 4 }, false }, { 4068326, { 1, 3 }, true }, { 4074639, { 1, 4 }, false }, { 4116472, { 4, 5 }, true },
+  { 4150190, { 2, 9 }, true }, { 4184387, { 1, 3 }, false }, { 4219516, { 4, 5 }, false }, { 4224787, { 1, 1 }, true },
+  { 4231730, { 2, 9 }, false }, { 4300576, { 4, 5 }, true }, { 4326221, { 1, 1 }, false }, { 4338569, { 2, 4 }, true },
+  { 4381034, { 1, 4 }, true }, { 4397436, { 4, 5 }, false }, { 4419116, { 1, 1 }, true }, { 4421710, { 2, 4 }, false },
+  { 4462989, { 1, 10 }, true }, { 4465749, { 1, 4 }, false }, { 4504403, { 1, 10 }, false }, { 4506015, { 1, 1 }, false },
+  { 4514403, { 1, 10 }, true }, { 4578150, { 1, 3 }, true }, { 4580250, { 1, 10 }, false }, { 4614543, { 4, 5 }, true },
+  { 4656976, { 1, 3 }, false }, { 4682286, { 2, 2 }, true }, { 4726720, { 4, 5 }, false }, { 4726958, { 4, 5 }, true },
+  { 4727265, { 4, 5 }, false }, { 4736808, { 1, 1 }, true }, { 4747576, { 2, 2 }, false }, { 4773342, { 3, 7 }, true },
+  { 4810642, { 2, 2 }, true }, { 4838602, { 3, 7 }, false }, { 4844673, { 1, 1 }, false }, { 4855999, { 4, 5 }, true },
+  { 4881303, { 2, 2 }, false }, { 4897930, { 1, 10 }, true }, { 4934825, { 1, 3 }, true }, { 4953820, { 4, 5 }, false },
+  { 4976771, { 1, 4 }, true }, { 4995672, { 1, 10 }, false }, { 5031390, { 1, 3 }, false }, { 5046442, { 2, 3 }, true },
+  { 5064878, { 1, 4 }, false }, { 5081812, { 1, 4 }, true }, { 5122379, { 2, 3 }, false }, { 5148904, { 1, 3 }, true },
+  { 5179255, { 1, 4 }, false }, { 5193936, { 4, 5 }, true }, { 5227498, { 1, 7 }, true }, { 5247174, { 1, 3 }, false },
+  { 5257189, { 4, 5 }, false }, { 5257332, { 4, 5 }, true }, { 5257409, { 4, 5 }, false }, { 5257560, { 4, 5 }, true },
+  { 5257663, { 4, 5 }, false }, { 5257816, { 4, 5 }, true }, { 5257879, { 4, 5 }, false }, { 5282944, { 3, 7 }, true },
+  { 5283368, { 3, 7 }, false }, { 5283628, { 3, 7 }, true }, { 5283957, { 3, 7 }, false }, { 5284237, { 3, 7 }, true },
+  { 5284351, { 3, 7 }, false }, { 5284640, { 3, 7 }, true }, { 5340668, { 1, 7 }, false }, { 5356922, { 1, 3 }, true },
+  { 5380385, { 3, 7 }, false }, { 5392006, { 4, 5 }, true }, { 5433810, { 2, 2 }, true }, { 5460954, { 4, 5 }, false },
+  { 5462727, { 1, 3 }, false }, { 5472727, { 1, 3 }, true }, { 5525835, { 2, 2 }, false }, { 5534436, { 1, 7 }, true },
+  { 5577138, { 2, 9 }, true }, { 5587217, { 1, 3 }, false }, { 5612280, { 1, 3 }, true }, { 5631084, { 1, 7 }, false },
+  { 5669705, { 4, 5 }, true }, { 5680950, { 2, 9 }, false }, { 5698151, { 1, 3 }, false }, { 5715773, { 1, 5 }, true },
+  { 5755759, { 1, 9 }, true }, { 5778232, { 4, 5 }, false }, { 5792477, { 1, 7 }, true }, { 5802376, { 1, 5 }, false },
+  { 5825475, { 3, 3 }, true }, { 5838963, { 1, 9 }, false }, { 5860912, { 2, 6 }, true }, { 5888549, { 1, 7 }, false },
+  { 5922196, { 1, 3 }, true }, { 5930664, { 3, 3 }, false }, { 5941601, { 2, 6 }, false }, { 5941731, { 2, 6 }, true },
+  { 5942000, { 2, 6 }, false }, { 5942051, { 2, 6 }, true }, { 5942140, { 2, 6 }, false }, { 5978272, { 3, 8 }, true },
+  { 5987201, { 1, 3 }, false }, { 6028564, { 4, 6 }, true }, { 6059069, { 4, 4 }, true }, { 6068959, { 3, 8 }, false },
+  { 6094704, { 2, 1 }, true }, { 6115810, { 4, 6 }, false }, { 6117456, { 4, 4 }, false }, { 6127456, { 1, 7 }, true },
+  { 6162793, { 1, 1 }, true }, { 6196265, { 1, 7 }, false }, { 6206809, { 2, 1 }, false }, { 6226161, { 1, 1 }, false },
+  { 6237929, { 3, 7 }, true }, { 6285537, { 2, 3 }, true }, { 6305581, { 3, 7 }, false }, { 6337791, { 4, 5 }, true },
+  { 6337919, { 4, 5 }, false }, { 6338033, { 4, 5 }, true }, { 6338111, { 4, 5 }, false }, { 6338196, { 4, 5 }, true },
+  { 6364709, { 2, 3 }, false }, { 6390380, { 1, 9 }, true }, { 6450045, { 4, 5 }, false }, { 6456974, { 3, 7 }, true },
+  { 6457885, { 3, 7 }, false }, { 6458611, { 3, 7 }, true }, { 6481256, { 1, 9 }, false }, { 6494397, { 4, 5 }, true },
+  { 6541960, { 3, 7 }, false }, { 6546023, { 1, 5 }, true }, { 6573564, { 4, 5 }, false }, { 6586281, { 1, 1 }, true },
+  { 6622795, { 1, 10 }, true }, { 6642954, { 1, 5 }, false }, { 6671373, { 1, 3 }, true }, { 6696821, { 1, 1 }, false },
+  { 6716500, { 4, 5 }, true }, { 6725595, { 1, 10 }, false }, { 6780176, { 1, 3 }, false }, { 6782427, { 3, 4 }, true },
+  { 6782632, { 3, 4 }, false }, { 6782845, { 3, 4 }, true }, { 6783080, { 3, 4 }, false }, { 6783194, { 3, 4 }, true },
+  { 6783365, { 3, 4 }, false }, { 6783629, { 3, 4 }, true }, { 6823942, { 4, 5 }, false }, { 6846879, { 1, 8 }, true },
+  { 6885777, { 3, 4 }, false }, { 6919693, { 1, 5 }, true }, { 6930227, { 1, 8 }, false }, { 6976892, { 1, 3 }, true },
+  { 6990523, { 1, 5 }, false }, { 7045341, { 3, 9 }, true }, { 7062249, { 1, 3 }, false }, { 7100260, { 4, 5 }, true },
+  { 7142841, { 3, 9 }, false }, { 7148084, { 2, 9 }, true }, { 7194820, { 4, 5 }, false }, { 7222954, { 1, 3 }, true },
+  { 7248855, { 2, 9 }, false }, { 7290265, { 2, 2 }, true }, { 7290317, { 2, 2 }, false }, { 7290490, { 2, 2 }, true },
+  { 7315699, { 1, 3 }, false }, { 7362340, { 4, 5 }, true }, { 7399359, { 2, 2 }, false }, { 7403964, { 2, 3 }, true },
+  { 7456365, { 1, 9 }, true }, { 7467056, { 4, 5 }, false }, { 7491686, { 2, 3 }, false }, { 7495291, { 1, 8 }, true },
+  { 7535957, { 1, 9 }, false }, { 7553200, { 2, 5 }, true }, { 7567631, { 1, 8 }, false }, { 7590852, { 1, 5 }, true },
+  { 7653068, { 2, 2 }, true }, { 7666517, { 2, 5 }, false }, { 7666624, { 2, 5 }, true }, { 7666880, { 2, 5 }, false },
+  { 7667026, { 2, 5 }, true }, { 7667261, { 2, 5 }, false }, { 7679163, { 1, 5 }, false }, { 7707672, { 4, 5 }, true },
+  { 7707776, { 4, 5 }, false }, { 7708033, { 4, 5 }, true }, { 7754248, { 2, 2 }, false }, { 7780621, { 2, 2 }, true },
+  { 7817359, { 4, 5 }, false }, { 7849674, { 1, 3 }, true }, { 7859569, { 2, 2 }, false }, { 7906519, { 4, 5 }, true },
+  { 7906679, { 4, 5 }, false }, { 7906773, { 4, 5 }, true }, { 7906898, { 4, 5 }, false }, { 7907046, { 4, 5 }, true },
+  { 7937940, { 1, 3 }, false }, { 7956957, { 3, 3 }, true }, { 7970576, { 4, 5 }, false }, { 7995695, { 2, 6 }, true },
+  { 8021985, { 3, 3 }, false }, { 8071405, { 1, 3 }, true }, { 8109717, { 2, 6 }, false }, { 8112982, { 3, 4 }, true },
+  { 8153146, { 1, 1 }, true }, { 8181780, { 1, 3 }, false }, { 8216681, { 1, 7 }, true }, { 8217419, { 3, 4 }, false },
+  { 8217482, { 3, 4 }, true }, { 8217638, { 3, 4 }, false }, { 8217840, { 3, 4 }, true }, { 8218069, { 3, 4 }, false },
+  { 8229635, { 1, 1 }, false }, { 8251878, { 3, 3 }, true }, { 8294583, { 1, 7 }, false }, { 8298252, { 2, 6 }, true },
+  { 8343662, { 1, 3 }, true }, { 8357867, { 3, 3 }, false }, { 8364350, { 2, 6 }, false }, { 8402406, { 3, 7 }, true },
+  { 8449205, { 1, 5 }, true }, { 8450747, { 1, 3 }, false }, { 8473704, { 3, 7 }, false }, { 8512564, { 4, 4 }, true },
+  { 8519276, { 4, 5 }, true }, { 8533380, { 1, 5 }, false }, { 8562168, { 3, 10 }, true }, { 8615809, { 4, 4 }, false },
+  { 8615809, { 4, 5 }, false }, { 8625809, { 4, 5 }, true }, { 8667837, { 3, 10 }, false }, { 8669293, { 1, 7 }, true },
+  { 8669446, { 1, 7 }, false }, { 8669557, { 1, 7 }, true }, { 8669611, { 1, 7 }, false }, { 8669662, { 1, 7 }, true },
+  { 8669759, { 1, 7 }, false }, { 8669905, { 1, 7 }, true }, { 8708903, { 4, 5 }, false }, { 8738027, { 3, 7 }, true },
+  { 8780954, { 1, 7 }, false }, { 8786756, { 1, 3 }, true }, { 8812451, { 3, 7 }, false }, { 8834743, { 4, 5 }, true },
+  { 8884866, { 1, 5 }, true }, { 8885710, { 1, 3 }, false }, { 8938981, { 4, 5 }, false }, { 8939100, { 4, 5 }, true },
+  { 8939241, { 4, 5 }, false }, { 8947710, { 1, 9 }, true }, { 8986355, { 1, 5 }, false }, { 9014891, { 1, 7 }, true },
+  { 9046621, { 1, 9 }, false }, { 9062843, { 3, 3 }, true }, { 9111657, { 1, 7 }, false }, { 9111853, { 1, 7 }, true },
+  { 9111940, { 1, 7 }, false }, { 9112036, { 1, 7 }, true }, { 9112169, { 1, 7 }, false }, { 9125108, { 2, 6 }, true },
+  { 9136202, { 3, 3 }, false }, { 9164189, { 1, 3 }, true }, { 9200271, { 4, 5 }, true }, { 9200364, { 4, 5 }, false },
+  { 9200500, { 4, 5 }, true }, { 9200654, { 4, 5 }, false }, { 9200761, { 4, 5 }, true }, { 9200872, { 4, 5 }, false },
+  { 9201004, { 4, 5 }, true }, { 9219541, { 2, 6 }, false }, { 9255881, { 1, 3 }, false }, { 9265881, { 1, 3 }, true },
+  { 9281357, { 4, 5 }, false }, { 9304732, { 2, 2 }, true }, { 9338971, { 1, 3 }, false }, { 9351272, { 1, 5 }, true },
+  { 9374018, { 2, 2 }, false }, { 9388820, { 4, 5 }, true }, { 9453011, { 1, 3 }, true }, { 9454118, { 1, 5 }, false },
+  { 9491480, { 3, 7 }, true }, { 9502494, { 4, 5 }, false }, { 9556020, { 3, 7 }, false }, { 9562565, { 2, 4 }, true },
+  { 9568524, { 1, 3 }, false }, { 9595512, { 1, 9 }, true }, { 9640443, { 3, 7 }, true }, { 9673606, { 1, 9 }, false },
+  { 9677779, { 2, 4 }, false }, { 9706390, { 3, 3 }, true }, { 9740033, { 3, 7 }, false }, { 9767702, { 1, 3 }, true },
+  { 9794654, { 1, 3 }, false }, { 9804654, { 1, 3 }, true }, { 9820212, { 3, 3 }, false }, { 9851461, { 4, 5 }, true },
+  { 9890128, { 1, 3 }, false }, { 9925347, { 1, 1 }, true }, { 9940795, { 4, 5 }, false }, { 9999217, { 3, 4 }, true },
+  { 10023056, { 1, 1 }, false }, { 10062314, { 1, 1 }, true }, { 10081841, { 3, 4 }, false }, { 10135426, { 3, 7 }, true },
+  { 10160110, { 1, 1 }, false }, { 10183486, { 1, 5 }, true }, { 10219599, { 3, 7 }, false }, { 10251417, { 4, 5 }, true },
+  { 10296584, { 2, 1 }, true }, { 10298066, { 1, 5 }, false }, { 10339049, { 4, 5 }, false }, { 10356827, { 1, 7 }, true },
+  { 10372009, { 2, 1 }, false }, { 10420606, { 1, 3 }, true }, { 10461691, { 1, 7 }, false }, { 10463509, { 4, 5 }, true },
+  { 10522230, { 2, 9 }, true }, { 10528916, { 1, 3 }, false }, { 10546542, { 4, 5 }, false }, { 10571509, { 1, 1 }, true },
+  { 10593866, { 2, 9 }, false }, { 10594384, { 2, 9 }, true }, { 10594641, { 2, 9 }, false }, { 10595065, { 2, 9 }, true },
+  { 10595224, { 2, 9 }, false }, { 10628730, { 4, 5 }, true }, { 10653424, { 1, 1 }, false }, { 10664381, { 1, 10 }, true },
+  { 10706738, { 1, 4 }, true }, { 10737574, { 4, 5 }, false }, { 10748354, { 1, 10 }, false }, { 10764282, { 1, 3 }, true },
+  { 10794074, { 1, 4 }, false }, { 10802923, { 3, 3 }, true }, { 10858075, { 1, 3 }, false }, { 10868075, { 1, 3 }, true },
+  { 10898245, { 3, 3 }, false }, { 10940302, { 2, 3 }, true }, { 10980734, { 1, 3 }, false }, { 10990881, { 1, 3 }, true },
+  { 11009779, { 2, 3 }, false }, { 11042929, { 3, 7 }, true }, { 11079892, { 1, 3 }, false }, { 11087792, { 1, 5 }, true },
+  { 11111395, { 3, 7 }, false }, { 11155773, { 1, 3 }, true }, { 11189528, { 1, 5 }, false }, { 11213623, { 4, 5 }, true },
+  { 11259979, { 1, 3 }, false }, { 11267815, { 2, 2 }, true }, { 11313061, { 1, 9 }, true }, { 11314009, { 4, 5 }, false },
+  { 11349752, { 2, 2 }, false }, { 11379741, { 1, 8 }, true }, { 11404574, { 1, 9 }, false }, { 11427672, { 1, 5 }, true },
+  { 11453166, { 1, 8 }, false }, { 11477349, { 4, 5 }, true }, { 11520270, { 1, 5 }, false }, { 11520958, { 1, 4 }, true },
+  { 11573482, { 4, 5 }, false }, { 11596785, { 1, 3 }, true }, { 11633829, { 1, 4 }, false }, { 11646174, { 2, 9 }, true },
+  { 11678984, { 1, 3 }, false }, { 11686490, { 1, 1 }, true }, { 11721404, { 3, 3 }, true }, { 11749820, { 2, 9 }, false },
+  { 11762559, { 1, 1 }, false }, { 11796906, { 2, 6 }, true }, { 11796963, { 2, 6 }, false }, { 11797195, { 2, 6 }, true },
+  { 11797368, { 2, 6 }, false }, { 11797550, { 2, 6 }, true }, { 11814087, { 3, 3 }, false }, { 11833614, { 1, 3 }, true },
+  { 11875721, { 1, 3 }, false }, { 11885721, { 1, 3 }, true }, { 11913638, { 2, 6 }, false }, { 11923905, { 3, 8 }, true },
+  { 11971859, { 4, 6 }, true }, { 11972243, { 4, 6 }, false }, { 11972637, { 4, 6 }, true }, { 11973012, { 4, 6 }, false },
+  { 11973251, { 4, 6 }, true }, { 11973649, { 4, 6 }, false }, { 11973913, { 4, 6 }, true }, { 11989609, { 1, 3 }, false },
+  { 11996960, { 4, 4 }, true }, { 12020953, { 3, 8 }, false }, { 12040547, { 1, 3 }, true }, { 12045389, { 4, 6 }, false },
+  { 12102485, { 4, 4 }, false }, { 12112485, { 2, 2 }, true }, { 12141962, { 1, 3 }, false }, { 12172047, { 1, 5 }, true },
+  { 12198414, { 4, 5 }, true }, { 12199729, { 2, 2 }, false }, { 12226256, { 1, 10 }, true }, { 12277723, { 1, 5 }, false },
+  { 12284010, { 4, 5 }, false }, { 12291771, { 1, 10 }, false }, { 12294010, { 3, 3 }, true }, { 12335560, { 1, 3 }, true },
+  { 12402858, { 4, 5 }, true }, { 12403018, { 4, 5 }, false }, { 12403224, { 4, 5 }, true }, { 12403310, { 4, 5 }, false },
+  { 12403433, { 4, 5 }, true }, { 12406400, { 3, 3 }, false }, { 12440689, { 1, 3 }, false }, { 12442870, { 2, 1 }, true },
+  { 12501808, { 4, 5 }, false }, { 12509004, { 2, 1 }, false }, { 12511741, { 1, 7 }, true }, { 12567777, { 1, 3 }, true },
+  { 12602551, { 1, 7 }, false }, { 12611755, { 4, 5 }, true }, { 12652404, { 2, 9 }, true }, { 12653086, { 1, 3 }, false },
+  { 12681757, { 4, 5 }, false }, { 12708417, { 1, 3 }, true }, { 12720061, { 2, 9 }, false }, { 12771963, { 4, 5 }, true },
+  { 12806333, { 1, 3 }, false }, { 12806556, { 3, 3 }, true }, { 12846295, { 4, 5 }, false }, { 12862354, { 2, 9 }, true },
+  { 12890587, { 3, 3 }, false }, { 12895546, { 1, 1 }, true }, { 12963943, { 3, 4 }, true }, { 12978118, { 2, 9 }, false },
+  { 12994946, { 1, 1 }, false }, { 13019526, { 1, 8 }, true }, { 13045007, { 3, 4 }, false }, { 13045568, { 3, 4 }, true },
+  { 13045883, { 3, 4 }, false }, { 13065429, { 1, 3 }, true }, { 13110452, { 1, 4 }, true }, { 13119789, { 1, 8 }, false },
+  { 13139345, { 1, 3 }, false }, { 13184810, { 4, 5 }, true }, { 13185079, { 1, 4 }, false }, { 13242950, { 1, 5 }, true },
+  { 13280939, { 1, 8 }, true }, { 13284703, { 4, 5 }, false }, { 13340821, { 1, 3 }, true }, { 13344389, { 1, 5 }, false },
+  { 13362180, { 1, 8 }, false }, { 13386643, { 3, 7 }, true }, { 13424808, { 1, 3 }, false }, { 13436261, { 1, 5 }, true },
+  { 13497707, { 4, 5 }, true }, { 13497945, { 3, 7 }, false }, { 13507877, { 1, 5 }, false }, { 13517707, { 4, 5 }, false },
+  { 13527707, { 4, 5 }, true }, { 13541184, { 3, 7 }, true }, { 13605917, { 3, 8 }, true }, { 13607113, { 3, 7 }, false },
+  { 13655759, { 4, 7 }, true }, { 13678546, { 3, 8 }, false }, { 13692146, { 4, 5 }, false }, { 13702146, { 4, 5 }, true },
+  { 13730689, { 4, 7 }, false }, { 13766784, { 2, 10 }, true }, { 13817808, { 4, 5 }, false }, { 13839232, { 1, 9 }, true },
+  { 13865411, { 2, 10 }, false }, { 13905706, { 1, 9 }, false }, { 13907157, { 1, 5 }, true }, { 13962030, { 2, 2 }, true },
+  { 14004312, { 1, 5 }, false }, { 14010526, { 4, 5 }, true }, { 14045919, { 2, 2 }, false }, { 14050309, { 1, 10 }, true },
+  { 14089080, { 4, 5 }, false }, { 14104710, { 1, 1 }, true }, { 14122257, { 1, 10 }, false }, { 14174597, { 1, 4 }, true },
+  { 14218251, { 1, 1 }, false }, { 14230354, { 4, 5 }, true }, { 14269165, { 2, 10 }, true }, { 14288546, { 1, 4 }, false },
+  { 14325169, { 4, 5 }, false }, { 14335738, { 1, 8 }, true }, { 14349620, { 2, 10 }, false }, { 14349762, { 2, 10 }, true },
+  { 14350238, { 2, 10 }, false }, { 14393600, { 3, 7 }, true }, { 14430847, { 1, 8 }, false }, { 14466624, { 1, 7 }, true },
+  { 14483834, { 3, 7 }, false }, { 14513666, { 1, 5 }, true }, { 14563179, { 1, 7 }, false }, { 14571854, { 1, 3 }, true },
+  { 14598624, { 1, 5 }, false }, { 14616686, { 4, 4 }, true }, { 14624122, { 4, 5 }, true }, { 14643515, { 1, 3 }, false },
+  { 14667120, { 3, 9 }, true }, { 14690323, { 4, 4 }, false }, { 14690323, { 4, 5 }, false }, { 14700323, { 4, 5 }, true },
+  { 14729695, { 4, 4 }, true }, { 14752489, { 3, 9 }, false }, { 14763431, { 1, 3 }, true }, { 14799462, { 4, 5 }, false },
+  { 14799483, { 4, 4 }, false }, { 14799808, { 4, 4 }, true }, { 14800185, { 4, 4 }, false }, { 14800454, { 4, 4 }, true },
+  { 14800628, { 4, 4 }, false }, { 14800870, { 4, 4 }, true }, { 14800932, { 4, 4 }, false }, { 14809483, { 1, 5 }, true },
+  { 14840091, { 1, 3 }, false }, { 14884407, { 4, 5 }, true }, { 14904407, { 4, 5 }, false }, { 14906836, { 1, 5 }, false },
+  { 14914407, { 4, 5 }, true }, { 14922975, { 3, 8 }, true }, { 14983755, { 4, 7 }, true }, { 15021032, { 4, 7 }, false },
+  { 15031024, { 3, 8 }, false }, { 15031032, { 4, 7 }, true }, { 15075376, { 4, 5 }, false }, { 15085376, { 4, 5 }, true },
+  { 15102076, { 4, 4 }, true }, { 15115542, { 4, 7 }, false }, { 15159128, { 3, 8 }, true }, { 15187134, { 4, 5 }, false },
+  { 15191139, { 4, 4 }, false }, { 15201139, { 4, 5 }, true }, { 15236560, { 4, 4 }, true }, { 15246457, { 3, 8 }, false },
+  { 15260607, { 2, 9 }, true }, { 15284612, { 4, 4 }, false }, { 15294612, { 1, 3 }, true }, { 15296520, { 4, 5 }, false },
+  { 15341202, { 2, 2 }, true }, { 15344814, { 2, 9 }, false }, { 15358239, { 1, 3 }, false }, { 15414376, { 4, 5 }, true },
+  { 15449475, { 3, 3 }, true }, { 15454218, { 2, 2 }, false }, { 15489582, { 1, 9 }, true }, { 15508084, { 4, 5 }, false },
+  { 15531538, { 3, 7 }, true }, { 15534575, { 3, 3 }, false }, { 15588592, { 1, 5 }, true }, { 15604017, { 1, 9 }, false },
+  { 15646208, { 3, 7 }, false }, { 15649292, { 1, 1 }, true }, { 15664362, { 1, 5 }, false }, { 15699758, { 3, 3 }, true },
+  { 15753294, { 1, 1 }, false }, { 15770528, { 1, 5 }, true }, { 15812870, { 3, 3 }, false }, { 15815118, { 2, 2 }, true },
+  { 15850738, { 4, 5 }, true }, { 15852118, { 1, 5 }, false }, { 15886110, { 2, 2 }, false }, { 15886254, { 2, 2 }, true },
+  { 15886413, { 2, 2 }, false }, { 15923919, { 1, 4 }, true }, { 15952131, { 4, 5 }, false }, { 15993691, { 1, 3 }, true },
+  { 15994725, { 1, 4 }, false }, { 16029311, { 3, 5 }, true }, { 16090132, { 1, 3 }, false }, { 16119907, { 3, 5 }, false },
+};
+
+static const uint16_t s_corpus220Typed[] = {
+  0x020F, 0x0008, 0x002C, 0x0006, 0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0008,
+  0x0016, 0x0017, 0x002C, 0x0018, 0x0011, 0x002C, 0x0012, 0x0018, 0x0017, 0x000C, 0x000F, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0021, 0x0012, 0x0011, 0x002C, 0x0018, 0x0017, 0x000C,
+  0x000F, 0x000C, 0x0016, 0x0008, 0x002C, 0x0017, 0x0012, 0x0018, 0x0017, 0x0008, 0x002C, 0x000F,
+  0x0014, 0x002C, 0x000D, 0x0012, 0x0018, 0x0015, 0x0011, 0x0008, 0x0008, 0x0010, 0x002C, 0x000C,
+  0x000F, 0x002C, 0x0007, 0x0012, 0x000C, 0x0017, 0x002C, 0x0016, 0x0018, 0x000C, 0x0019, 0x0015,
+  0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0009, 0x0015, 0x0014, 0x0013, 0x0013, 0x0008, 0x002C,
+  0x0016, 0x0014, 0x0011, 0x0016, 0x002C, 0x0013, 0x0008, 0x0015, 0x0007, 0x0015, 0x0008, 0x002C,
+  0x0018, 0x0011, 0x0008, 0x002C, 0x0016, 0x0008, 0x0018, 0x000F, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x0236, 0x0028, 0x0204, 0x0018, 0x0014, 0x0011, 0x0007, 0x002C,
+  0x0012, 0x0011, 0x002C, 0x0017, 0x0014, 0x0013, 0x0008, 0x002C, 0x0019, 0x000C, 0x0017, 0x0008,
+  0x0010, 0x002C, 0x000F, 0x0008, 0x0016, 0x002C, 0x0007, 0x0012, 0x000C, 0x000A, 0x0017, 0x0016,
+  0x002C, 0x0016, 0x0008, 0x002C, 0x0006, 0x000B, 0x0008, 0x0019, 0x0014, 0x0018, 0x0006, 0x000B,
+  0x0008, 0x0011, 0x0017, 0x002C, 0x0037, 0x002C, 0x0018, 0x0011, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x002C, 0x0008, 0x0016, 0x0017, 0x002C, 0x0008, 0x0011, 0x0009,
+  0x0012, 0x0011, 0x0006, 0x0008, 0x0008, 0x002C, 0x0014, 0x0019, 0x0014, 0x0011, 0x0017, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0013, 0x0015, 0x0008, 0x0006, 0x0008,
+  0x0007, 0x0008, 0x0011, 0x0017, 0x0008, 0x002C, 0x0016, 0x0012, 0x000C, 0x0017, 0x002C, 0x0015,
+  0x0008, 0x000F, 0x0014, 0x0006, 0x000B, 0x0008, 0x0008, 0x0236, 0x0028, 0x0208, 0x0016, 0x0017,
+  0x0056, 0x0006, 0x0008, 0x002C, 0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0008, 0x002C, 0x0006,
+  0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0017, 0x000C, 0x0008, 0x0011, 0x0017,
+  0x002C, 0x0059, 0x005A, 0x0062, 0x002C, 0x0033, 0x0012, 0x0017, 0x0016, 0x002C, 0x0013, 0x0014,
+  0x0015, 0x002C, 0x0033, 0x000C, 0x0011, 0x0018, 0x0017, 0x0008, 0x002C, 0x0210, 0x002C, 0x0208,
+  0x0017, 0x002C, 0x005A, 0x0062, 0x0062, 0x002C, 0x0038, 0x002C, 0x020F, 0x0008, 0x0016, 0x002C,
+  0x0006, 0x0012, 0x0011, 0x0017, 0x0014, 0x0006, 0x0017, 0x0016, 0x002C, 0x0015, 0x0008, 0x0005,
+};
+
+static const TraceEdge s_corpus260[] = {
+  { 0, { 4, 4 }, true }, { 50927, { 2, 9 }, true }, { 71019, { 4, 4 }, false }, { 81019, { 1, 3 }, true },
+  { 81212, { 1, 3 }, false }, { 81349, { 1, 3 }, true }, { 81830, { 1, 3 }, false }, { 82216, { 1, 3 }, true },
+  { 128956, { 2, 9 }, false }, { 135211, { 4, 5 }, true }, { 135904, { 4, 5 }, false }, { 136040, { 4, 5 }, true },
+  { 184525, { 3, 3 }, true }, { 197210, { 1, 3 }, false }, { 227129, { 4, 5 }, false }, { 239665, { 2, 9 }, true },
+  { 284820, { 3, 3 }, false }, { 293382, { 1, 1 }, true }, { 344767, { 2, 9 }, false }, { 352263, { 3, 4 }, true },
+  { 383882, { 1, 8 }, true }, { 388852, { 1, 1 }, false }, { 440355, { 1, 3 }, true }, { 454912, { 3, 4 }, false },
+  { 481117, { 1, 8 }, false }, { 495003, { 1, 4 }, true }, { 531073, { 4, 5 }, true }, { 549173, { 1, 3 }, false },
+  { 581292, { 1, 3 }, true }, { 581493, { 1, 3 }, false }, { 581557, { 1, 3 }, true }, { 581666, { 1, 3 }, false },
+  { 582000, { 1, 3 }, true }, { 582180, { 1, 3 }, false }, { 582474, { 1, 3 }, true }, { 599860, { 1, 4 }, false },
+  { 616670, { 4, 5 }, false }, { 619613, { 2, 2 }, true }, { 664730, { 1, 5 }, true }, { 692670, { 1, 3 }, false },
+  { 705708, { 4, 5 }, true }, { 728742, { 2, 2 }, false }, { 736724, { 1, 5 }, false }, { 739450, { 1, 7 }, true },
+  { 739597, { 1, 7 }, false }, { 739703, { 1, 7 }, true }, { 739814, { 1, 7 }, false }, { 739939, { 1, 7 }, true },
+  { 740051, { 1, 7 }, false }, { 740176, { 1, 7 }, true }, { 793477, { 3, 7 }, true }, { 803576, { 4, 5 }, false },
+  { 815761, { 1, 7 }, false }, { 825221, { 4, 5 }, true }, { 881294, { 1, 9 }, true }, { 887102, { 3, 7 }, false },
+  { 931572, { 4, 5 }, false }, { 931985, { 4, 5 }, true }, { 932227, { 4, 5 }, false }, { 943715, { 1, 7 }, true },
+  { 959634, { 1, 9 }, false }, { 1004030, { 1, 5 }, true }, { 1054836, { 1, 7 }, false }, { 1062340, { 1, 8 }, true },
+  { 1062460, { 1, 8 }, false }, { 1062645, { 1, 8 }, true }, { 1062807, { 1, 8 }, false }, { 1062971, { 1, 8 }, true },
+  { 1092739, { 1, 5 }, false }, { 1107542, { 2, 9 }, true }, { 1137528, { 1, 8 }, false }, { 1150654, { 4, 5 }, true },
+  { 1182641, { 2, 1 }, true }, { 1194802, { 2, 9 }, false }, { 1243522, { 1, 7 }, true }, { 1254348, { 4, 5 }, false },
+  { 1271409, { 1, 3 }, true }, { 1291854, { 2, 1 }, false }, { 1321714, { 4, 5 }, true }, { 1338648, { 1, 7 }, false },
+  { 1341693, { 1, 3 }, false }, { 1359537, { 4, 5 }, false }, { 1359875, { 4, 5 }, true }, { 1360067, { 4, 5 }, false },
+  { 1360278, { 4, 5 }, true }, { 1360498, { 4, 5 }, false }, { 1364520, { 2, 9 }, true }, { 1369537, { 4, 5 }, true },
+  { 1397246, { 1, 5 }, true }, { 1418339, { 4, 5 }, false }, { 1428339, { 1, 9 }, true }, { 1438501, { 2, 9 }, false },
+  { 1486164, { 3, 7 }, true }, { 1508521, { 1, 5 }, false }, { 1531894, { 1, 9 }, false }, { 1534594, { 4, 5 }, true },
+  { 1550169, { 3, 7 }, false }, { 1593136, { 1, 7 }, true }, { 1642136, { 1, 5 }, true }, { 1651222, { 4, 5 }, false },
+  { 1656553, { 1, 7 }, false }, { 1656614, { 1, 7 }, true }, { 1656731, { 1, 7 }, false }, { 1656942, { 1, 7 }, true },
+  { 1657027, { 1, 7 }, false }, { 1689201, { 1, 8 }, true }, { 1752173, { 2, 9 }, true }, { 1753223, { 1, 5 }, false },
+  { 1783844, { 1, 8 }, false }, { 1800596, { 1, 8 }, true }, { 1837602, { 2, 9 }, false }, { 1847141, { 2, 2 }, true },
+  { 1891978, { 1, 3 }, true }, { 1908274, { 1, 8 }, false }, { 1943565, { 4, 5 }, true }, { 1950029, { 2, 2 }, false },
+  { 1985526, { 1, 3 }, false }, { 2003686, { 1, 5 }, true }, { 2004103, { 1, 5 }, false }, { 2004652, { 1, 5 }, true },
+  { 2004754, { 1, 5 }, false }, { 2004966, { 1, 5 }, true }, { 2040792, { 4, 5 }, false }, { 2053017, { 1, 9 }, true },
+  { 2067021, { 1, 5 }, false }, { 2100292, { 1, 7 }, true }, { 2144484, { 1, 9 }, false }, { 2145740, { 1, 5 }, true },
+  { 2175100, { 1, 3 }, true }, { 2196374, { 1, 7 }, false }, { 2203053, { 4, 5 }, true }, { 2212230, { 1, 5 }, false },
+  { 2212484, { 1, 5 }, true }, { 2212695, { 1, 5 }, false }, { 2212985, { 1, 5 }, true }, { 2213244, { 1, 5 }, false },
+  { 2213372, { 1, 5 }, true }, { 2213662, { 1, 5 }, false }, { 2246653, { 2, 9 }, true }, { 2269098, { 4, 5 }, false },
+  { 2286699, { 1, 1 }, true }, { 2291264, { 1, 3 }, false }, { 2342796, { 4, 5 }, true }, { 2358719, { 2, 9 }, false },
+  { 2366498, { 1, 1 }, false }, { 2373794, { 2, 7 }, true }, { 2404181, { 1, 9 }, true }, { 2447123, { 4, 5 }, false },
+  { 2450744, { 2, 7 }, false }, { 2465737, { 1, 7 }, true }, { 2475075, { 1, 9 }, false }, { 2475939, { 1, 9 }, true },
+  { 2476789, { 1, 9 }, false }, { 2494996, { 1, 4 }, true }, { 2544613, { 3, 7 }, true }, { 2557521, { 1, 7 }, false },
+  { 2561540, { 1, 4 }, false }, { 2605391, { 1, 3 }, true }, { 2625079, { 3, 7 }, false }, { 2647640, { 1, 3 }, false },
+  { 2657640, { 1, 3 }, true }, { 2688612, { 3, 9 }, true }, { 2732834, { 1, 3 }, false }, { 2747081, { 4, 5 }, true },
+  { 2793495, { 1, 8 }, true }, { 2793577, { 1, 8 }, false }, { 2793674, { 1, 8 }, true }, { 2793737, { 1, 8 }, false },
+  { 2793833, { 1, 8 }, true }, { 2793923, { 1, 8 }, false }, { 2794024, { 1, 8 }, true }, { 2804019, { 3, 9 }, false },
+  { 2832287, { 4, 5 }, false }, { 2842002, { 2, 9 }, true }, { 2872897, { 1, 8 }, false }, { 2877032, { 4, 5 }, true },
+  { 2909067, { 2, 3 }, true }, { 2938974, { 2, 9 }, false }, { 2957439, { 1, 9 }, true }, { 2962081, { 4, 5 }, false },
+  { 3008586, { 1, 8 }, true }, { 3017175, { 2, 3 }, false }, { 3017289, { 2, 3 }, true }, { 3017363, { 2, 3 }, false },
+  { 3017438, { 2, 3 }, true }, { 3017558, { 2, 3 }, false }, { 3017655, { 2, 3 }, true }, { 3017785, { 2, 3 }, false },
+  { 3052794, { 1, 5 }, true }, { 3068608, { 1, 9 }, false }, { 3103727, { 1, 8 }, false }, { 3105766, { 4, 5 }, true },
+  { 3122093, { 1, 5 }, false }, { 3169331, { 2, 2 }, true }, { 3220973, { 1, 7 }, true }, { 3221230, { 4, 5 }, false },
+  { 3270284, { 2, 2 }, false }, { 3281720, { 1, 8 }, true }, { 3321700, { 1, 7 }, false }, { 3327118, { 3, 4 }, true },
+  { 3361778, { 1, 8 }, false }, { 3382820, { 1, 4 }, true }, { 3416708, { 3, 4 }, false }, { 3447044, { 1, 3 }, true },
+  { 3453691, { 1, 4 }, false }, { 3483869, { 4, 5 }, true }, { 3533447, { 1, 3 }, false }, { 3543863, { 2, 9 }, true },
+  { 3596800, { 4, 5 }, false }, { 3596872, { 4, 5 }, true }, { 3597240, { 4, 5 }, false }, { 3597369, { 4, 5 }, true },
+  { 3597622, { 4, 5 }, false }, { 3607817, { 1, 1 }, true }, { 3638987, { 2, 9 }, false }, { 3644745, { 4, 5 }, true },
+  { 3644921, { 4, 5 }, false }, { 3645105, { 4, 5 }, true }, { 3645201, { 4, 5 }, false }, { 3645562, { 4, 5 }, true },
+  { 3678869, { 1, 1 }, false }, { 3690683, { 2, 4 }, true }, { 3742084, { 1, 4 }, true }, { 3747059, { 4, 5 }, false },
+  { 3762926, { 2, 4 }, false }, { 3798014, { 1, 1 }, true }, { 3812591, { 1, 4 }, false }, { 3832080, { 1, 10 }, true },
+  { 3861174, { 1, 1 }, false }, { 3876171, { 1, 10 }, false }, { 3886171, { 1, 10 }, true }, { 3886341, { 1, 10 }, false },
+  { 3886574, { 1, 10 }, true }, { 3948204, { 1, 3 }, true }, { 3948618, { 1, 3 }, false }, { 3948812, { 1, 3 }, true },
+  { 3964250, { 1, 10 }, false }, { 3987307, { 4, 5 }, true }, { 4043483, { 2, 2 }, true }, { 4050231, { 1, 3 }, false },
+  { 4066929, { 4, 5 }, false }, { 4087136, { 1, 1 }, true }, { 4122350, { 2, 2 }, false }, { 4147229, { 3, 7 }, true },
+  { 4185948, { 2, 2 }, true }, { 4192466, { 1, 1 }, false }, { 4226820, { 4, 5 }, true }, { 4227279, { 4, 5 }, false },
+  { 4227615, { 4, 5 }, true }, { 4227692, { 4, 5 }, false }, { 4227953, { 4, 5 }, true }, { 4255441, { 2, 2 }, false },
+  { 4260212, { 3, 7 }, false }, { 4281000, { 1, 10 }, true }, { 4312165, { 4, 5 }, false }, { 4343187, { 1, 3 }, true },
+  { 4378467, { 1, 10 }, false }, { 4398684, { 1, 4 }, true }, { 4424009, { 1, 3 }, false }, { 4424407, { 1, 3 }, true },
+  { 4424664, { 1, 3 }, false }, { 4444336, { 2, 3 }, true }, { 4465670, { 1, 4 }, false }, { 4475670, { 1, 4 }, true },
+  { 4530673, { 1, 3 }, true }, { 4539584, { 2, 3 }, false }, { 4566538, { 1, 4 }, false }, { 4584123, { 4, 5 }, true },
+  { 4594430, { 1, 3 }, false }, { 4620657, { 1, 7 }, true }, { 4662666, { 4, 5 }, false }, { 4663752, { 3, 7 }, true },
+  { 4689273, { 1, 7 }, false }, { 4709083, { 1, 3 }, true }, { 4745449, { 3, 7 }, false }, { 4745533, { 3, 7 }, true },
+  { 4745702, { 3, 7 }, false }, { 4745846, { 3, 7 }, true }, { 4746012, { 3, 7 }, false }, { 4755613, { 4, 5 }, true },
+  { 4803030, { 2, 2 }, true }, { 4807606, { 1, 3 }, false }, { 4819253, { 4, 5 }, false }, { 4853695, { 1, 3 }, true },
+  { 4854198, { 1, 3 }, false }, { 4854698, { 1, 3 }, true }, { 4867417, { 2, 2 }, false }, { 4867613, { 2, 2 }, true },
+  { 4867868, { 2, 2 }, false }, { 4913337, { 1, 7 }, true }, { 4929419, { 1, 3 }, false }, { 4964271, { 2, 9 }, true },
+  { 5004137, { 1, 7 }, false }, { 5019555, { 1, 3 }, true }, { 5028969, { 2, 9 }, false }, { 5082280, { 4, 5 }, true },
+  { 5100909, { 1, 3 }, false }, { 5146149, { 1, 5 }, true }, { 5154881, { 4, 5 }, false }, { 5193291, { 1, 9 }, true },
+  { 5232369, { 1, 5 }, false }, { 5246124, { 1, 7 }, true }, { 5285279, { 3, 3 }, true }, { 5286906, { 1, 9 }, false },
+  { 5325276, { 2, 6 }, true }, { 5325389, { 2, 6 }, false }, { 5325894, { 2, 6 }, true }, { 5327566, { 1, 7 }, false },
+  { 5369922, { 1, 3 }, true }, { 5400097, { 3, 3 }, false }, { 5430971, { 2, 6 }, false }, { 5432429, { 3, 8 }, true },
+  { 5475486, { 1, 3 }, false }, { 5484542, { 4, 6 }, true }, { 5501590, { 4, 4 }, true }, { 5531863, { 3, 8 }, false },
+  { 5541587, { 2, 1 }, true }, { 5563703, { 4, 6 }, false }, { 5568629, { 4, 4 }, false }, { 5568721, { 4, 4 }, true },
+  { 5568812, { 4, 4 }, false }, { 5569076, { 4, 4 }, true }, { 5569199, { 4, 4 }, false }, { 5569439, { 4, 4 }, true },
+  { 5569518, { 4, 4 }, false }, { 5578629, { 1, 7 }, true }, { 5620968, { 1, 1 }, true }, { 5625702, { 2, 1 }, false },
+  { 5646099, { 1, 7 }, false }, { 5679050, { 3, 7 }, true }, { 5679158, { 3, 7 }, false }, { 5679256, { 3, 7 }, true },
+  { 5679342, { 3, 7 }, false }, { 5679475, { 3, 7 }, true }, { 5679607, { 3, 7 }, false }, { 5679743, { 3, 7 }, true },
+  { 5713236, { 1, 1 }, false }, { 5731218, { 2, 3 }, true }, { 5785058, { 4, 5 }, true }, { 5792050, { 3, 7 }, false },
+  { 5835764, { 1, 9 }, true }, { 5836707, { 2, 3 }, false }, { 5836837, { 2, 3 }, true }, { 5836926, { 2, 3 }, false },
+  { 5836988, { 2, 3 }, true }, { 5837057, { 2, 3 }, false }, { 5837158, { 2, 3 }, true }, { 5837258, { 2, 3 }, false },
+  { 5877213, { 4, 5 }, false }, { 5887888, { 3, 7 }, true }, { 5900280, { 1, 9 }, false }, { 5928630, { 4, 5 }, true },
+  { 5928720, { 4, 5 }, false }, { 5928961, { 4, 5 }, true }, { 5929083, { 4, 5 }, false }, { 5929292, { 4, 5 }, true },
+  { 5929396, { 4, 5 }, false }, { 5929474, { 4, 5 }, true }, { 5960134, { 1, 5 }, true }, { 5968760, { 3, 7 }, false },
+  { 6018128, { 1, 1 }, true }, { 6037701, { 1, 5 }, false }, { 6040103, { 4, 5 }, false }, { 6077800, { 1, 10 }, true },
+  { 6077860, { 1, 10 }, false }, { 6078015, { 1, 10 }, true }, { 6078102, { 1, 10 }, false }, { 6078170, { 1, 10 }, true },
+  { 6108485, { 1, 1 }, false }, { 6135995, { 1, 3 }, true }, { 6142414, { 1, 10 }, false }, { 6172682, { 4, 5 }, true },
+  { 6203299, { 1, 3 }, false }, { 6224577, { 3, 4 }, true }, { 6248870, { 4, 5 }, false }, { 6256891, { 1, 8 }, true },
+  { 6308302, { 3, 4 }, false }, { 6319339, { 1, 5 }, true }, { 6324922, { 1, 8 }, false }, { 6366742, { 1, 3 }, true },
+  { 6405761, { 3, 9 }, true }, { 6418424, { 1, 5 }, false }, { 6437188, { 4, 5 }, true }, { 6470603, { 3, 9 }, false },
+  { 6475738, { 1, 3 }, false }, { 6481440, { 2, 9 }, true }, { 6512821, { 4, 5 }, false }, { 6536940, { 1, 3 }, true },
+  { 6588173, { 2, 9 }, false }, { 6591374, { 2, 2 }, true }, { 6645254, { 1, 3 }, false }, { 6655262, { 4, 5 }, true },
+  { 6684774, { 2, 2 }, false }, { 6702202, { 2, 3 }, true }, { 6751845, { 4, 5 }, false }, { 6766293, { 1, 9 }, true },
+  { 6798144, { 2, 3 }, false }, { 6798374, { 2, 3 }, true }, { 6798488, { 2, 3 }, false }, { 6803242, { 1, 8 }, true },
+  { 6803371, { 1, 8 }, false }, { 6803475, { 1, 8 }, true }, { 6803617, { 1, 8 }, false }, { 6803735, { 1, 8 }, true },
+  { 6850253, { 1, 9 }, false }, { 6866196, { 2, 5 }, true }, { 6873453, { 1, 8 }, false }, { 6904844, { 1, 5 }, true },
+  { 6937050, { 2, 5 }, false }, { 6952076, { 2, 2 }, true }, { 6971255, { 1, 5 }, false }, { 6982605, { 4, 5 }, true },
+  { 6982747, { 4, 5 }, false }, { 6983149, { 4, 5 }, true }, { 6983228, { 4, 5 }, false }, { 6983303, { 4, 5 }, true },
+  { 7019053, { 2, 2 }, false }, { 7029053, { 2, 2 }, true }, { 7074016, { 4, 5 }, false }, { 7080464, { 1, 3 }, true },
+  { 7134601, { 4, 5 }, true }, { 7138844, { 2, 2 }, false }, { 7155751, { 1, 3 }, false }, { 7178793, { 3, 3 }, true },
+  { 7230916, { 2, 6 }, true }, { 7239412, { 4, 5 }, false }, { 7252971, { 3, 3 }, false }, { 7292197, { 1, 3 }, true },
+  { 7342080, { 2, 6 }, false }, { 7351986, { 3, 4 }, true }, { 7376197, { 1, 3 }, false }, { 7413344, { 1, 1 }, true },
+  { 7457466, { 3, 4 }, false }, { 7463093, { 1, 7 }, true }, { 7502133, { 1, 1 }, false }, { 7516461, { 3, 3 }, true },
+  { 7549652, { 1, 7 }, false }, { 7558011, { 2, 6 }, true }, { 7613113, { 3, 3 }, false }, { 7619661, { 1, 3 }, true },
+  { 7645009, { 2, 6 }, false }, { 7661625, { 3, 7 }, true }, { 7694786, { 1, 3 }, false }, { 7723439, { 1, 5 }, true },
+  { 7757483, { 3, 7 }, false }, { 7781377, { 4, 5 }, true }, { 7802995, { 4, 4 }, true }, { 7831011, { 1, 5 }, false },
+  { 7833498, { 3, 10 }, true }, { 7833671, { 3, 10 }, false }, { 7833724, { 3, 10 }, true }, { 7833824, { 3, 10 }, false },
+  { 7833949, { 3, 10 }, true }, { 7834043, { 3, 10 }, false }, { 7834223, { 3, 10 }, true }, { 7855342, { 4, 5 }, false },
+  { 7881431, { 4, 4 }, false }, { 7891431, { 4, 5 }, true }, { 7918903, { 3, 10 }, false }, { 7937346, { 1, 7 }, true },
+  { 7937441, { 1, 7 }, false }, { 7937612, { 1, 7 }, true }, { 7937748, { 1, 7 }, false }, { 7937841, { 1, 7 }, true },
+  { 7937978, { 1, 7 }, false }, { 7938058, { 1, 7 }, true }, { 7967354, { 3, 7 }, true }, { 7981641, { 4, 5 }, false },
+  { 8005186, { 1, 7 }, false }, { 8023051, { 1, 3 }, true }, { 8063013, { 3, 7 }, false }, { 8073619, { 4, 5 }, true },
+  { 8104125, { 1, 5 }, true }, { 8124477, { 1, 3 }, false }, { 8138519, { 1, 9 }, true }, { 8138883, { 1, 9 }, false },
+  { 8139332, { 1, 9 }, true }, { 8139709, { 1, 9 }, false }, { 8140262, { 1, 9 }, true }, { 8146820, { 4, 5 }, false },
+  { 8185469, { 1, 7 }, true }, { 8211785, { 1, 9 }, false }, { 8211911, { 1, 5 }, false }, { 8226015, { 3, 3 }, true },
+  { 8272849, { 2, 6 }, true }, { 8301318, { 1, 7 }, false }, { 8306395, { 3, 3 }, false }, { 8309070, { 1, 3 }, true },
+  { 8345713, { 2, 6 }, false }, { 8363308, { 4, 5 }, true }, { 8384920, { 1, 3 }, false }, { 8394920, { 1, 3 }, true },
+  { 8427352, { 4, 5 }, false }, { 8447068, { 2, 2 }, true }, { 8458202, { 1, 3 }, false }, { 8497490, { 1, 5 }, true },
+  { 8552558, { 4, 5 }, true }, { 8561584, { 2, 2 }, false }, { 8605904, { 1, 5 }, false }, { 8606651, { 1, 3 }, true },
+  { 8639642, { 3, 7 }, true }, { 8668853, { 4, 5 }, false }, { 8688102, { 2, 4 }, true }, { 8688627, { 2, 4 }, false },
+  { 8688782, { 2, 4 }, true }, { 8716084, { 1, 3 }, false }, { 8741645, { 1, 9 }, true }, { 8754812, { 3, 7 }, false },
+  { 8766467, { 2, 4 }, false }, { 8790406, { 3, 7 }, true }, { 8837001, { 1, 9 }, false }, { 8846352, { 3, 3 }, true },
+  { 8878447, { 3, 7 }, false }, { 8878561, { 3, 7 }, true }, { 8878667, { 3, 7 }, false }, { 8878727, { 3, 7 }, true },
+  { 8878907, { 3, 7 }, false }, { 8883739, { 1, 3 }, true }, { 8926241, { 1, 3 }, false }, { 8930455, { 3, 3 }, false },
+  { 8936241, { 1, 3 }, true }, { 8969955, { 4, 5 }, true }, { 9011213, { 1, 3 }, false }, { 9015513, { 1, 1 }, true },
+  { 9062354, { 3, 4 }, true }, { 9063276, { 4, 5 }, false }, { 9063514, { 4, 5 }, true }, { 9063820, { 4, 5 }, false },
+  { 9063892, { 4, 5 }, true }, { 9063996, { 4, 5 }, false }, { 9064129, { 4, 5 }, true }, { 9064418, { 4, 5 }, false },
+  { 9092568, { 1, 1 }, false }, { 9111083, { 1, 1 }, true }, { 9127841, { 3, 4 }, false }, { 9174579, { 3, 7 }, true },
+  { 9176189, { 1, 1 }, false }, { 9225347, { 1, 5 }, true }, { 9257263, { 3, 7 }, false }, { 9268429, { 4, 5 }, true },
+  { 9322381, { 1, 5 }, false }, { 9329973, { 2, 1 }, true }, { 9335716, { 4, 5 }, false }, { 9360369, { 1, 7 }, true },
+  { 9420977, { 1, 3 }, true }, { 9424709, { 2, 1 }, false }, { 9450613, { 1, 7 }, false }, { 9464731, { 4, 5 }, true },
+  { 9465007, { 4, 5 }, false }, { 9465106, { 4, 5 }, true }, { 9465294, { 4, 5 }, false }, { 9465457, { 4, 5 }, true },
+  { 9465561, { 4, 5 }, false }, { 9465815, { 4, 5 }, true }, { 9506558, { 2, 9 }, true }, { 9513137, { 1, 3 }, false },
+  { 9528073, { 4, 5 }, false }, { 9528917, { 4, 5 }, true }, { 9529528, { 4, 5 }, false }, { 9545528, { 1, 1 }, true },
+  { 9579980, { 4, 5 }, true }, { 9608902, { 1, 1 }, false }, { 9614763, { 2, 9 }, false }, { 9614947, { 1, 10 }, true },
+  { 9657240, { 4, 5 }, false }, { 9666422, { 1, 4 }, true }, { 9686385, { 1, 10 }, false }, { 9694980, { 1, 3 }, true },
+  { 9695293, { 1, 3 }, false }, { 9695602, { 1, 3 }, true }, { 9728898, { 3, 3 }, true }, { 9750495, { 1, 3 }, false },
+  { 9753328, { 1, 4 }, false }, { 9760495, { 1, 3 }, true }, { 9760776, { 1, 3 }, false }, { 9761210, { 1, 3 }, true },
+  { 9761330, { 1, 3 }, false }, { 9761799, { 1, 3 }, true }, { 9788873, { 2, 3 }, true }, { 9831279, { 1, 3 }, false },
+  { 9834018, { 3, 3 }, false }, { 9841279, { 1, 3 }, true }, { 9862735, { 2, 3 }, false }, { 9874990, { 3, 7 }, true },
+  { 9875047, { 3, 7 }, false }, { 9875105, { 3, 7 }, true }, { 9875161, { 3, 7 }, false }, { 9875302, { 3, 7 }, true },
+  { 9875364, { 3, 7 }, false }, { 9875478, { 3, 7 }, true }, { 9905930, { 1, 3 }, false }, { 9933668, { 1, 5 }, true },
+  { 9964352, { 1, 3 }, true }, { 9986279, { 3, 7 }, false }, { 10006688, { 1, 5 }, false }, { 10011309, { 4, 5 }, true },
+  { 10054158, { 1, 3 }, false }, { 10063279, { 2, 2 }, true }, { 10092586, { 4, 5 }, false }, { 10103514, { 1, 9 }, true },
+  { 10142145, { 1, 8 }, true }, { 10149600, { 2, 2 }, false }, { 10150119, { 2, 2 }, true }, { 10150333, { 2, 2 }, false },
+  { 10168365, { 1, 9 }, false }, { 10172571, { 1, 5 }, true }, { 10226795, { 4, 5 }, true }, { 10227022, { 4, 5 }, false },
+  { 10227148, { 4, 5 }, true }, { 10227208, { 4, 5 }, false }, { 10227491, { 4, 5 }, true }, { 10227655, { 4, 5 }, false },
+  { 10227799, { 4, 5 }, true }, { 10243464, { 1, 8 }, false }, { 10260252, { 1, 5 }, false }, { 10278612, { 1, 4 }, true },
+  { 10329604, { 4, 5 }, false }, { 10330004, { 1, 3 }, true }, { 10377288, { 2, 9 }, true }, { 10386568, { 1, 4 }, false },
+  { 10395593, { 1, 3 }, false }, { 10408327, { 1, 1 }, true }, { 10458938, { 3, 3 }, true }, { 10464034, { 2, 9 }, false },
+  { 10516486, { 2, 6 }, true }, { 10516827, { 1, 1 }, false }, { 10558096, { 1, 3 }, true }, { 10560806, { 3, 3 }, false },
+  { 10607326, { 1, 3 }, false }, { 10609726, { 2, 6 }, false }, { 10617326, { 1, 3 }, true }, { 10650621, { 3, 8 }, true },
+  { 10682795, { 4, 6 }, true }, { 10682805, { 1, 3 }, false }, { 10703095, { 4, 4 }, true }, { 10740131, { 3, 8 }, false },
+  { 10740336, { 3, 8 }, true }, { 10740622, { 3, 8 }, false }, { 10740841, { 3, 8 }, true }, { 10740958, { 3, 8 }, false },
+  { 10741369, { 3, 8 }, true }, { 10741455, { 3, 8 }, false }, { 10741914, { 1, 3 }, true }, { 10762109, { 4, 6 }, false },
+  { 10762729, { 4, 6 }, true }, { 10763091, { 4, 6 }, false }, { 10790406, { 4, 4 }, false }, { 10800406, { 2, 2 }, true },
+  { 10812569, { 1, 3 }, false }, { 10853140, { 1, 5 }, true }, { 10866526, { 4, 5 }, true }, { 10866825, { 2, 2 }, false },
+  { 10889906, { 1, 10 }, true }, { 10917655, { 4, 5 }, false }, { 10927655, { 3, 3 }, true }, { 10954378, { 1, 5 }, false },
+  { 10971850, { 1, 10 }, false }, { 10979721, { 1, 3 }, true }, { 11010711, { 3, 3 }, false }, { 11018396, { 4, 5 }, true },
+  { 11043218, { 1, 3 }, false }, { 11072768, { 2, 1 }, true }, { 11098314, { 4, 5 }, false }, { 11119850, { 1, 7 }, true },
+  { 11167007, { 1, 3 }, true }, { 11181323, { 2, 1 }, false }, { 11195902, { 4, 5 }, true }, { 11224844, { 1, 7 }, false },
+  { 11239358, { 2, 9 }, true }, { 11270708, { 1, 3 }, false }, { 11302430, { 1, 3 }, true }, { 11306701, { 2, 9 }, false },
+  { 11311915, { 4, 5 }, false }, { 11365255, { 4, 5 }, true }, { 11406026, { 3, 3 }, true }, { 11407732, { 1, 3 }, false },
+  { 11434049, { 2, 9 }, true }, { 11443022, { 4, 5 }, false }, { 11485913, { 1, 1 }, true }, { 11510177, { 3, 3 }, false },
+  { 11528320, { 3, 4 }, true }, { 11537286, { 2, 9 }, false }, { 11563622, { 1, 8 }, true }, { 11572144, { 1, 1 }, false },
+  { 11609564, { 3, 4 }, false }, { 11622972, { 1, 3 }, true }, { 11658011, { 1, 8 }, false }, { 11658077, { 1, 8 }, true },
+  { 11658238, { 1, 8 }, false }, { 11658404, { 1, 8 }, true }, { 11658541, { 1, 8 }, false }, { 11672797, { 1, 4 }, true },
+  { 11706772, { 1, 3 }, false }, { 11731726, { 4, 5 }, true }, { 11756822, { 1, 4 }, false }, { 11792892, { 1, 5 }, true },
+  { 11796322, { 4, 5 }, false }, { 11851023, { 1, 8 }, true }, { 11893344, { 1, 3 }, true }, { 11893396, { 1, 3 }, false },
+  { 11893631, { 1, 3 }, true }, { 11894007, { 1, 3 }, false }, { 11894437, { 1, 3 }, true }, { 11906227, { 1, 5 }, false },
+  { 11918252, { 1, 8 }, false }, { 11944441, { 3, 7 }, true }, { 11982807, { 1, 5 }, true }, { 12009524, { 1, 3 }, false },
+  { 12009982, { 1, 3 }, true }, { 12010150, { 1, 3 }, false }, { 12010259, { 1, 3 }, true }, { 12010630, { 1, 3 }, false },
+  { 12016525, { 4, 5 }, true }, { 12036525, { 4, 5 }, false }, { 12043786, { 3, 7 }, false }, { 12046525, { 4, 5 }, true },
+  { 12059634, { 3, 7 }, true }, { 12079135, { 1, 5 }, false }, { 12110091, { 3, 8 }, true }, { 12166375, { 3, 7 }, false },
+  { 12172562, { 4, 7 }, true }, { 12197164, { 4, 5 }, false }, { 12207164, { 4, 5 }, true }, { 12226625, { 3, 8 }, false },
+  { 12239534, { 4, 7 }, false }, { 12253831, { 2, 10 }, true }, { 12300951, { 1, 9 }, true }, { 12318241, { 4, 5 }, false },
+  { 12334223, { 1, 5 }, true }, { 12334669, { 1, 5 }, false }, { 12335593, { 1, 5 }, true }, { 12341871, { 2, 10 }, false },
+  { 12361918, { 2, 2 }, true }, { 12400583, { 1, 5 }, false }, { 12406541, { 4, 5 }, true }, { 12416527, { 1, 9 }, false },
+  { 12449192, { 2, 2 }, false }, { 12449687, { 1, 10 }, true }, { 12497736, { 1, 1 }, true }, { 12508027, { 4, 5 }, false },
+  { 12528090, { 1, 4 }, true }, { 12536347, { 1, 10 }, false }, { 12536522, { 1, 10 }, true }, { 12536625, { 1, 10 }, false },
+  { 12536780, { 1, 10 }, true }, { 12536909, { 1, 10 }, false }, { 12580511, { 1, 1 }, false }, { 12582236, { 4, 5 }, true },
+  { 12603038, { 1, 4 }, false }, { 12624321, { 2, 10 }, true }, { 12670558, { 4, 5 }, false }, { 12677925, { 1, 8 }, true },
+  { 12712753, { 2, 10 }, false }, { 12735620, { 3, 7 }, true }, { 12749353, { 1, 8 }, false }, { 12772102, { 1, 7 }, true },
+  { 12818045, { 1, 5 }, true }, { 12831853, { 3, 7 }, false }, { 12836915, { 1, 7 }, false }, { 12879716, { 1, 3 }, true },
+  { 12880050, { 1, 3 }, false }, { 12880352, { 1, 3 }, true }, { 12880525, { 1, 3 }, false }, { 12880791, { 1, 3 }, true },
+  { 12881053, { 1, 3 }, false }, { 12881332, { 1, 3 }, true }, { 12884543, { 1, 5 }, false }, { 12926694, { 4, 5 }, true },
+  { 12938468, { 4, 4 }, true }, { 12960773, { 1, 3 }, false }, { 12974775, { 3, 9 }, true }, { 13013569, { 4, 5 }, false },
+  { 13025735, { 4, 4 }, false }, { 13035735, { 4, 5 }, true }, { 13075468, { 4, 4 }, true }, { 13079388, { 3, 9 }, false },
+  { 13099811, { 1, 3 }, true }, { 13122087, { 4, 5 }, false }, { 13136791, { 4, 4 }, false }, { 13137346, { 4, 4 }, true },
+  { 13138104, { 4, 4 }, false }, { 13146791, { 1, 5 }, true }, { 13184992, { 4, 5 }, true }, { 13187614, { 1, 3 }, false },
+  { 13204992, { 4, 5 }, false }, { 13214992, { 4, 5 }, true }, { 13223426, { 1, 5 }, false }, { 13233059, { 3, 8 }, true },
+  { 13263946, { 4, 7 }, true }, { 13304810, { 4, 7 }, false }, { 13314810, { 4, 7 }, true }, { 13331192, { 3, 8 }, false },
+  { 13361554, { 4, 4 }, true }, { 13362462, { 4, 5 }, false }, { 13372462, { 4, 5 }, true }, { 13390966, { 4, 7 }, false },
+  { 13428476, { 3, 8 }, true }, { 13451099, { 4, 5 }, false }, { 13478688, { 4, 4 }, false }, { 13488688, { 4, 5 }, true },
+  { 13488799, { 4, 5 }, false }, { 13489118, { 4, 5 }, true }, { 13489287, { 4, 5 }, false }, { 13489383, { 4, 5 }, true },
+  { 13492133, { 4, 4 }, true }, { 13521348, { 3, 8 }, false }, { 13541115, { 2, 9 }, true }, { 13561863, { 4, 5 }, false },
+  { 13567976, { 4, 4 }, false }, { 13577976, { 1, 3 }, true }, { 13606473, { 2, 2 }, true }, { 13643966, { 4, 5 }, true },
+  { 13651058, { 2, 9 }, false }, { 13667077, { 1, 3 }, false }, { 13680369, { 3, 3 }, true }, { 13720977, { 1, 9 }, true },
+  { 13721008, { 2, 2 }, false }, { 13738929, { 4, 5 }, false }, { 13739170, { 4, 5 }, true }, { 13739488, { 4, 5 }, false },
+  { 13739631, { 4, 5 }, true }, { 13739845, { 4, 5 }, false }, { 13767966, { 3, 7 }, true }, { 13770884, { 3, 3 }, false },
+  { 13827470, { 1, 5 }, true }, { 13833263, { 1, 9 }, false }, { 13852670, { 3, 7 }, false }, { 13891140, { 1, 1 }, true },
+  { 13896398, { 1, 5 }, false }, { 13953674, { 3, 3 }, true }, { 13989961, { 1, 1 }, false }, { 14009312, { 1, 5 }, true },
+  { 14039411, { 2, 2 }, true }, { 14055832, { 3, 3 }, false }, { 14067786, { 4, 5 }, true }, { 14117295, { 1, 5 }, false },
+  { 14122091, { 1, 4 }, true }, { 14124272, { 2, 2 }, false }, { 14160003, { 1, 3 }, true }, { 14180958, { 4, 5 }, false },
+  { 14201294, { 3, 5 }, true }, { 14214583, { 1, 4 }, false }, { 14237143, { 1, 3 }, false }, { 14287290, { 3, 5 }, false },
+};
+
+static const uint16_t s_corpus260Typed[] = {
+  0x020F, 0x0008, 0x002C, 0x0006, 0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0008,
+  0x0016, 0x0017, 0x002C, 0x0018, 0x0011, 0x002C, 0x0012, 0x0018, 0x0017, 0x000C, 0x000F, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0021, 0x0012, 0x0011, 0x002C, 0x0018, 0x0017, 0x000C,
+  0x000F, 0x000C, 0x0016, 0x0008, 0x002C, 0x0017, 0x0012, 0x0018, 0x0017, 0x0008, 0x002C, 0x000F,
+  0x0014, 0x002C, 0x000D, 0x0012, 0x0018, 0x0015, 0x0011, 0x0008, 0x0008, 0x0010, 0x002C, 0x000C,
+  0x000F, 0x002C, 0x0007, 0x0012, 0x000C, 0x0017, 0x002C, 0x0016, 0x0018, 0x000C, 0x0019, 0x0015,
+  0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0009, 0x0015, 0x0014, 0x0013, 0x0013, 0x0008, 0x002C,
+  0x0016, 0x0014, 0x0011, 0x0016, 0x002C, 0x0013, 0x0008, 0x0015, 0x0007, 0x0015, 0x0008, 0x002C,
+  0x0018, 0x0011, 0x0008, 0x002C, 0x0016, 0x0008, 0x0018, 0x000F, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x0236, 0x0028, 0x0204, 0x0018, 0x0014, 0x0011, 0x0007, 0x002C,
+  0x0012, 0x0011, 0x002C, 0x0017, 0x0014, 0x0013, 0x0008, 0x002C, 0x0019, 0x000C, 0x0017, 0x0008,
+  0x0010, 0x002C, 0x000F, 0x0008, 0x0016, 0x002C, 0x0007, 0x0012, 0x000C, 0x000A, 0x0017, 0x0016,
+  0x002C, 0x0016, 0x0008, 0x002C, 0x0006, 0x000B, 0x0008, 0x0019, 0x0014, 0x0018, 0x0006, 0x000B,
+  0x0008, 0x0011, 0x0017, 0x002C, 0x0037, 0x002C, 0x0018, 0x0011, 0x0008, 0x002C, 0x0017, 0x0012,
+  0x0018, 0x0006, 0x000B, 0x0008, 0x002C, 0x0008, 0x0016, 0x0017, 0x002C, 0x0008, 0x0011, 0x0009,
+  0x0012, 0x0011, 0x0006, 0x0008, 0x0008, 0x002C, 0x0014, 0x0019, 0x0014, 0x0011, 0x0017, 0x002C,
+  0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0014, 0x002C, 0x0013, 0x0015, 0x0008, 0x0006, 0x0008,
+  0x0007, 0x0008, 0x0011, 0x0017, 0x0008, 0x002C, 0x0016, 0x0012, 0x000C, 0x0017, 0x002C, 0x0015,
+  0x0008, 0x000F, 0x0014, 0x0006, 0x000B, 0x0008, 0x0008, 0x0236, 0x0028, 0x0208, 0x0016, 0x0017,
+  0x0056, 0x0006, 0x0008, 0x002C, 0x0004, 0x0018, 0x0008, 0x002C, 0x000F, 0x0008, 0x002C, 0x0006,
+  0x000F, 0x0014, 0x0019, 0x000C, 0x0008, 0x0015, 0x002C, 0x0017, 0x000C, 0x0008, 0x0011, 0x0017,
+  0x002C, 0x0059, 0x005A, 0x0062, 0x002C, 0x0033, 0x0012, 0x0017, 0x0016, 0x002C, 0x0013, 0x0014,
+  0x0015, 0x002C, 0x0033, 0x000C, 0x0011, 0x0018, 0x0017, 0x0008, 0x002C, 0x0210, 0x002C, 0x0208,
+  0x0017, 0x002C, 0x005A, 0x0062, 0x0062, 0x002C, 0x0038, 0x002C, 0x020F, 0x0008, 0x0016, 0x002C,
+  0x0006, 0x0012, 0x0011, 0x0017, 0x0014, 0x0006, 0x0017, 0x0016, 0x002C, 0x0015, 0x0008, 0x0005,
+};
+
+static const CorpusTrace s_corpusTraces[] = {
+  { { "corpus_60wpm", s_corpus60, sizeof(s_corpus60) / sizeof(TraceEdge) }, 60, s_corpus60Typed, sizeof(s_corpus60Typed) / sizeof(uint16_t) },
+  { { "corpus_100wpm", s_corpus100, sizeof(s_corpus100) / sizeof(TraceEdge) }, 100, s_corpus100Typed, sizeof(s_corpus100Typed) / sizeof(uint16_t) },
+  { { "corpus_140wpm", s_corpus140, sizeof(s_corpus140) / sizeof(TraceEdge) }, 140, s_corpus140Typed, sizeof(s_corpus140Typed) / sizeof(uint16_t) },
+  { { "corpus_180wpm", s_corpus180, sizeof(s_corpus180) / sizeof(TraceEdge) }, 180, s_corpus180Typed, sizeof(s_corpus180Typed) / sizeof(uint16_t) },
+  { { "corpus_220wpm", s_corpus220, sizeof(s_corpus220) / sizeof(TraceEdge) }, 220, s_corpus220Typed, sizeof(s_corpus220Typed) / sizeof(uint16_t) },
+  { { "corpus_260wpm", s_corpus260, sizeof(s_corpus260) / sizeof(TraceEdge) }, 260, s_corpus260Typed, sizeof(s_corpus260Typed) / sizeof(uint16_t) },
+};
+}
@@ -0,0 +1,97 @@
+#include "deadline.h"
+#include "perf.h"
+#include "recorder.h"
+#include "mbed.h"
+#include <Arduino.h>
+
+namespace DeadlineImpl {
+volatile Deadline::Stage s_stage = Deadline::STAGE_IDLE;
+volatile int8_t s_chip = -1;
+
+/// Start of the current deadline, in micro-seconds.
+volatile unsigned long s_start = 0;
+
+/// Length of the current deadline, in micro-seconds.
+volatile unsigned long s_length = LOOP_DEADLINE;
+
+/// The current deadline was overrun, it is only reported once.
+volatile bool s_overrun = false;
+
+/// Bit i is set if the stage i overran its deadline since the last call to Deadline::hasStalled().
+volatile uint8_t s_stalled = 0;
+
+/// An overrun was latched by check() and not counted yet.
+volatile bool s_stallPending = false;
+
+/// Runs the deadline checks.
+Ticker s_ticker;
+
+/// Called from an interrupt every half deadline, so that an overrun is caught at most half a deadline late.
+void check() {
+  Deadline::Stage stage = s_stage;
+  if (stage == Deadline::STAGE_IDLE || s_overrun) return;
+
+  unsigned long now = micros();
+  if (now - s_start < s_length) return;
+
+  // The loop may be in the middle of writing the counters or the trace, the overrun is only latched. reportStall() records it once the stage returns, Recorder::init() after a reset if it never does.
+  s_overrun = true;
+  s_stalled |= 1 << stage;
+  Recorder::latch(Recorder::ENTRY_STALL, stage, stage == Deadline::STAGE_SCAN ? uint16_t(s_chip) : 0xFFFF, now);
+  s_stallPending = true;
+}
+
+/// Record the overrun latched by check(), if any. Must be called while the stage is idle, so that check() does not run meanwhile.
+inline void reportStall() {
+  if (!s_stallPending) return;
+  s_stallPending = false;
+  Perf::count(Perf::COUNTER_LOOP_STALLS);
+  Recorder::flush();
+}
+
+/// Count the current deadline as a near miss if it was not overrun but took more than half of its length.
+inline void closeLap(unsigned long now) {
+  if (!s_overrun && now - s_start > s_length / 2) Perf::count(Perf::COUNTER_LOOP_NEAR_MISSES);
+}
+}
+
+void Deadline::init() {
+  using namespace DeadlineImpl;
+
+  Watchdog::get_instance().start(WATCHDOG_TIMEOUT);
+  s_ticker.attach(&check, std::chrono::microseconds(LOOP_DEADLINE / 2));
+}
+
+void Deadline::lap(Stage stage, unsigned long now) {
+  using namespace DeadlineImpl;
+
+  if (s_stage != STAGE_IDLE) closeLap(now);
+  Watchdog::get_instance().kick();
+
+  // The interrupt only reads the deadline while the stage is not idle.
+  s_stage = STAGE_IDLE;
+  reportStall();
+  s_start = now;
+  s_length = stage == STAGE_MAINTENANCE ? MAINTENANCE_DEADLINE : LOOP_DEADLINE;
+  s_overrun = false;
+  s_chip = -1;
+  s_stage = stage;
+}
+
+void Deadline::end(unsigned long now) {
+  using namespace DeadlineImpl;
+
+  closeLap(now);
+  s_stage = STAGE_IDLE;
+  reportStall();
+}
+
+bool Deadline::hasStalled(Stage stage) {
+  using namespace DeadlineImpl;
+
+  if ((s_stalled & (1 << stage)) == 0) return false;
+  core_util_critical_section_enter();
+  s_stalled &= ~(1 << stage);
+  core_util_critical_section_exit();
+  return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "config.h"
+#include <stdint.h>
+
+/// Deadline of each iteration of the main loop, backed by the hardware watchdog.
+///
+/// The main loop marks the stage it is in, and the input backends the chip they are reading. A periodic interrupt checks that the current iteration did not overrun its deadline.
+/// On an overrun, the interrupt flags the stage and latches the stage and the chip, so that the loop can reset the faulty subsystem and record the overrun in the post-mortem trace once the stage returns.
+/// If it never returns, the hardware watchdog resets the board after WATCHDOG_TIMEOUT and the next boot records the latched overrun as the last entry of the saved trace.
+/// The I2C transfers of the MCP backends time out, see timedI2c.h, so a stuck bus returns from the scan within the deadline. The watchdog is left for what has no timeout,
+/// like a USB send blocked in the USB stack.
+namespace Deadline {
+
+/// The stages of an iteration of the main loop.
+enum Stage : uint8_t {
+  /// Between two iterations, including the sleep while the USB host is suspended. This stage has no deadline.
+  STAGE_IDLE,
+  /// Pushing the queued reports to the USB endpoint.
+  STAGE_USB,
+  /// Reading the switches.
+  STAGE_SCAN,
+  /// Processing the event queue and sending the keyboard states.
+  STAGE_EVENTS,
+  /// Flash writes, the control channel and keymap swaps, done while nothing is being typed. Its deadline is MAINTENANCE_DEADLINE instead of LOOP_DEADLINE.
+  STAGE_MAINTENANCE,
+
+  NUM_STAGES
+};
+
+/// Start the hardware watchdog and the deadline checks. Must be called once at the end of setup(), after the slow initialization.
+void init();
+
+/// Kick the hardware watchdog and start a new deadline at 'now', in 'stage'. An iteration starts with STAGE_USB or STAGE_SCAN, STAGE_MAINTENANCE gets its own deadline.
+void lap(Stage stage, unsigned long now);
+
+/// Mark that the loop entered 'stage', within the deadline started by lap().
+inline void enter(Stage stage);
+
+/// Mark that the input backend is reading the chip 'index'.
+inline void chip(int index);
+
+/// End the iteration at 'now'. An iteration that took more than half of its deadline is counted as a near miss.
+void end(unsigned long now);
+
+/// Return true, once, if 'stage' overran its deadline since the last call.
+bool hasStalled(Stage stage);
+}
+
+/// Namespace containing all the implementation details of the loop deadline.
+namespace DeadlineImpl {
+
+/// Shared with the interrupt checking the deadline.
+extern volatile Deadline::Stage s_stage;
+extern volatile int8_t s_chip;
+}
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline void Deadline::enter(Stage stage) {
+  DeadlineImpl::s_stage = stage;
+}
+
+inline void Deadline::chip(int index) {
+  DeadlineImpl::s_chip = index;
+}
@@ -0,0 +1,115 @@
+#include "debounce.h"
+#include "settings.h"
+#include "storage.h"
+
+namespace DebounceImpl {
+
+/// On each clean edge, the bounce estimate of the key decreases by 1/2^DECAY_SHIFT.
+static const int DECAY_SHIFT = 6;
+
+uint16_t s_time[NUM_LINES][NUM_COLUMNS];
+
+/// Estimated bounce duration of each key, in micro-seconds. This is what is saved in flash.
+uint16_t s_bounce[NUM_LINES][NUM_COLUMNS];
+
+/// Time of the last edge of each key that passed the debouncing, 0 if none yet.
+unsigned long s_lastEdge[NUM_LINES][NUM_COLUMNS];
+
+/// True if an estimate changed since the last call to Debounce::step().
+bool s_changed = false;
+
+/// True if the estimates differ from the ones saved in flash.
+bool s_dirty = false;
+
+/// Time of the last edge, or of the last change of an estimate seen by Debounce::step(). The estimates are saved once it is DEBOUNCE_SAVE_DELAY old, so that the write
+/// never stalls typing, like the heatmap.
+unsigned long s_lastActivity = 0;
+
+/// Derive the debounce time of the key at 'pos' from its bounce estimate. We wait half the estimate again as a safety margin.
+void updateTime(Pos pos) {
+  unsigned long time = s_bounce[pos.m_line][pos.m_column];
+  time += time / 2;
+  if (time < DEBOUNCE_MIN_TIME) time = DEBOUNCE_MIN_TIME;
+  if (time > DEBOUNCE_MAX_TIME) time = DEBOUNCE_MAX_TIME;
+  s_time[pos.m_line][pos.m_column] = time;
+}
+}
+
+void Debounce::init() {
+  using namespace DebounceImpl;
+
+  if (!Storage::read(Storage::RECORD_DEBOUNCE, s_bounce, sizeof(s_bounce))) {
+    // Nothing learned yet.
+    reset();
+    s_changed = false;
+  }
+
+  for (int8_t line = 0; line < NUM_LINES; ++line) {
+    for (int8_t column = 0; column < NUM_COLUMNS; ++column) {
+      s_lastEdge[line][column] = 0;
+      updateTime(Pos{ line, column });
+    }
+  }
+}
+
+void Debounce::reset() {
+  using namespace DebounceImpl;
+
+  // Start from an estimate that gives the default debounce time once the margin is applied.
+  for (int8_t line = 0; line < NUM_LINES; ++line) {
+    for (int8_t column = 0; column < NUM_COLUMNS; ++column) {
+      s_bounce[line][column] = Settings::get(Settings::SETTING_DEBOUNCE_TIME) * 2 / 3;
+      updateTime(Pos{ line, column });
+    }
+  }
+  s_changed = true;
+}
+
+void Debounce::recordBounce(Pos pos, unsigned long interval) {
+  using namespace DebounceImpl;
+
+  uint16_t& bounce = s_bounce[pos.m_line][pos.m_column];
+  if (interval > bounce) {
+    bounce = interval > 0xFFFF ? 0xFFFF : interval;
+    updateTime(pos);
+    s_changed = true;
+  }
+}
+
+void Debounce::recordEdge(Pos pos, unsigned long time) {
+  using namespace DebounceImpl;
+
+  unsigned long& lastEdge = s_lastEdge[pos.m_line][pos.m_column];
+  unsigned long interval = time - lastEdge;
+  bool leaked = lastEdge != 0 && interval < DEBOUNCE_MAX_TIME;
+  lastEdge = time;
+  s_lastActivity = time;
+
+  if (leaked) {
+    recordBounce(pos, interval);
+  } else {
+    uint16_t& bounce = s_bounce[pos.m_line][pos.m_column];
+    uint16_t decay = bounce >> DECAY_SHIFT;
+    if (decay > 0 && s_time[pos.m_line][pos.m_column] > DEBOUNCE_MIN_TIME) {
+      bounce -= decay;
+      updateTime(pos);
+      s_changed = true;
+    }
+  }
+}
+
+void Debounce::step(unsigned long now) {
+  using namespace DebounceImpl;
+
+  if (s_changed) {
+    s_changed = false;
+    s_dirty = true;
+    s_lastActivity = now;
+  }
+
+  if (s_dirty && now - s_lastActivity >= DEBOUNCE_SAVE_DELAY) {
+    if (Storage::write(Storage::RECORD_DEBOUNCE, s_bounce, sizeof(s_bounce))) s_dirty = false;
+    // If the save failed, try again after another delay.
+    s_lastActivity = now;
+  }
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include "config.h"
+#include "pos.h"
+#include <stdint.h>
+
+/// Per-key debounce times, learned from the bounces observed on each switch.
+///
+/// Each key keeps an estimate of how long its switch bounces. It is raised by every bounce observed on the switch and slowly decays on clean presses.
+/// The debounce time of the key is derived from it, bounded by DEBOUNCE_MIN_TIME and DEBOUNCE_MAX_TIME.
+namespace Debounce {
+
+/// Initialize the debounce times, restoring the ones saved in flash if any. Must be called once after Storage::init() and Settings::init().
+void init();
+
+/// Forget everything learned and start again from Settings::SETTING_DEBOUNCE_TIME for every key.
+void reset();
+
+/// Debounce time of the key at 'pos', in micro-seconds.
+inline unsigned long time(Pos pos);
+
+/// Record that the switch at 'pos' bounced: two opposite edges were 'interval' micro-seconds apart.
+void recordBounce(Pos pos, unsigned long interval);
+
+/// Record that an edge of the switch at 'pos' passed the debouncing at 'time'.
+///
+/// Edges too close to the previous one of the same key are bounces that leaked through the debouncing, they raise the debounce time of the key.
+void recordEdge(Pos pos, unsigned long time);
+
+/// Save the debounce times to flash if they changed, once no edge was recorded for DEBOUNCE_SAVE_DELAY. Only call it when the keyboard is idle.
+void step(unsigned long now);
+}
+
+/// Namespace containing all the implementation details of the debouncing.
+namespace DebounceImpl {
+/// Debounce time of each key, in micro-seconds.
+extern uint16_t s_time[NUM_LINES][NUM_COLUMNS];
+}
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline unsigned long Debounce::time(Pos pos) {
+  return DebounceImpl::s_time[pos.m_line][pos.m_column];
+}
@@ -44,6 +44,12 @@ public:
   /// True if the queue is empty.
   inline bool isEmpty() const;
 
+  /// True if no more event can be added to the queue.
+  inline bool isFull() const;
+
+  /// Number of entries between the front and the end of the queue, including the removed events that are still occupying a slot.
+  inline uint8_t size() const;
+
   /// Loot at the first event in the queue without consumint it.
   inline const Event& peek() const;
 
@@ -127,6 +133,14 @@ inline bool EventQueue::isEmpty() const {
   return m_head == m_tail;
 }
 
+inline bool EventQueue::isFull() const {
+  return uint8_t(m_tail.m_index + 1) == m_head.m_index;
+}
+
+inline uint8_t EventQueue::size() const {
+  return m_tail.m_index - m_head.m_index;
+}
+
 inline const Event& EventQueue::peek() const {
   return m_events[m_head.m_index].m_item;
 }
@@ -160,7 +174,8 @@ inline Event& EventQueue::operator[](Iterator it) {
 
 inline void EventQueue::remove(Iterator it) {
   if (it == m_head) {
-    m_head.m_index++;
+    // Like popFront(), skip the removed events that follow so that the front is never a removed event.
+    m_head = next(m_head);
   } else {
     m_events[it.m_index].m_deleted = true;
   }
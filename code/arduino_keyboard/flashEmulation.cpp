@@ -0,0 +1,87 @@
+#include "flashEmulation.h"
+#if FLASH_EMULATION
+#include <string.h>
+
+static_assert(FLASH_EMULATION_SIZE % EmulatedFlash::SECTOR_SIZE == 0, "the emulated flash is made of whole sectors");
+
+EmulatedFlash::EmulatedFlash() {
+  memset(m_memory, 0xFF, sizeof(m_memory));
+}
+
+int EmulatedFlash::init() {
+  return 0;
+}
+
+int EmulatedFlash::deinit() {
+  return 0;
+}
+
+int EmulatedFlash::read(void* buffer, uint32_t address, uint32_t size) {
+  if (m_isOff || address < START || address - START + size > sizeof(m_memory)) return -1;
+  memcpy(buffer, m_memory + (address - START), size);
+  return 0;
+}
+
+int EmulatedFlash::program(const void* buffer, uint32_t address, uint32_t size) {
+  if (address < START || address - START + size > sizeof(m_memory) || (address - START) % PAGE_SIZE != 0 || size % PAGE_SIZE != 0) return -1;
+
+  const uint8_t* bytes = (const uint8_t*)buffer;
+  for (uint32_t offset = 0; offset < size; offset += PAGE_SIZE) {
+    uint8_t* page = m_memory + (address - START) + offset;
+    uint32_t length = poweredLength(PAGE_SIZE);
+    for (uint32_t i = 0; i < length; ++i) {
+      page[i] &= bytes[offset + i];
+    }
+    if (length < PAGE_SIZE) return -1;
+  }
+  return 0;
+}
+
+int EmulatedFlash::erase(uint32_t address, uint32_t size) {
+  if (address < START || address - START + size > sizeof(m_memory) || (address - START) % SECTOR_SIZE != 0 || size % SECTOR_SIZE != 0) return -1;
+
+  for (uint32_t offset = 0; offset < size; offset += SECTOR_SIZE) {
+    uint32_t length = poweredLength(SECTOR_SIZE);
+    memset(m_memory + (address - START) + offset, 0xFF, length);
+    if (length < SECTOR_SIZE) return -1;
+  }
+  return 0;
+}
+
+uint32_t EmulatedFlash::get_sector_size(uint32_t) const {
+  return SECTOR_SIZE;
+}
+
+uint32_t EmulatedFlash::get_page_size() const {
+  return PAGE_SIZE;
+}
+
+uint32_t EmulatedFlash::get_flash_start() const {
+  return START;
+}
+
+uint32_t EmulatedFlash::get_flash_size() const {
+  return sizeof(m_memory);
+}
+
+const uint8_t* EmulatedFlash::memory(uint32_t address) const {
+  return m_memory + (address - START);
+}
+
+void EmulatedFlash::cutPowerAfter(int operations) {
+  m_remaining = operations;
+}
+
+void EmulatedFlash::powerOn() {
+  m_remaining = -1;
+  m_isOff = false;
+}
+
+uint32_t EmulatedFlash::poweredLength(uint32_t size) {
+  if (m_isOff) return 0;
+  if (m_remaining < 0 || m_remaining-- > 0) return size;
+
+  m_isOff = true;
+  return size / 2;
+}
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+#include "config.h"
+#if FLASH_EMULATION
+#include <stdint.h>
+
+/// Flash memory kept in RAM, with the interface of mbed's FlashIAP used by Storage, so that the storage can run on Linux. Enabled by FLASH_EMULATION.
+///
+/// It behaves like a NOR flash: an erase sets a whole sector to 0xFF and programming can only clear bits, so a sector programmed twice without an erase reads back wrong, as on the chip.
+/// cutPowerAfter() interrupts a later operation halfway, to check that the records survive a power loss during a write.
+class EmulatedFlash {
+public:
+  static const uint32_t START = 0x10000000;
+  static const uint32_t SECTOR_SIZE = 4096;
+  static const uint32_t PAGE_SIZE = 256;
+
+  /// A new flash, erased as it leaves the factory.
+  EmulatedFlash();
+
+  /// Do nothing, the content is kept from a call to the next as on the chip.
+  int init();
+  int deinit();
+
+  /// Copy 'size' bytes at 'address' to 'buffer'. Return 0 on success, like every operation.
+  int read(void* buffer, uint32_t address, uint32_t size);
+
+  /// Program 'size' bytes from 'buffer' at 'address', both multiples of PAGE_SIZE.
+  int program(const void* buffer, uint32_t address, uint32_t size);
+
+  /// Erase the 'size' bytes at 'address', both multiples of SECTOR_SIZE.
+  int erase(uint32_t address, uint32_t size);
+
+  uint32_t get_sector_size(uint32_t address) const;
+  uint32_t get_page_size() const;
+  uint32_t get_flash_start() const;
+  uint32_t get_flash_size() const;
+
+  /// The byte at 'address', where the chip maps the flash in memory.
+  const uint8_t* memory(uint32_t address) const;
+
+  /// Interrupt the operation after the next 'operations' pages programmed or sectors erased: it only does the first half of its page or sector, and every operation fails until powerOn().
+  void cutPowerAfter(int operations);
+
+  /// Accept operations again after cutPowerAfter(). The content of the flash is kept, as after a reboot.
+  void powerOn();
+
+private:
+  /// Number of bytes of the next page or sector of 'size' bytes that are actually written: all of them, half of them if the power is cut during this one, none once it is off.
+  uint32_t poweredLength(uint32_t size);
+
+  uint8_t m_memory[FLASH_EMULATION_SIZE];
+  /// Number of operations before the power is cut, or -1 if it is never cut.
+  int m_remaining = -1;
+  bool m_isOff = false;
+};
+#endif
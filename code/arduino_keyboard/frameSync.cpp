@@ -0,0 +1,109 @@
+#include "frameSync.h"
+#include "perf.h"
+#include "mbed.h"
+#include "hardware/structs/usb.h"
+#include <Arduino.h>
+
+namespace FrameSyncImpl {
+volatile uint16_t s_frameNumber = 0;
+volatile unsigned long s_frameTime = 0;
+volatile bool s_hasFrame = false;
+volatile unsigned long s_submitTime = 0;
+
+/// Length of a full speed USB frame, in micro-seconds.
+static const unsigned long FRAME_LENGTH = 1000;
+
+/// Phase of the polls after the start of frame, averaged over the last polls, in eighths of micro-second: in micro-seconds, the average would stop up to 7 micro-seconds
+/// away from the polls, the eighth of the difference being rounded to 0.
+static const unsigned long PHASE_SCALE = 8;
+volatile unsigned long s_pollPhase = 0;
+
+/// Estimate of the time from the start of a scan to its reports being queued, in micro-seconds.
+/// It follows a longer scan right away but a shorter one slowly, so that the aligned scans are rarely late.
+unsigned long s_scanTime = 0;
+
+/// The poll the current scan was aligned on, and whether it was.
+unsigned long s_poll = 0;
+bool s_isAligned = false;
+
+/// Handler of the USB interrupt installed by the USB stack.
+void (*s_usbHandler)() = nullptr;
+
+/// Replaces the handler of the USB interrupt. The USB stack does not forward the start of frame to the HID classes, so it is timestamped here before the USB stack handles the rest.
+void onUsbInterrupt() {
+  if (usb_hw->ints & USB_INTS_DEV_SOF_BITS) {
+    // Reading the frame number acknowledges the interrupt.
+    FrameSync::frame(usb_hw->sof_rd & USB_SOF_RD_BITS, micros());
+  }
+  s_usbHandler();
+}
+}
+
+void FrameSync::init() {
+  using namespace FrameSyncImpl;
+
+  core_util_critical_section_enter();
+  s_usbHandler = (void (*)())(uintptr_t)NVIC_GetVector(USBCTRL_IRQ_IRQn);
+  NVIC_SetVector(USBCTRL_IRQ_IRQn, (uint32_t)(uintptr_t)&onUsbInterrupt);
+  usb_hw_set->inte = USB_INTE_DEV_SOF_BITS;
+  core_util_critical_section_exit();
+}
+
+void FrameSync::polled(unsigned long now) {
+  using namespace FrameSyncImpl;
+
+  unsigned long phase = (now - s_frameTime) % FRAME_LENGTH;
+
+  // The phase wraps around at the end of the frame: polls just before and just after the start of frame are close, the average moves by the shortest way between them.
+  const long length = FRAME_LENGTH * PHASE_SCALE;
+  long difference = long(phase * PHASE_SCALE) - long(s_pollPhase);
+  if (difference >= length / 2) {
+    difference -= length;
+  } else if (difference < -length / 2) {
+    difference += length;
+  }
+  s_pollPhase = (s_pollPhase + length + difference / 8) % length;
+  Perf::record(Perf::HISTOGRAM_POLL_PHASE, phase);
+  Perf::record(Perf::HISTOGRAM_REPORT_WAIT, now - s_submitTime);
+}
+
+unsigned long FrameSync::align(unsigned long now) {
+  using namespace FrameSyncImpl;
+
+  // Without recent frames the bus is not configured or suspended, there is nothing to align on.
+  s_isAligned = false;
+  unsigned long frameTime = s_frameTime;
+  if (!s_hasFrame || now - frameTime > 2 * FRAME_LENGTH) return now;
+
+  // The next poll, and when a scan must start to end just before it.
+  unsigned long poll = frameTime + s_pollPhase / PHASE_SCALE;
+  while (long(poll - SOF_SYNC_MARGIN - now) <= 0) poll += FRAME_LENGTH;
+  unsigned long start = poll - SOF_SYNC_MARGIN - s_scanTime;
+
+  // If a whole scan fits before 'start', it runs now and the next one is aligned. If this scan already ends after the poll, waiting would not help.
+  long slack = long(start - now);
+  if (slack <= 0 || (unsigned long)slack >= s_scanTime) return now;
+
+  wait_us(slack);
+  s_poll = poll;
+  s_isAligned = true;
+  Perf::count(Perf::COUNTER_SOF_ALIGNED);
+  return micros();
+}
+
+unsigned long FrameSync::pollPhase() {
+  return FrameSyncImpl::s_pollPhase / FrameSyncImpl::PHASE_SCALE;
+}
+
+void FrameSync::scanned(unsigned long start, unsigned long end) {
+  using namespace FrameSyncImpl;
+
+  unsigned long duration = end - start;
+  if (duration > s_scanTime) {
+    s_scanTime = duration;
+  } else {
+    s_scanTime -= (s_scanTime - duration) / 16;
+  }
+
+  if (s_isAligned && long(end - s_poll) > 0) Perf::count(Perf::COUNTER_SOF_LATE);
+}
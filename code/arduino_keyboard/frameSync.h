@@ -0,0 +1,65 @@
+#pragma once
+#include "config.h"
+#include <stdint.h>
+
+/// Alignment of the scans on the polls of the USB host, see SOF_SYNC.
+///
+/// The host polls the keyboard once per USB frame, at a fixed phase after the start of frame. A report queued just after a poll waits for the next frame, so the last scan before a poll is the one that matters.
+/// The USB interrupt timestamps each start of frame and each poll that took a report, which gives the phase of the polls. When the scan after the current one would end after the next poll, the main loop waits so that the current one ends just before it.
+namespace FrameSync {
+
+/// Enable the start of frame interrupt of the USB controller. Must be called once in setup().
+void init();
+
+/// Called from the USB interrupt at each start of frame 'number', at 'now'.
+inline void frame(uint16_t number, unsigned long now);
+
+/// Number of the last start of frame seen by the USB interrupt, 0 before the first one.
+///
+/// Reading the frame number from the controller acknowledges the start of frame interrupt, so only the interrupt reads it once it is enabled. The others read this copy.
+inline uint16_t frameNumber();
+
+/// Called when a keyboard report is handed to the USB endpoint, at 'now'.
+inline void submitted(unsigned long now);
+
+/// Called from the USB interrupt when the host took the keyboard report handed to the endpoint, at 'now'.
+void polled(unsigned long now);
+
+/// Wait if needed so that a scan starting now ends just before the next poll. Return the time the scan can start.
+unsigned long align(unsigned long now);
+
+/// The scan started by align() at 'start' queued its reports at 'end'.
+void scanned(unsigned long start, unsigned long end);
+
+/// Phase of the polls after the start of frame, averaged over the last polls, in micro-seconds.
+unsigned long pollPhase();
+}
+
+/// Namespace containing all the implementation details of the frame synchronization.
+namespace FrameSyncImpl {
+
+/// Number and time of the last start of frame, and whether one was seen at all.
+extern volatile uint16_t s_frameNumber;
+extern volatile unsigned long s_frameTime;
+extern volatile bool s_hasFrame;
+
+/// Time at which the report being sent was handed to the endpoint.
+extern volatile unsigned long s_submitTime;
+}
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline void FrameSync::frame(uint16_t number, unsigned long now) {
+  using namespace FrameSyncImpl;
+  s_frameNumber = number;
+  s_frameTime = now;
+  s_hasFrame = true;
+}
+
+inline uint16_t FrameSync::frameNumber() {
+  return FrameSyncImpl::s_frameNumber;
+}
+
+inline void FrameSync::submitted(unsigned long now) {
+  FrameSyncImpl::s_submitTime = now;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+/// The GPIO pins of the matrix input backend.
+///
+/// They are mbed's DigitalInOut and DigitalIn, unless GPIO_IN_OUT and GPIO_IN are defined to classes with the same constructors, input(), output(), mode(), read() and
+/// write() and declared before this header, along with wait_us() and the PinName and PinMode of the pins, e.g. the fake pins of the host tests.
+#ifdef GPIO_IN_OUT
+typedef GPIO_IN_OUT GpioInOut;
+typedef GPIO_IN GpioIn;
+#else
+#include "mbed.h"
+typedef mbed::DigitalInOut GpioInOut;
+typedef mbed::DigitalIn GpioIn;
+#endif
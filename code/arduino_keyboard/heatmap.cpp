@@ -0,0 +1,58 @@
+#include "heatmap.h"
+#include "storage.h"
+#include <string.h>
+
+namespace HeatmapImpl {
+HeatmapRecord s_record;
+bool s_dirty = false;
+unsigned long s_lastPress = 0;
+
+/// The flash records used in turn by the saves.
+static const Storage::Record s_banks[] = { Storage::RECORD_HEATMAP_0, Storage::RECORD_HEATMAP_1, Storage::RECORD_HEATMAP_2, Storage::RECORD_HEATMAP_3 };
+
+static const int NUM_BANKS = sizeof(s_banks) / sizeof(s_banks[0]);
+}
+
+void Heatmap::init() {
+  using namespace HeatmapImpl;
+
+  s_record.m_sequence = 0;
+  reset();
+  s_dirty = false;
+
+  HeatmapRecord record;
+  for (int bank = 0; bank < NUM_BANKS; ++bank) {
+    if (Storage::read(s_banks[bank], &record, sizeof(record)) && record.m_sequence > s_record.m_sequence) {
+      s_record = record;
+    }
+  }
+}
+
+void Heatmap::reset() {
+  using namespace HeatmapImpl;
+
+  // The sequence is kept so that the next save still goes after the most recent one.
+  memset(s_record.m_presses, 0, sizeof(s_record.m_presses));
+  s_dirty = true;
+}
+
+void Heatmap::step(unsigned long now) {
+  using namespace HeatmapImpl;
+
+  if (s_dirty && now - s_lastPress >= HEATMAP_SAVE_DELAY) {
+    save();
+    // If the save failed, try again after another delay.
+    s_lastPress = now;
+  }
+}
+
+void Heatmap::save() {
+  using namespace HeatmapImpl;
+
+  if (!s_dirty) return;
+
+  s_record.m_sequence++;
+  if (Storage::write(s_banks[s_record.m_sequence % NUM_BANKS], &s_record, sizeof(s_record))) {
+    s_dirty = false;
+  }
+}
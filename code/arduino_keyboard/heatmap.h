@@ -0,0 +1,62 @@
+#pragma once
+#include "config.h"
+#include "keymap.h"
+#include "pos.h"
+#include <stdint.h>
+
+/// Number of presses of each key on each layer combination, used to optimize the keymap from real usage.
+///
+/// The counters live in RAM and are saved to flash when the keyboard is not used, never while typing: a flash write stalls the execution from flash for several milli-seconds.
+/// Each save goes to the next of several flash sectors, so that their erases are spread evenly. They are read by the USB host through CONTROL_READ_HEATMAP.
+namespace Heatmap {
+
+/// Restore the counters from the most recent save in flash, if any. Must be called once after Storage::init().
+void init();
+
+/// Forget every press, in RAM only. The flash is updated by the next save.
+void reset();
+
+/// Record a press of the key at 'pos' while the layers of 'mask' were active.
+inline void recordPress(uint8_t mask, Pos pos, unsigned long time);
+
+/// Number of presses of the key at 'pos' while the layers of 'mask' were active.
+inline uint32_t presses(uint8_t mask, Pos pos);
+
+/// Save the counters to flash if they changed and no key was pressed for HEATMAP_SAVE_DELAY. Only call it when the keyboard is idle.
+void step(unsigned long now);
+
+/// Save the counters to flash now if they changed. Only call it when the keyboard is idle or suspended by the USB host.
+void save();
+}
+
+/// Namespace containing all the implementation details of the heatmap.
+namespace HeatmapImpl {
+
+/// Content of a flash sector of the heatmap.
+struct HeatmapRecord {
+  /// Incremented by each save. The bank with the highest sequence is the most recent one.
+  uint32_t m_sequence;
+  uint32_t m_presses[NUM_LAYER_MASKS][NUM_LINES][NUM_COLUMNS];
+};
+
+extern HeatmapRecord s_record;
+
+/// The counters changed since the last save.
+extern bool s_dirty;
+
+/// Time of the last recorded press.
+extern unsigned long s_lastPress;
+}
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline void Heatmap::recordPress(uint8_t mask, Pos pos, unsigned long time) {
+  using namespace HeatmapImpl;
+  s_record.m_presses[mask][pos.m_line][pos.m_column]++;
+  s_dirty = true;
+  s_lastPress = time;
+}
+
+inline uint32_t Heatmap::presses(uint8_t mask, Pos pos) {
+  return HeatmapImpl::s_record.m_presses[mask][pos.m_line][pos.m_column];
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+/// The I2C bus of the MCP drivers and input backends.
+///
+/// It is TimedI2c, whose transfers time out, unless I2C_BUS is defined to a class with the same constructor, frequency(), read() and write() and declared before this
+/// header, e.g. the fake bus of the host tests.
+#ifdef I2C_BUS
+typedef I2C_BUS I2cBus;
+#else
+#include "timedI2c.h"
+typedef TimedI2c I2cBus;
+#endif
@@ -0,0 +1,112 @@
+#include "i2cClock.h"
+#include "perf.h"
+
+namespace I2cClockImpl {
+uint8_t s_level = 0;
+uint32_t s_levels[3] = {};
+uint16_t s_scans = 0;
+
+/// The standard speeds of the bus below Fast-mode Plus, from the highest.
+const uint32_t STANDARD_FREQUENCIES[] = { 400000, 100000 };
+
+/// Number of clock levels used by this board.
+uint8_t s_numLevels = 1;
+
+/// Number of failed reads of each chip in the current window.
+uint8_t s_errors[I2cClock::MAX_CHIPS] = {};
+
+/// Number of windows without errors since the last change of the clock.
+uint16_t s_cleanWindows = 0;
+
+/// Number of windows without errors before stepping up, doubled by each step up that fails.
+uint16_t s_probeWindows = I2C_PROBE_WINDOWS;
+
+/// The clock stepped up and the current window is the first one at that clock.
+bool s_probing = false;
+
+/// Start a new window of scans.
+void resetWindow() {
+  s_scans = 0;
+  for (int i = 0; i < I2cClock::MAX_CHIPS; ++i) {
+    s_errors[i] = 0;
+  }
+}
+
+/// Change the clock to the level 'level'.
+void setLevel(uint8_t level) {
+  s_level = level;
+  s_cleanWindows = 0;
+  Perf::set(Perf::COUNTER_I2C_KHZ, I2cClock::frequency() / 1000);
+}
+
+bool endWindow() {
+  bool clean = true;
+  for (int i = 0; i < I2cClock::MAX_CHIPS; ++i) {
+    clean = clean && s_errors[i] == 0;
+  }
+  resetWindow();
+
+  if (s_probing) {
+    s_probing = false;
+    if (!clean) {
+      // Even a few errors in the first window show that the wiring is at its limit at the new clock: step back down, and wait longer before the next step up.
+      if (s_probeWindows < I2C_PROBE_WINDOWS * 8) s_probeWindows *= 2;
+      setLevel(s_level + 1);
+      Perf::count(Perf::COUNTER_I2C_SLOWDOWNS);
+      return true;
+    }
+
+    // The new clock held for a whole window without any error, the next step up comes at the normal pace.
+    s_probeWindows = I2C_PROBE_WINDOWS;
+  }
+  if (!clean) {
+    s_cleanWindows = 0;
+    return false;
+  }
+  if (s_level == 0 || ++s_cleanWindows < s_probeWindows) return false;
+
+  setLevel(s_level - 1);
+  s_probing = true;
+  Perf::count(Perf::COUNTER_I2C_SPEEDUPS);
+  return true;
+}
+}
+
+void I2cClock::init(uint32_t maximum) {
+  using namespace I2cClockImpl;
+
+  // The standard speeds that are not below the maximum are skipped.
+  s_levels[0] = maximum;
+  s_numLevels = 1;
+  for (uint32_t frequency : STANDARD_FREQUENCIES) {
+    if (frequency < maximum) s_levels[s_numLevels++] = frequency;
+  }
+  resetWindow();
+  setLevel(0);
+}
+
+bool I2cClock::recordError(int chip) {
+  using namespace I2cClockImpl;
+
+  Perf::count(Perf::COUNTER_I2C_ERRORS);
+  // The failed scan still counts in the window, so that a chip failing in every scan is not stuck in it.
+  ++s_scans;
+  if (++s_errors[chip] < I2C_ERROR_THRESHOLD) {
+    return s_scans >= I2C_ERROR_WINDOW && endWindow();
+  }
+
+  resetWindow();
+  if (s_probing) {
+    // The step up failed right away, wait longer before the next one.
+    s_probing = false;
+    if (s_probeWindows < I2C_PROBE_WINDOWS * 8) s_probeWindows *= 2;
+  }
+  if (s_level + 1 >= s_numLevels) {
+    s_cleanWindows = 0;
+    return false;
+  }
+
+  setLevel(s_level + 1);
+  Perf::count(Perf::COUNTER_I2C_SLOWDOWNS);
+  return true;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "config.h"
+#include <stdint.h>
+
+/// Clock of the I2C bus of the MCP input backends, adapted to the error rate of the chips.
+///
+/// The bus starts at the highest clock of the board. When a chip fails I2C_ERROR_THRESHOLD reads within a window of I2C_ERROR_WINDOW scans, the clock steps down to the next standard speed.
+/// After I2C_PROBE_WINDOWS windows without errors it steps up again. A step up is only kept if its first window has no error at all, otherwise the clock steps back down and the next step up waits twice as long, so that a board whose wiring cannot take a speed settles below it.
+namespace I2cClock {
+
+/// Largest number of chips on the bus.
+static const int MAX_CHIPS = 8;
+
+/// Start at 'maximum' Hz, the highest clock the wiring of the board was designed for. Must be called once before any other functions.
+void init(uint32_t maximum);
+
+/// Current clock of the bus, in Hz.
+inline uint32_t frequency();
+
+/// Record a successful scan of every chip. Return true if the clock changed, the bus must then be set to frequency().
+inline bool recordScan();
+
+/// Record a failed read of the chip 'chip'. Return true if the clock changed, the bus must then be set to frequency().
+bool recordError(int chip);
+}
+
+/// Namespace containing all the implementation details of the I2C clock.
+namespace I2cClockImpl {
+
+/// Index in the clock levels of the current clock.
+extern uint8_t s_level;
+
+/// The clock levels, from the highest.
+extern uint32_t s_levels[];
+
+/// Number of scans in the current window.
+extern uint16_t s_scans;
+
+/// Called when a window of scans is complete.
+bool endWindow();
+}
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline uint32_t I2cClock::frequency() {
+  using namespace I2cClockImpl;
+  return s_levels[s_level];
+}
+
+inline bool I2cClock::recordScan() {
+  using namespace I2cClockImpl;
+  if (++s_scans < I2C_ERROR_WINDOW) return false;
+  return endWindow();
+}
@@ -1,61 +1,16 @@
 #include "input.h"
-#include "pos.h"
-#include "MCP23008.hpp"
-
-#if VERSION == 1
-#define NUM_MCP_CHIPS 8
-#else
-#define NUM_MCP_CHIPS 6
-#endif
+#include "inputBackend.h"
+#include "split.h"
+#include <Arduino.h>
 
 /// Namespace containing all the implementation details of the input system.
 namespace InputImpl {
 
-/// Indicate which key coordinates each input of each MCP is responsible for. m_mcp[i][j] is the key location for the j-th channel of the i-th MCP chip.
-static const Pos s_mcpToPos[8][8] = {
-#if VERSION == 1
-  { Pos{ 0, 6 }, Pos{ 1, 6 }, Pos{ 2, 6 }, Pos{ 3, 6 }, Pos{ 4, 6 }, Pos{ 4, 7 }, Pos{ 3, 7 }, Pos{ 2, 7 } },
-  { Pos{ 0, 7 }, Pos{ 1, 7 }, Pos{ 4, 8 }, Pos{ 3, 8 }, Pos{ 2, 8 }, Pos{ 1, 8 }, Pos{ 0, 8 }, Pos{ 4, 9 } },
-  { Pos{ 3, 9 }, Pos{ 2, 9 }, Pos{ 1, 9 }, Pos{ 4, 10 }, Pos{ 3, 10 }, Pos{ 0, 9 }, Pos{ 2, 10 }, Pos{ 1, 10 } },
-  { Pos{ 4, 11 }, Pos{ 3, 11 }, Pos{ 2, 11 }, Pos{ 0, 10 }, Pos{ 1, 11 }, Pos{ 0, 11 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
-  { Pos{ 0, 0 }, Pos{ 1, 0 }, Pos{ 2, 0 }, Pos{ 3, 0 }, Pos{ 4, 0 }, Pos{ 4, 1 }, Pos{ 3, 1 }, Pos{ 2, 1 } },
-  { Pos{ 0, 1 }, Pos{ 1, 1 }, Pos{ 4, 2 }, Pos{ 3, 2 }, Pos{ 2, 2 }, Pos{ 1, 2 }, Pos{ 0, 2 }, Pos{ 4, 3 } },
-  { Pos{ 3, 3 }, Pos{ 2, 3 }, Pos{ 1, 3 }, Pos{ 4, 4 }, Pos{ 3, 4 }, Pos{ 0, 3 }, Pos{ 2, 4 }, Pos{ 1, 4 } },
-  { Pos{ 4, 5 }, Pos{ 3, 5 }, Pos{ 2, 5 }, Pos{ 0, 4 }, Pos{ 1, 5 }, Pos{ 0, 5 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
-#else
-  { Pos{ 4, 8 }, Pos{ 4, 7 }, Pos{ 4, 6 }, Pos{ 3, 7 }, Pos{ 3, 6 }, Pos{ 2, 6 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
-  { Pos{ 2, 7 }, Pos{ 3, 8 }, Pos{ 2, 8 }, Pos{ 1, 8 }, Pos{ 1, 7 }, Pos{ 1, 6 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
-  { Pos{ 3, 9 }, Pos{ 3, 10 }, Pos{ 2, 10 }, Pos{ 1, 10 }, Pos{ 1, 9 }, Pos{ 2, 9 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
-
-  { Pos{ 4, 3 }, Pos{ 4, 4 }, Pos{ 4, 5 }, Pos{ 3, 4 }, Pos{ 3, 5 }, Pos{ 2, 5 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
-  { Pos{ 2, 4 }, Pos{ 3, 3 }, Pos{ 2, 3 }, Pos{ 1, 3 }, Pos{ 1, 4 }, Pos{ 1, 5 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
-  { Pos{ 3, 2 }, Pos{ 3, 1 }, Pos{ 2, 1 }, Pos{ 1, 1 }, Pos{ 1, 2 }, Pos{ 2, 2 }, Pos{ -1, -1 }, Pos{ -1, -1 } },
-#endif
-};
-
-/// The I2C handle, setup by Input::Init().
-I2C* s_i2c = nullptr;
-
-/// All MCP IO handles, passing the addressed on the I2C bus.
-static MCP23008 s_mcps[] = {
-#if VERSION == 1
-  MCP23008(0),
-  MCP23008(1),
-  MCP23008(2),
-  MCP23008(3),
-  MCP23008(4),
-  MCP23008(5),
-  MCP23008(6),
-  MCP23008(7),
-#else
-  MCP23008(0),
-  MCP23008(1),
-  MCP23008(2),
-  MCP23008(4),
-  MCP23008(5),
-  MCP23008(6),
-#endif
-};
+/// The inputs pressed at the last successful call to Input::step(), including the ones of the secondary half on the primary half of a split keyboard.
+InputFrame s_pressed = 0;
+
+/// The inputs whose state changed in the last call to Input::step().
+InputFrame s_changed = 0;
 
 /// The current state of every switch. True mean pressed, false mean released.
 bool s_state[NUM_LINES][NUM_COLUMNS];
@@ -63,20 +18,16 @@ bool s_state[NUM_LINES][NUM_COLUMNS];
 /// Indicate if the state each switch have changed in the last call to Input::step().
 bool s_stateChanged[NUM_LINES][NUM_COLUMNS];
 
-/// Reset the I2C bus and initialize each MCP chip.
-void resetI2C() {
-  if (s_i2c != nullptr) {
-    delete s_i2c;
-  }
-  s_i2c = new I2C(p8, p9);
-  s_i2c->frequency(400000);
-  //s_i2c->frequency(100000);
-
-  for (MCP23008& mcp : s_mcps) {
-    mcp.setI2C(s_i2c);
-    mcp.reset();
-    mcp.set_input_pins(MCP23008::Pin_All);
-    mcp.set_pullups(MCP23008::Pin_All);
+/// Set the flag of the switch of each input of 'inputs' in 'flags' to its bit in 'values'. Only the set bits are visited.
+void setFlags(bool (&flags)[NUM_LINES][NUM_COLUMNS], InputFrame inputs, InputFrame values) {
+  while (inputs != 0) {
+    int input = __builtin_ctzll(inputs);
+    inputs &= inputs - 1;
+
+    Pos pos = InputBackend::pos(input);
+    if (pos.m_line >= 0) {
+      flags[pos.m_line][pos.m_column] = (values >> input) & 1;
+    }
   }
 }
 }
@@ -84,73 +35,61 @@ void resetI2C() {
 void Input::init() {
   using namespace InputImpl;
 
-  resetI2C();
+#if SPLIT_ROLE != SPLIT_NONE
+  Split::init();
+#endif
+  InputBackend::init();
 
   // Set the initial state.
   for (int line = 0; line < NUM_LINES; ++line) {
     for (int column = 0; column < NUM_COLUMNS; ++column) {
       s_state[line][column] = false;
       s_stateChanged[line][column] = false;
-      //s_currentPressCount[line][column] = 0;
     }
   }
 }
+
 void Input::step() {
   using namespace InputImpl;
 
-  bool mcpError = false;
-#if I2C_RESET_LOG
-  int mcpErrorIndex;
+#if SPLIT_ROLE == SPLIT_PRIMARY
+  // The link is read before the scan so that it is drained even if the scan fails.
+  uint32_t remotePressed = Split::receive(micros());
 #endif
 
-  // We read all all the MCP first.
-  // We do this first because we want to sure we can updates all the s_stateChanged otherwise if we stop midway through in case of error we would could skip some s_stateChanged.
-  uint8_t pinsForMcp[NUM_MCP_CHIPS];
-  for (int mcpIndex = 0; mcpIndex < NUM_MCP_CHIPS; ++mcpIndex) {
-    pinsForMcp[mcpIndex] = s_mcps[mcpIndex].read_inputs();
+  // The changes of the last step are reported once, even if the backend cannot be read.
+  setFlags(s_stateChanged, s_changed, 0);
+  s_changed = 0;
+
+  // If the backend could not be read, it has reset itself and we keep the previous state.
+  InputFrame pressed;
+  if (!InputBackend::scan(pressed)) return;
 
-    if (s_mcps[mcpIndex].isError()) {
-      mcpError = true;
-#if I2C_RESET_LOG
-      mcpErrorIndex = mcpIndex;
+#if SPLIT_ROLE == SPLIT_PRIMARY
+  // The inputs of the secondary half are read from the split link, as if they were on this board.
+  pressed |= InputFrame(remotePressed) << SPLIT_FIRST_INPUT;
+#elif SPLIT_ROLE == SPLIT_SECONDARY
+  Split::send(uint32_t(pressed >> SPLIT_FIRST_INPUT), micros());
 #endif
-      break;
-    }
-  }
 
-  if (!mcpError) {
-    // If there was no issue reading the MCPs, we update all the switches state.
-    for (int mcpIndex = 0; mcpIndex < NUM_MCP_CHIPS; ++mcpIndex) {
-      uint8_t pins = pinsForMcp[mcpIndex];
-
-      for (int pin = 0; pin < 8; ++pin) {
-        Pos pos = s_mcpToPos[mcpIndex][pin];
-        if (pos.m_line >= 0) {
-          bool isPressed = !(pins & (1 << pin));
-          s_stateChanged[pos.m_line][pos.m_column] = s_state[pos.m_line][pos.m_column] != isPressed;
-          s_state[pos.m_line][pos.m_column] = isPressed;
-        }
-      }
-    }
-  } else {
-    // If we had an error, we reset the I2C bus.
+  update(pressed);
+}
 
-    // First reset the bus a few time, this somehow help.
-    for (int i = 0; i < 10; ++i) {
-      delete s_i2c;
-      s_i2c = new I2C(p8, p9);
-    }
+void Input::reset() {
+  InputBackend::reset();
+}
 
-    // Actual reset.
-    resetI2C();
+void Input::update(InputFrame pressed) {
+  using namespace InputImpl;
 
-#if I2C_RESET_LOG
-    Serial.print("Reset i2c (chip index ");
-    Serial.print(mcpErrorIndex);
-    Serial.println(" was in error state)");
-#endif
-    //return;
-  }
+  // The changes of the last update are reported once.
+  setFlags(s_stateChanged, s_changed, 0);
+
+  // Only the switches that changed are updated.
+  s_changed = pressed ^ s_pressed;
+  s_pressed = pressed;
+  setFlags(s_state, s_changed, pressed);
+  setFlags(s_stateChanged, s_changed, ~InputFrame(0));
 }
 
 bool Input::isPressed(int line, int column) {
@@ -163,4 +102,4 @@ bool Input::hasChanged(int line, int column) {
   using namespace InputImpl;
 
   return s_stateChanged[line][column];
-}
\ No newline at end of file
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "config.h"
+#include "inputBackend.h"
 
 /// Relate to everything about reading switches
 namespace Input {
@@ -10,6 +11,12 @@ void init();
 /// Read the state of the key switched.
 void step();
 
+/// Reset the hardware reading the switches after a scan got stuck. The state of the switches is kept.
+void reset();
+
+/// Update the state of the switches from the inputs pressed in 'pressed', as step() does with the inputs read from the backend.
+void update(InputFrame pressed);
+
 /// Return true if the key at coordinated (line, column) is pressed.
 bool isPressed(int line, int column);
 
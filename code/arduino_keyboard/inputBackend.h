@@ -0,0 +1,55 @@
+#pragma once
+#include "config.h"
+#include "pos.h"
+#include <stdint.h>
+
+/// State of every input of the backend, bit i is set if the switch on input i is pressed.
+typedef uint64_t InputFrame;
+
+// Number of inputs of the backend selected by INPUT_BACKEND.
+#if INPUT_BACKEND == INPUT_BACKEND_MATRIX
+#define NUM_INPUTS (NUM_LINES * NUM_COLUMNS)
+#else
+#include "board.h"
+#define NUM_INPUTS (NUM_MCP_PORTS * 8)
+#endif
+
+// On a split keyboard, the inputs from SPLIT_FIRST_INPUT are on the secondary half.
+#define SPLIT_FIRST_INPUT (NUM_INPUTS / 2)
+
+// Range of the inputs read by this board.
+#if SPLIT_ROLE == SPLIT_PRIMARY
+#define FIRST_LOCAL_INPUT 0
+#define END_LOCAL_INPUT SPLIT_FIRST_INPUT
+#elif SPLIT_ROLE == SPLIT_SECONDARY
+#define FIRST_LOCAL_INPUT SPLIT_FIRST_INPUT
+#define END_LOCAL_INPUT NUM_INPUTS
+#else
+#define FIRST_LOCAL_INPUT 0
+#define END_LOCAL_INPUT NUM_INPUTS
+#endif
+
+static_assert(NUM_INPUTS <= 64, "an InputFrame holds 64 inputs");
+static_assert(SPLIT_ROLE == SPLIT_NONE || NUM_INPUTS - SPLIT_FIRST_INPUT <= 32, "a split frame holds 32 inputs");
+
+/// The hardware reading the switches, used by Input.
+///
+/// There is one implementation per value of INPUT_BACKEND, in the input*.cpp files, and only the selected one is compiled: there is no dispatch at runtime.
+/// The drivers of the chips only use the bus through its read() and write() functions, and the MCP backends create it as an I2cBus, so that they can be run against a fake bus, see i2cBus.h.
+/// Likewise the matrix backend creates its pins as GpioInOut and GpioIn, so that it can be run against fake pins, see gpio.h.
+namespace InputBackend {
+
+/// Initialize the hardware. Must be called once before any other functions.
+void init();
+
+/// Read the state of the inputs from FIRST_LOCAL_INPUT to END_LOCAL_INPUT into 'pressed', other bits are cleared.
+///
+/// Return false, leaving 'pressed' unspecified, if the hardware could not be read. The backend then resets itself, the next scan can be tried right away.
+bool scan(InputFrame& pressed);
+
+/// Reset the hardware after a scan got stuck, see Deadline. The next scan can be tried right away.
+void reset();
+
+/// Position of the switch on 'input', or {-1, -1} if there is none.
+Pos pos(int input);
+}
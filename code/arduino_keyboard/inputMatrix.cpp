@@ -0,0 +1,74 @@
+#include "inputBackend.h"
+#if INPUT_BACKEND == INPUT_BACKEND_MATRIX
+#include "gpio.h"
+
+// Input column * NUM_LINES + line is the switch at (line, column). Counting by columns puts each half of a split keyboard in its own range of inputs.
+static_assert(SPLIT_ROLE == SPLIT_NONE || SPLIT_FIRST_INPUT % NUM_LINES == 0, "the halves of a split keyboard must have their own columns");
+
+/// Namespace containing all the implementation details of the matrix input backend.
+namespace InputMatrixImpl {
+
+/// Pins of the lines, from MATRIX_LINE_PINS.
+static const PinName s_linePins[] = { MATRIX_LINE_PINS };
+
+/// Pins of the columns, from MATRIX_COLUMN_PINS.
+static const PinName s_columnPins[] = { MATRIX_COLUMN_PINS };
+
+static_assert(sizeof(s_linePins) / sizeof(s_linePins[0]) == NUM_LINES, "MATRIX_LINE_PINS must have a pin per line");
+static_assert(sizeof(s_columnPins) / sizeof(s_columnPins[0]) == NUM_COLUMNS, "MATRIX_COLUMN_PINS must have a pin per column");
+
+/// The lines, setup by InputBackend::init(). A line is only driven while it is read, otherwise it floats so that two pressed switches of a column do not short two lines.
+GpioInOut* s_lines[NUM_LINES];
+
+/// The columns of this board, setup by InputBackend::init().
+GpioIn* s_columns[NUM_COLUMNS];
+}
+
+void InputBackend::init() {
+  using namespace InputMatrixImpl;
+
+  for (int line = 0; line < NUM_LINES; ++line) {
+    s_lines[line] = new GpioInOut(s_linePins[line]);
+    s_lines[line]->input();
+    s_lines[line]->mode(PullNone);
+  }
+  for (int column = FIRST_LOCAL_INPUT / NUM_LINES; column < END_LOCAL_INPUT / NUM_LINES; ++column) {
+    s_columns[column] = new GpioIn(s_columnPins[column], PullUp);
+  }
+}
+
+void InputBackend::reset() {
+  using namespace InputMatrixImpl;
+
+  // A scan stopped in the middle leaves its line driven.
+  for (int line = 0; line < NUM_LINES; ++line) s_lines[line]->input();
+}
+
+bool InputBackend::scan(InputFrame& pressed) {
+  using namespace InputMatrixImpl;
+
+  pressed = 0;
+  for (int line = 0; line < NUM_LINES; ++line) {
+    GpioInOut& driven = *s_lines[line];
+    driven.output();
+    driven.write(0);
+    wait_us(MATRIX_SETTLE_TIME);
+
+    // The columns have pull-ups, a pressed switch pulls its column to the driven line.
+    for (int column = FIRST_LOCAL_INPUT / NUM_LINES; column < END_LOCAL_INPUT / NUM_LINES; ++column) {
+      if (s_columns[column]->read() == 0) {
+        pressed |= InputFrame(1) << (column * NUM_LINES + line);
+      }
+    }
+
+    driven.input();
+  }
+
+  // The pins are read directly, this cannot fail.
+  return true;
+}
+
+Pos InputBackend::pos(int input) {
+  return Pos{ int8_t(input % NUM_LINES), int8_t(input / NUM_LINES) };
+}
+#endif
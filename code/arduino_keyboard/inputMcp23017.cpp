@@ -0,0 +1,103 @@
+#include "inputBackend.h"
+#if INPUT_BACKEND == INPUT_BACKEND_MCP23017
+#include "MCP23017.hpp"
+#include "deadline.h"
+#include "i2cClock.h"
+#include "recorder.h"
+#include "settings.h"
+#include <Arduino.h>
+
+// Each chip has two ports of board.h, input 16 * i + j is the j-th pin of the i-th chip, counting the pins of port A first.
+static_assert(NUM_MCP_PORTS % 2 == 0, "each chip has two ports");
+// The halves are split at NUM_INPUTS / 2 as for the MCP23008, moving the split would read ports of the other half, see INPUT_BACKEND.
+static_assert(SPLIT_ROLE == SPLIT_NONE || SPLIT_FIRST_INPUT % 16 == 0, "the halves of a split keyboard must have their own chips, this board cannot be split with the MCP23017 backend");
+
+// On a stuck bus, a failed scan waits for the timeout of its read, then of the reset of each chip.
+static_assert(((END_LOCAL_INPUT - FIRST_LOCAL_INPUT) / 16 + 1) * I2C_TRANSFER_TIMEOUT < LOOP_DEADLINE, "a stuck bus must be reset within the deadline of an iteration");
+
+/// Namespace containing all the implementation details of the MCP23017 input backend.
+namespace InputMcp23017Impl {
+
+/// The I2C handle, setup by InputBackend::init().
+I2cBus* s_i2c = nullptr;
+
+/// All MCP IO handles, passing the addressed on the I2C bus.
+static auto s_mcps = makeChips<MCP23017>(s_board.m_mcp23017Addresses);
+
+/// Reset the I2C bus and initialize each MCP chip of this board.
+void resetI2C() {
+  if (s_i2c != nullptr) {
+    delete s_i2c;
+  }
+  s_i2c = new I2cBus(p8, p9);
+  s_i2c->frequency(I2cClock::frequency());
+
+  for (int mcpIndex = FIRST_LOCAL_INPUT / 16; mcpIndex < END_LOCAL_INPUT / 16; ++mcpIndex) {
+    MCP23017& mcp = s_mcps[mcpIndex];
+    mcp.setI2C(s_i2c);
+    mcp.reset();
+    // A chip that does not answer would only make the next transfers wait for their timeout too, the next scan fails on it and resets the bus again.
+    if (mcp.isError()) continue;
+    mcp.set_input_pins(MCP23017::Pin_All);
+    mcp.set_pullups(MCP23017::Pin_All);
+  }
+}
+}
+
+void InputBackend::init() {
+  using namespace InputMcp23017Impl;
+
+  uint32_t frequency = Settings::get(Settings::SETTING_I2C_FREQUENCY);
+  I2cClock::init(frequency < s_board.m_i2cFrequency ? frequency : s_board.m_i2cFrequency);
+  resetI2C();
+}
+
+void InputBackend::reset() {
+  using namespace InputMcp23017Impl;
+
+  resetI2C();
+}
+
+bool InputBackend::scan(InputFrame& pressed) {
+  using namespace InputMcp23017Impl;
+
+  pressed = 0;
+  bool ok = Unrolled<FIRST_LOCAL_INPUT / 16, END_LOCAL_INPUT / 16>::all([&](int mcpIndex) {
+    Deadline::chip(mcpIndex);
+    uint16_t pins = s_mcps[mcpIndex].read_inputs();
+
+    if (s_mcps[mcpIndex].isError()) {
+      // First reset the bus a few time, like for the MCP23008 this somehow help.
+      for (int i = 0; i < 10; ++i) {
+        delete s_i2c;
+        s_i2c = new I2cBus(p8, p9);
+      }
+
+      // Actual reset, at a lower clock if this chip keeps failing.
+      I2cClock::recordError(mcpIndex);
+      resetI2C();
+      Recorder::record(Recorder::ENTRY_I2C_RESET, uint8_t(mcpIndex), 0, micros());
+
+#if I2C_RESET_LOG
+      Serial.print("Reset i2c (chip index ");
+      Serial.print(mcpIndex);
+      Serial.println(" was in error state)");
+#endif
+      return false;
+    }
+
+    // The pins have pull-ups, a pressed switch pulls its pin low.
+    pressed |= InputFrame(uint16_t(~pins)) << (16 * mcpIndex);
+    return true;
+  });
+
+  if (ok && I2cClock::recordScan()) {
+    s_i2c->frequency(I2cClock::frequency());
+  }
+  return ok;
+}
+
+Pos InputBackend::pos(int input) {
+  return s_board.m_portToPos[input / 8][input % 8];
+}
+#endif
@@ -1,24 +1,7 @@
 #pragma once
+#include "keymap.h"
 
-struct Forced
-{
-  Forced(Key k) : m_key(k) {}
-  Key m_key;
-};
-
-struct K
-{
-  K() : m_key0(Key::NONE), m_key1(Key::NONE), m_mediaKey(MediaKey::NONE), m_forcedKey(Key::NONE) {}
-  K(Key key0) : m_key0(key0), m_key1(Key::NONE), m_mediaKey(MediaKey::NONE), m_forcedKey(Key::NONE) {}
-  K(Key key0, Key key1) : m_key0(key0), m_key1(key1), m_mediaKey(MediaKey::NONE), m_forcedKey(Key::NONE) {}
-  K(Key key0, Forced key1) : m_key0(key0), m_key1(Key::NONE), m_mediaKey(MediaKey::NONE), m_forcedKey(key1.m_key) {}
-  K(MediaKey key) : m_key0(Key::NONE), m_key1(Key::NONE), m_mediaKey(key), m_forcedKey(Key::NONE) {}
-
-  Key m_key0;
-  Key m_key1;
-  MediaKey m_mediaKey;
-  Key m_forcedKey;
-};
+// Compiled-in keymap. It is used until a keymap image is loaded in flash, and it is what code/tools/keymap_compiler.cpp turns into an image.
 
 K baseLayer[5][12] =
 {
@@ -84,14 +67,6 @@ bool onRelease[5][12] =
   {false, false, false, false, false, true,  /**/ true,  false, false, false, false, false},
 };
 
-enum LayerBit : uint8_t
-{
-  LAYER_NONE = 0,
-  LAYER_SHIFT = 1,
-  LAYER_FUNCTION = 2,
-  LAYER_ACCENT = 3,
-};
-
 LayerBit s_layerKeys[5][12] =
 {
   {LAYER_NONE,  LAYER_NONE, LAYER_NONE, LAYER_NONE,     LAYER_NONE,   LAYER_NONE,   /**/ LAYER_NONE,     LAYER_NONE, LAYER_NONE, LAYER_NONE, LAYER_NONE, LAYER_NONE},
@@ -101,14 +76,16 @@ LayerBit s_layerKeys[5][12] =
   {LAYER_NONE,  LAYER_NONE, LAYER_NONE, LAYER_NONE,     LAYER_SHIFT,  LAYER_ACCENT, /**/ LAYER_FUNCTION, LAYER_NONE, LAYER_NONE, LAYER_NONE, LAYER_NONE, LAYER_NONE},
 };
 
-K s_keyMaps [8][5][12] =
+// All layer keys are active while held.
+LayerActivation s_layerActivations[5][12] = {};
+
+// The layers, from the lowest priority to the highest. See Layer.
+// The layers below define every key, use K(Key::TRANSPARENT) for the keys that a layer does not change.
+Layer s_layers[] =
 {
-  baseLayer,
-  shiftLayer,
-  functionLayer,
-  functionLayer,
-  accentLayer,
-  accentLayer,
-  accentLayer2,
-  accentLayer2
+  { 0,                                                        baseLayer,     K()           },
+  { LAYER_MASK(LAYER_SHIFT),                                  shiftLayer,    K(Key::SHIFT) },
+  { LAYER_MASK(LAYER_FUNCTION),                               functionLayer, K()           },
+  { LAYER_MASK(LAYER_ACCENT),                                 accentLayer,   K()           },
+  { LAYER_MASK(LAYER_FUNCTION) | LAYER_MASK(LAYER_ACCENT),    accentLayer2,  K()           },
 };
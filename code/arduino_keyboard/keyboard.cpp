@@ -1,4 +1,8 @@
 #include "keyboard.h"
+#include "perf.h"
+#include "telemetry.h"
+#include "frameSync.h"
+#include "controlProtocol.h"
 
 #include "PluggableUSBHID.h"
 #include "platform/Stream.h"
@@ -6,10 +10,12 @@
 
 #include "Keyboard.h"
 #include "usb_phy_api.h"
+#include "hardware/structs/usb.h"
+#include "reportDescriptor.h"
+#include "reportFifo.h"
 
 namespace KeyboardImpl {
-#define REPORT_ID_KEYBOARD 1
-#define REPORT_ID_VOLUME 3
+#define REPORT_TYPE_FEATURE 3
 
 enum ModifierKeys {
   MOD_CTRL = 0x01,
@@ -29,15 +35,72 @@ public:
   KeyboardHID(uint16_t vendor_id = 0x1235, uint16_t product_id = 0x0050, uint16_t product_release = 0x0001);
   virtual ~KeyboardHID();
 
+  /// Queue the given keyboard state to be sent to the host. This never waits for the USB endpoint.
   void press(uint8_t *keys, uint8_t modifiers, uint8_t mediaKey);
+
+  /// Queue a state with no key pressed.
   void releaseAll();
 
+  /// Start sending the next queued report if the IN endpoint is idle.
+  void pump();
+
+  /// Queue an answer of the control channel. It is sent once no keyboard state is waiting. Return false if the previous answer was not sent yet.
+  bool sendControl(const uint8_t *data);
+
+  /// Read a request of the control channel. Other output reports are discarded.
+  bool receiveControl(uint8_t *data);
+
+  /// True if the host allowed the keyboard to wake it up.
+  bool isRemoteWakeupEnabled() {
+    return m_remoteWakeup;
+  }
+
 protected:
   virtual const uint8_t *report_desc() override;
   virtual const uint8_t *configuration_desc(uint8_t index) override;
 
+  /// Called from the USB interrupt when the previous report was sent.
+  virtual void report_tx() override;
+
+  /// Called from the USB interrupt on control requests. Answers the reads of the telemetry feature report and the remote wakeup feature requests, everything else is handled by USBHID.
+  virtual uint32_t callback_request(const USBDevice::setup_packet_t *setup, USBDevice::RequestResult *result, uint8_t **data) override;
+
 private:
+  /// Add a state at the end of the FIFO, merging queued states if the FIFO is full, see ReportFifo.
+  void enqueue(const PendingState &state);
+
+  /// Must be called inside a critical section.
+  void pumpLocked();
+
   uint8_t _configuration_descriptor[41];
+
+  /// The states waiting to be sent. The state at the front is the one being sent.
+  ReportFifo<REPORT_FIFO_SIZE> m_fifo;
+
+  /// True while a report is owned by the IN endpoint.
+  volatile bool m_inFlight = false;
+
+  /// True when the keyboard report of the state at the front of the FIFO was sent and the media report is the next to send.
+  volatile bool m_mediaStage = false;
+
+  /// The last media key sent to the host, the media report is skipped when it did not change.
+  uint8_t m_lastMediaKey = 0;
+
+  /// Answer of the control channel waiting to be sent.
+  uint8_t m_control[CONTROL_REPORT_SIZE];
+  volatile bool m_controlPending = false;
+
+  /// True if the report owned by the IN endpoint is the control answer.
+  volatile bool m_controlInFlight = false;
+
+  /// Buffer for the telemetry feature report, it must outlive the control transfer.
+  uint8_t m_telemetryReport[1 + TELEMETRY_PAGE_SIZE];
+
+  /// First key of the next telemetry page to return.
+  uint8_t m_telemetryKey = 0;
+
+  /// Set by the host with SET_FEATURE(DEVICE_REMOTE_WAKEUP) before it suspends the bus.
+  volatile bool m_remoteWakeup = false;
 };
 
 
@@ -50,157 +113,163 @@ KeyboardHID::~KeyboardHID() {
 
 
 void KeyboardHID::press(uint8_t *keys, uint8_t modifiers, uint8_t mediaKey) {
-  HID_REPORT report;
-  report.data[0] = REPORT_ID_KEYBOARD;
-  report.data[1] = modifiers;
-  report.data[2] = 0;
-  report.data[3] = keys[0];
-  report.data[4] = keys[1];
-  report.data[5] = keys[2];
-  report.data[6] = keys[3];
-  report.data[7] = keys[4];
-  report.data[8] = keys[5];
-  report.length = 9;
-  send(&report);
-
-  report.data[0] = REPORT_ID_VOLUME;
-  report.data[1] = mediaKey;
-  report.length = 2;
-  send(&report);
+  PendingState state;
+  state.m_modifiers = modifiers;
+  memcpy(state.m_keys, keys, sizeof(state.m_keys));
+  state.m_mediaKey = mediaKey;
+  enqueue(state);
 }
 
 void KeyboardHID::releaseAll() {
+  PendingState state;
+  memset(&state, 0, sizeof(state));
+  enqueue(state);
+}
+
+void KeyboardHID::enqueue(const PendingState &state) {
+  core_util_critical_section_enter();
+
+  // The host is not polling fast enough when the FIFO is full, queued states are merged only when the host cannot tell the difference.
+  switch (m_fifo.push(state)) {
+    case ReportFifo<REPORT_FIFO_SIZE>::PUSH_MERGED:
+      Perf::count(Perf::COUNTER_REPORTS_MERGED);
+      break;
+    case ReportFifo<REPORT_FIFO_SIZE>::PUSH_DROPPED:
+      Perf::count(Perf::COUNTER_REPORTS_DROPPED);
+      break;
+    default:
+      break;
+  }
+  Perf::record(Perf::HISTOGRAM_REPORT_FIFO_DEPTH, m_fifo.count());
+
+  pumpLocked();
+  core_util_critical_section_exit();
+}
+
+void KeyboardHID::pump() {
+  core_util_critical_section_enter();
+  pumpLocked();
+  core_util_critical_section_exit();
+}
+
+bool KeyboardHID::sendControl(const uint8_t *data) {
+  core_util_critical_section_enter();
+  bool accepted = !m_controlPending;
+  if (accepted) {
+    memcpy(m_control, data, CONTROL_REPORT_SIZE);
+    m_controlPending = true;
+    pumpLocked();
+  }
+  core_util_critical_section_exit();
+  return accepted;
+}
+
+bool KeyboardHID::receiveControl(uint8_t *data) {
+  HID_REPORT report;
+  while (read_nb(&report)) {
+    if (report.length >= 1 + CONTROL_REPORT_SIZE && report.data[0] == REPORT_ID_CONTROL) {
+      memcpy(data, report.data + 1, CONTROL_REPORT_SIZE);
+      return true;
+    }
+  }
+  return false;
+}
+
+void KeyboardHID::pumpLocked() {
+  if (m_inFlight) return;
+
   HID_REPORT report;
-  report.data[0] = REPORT_ID_KEYBOARD;
-  report.data[1] = 0;
-  report.data[2] = 0;
-  report.data[3] = 0;
-  report.data[4] = 0;
-  report.data[5] = 0;
-  report.data[6] = 0;
-  report.data[7] = 0;
-  report.data[8] = 0;
-  report.length = 9;
-
-  send(&report);
+  if (m_fifo.count() == 0) {
+    // Keyboard states always go first, the control answer is only sent when the keyboard has nothing to say.
+    if (!m_controlPending) return;
+
+    report.data[0] = REPORT_ID_CONTROL;
+    memcpy(&report.data[1], m_control, CONTROL_REPORT_SIZE);
+    report.length = 1 + CONTROL_REPORT_SIZE;
+    if (send_nb(&report)) {
+      m_inFlight = true;
+      m_controlInFlight = true;
+    }
+    return;
+  }
+
+  const PendingState &state = m_fifo.front();
+  if (!m_mediaStage) {
+    report.data[0] = REPORT_ID_KEYBOARD;
+    report.data[1] = state.m_modifiers;
+    report.data[2] = 0;
+    memcpy(&report.data[3], state.m_keys, sizeof(state.m_keys));
+    report.length = 9;
+  } else {
+    report.data[0] = REPORT_ID_VOLUME;
+    report.data[1] = state.m_mediaKey;
+    report.length = 2;
+  }
+
+  // If the endpoint is not ready (e.g. the device is not configured yet) the report stays queued, the next call to pump() will try again.
+  if (send_nb(&report)) {
+    m_inFlight = true;
+    ON_SOF_SYNC(FrameSync::submitted(micros()));
+  }
+}
+
+void KeyboardHID::report_tx() {
+  m_inFlight = false;
+  Perf::count(Perf::COUNTER_USB_REPORTS);
+
+  if (m_controlInFlight) {
+    m_controlInFlight = false;
+    m_controlPending = false;
+    pumpLocked();
+    return;
+  }
+
+  ON_SOF_SYNC(FrameSync::polled(micros()));
+
+  // Move to the next report: the media report of the same state if the media key changed, otherwise the next state.
+  const PendingState &state = m_fifo.front();
+  if (!m_mediaStage && state.m_mediaKey != m_lastMediaKey) {
+    m_mediaStage = true;
+  } else {
+    if (m_mediaStage) m_lastMediaKey = state.m_mediaKey;
+    m_mediaStage = false;
+    m_fifo.pop();
+  }
+
+  pumpLocked();
+}
+
+uint32_t KeyboardHID::callback_request(const USBDevice::setup_packet_t *setup, USBDevice::RequestResult *result, uint8_t **data) {
+  if (setup->bmRequestType.Type == CLASS_TYPE
+      && setup->bRequest == GET_REPORT
+      && (setup->wValue >> 8) == REPORT_TYPE_FEATURE
+      && (setup->wValue & 0xFF) == REPORT_ID_TELEMETRY) {
+    // Each read returns the next page, the host uses the first key index of the page to know where it is.
+    m_telemetryReport[0] = REPORT_ID_TELEMETRY;
+    Telemetry::fillPage(m_telemetryKey, m_telemetryReport + 1, micros());
+    m_telemetryKey = m_telemetryReport[1] + m_telemetryReport[2];
+
+    *result = USBDevice::Send;
+    *data = m_telemetryReport;
+    return setup->wLength < sizeof(m_telemetryReport) ? setup->wLength : sizeof(m_telemetryReport);
+  }
+
+  // USBDevice does not support the remote wakeup feature and would stall these requests.
+  if (setup->bmRequestType.Type == STANDARD_TYPE
+      && setup->bmRequestType.Recipient == DEVICE_RECIPIENT
+      && (setup->bRequest == SET_FEATURE || setup->bRequest == CLEAR_FEATURE)
+      && setup->wValue == DEVICE_REMOTE_WAKEUP) {
+    m_remoteWakeup = setup->bRequest == SET_FEATURE;
+    *result = USBDevice::Success;
+    return 0;
+  }
+
+  return USBHID::callback_request(setup, result, data);
 }
 
 const uint8_t *KeyboardHID::report_desc() {
-  static const uint8_t reportDescriptor[] = {
-    USAGE_PAGE(1),
-    0x01,  // Generic Desktop
-    USAGE(1),
-    0x06,  // Keyboard
-    COLLECTION(1),
-    0x01,  // Application
-    REPORT_ID(1),
-    REPORT_ID_KEYBOARD,
-
-    USAGE_PAGE(1),
-    0x07,  // Key Codes
-    USAGE_MINIMUM(1),
-    0xE0,
-    USAGE_MAXIMUM(1),
-    0xE7,
-    LOGICAL_MINIMUM(1),
-    0x00,
-    LOGICAL_MAXIMUM(1),
-    0x01,
-    REPORT_SIZE(1),
-    0x01,
-    REPORT_COUNT(1),
-    0x08,
-    INPUT(1),
-    0x02,  // Data, Variable, Absolute
-    REPORT_COUNT(1),
-    0x01,
-    REPORT_SIZE(1),
-    0x08,
-    INPUT(1),
-    0x01,  // Constant
-
-
-    REPORT_COUNT(1),
-    0x05,
-    REPORT_SIZE(1),
-    0x01,
-    USAGE_PAGE(1),
-    0x08,  // LEDs
-    USAGE_MINIMUM(1),
-    0x01,
-    USAGE_MAXIMUM(1),
-    0x05,
-    OUTPUT(1),
-    0x02,  // Data, Variable, Absolute
-    REPORT_COUNT(1),
-    0x01,
-    REPORT_SIZE(1),
-    0x03,
-    OUTPUT(1),
-    0x01,  // Constant
-
-
-    REPORT_COUNT(1),
-    0x06,
-    REPORT_SIZE(1),
-    0x08,
-    LOGICAL_MINIMUM(1),
-    0x00,
-    LOGICAL_MAXIMUM(1),
-    0x65,
-    USAGE_PAGE(1),
-    0x07,  // Key Codes
-    USAGE_MINIMUM(1),
-    0x00,
-    USAGE_MAXIMUM(1),
-    0x65,
-    INPUT(1),
-    0x00,  // Data, Array
-    END_COLLECTION(0),
-
-    // Media Control
-    USAGE_PAGE(1),
-    0x0C,
-    USAGE(1),
-    0x01,
-    COLLECTION(1),
-    0x01,
-    REPORT_ID(1),
-    REPORT_ID_VOLUME,
-    USAGE_PAGE(1),
-    0x0C,
-    LOGICAL_MINIMUM(1),
-    0x00,
-    LOGICAL_MAXIMUM(1),
-    0x01,
-    REPORT_SIZE(1),
-    0x01,
-    REPORT_COUNT(1),
-    0x07,
-    USAGE(1),
-    0xB5,  // Next Track
-    USAGE(1),
-    0xB6,  // Previous Track
-    USAGE(1),
-    0xB7,  // Stop
-    USAGE(1),
-    0xCD,  // Play / Pause
-    USAGE(1),
-    0xE2,  // Mute
-    USAGE(1),
-    0xE9,  // Volume Up
-    USAGE(1),
-    0xEA,  // Volume Down
-    INPUT(1),
-    0x02,  // Input (Data, Variable, Absolute)
-    REPORT_COUNT(1),
-    0x01,
-    INPUT(1),
-    0x01,
-    END_COLLECTION(0),
-  };
-  reportLength = sizeof(reportDescriptor);
-  return reportDescriptor;
+  reportLength = sizeof(s_reportDescriptor);
+  return s_reportDescriptor;
 }
 
 #define DEFAULT_CONFIGURATION (1)
@@ -221,7 +290,7 @@ const uint8_t *KeyboardHID::configuration_desc(uint8_t index) {
     0x01,                             // bNumInterfaces
     DEFAULT_CONFIGURATION,            // bConfigurationValue
     0x00,                             // iConfiguration
-    C_RESERVED | C_SELF_POWERED,      // bmAttributes
+    C_RESERVED | C_SELF_POWERED | C_REMOTE_WAKEUP,  // bmAttributes
     C_POWER(0),                       // bMaxPower
 
     INTERFACE_DESCRIPTOR_LENGTH,  // bLength
@@ -272,6 +341,10 @@ uint8_t s_modifiers = 0;
 uint8_t s_keys[6] = { 0, 0, 0, 0, 0, 0 };
 int s_nextKey = 0;
 uint8_t s_mediaKeys = 0;
+
+/// Frame number of the last start of frame seen on the bus, and the time it was first seen.
+uint16_t s_lastFrame = 0;
+unsigned long s_lastFrameTime = 0;
 }
 
 void KeyboardOutput::add(Key k) {
@@ -312,9 +385,26 @@ void KeyboardOutput::send() {
   using namespace KeyboardImpl;
   s_keyboard.press(s_keys, s_modifiers, s_mediaKeys);
 
+#if DEBUG_LOG
   debugPrint("\tSending event: ");
-  ON_DEBUG(print());
+  print();
   debugPrintln();
+#endif
+}
+
+void KeyboardOutput::step() {
+  using namespace KeyboardImpl;
+  s_keyboard.pump();
+}
+
+bool KeyboardOutput::sendControl(const uint8_t* data) {
+  using namespace KeyboardImpl;
+  return s_keyboard.sendControl(data);
+}
+
+bool KeyboardOutput::receiveControl(uint8_t* data) {
+  using namespace KeyboardImpl;
+  return s_keyboard.receiveControl(data);
 }
 
 bool KeyboardOutput::isAnyKeyPressed() {
@@ -322,6 +412,39 @@ bool KeyboardOutput::isAnyKeyPressed() {
   return s_modifiers != 0 || s_nextKey != 0;
 }
 
+bool KeyboardOutput::isSuspended(unsigned long now) {
+  using namespace KeyboardImpl;
+
+  // The host sends a start of frame every milli-second while the bus is active, the frame number read back by the controller stops changing when it is suspended.
+  // With SOF_SYNC the start of frame interrupt reads it, reading the register here would acknowledge the interrupt before it runs.
+#if SOF_SYNC
+  uint16_t frame = FrameSync::frameNumber();
+#else
+  uint16_t frame = usb_hw->sof_rd & USB_SOF_RD_BITS;
+#endif
+  if (frame != s_lastFrame) {
+    s_lastFrame = frame;
+    s_lastFrameTime = now;
+  }
+  return now - s_lastFrameTime >= USB_SUSPEND_TIME;
+}
+
+bool KeyboardOutput::wakeUp() {
+  using namespace KeyboardImpl;
+  if (!s_keyboard.isRemoteWakeupEnabled()) return false;
+
+  // The controller drives the resume signaling on the bus, the bit clears itself.
+  usb_hw_set->sie_ctrl = USB_SIE_CTRL_RESUME_BITS;
+  return true;
+}
+
+void KeyboardOutput::getState(uint8_t* data) {
+  using namespace KeyboardImpl;
+  data[0] = s_modifiers;
+  memcpy(data + 1, s_keys, sizeof(s_keys));
+  data[7] = s_mediaKeys;
+}
+
 #if DEBUG_LOG
 void KeyboardOutput::print() {
   using namespace KeyboardImpl;
@@ -2,7 +2,7 @@
 #include "config.h"
 #include "stdint.h"
 
-enum class Key {
+enum class Key : uint8_t {
   NONE = 0,
 
   A = 0x14,
@@ -117,15 +117,21 @@ enum class Key {
   RSHIFT = 0xE5,
   RALT = 0xE6,
   RWIN = 0xE7,
+
+  /// Not a key: used in a layer for the switches that keep the key of the layers below, see Layer.
+  TRANSPARENT = 0xFF,
 };
 
-enum class MediaKey {
+enum class MediaKey : uint8_t {
   NONE = 0,
 
   VOLUME_UP = 0x20,
   VOLUME_DOWN = 0x40,
 };
 
+/// Size of the keyboard state written by KeyboardOutput::getState().
+#define KEYBOARD_STATE_SIZE 8
+
 /// Everything related to write the key presses to the USB bus.
 ///
 /// This is a statefull system. Key presses are retained between calls to send().
@@ -141,11 +147,33 @@ void add(MediaKey k);
 void releaseAll();
 
 /// Send a a USB packet to sent to the computer host what keys are currently being pressed.
+///
+/// This does not wait for the host: the state is queued in a FIFO of REPORT_FIFO_SIZE entries that is drained as the host polls the keyboard.
 void send();
 
+/// Retry sending queued reports if the USB endpoint was not ready. Must be called regularly.
+void step();
+
+/// Queue an answer of the control channel, CONTROL_REPORT_SIZE bytes. Return false if the previous answer was not sent yet.
+bool sendControl(const uint8_t* data);
+
+/// Read a request of the control channel received from the host into 'data', CONTROL_REPORT_SIZE bytes. Return false if there is none.
+bool receiveControl(uint8_t* data);
+
 /// Return true if any key are currently being pressed.
 bool isAnyKeyPressed();
 
+/// Return true if the USB host suspended the bus, e.g. while it sleeps: no start of frame was seen for USB_SUSPEND_TIME.
+///
+/// Queued reports wait for the host to resume the bus.
+bool isSuspended(unsigned long now);
+
+/// Signal the suspended USB host to resume. Return false, doing nothing, if the host did not allow the keyboard to wake it up.
+bool wakeUp();
+
+/// Write in 'data' the keyboard state that send() would send, KEYBOARD_STATE_SIZE bytes: modifiers, the 6 keys, media keys.
+void getState(uint8_t* data);
+
 #if DEBUG_LOG
 /// Print in the debug output the list of keys currently being pressed.
 void print();
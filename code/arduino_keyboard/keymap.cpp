@@ -0,0 +1,104 @@
+#include "keymap.h"
+#include "keyConfig.h"
+#include "storage.h"
+#include <string.h>
+
+namespace KeymapImpl {
+
+/// The compiled-in keymap, built from keyConfig.h.
+KeymapImage s_default;
+
+const KeymapImage* s_active = &s_default;
+
+/// Image committed but not active yet.
+const KeymapImage* volatile s_pending = nullptr;
+
+/// Buffer receiving a new image before it is committed.
+KeymapImage s_staging;
+
+/// Flash records of the two banks.
+static const Storage::Record s_banks[2] = { Storage::RECORD_KEYMAP_0, Storage::RECORD_KEYMAP_1 };
+
+/// Return true if every value of 'tables' that is used as an index or a flag is in range. The layer keys index the counts of LayerTracker and its masks index m_layers, so
+/// a layer above LAYER_ACCENT would read and write out of bounds. The keys themselves are sent to the host as they are.
+bool hasValidIndices(const KeymapTables& tables) {
+  // The flags are read as bytes, a bool holding something else than 0 or 1 is undefined.
+  const uint8_t* immuneToReset = (const uint8_t*)tables.m_immuneToReset;
+  const uint8_t* onRelease = (const uint8_t*)tables.m_onRelease;
+  for (int line = 0; line < NUM_LINES; ++line) {
+    for (int column = 0; column < NUM_COLUMNS; ++column) {
+      int index = line * NUM_COLUMNS + column;
+      if (tables.m_layerKeys[line][column] > LAYER_ACCENT || tables.m_layerActivations[line][column] > LAYER_ONE_SHOT || immuneToReset[index] > 1 || onRelease[index] > 1) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/// Return true if 'image' can be used with this firmware.
+bool isValid(const KeymapImage& image) {
+  const KeymapHeader& header = image.m_header;
+  return header.m_magic == KEYMAP_MAGIC
+         && header.m_version == KEYMAP_VERSION
+         && header.m_lines == NUM_LINES
+         && header.m_columns == NUM_COLUMNS
+         && header.m_size == sizeof(KeymapImage)
+         && header.m_crc == Storage::crc32(&image.m_tables, sizeof(image.m_tables))
+         && hasValidIndices(image.m_tables);
+}
+
+/// The image stored in 'bank', or nullptr if the bank does not hold a valid image.
+const KeymapImage* bankImage(int bank) {
+  const KeymapImage* image = (const KeymapImage*)Storage::map(s_banks[bank], sizeof(KeymapImage));
+  return image != nullptr && isValid(*image) ? image : nullptr;
+}
+}
+
+void Keymap::init() {
+  using namespace KeymapImpl;
+
+  KeymapTables& tables = s_default.m_tables;
+  flatten(s_layers, sizeof(s_layers) / sizeof(Layer), tables);
+  memcpy(tables.m_immuneToReset, immuneToReset, sizeof(tables.m_immuneToReset));
+  memcpy(tables.m_onRelease, onRelease, sizeof(tables.m_onRelease));
+  memcpy(tables.m_layerKeys, s_layerKeys, sizeof(tables.m_layerKeys));
+  memcpy(tables.m_layerActivations, s_layerActivations, sizeof(tables.m_layerActivations));
+  s_default.m_header = KeymapHeader{ KEYMAP_MAGIC, KEYMAP_VERSION, NUM_LINES, NUM_COLUMNS, sizeof(KeymapImage), Storage::crc32(&tables, sizeof(tables)), 0 };
+
+  // Use the most recent image in flash, if any.
+  for (int bank = 0; bank < 2; ++bank) {
+    const KeymapImage* image = bankImage(bank);
+    if (image != nullptr && image->m_header.m_sequence > s_active->m_header.m_sequence) {
+      s_active = image;
+    }
+  }
+}
+
+bool Keymap::write(uint32_t offset, const uint8_t* data, uint32_t length) {
+  using namespace KeymapImpl;
+  if (offset + length > sizeof(s_staging)) return false;
+  memcpy((uint8_t*)&s_staging + offset, data, length);
+  return true;
+}
+
+bool Keymap::commit() {
+  using namespace KeymapImpl;
+
+  if (!isValid(s_staging)) return false;
+
+  // Write the bank that is not active. A pending image not swapped in yet is simply replaced.
+  s_pending = nullptr;
+  int bank = s_active == bankImage(0) ? 1 : 0;
+  s_staging.m_header.m_sequence = s_active->m_header.m_sequence + 1;
+  if (!Storage::write(s_banks[bank], &s_staging, sizeof(s_staging))) return false;
+
+  const KeymapImage* image = bankImage(bank);
+  if (image == nullptr) return false;
+  s_pending = image;
+  return true;
+}
+
+uint32_t Keymap::sequence() {
+  return KeymapImpl::s_active->m_header.m_sequence;
+}
@@ -0,0 +1,196 @@
+#pragma once
+#include "config.h"
+#include "keyboard.h"
+#include <stdint.h>
+
+struct Forced
+{
+  Forced(Key k) : m_key(k) {}
+  Key m_key;
+};
+
+struct K
+{
+  K() : m_key0(Key::NONE), m_key1(Key::NONE), m_mediaKey(MediaKey::NONE), m_forcedKey(Key::NONE) {}
+  K(Key key0) : m_key0(key0), m_key1(Key::NONE), m_mediaKey(MediaKey::NONE), m_forcedKey(Key::NONE) {}
+  K(Key key0, Key key1) : m_key0(key0), m_key1(key1), m_mediaKey(MediaKey::NONE), m_forcedKey(Key::NONE) {}
+  K(Key key0, Forced key1) : m_key0(key0), m_key1(Key::NONE), m_mediaKey(MediaKey::NONE), m_forcedKey(key1.m_key) {}
+  K(MediaKey key) : m_key0(Key::NONE), m_key1(Key::NONE), m_mediaKey(key), m_forcedKey(Key::NONE) {}
+
+  Key m_key0;
+  Key m_key1;
+  MediaKey m_mediaKey;
+  Key m_forcedKey;
+};
+
+enum LayerBit : uint8_t
+{
+  LAYER_NONE = 0,
+  LAYER_SHIFT = 1,
+  LAYER_FUNCTION = 2,
+  LAYER_ACCENT = 3,
+};
+
+/// Bit of 'layer' in a layer mask, see LayerTracker::mask().
+#define LAYER_MASK(layer) (1 << ((layer) - 1))
+
+/// How a layer key selects its layer.
+enum LayerActivation : uint8_t
+{
+  /// The layer is active while the key is held.
+  LAYER_MOMENTARY = 0,
+  /// Each press of the key switches the layer on or off.
+  LAYER_TOGGLE = 1,
+  /// The layer is active while the key is held. If no other key was pressed meanwhile, it stays active after the release until the next key is released.
+  LAYER_ONE_SHOT = 2,
+};
+
+/// A layer of a keymap, as written in keyConfig.h.
+///
+/// Layers are ordered by priority. For each combination of active layers, each switch has the key of the highest layer whose entry is not K(Key::TRANSPARENT).
+struct Layer
+{
+  /// Layers that must all be active for this layer to be used, as a layer mask. 0 for the base layer.
+  uint8_t m_mask;
+
+  /// Key of each switch.
+  const K (*m_keys)[NUM_COLUMNS];
+
+  /// Key held while no other key is pressed, e.g. shift for the shift layer so that the physical shift key works with keys of other layers. Resolved like the keys of the switches.
+  K m_idleKey;
+};
+
+// K is stored as is in keymap images.
+static_assert(sizeof(K) == 4, "K must be 4 bytes");
+static_assert(sizeof(bool) == 1, "bool must be 1 byte");
+
+/// Marker at the start of a keymap image.
+#define KEYMAP_MAGIC 0x50414D4B  // "KMAP"
+
+/// Version of the keymap image format. Must be changed whenever KeymapTables changes.
+#define KEYMAP_VERSION 2
+
+/// Number of layer masks, i.e. of combinations of active layers.
+#define NUM_LAYER_MASKS 8
+
+/// Everything that define what each switch does.
+///
+/// The layers are flattened: there is a table for each combination of active layers, so that finding the key of a switch is a single lookup.
+struct KeymapTables {
+  /// Key mapping for each combination of active layers, indexed by LayerTracker::mask().
+  K m_layers[NUM_LAYER_MASKS][NUM_LINES][NUM_COLUMNS];
+
+  /// Key held while no other key is pressed, for each combination of active layers.
+  K m_idleKeys[NUM_LAYER_MASKS];
+
+  /// Keys that keep being pressed when the layer change.
+  bool m_immuneToReset[NUM_LINES][NUM_COLUMNS];
+
+  /// Keys that output their key when released, if they were not used to select a layer. See arduino_keyboard.ino.
+  bool m_onRelease[NUM_LINES][NUM_COLUMNS];
+
+  /// Layer selected by each key.
+  LayerBit m_layerKeys[NUM_LINES][NUM_COLUMNS];
+
+  /// How each layer key selects its layer.
+  LayerActivation m_layerActivations[NUM_LINES][NUM_COLUMNS];
+};
+
+/// Header of a keymap image.
+struct KeymapHeader {
+  /// Must be KEYMAP_MAGIC.
+  uint32_t m_magic;
+  /// Must be KEYMAP_VERSION.
+  uint16_t m_version;
+  /// Must be NUM_LINES and NUM_COLUMNS.
+  uint8_t m_lines;
+  uint8_t m_columns;
+  /// Size of the whole image, header included.
+  uint32_t m_size;
+  /// CRC-32 of m_tables.
+  uint32_t m_crc;
+  /// Set by the firmware when the image is stored. The bank with the highest sequence is the active one.
+  uint32_t m_sequence;
+};
+
+/// A keymap image, as produced by the keymap compiler in code/tools and stored in flash. The firmware reads it in place.
+struct KeymapImage {
+  KeymapHeader m_header;
+  KeymapTables m_tables;
+};
+
+/// The active keymap.
+///
+/// It is the compiled-in one from keyConfig.h until an image is loaded into flash. Images are stored in two banks: a new image is written in the inactive bank, then swapped in between two scan cycles.
+namespace Keymap {
+
+/// Select the active keymap, the most recent valid image in flash or the compiled-in one. Must be called once after Storage::init().
+void init();
+
+/// The tables of the active keymap.
+inline const KeymapTables& tables();
+
+/// Copy 'length' bytes of a new image at 'offset' in the staging buffer. Return false if it does not fit.
+bool write(uint32_t offset, const uint8_t* data, uint32_t length);
+
+/// Check the image in the staging buffer and store it in the inactive bank. Return false if the image is invalid, including a layer key or a flag out of range, or could not be written.
+///
+/// This erases a flash sector, only call it when the keyboard is idle. The new keymap becomes active on the next call to swap().
+bool commit();
+
+/// Make the last committed image active, if any. Only call it between two scan cycles while no layer is active.
+inline void swap();
+
+/// Sequence number of the active image, 0 for the compiled-in keymap.
+uint32_t sequence();
+
+/// Fill the m_layers and m_idleKeys tables of 'tables' from the 'numLayers' layers in 'layers', ordered by priority.
+///
+/// This is inline so that the keymap compiler of code/tools can use it.
+inline void flatten(const Layer* layers, int numLayers, KeymapTables& tables);
+}
+
+/// Namespace containing all the implementation details of the keymap.
+namespace KeymapImpl {
+extern const KeymapImage* s_active;
+extern const KeymapImage* volatile s_pending;
+}
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline const KeymapTables& Keymap::tables() {
+  return KeymapImpl::s_active->m_tables;
+}
+
+inline void Keymap::swap() {
+  using namespace KeymapImpl;
+  if (s_pending != nullptr) {
+    s_active = s_pending;
+    s_pending = nullptr;
+  }
+}
+
+inline void Keymap::flatten(const Layer* layers, int numLayers, KeymapTables& tables) {
+  for (int mask = 0; mask < NUM_LAYER_MASKS; ++mask) {
+    tables.m_idleKeys[mask] = K();
+    for (int line = 0; line < NUM_LINES; ++line) {
+      for (int column = 0; column < NUM_COLUMNS; ++column) {
+        tables.m_layers[mask][line][column] = K();
+      }
+    }
+
+    // Go from the lowest layer to the highest, each active layer overwrites what is not transparent.
+    for (int i = 0; i < numLayers; ++i) {
+      const Layer& layer = layers[i];
+      if ((layer.m_mask & mask) != layer.m_mask) continue;
+
+      if (layer.m_idleKey.m_key0 != Key::TRANSPARENT) tables.m_idleKeys[mask] = layer.m_idleKey;
+      for (int line = 0; line < NUM_LINES; ++line) {
+        for (int column = 0; column < NUM_COLUMNS; ++column) {
+          const K& key = layer.m_keys[line][column];
+          if (key.m_key0 != Key::TRANSPARENT) tables.m_layers[mask][line][column] = key;
+        }
+      }
+    }
+  }
+}
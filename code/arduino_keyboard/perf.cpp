@@ -0,0 +1,83 @@
+#include "perf.h"
+
+namespace PerfImpl {
+uint32_t s_counters[Perf::NUM_COUNTERS];
+uint32_t s_histograms[Perf::NUM_HISTOGRAMS][PERF_HISTOGRAM_BUCKETS];
+uint32_t s_maximums[Perf::NUM_HISTOGRAMS];
+
+static const char* const s_counterNames[Perf::NUM_COUNTERS] = {
+  "loops",
+  "events_processed",
+  "budget_exhausted",
+  "events_dropped",
+  "reports_sent",
+  "usb_reports",
+  "reports_merged",
+  "reports_dropped",
+  "split_frames",
+  "split_crc_errors",
+  "split_lost_frames",
+  "split_timeouts",
+  "usb_suspends",
+  "remote_wakeups",
+  "loop_stalls",
+  "loop_near_misses",
+  "i2c_errors",
+  "i2c_slowdowns",
+  "i2c_speedups",
+  "i2c_khz",
+  "streak_taps",
+  "streak_misfires",
+  "sof_aligned",
+  "sof_late",
+};
+
+static const char* const s_histogramNames[Perf::NUM_HISTOGRAMS] = {
+  "loop_time_us",
+  "queue_depth",
+  "report_fifo_depth",
+  "key_latency_us",
+  "tap_latency_us",
+  "poll_phase_us",
+  "report_wait_us",
+};
+}
+
+void Perf::reset() {
+  using namespace PerfImpl;
+  for (uint32_t& c : s_counters) c = 0;
+  for (int h = 0; h < NUM_HISTOGRAMS; ++h) {
+    for (uint32_t& b : s_histograms[h]) b = 0;
+    s_maximums[h] = 0;
+  }
+}
+
+const char* Perf::name(Counter c) {
+  return PerfImpl::s_counterNames[c];
+}
+
+const char* Perf::name(Histogram h) {
+  return PerfImpl::s_histogramNames[h];
+}
+
+#if PERF_LOG
+void Perf::print() {
+  using namespace PerfImpl;
+  for (int c = 0; c < NUM_COUNTERS; ++c) {
+    debugPrint(s_counterNames[c]);
+    debugPrint("=");
+    debugPrintln(s_counters[c]);
+  }
+  for (int h = 0; h < NUM_HISTOGRAMS; ++h) {
+    debugPrint(s_histogramNames[h]);
+    debugPrint(" max=");
+    debugPrint(s_maximums[h]);
+    debugPrint(" buckets:");
+    for (uint32_t b : s_histograms[h]) {
+      debugPrint(" ");
+      debugPrint(b);
+    }
+    debugPrintln();
+  }
+}
+#endif
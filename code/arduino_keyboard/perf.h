@@ -0,0 +1,153 @@
+#pragma once
+#include "config.h"
+#include <stdint.h>
+
+/// Always-on performance counters and histograms.
+///
+/// Recording a value is a couple of memory writes, so these are kept enabled in production builds. PERF_LOG only controls whether they are periodically printed on the debug output.
+namespace Perf {
+
+/// Number of buckets in each histogram. Bucket 0 counts values of 0, bucket i counts values in [2^(i-1), 2^i), the last bucket also counts everything above.
+#define PERF_HISTOGRAM_BUCKETS 16
+
+/// Monotonic event counters.
+enum Counter : uint8_t {
+  /// Number of iterations of the main loop.
+  COUNTER_LOOPS,
+  /// Number of events consumed from the event queue (processed or debounced).
+  COUNTER_EVENTS_PROCESSED,
+  /// Number of loop iterations that stopped processing events because the per-iteration budget was exhausted.
+  COUNTER_BUDGET_EXHAUSTED,
+  /// Number of key edges that could not be added because the event queue was full.
+  COUNTER_EVENTS_DROPPED,
+  /// Number of keyboard states built by sendCurrentKeyPress().
+  COUNTER_REPORTS_SENT,
+  /// Number of USB reports received by the host.
+  COUNTER_USB_REPORTS,
+  /// Number of keyboard states merged with the next one because the report FIFO was full.
+  COUNTER_REPORTS_MERGED,
+  /// Number of keyboard states lost because the report FIFO was full, no state could be merged and a newer state replaced the one waiting for room.
+  COUNTER_REPORTS_DROPPED,
+  /// Number of valid frames received from the secondary half of a split keyboard.
+  COUNTER_SPLIT_FRAMES,
+  /// Number of frames from the secondary half dropped because they were corrupted.
+  COUNTER_SPLIT_CRC_ERRORS,
+  /// Number of frames from the secondary half missing from the sequence numbers.
+  COUNTER_SPLIT_LOST_FRAMES,
+  /// Number of times the link with the secondary half went down.
+  COUNTER_SPLIT_TIMEOUTS,
+  /// Number of times the USB host suspended the bus.
+  COUNTER_USB_SUSPENDS,
+  /// Number of times a key press woke the USB host up.
+  COUNTER_REMOTE_WAKEUPS,
+  /// Number of iterations of the main loop that overran their deadline, see Deadline.
+  COUNTER_LOOP_STALLS,
+  /// Number of iterations of the main loop that took more than half of their deadline without overrunning it.
+  COUNTER_LOOP_NEAR_MISSES,
+  /// Number of failed reads of an MCP chip.
+  COUNTER_I2C_ERRORS,
+  /// Number of times the I2C clock stepped down or up, see I2cClock.
+  COUNTER_I2C_SLOWDOWNS,
+  COUNTER_I2C_SPEEDUPS,
+  /// Not a counter: the current I2C clock in kHz, set by I2cClock.
+  COUNTER_I2C_KHZ,
+  /// Number of "on release" keys resolved as a tap at their press because of a typing streak, see TYPING_STREAK_TIME.
+  COUNTER_STREAK_TAPS,
+  /// Number of those keys that were meant to select their layer: held while another key was pressed, or held for more than MAX_HOLD_TIME.
+  COUNTER_STREAK_MISFIRES,
+  /// Number of scans delayed to end just before a poll of the USB host, and number of those that still ended after the poll, see SOF_SYNC.
+  COUNTER_SOF_ALIGNED,
+  COUNTER_SOF_LATE,
+
+  NUM_COUNTERS
+};
+
+/// Value distributions.
+enum Histogram : uint8_t {
+  /// Duration of one iteration of the main loop, in micro-seconds.
+  HISTOGRAM_LOOP_TIME,
+  /// Number of entries in the event queue at the end of a loop iteration.
+  HISTOGRAM_QUEUE_DEPTH,
+  /// Number of states in the report FIFO after a state was queued. The maximum is the high-water mark.
+  HISTOGRAM_REPORT_FIFO_DEPTH,
+  /// Time between a key edge and the keyboard state it produced, in micro-seconds. This includes the debounce time and the time waiting for the end of an "on release" key.
+  HISTOGRAM_KEY_LATENCY,
+  /// Time between the press of an "on release" key and its tap, in micro-seconds. This is where the typing streak saves time.
+  HISTOGRAM_TAP_LATENCY,
+  /// Time between the start of a USB frame and the poll of the host that took a keyboard report, in micro-seconds. See SOF_SYNC.
+  HISTOGRAM_POLL_PHASE,
+  /// Time between a keyboard report handed to the USB endpoint and its poll by the host, in micro-seconds. See SOF_SYNC.
+  HISTOGRAM_REPORT_WAIT,
+
+  NUM_HISTOGRAMS
+};
+
+/// Add 'n' to the counter 'c'.
+inline void count(Counter c, uint32_t n = 1);
+
+/// Set the counter 'c' to 'value', for the counters that are levels rather than counts.
+inline void set(Counter c, uint32_t value);
+
+/// Add 'value' to the histogram 'h'.
+inline void record(Histogram h, uint32_t value);
+
+/// Current value of the counter 'c'.
+inline uint32_t counter(Counter c);
+
+/// Number of values recorded in the bucket 'index' of the histogram 'h'.
+inline uint32_t bucket(Histogram h, int index);
+
+/// Largest value ever recorded in the histogram 'h'.
+inline uint32_t maximum(Histogram h);
+
+/// Clear all counters and histograms.
+void reset();
+
+/// Name of the counter 'c', as shown to the user.
+const char* name(Counter c);
+
+/// Name of the histogram 'h', as shown to the user.
+const char* name(Histogram h);
+
+#if PERF_LOG
+/// Print all counters and histograms in the debug output.
+void print();
+#endif
+}
+
+/// Namespace containing all the implementation details of the performance counters.
+namespace PerfImpl {
+extern uint32_t s_counters[Perf::NUM_COUNTERS];
+extern uint32_t s_histograms[Perf::NUM_HISTOGRAMS][PERF_HISTOGRAM_BUCKETS];
+extern uint32_t s_maximums[Perf::NUM_HISTOGRAMS];
+}
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline void Perf::count(Counter c, uint32_t n) {
+  PerfImpl::s_counters[c] += n;
+}
+
+inline void Perf::set(Counter c, uint32_t value) {
+  PerfImpl::s_counters[c] = value;
+}
+
+inline void Perf::record(Histogram h, uint32_t value) {
+  using namespace PerfImpl;
+  int index = value == 0 ? 0 : 32 - __builtin_clz(value);
+  if (index >= PERF_HISTOGRAM_BUCKETS) index = PERF_HISTOGRAM_BUCKETS - 1;
+  s_histograms[h][index]++;
+  if (value > s_maximums[h]) s_maximums[h] = value;
+}
+
+inline uint32_t Perf::counter(Counter c) {
+  return PerfImpl::s_counters[c];
+}
+
+inline uint32_t Perf::bucket(Histogram h, int index) {
+  return PerfImpl::s_histograms[h][index];
+}
+
+inline uint32_t Perf::maximum(Histogram h) {
+  return PerfImpl::s_maximums[h];
+}
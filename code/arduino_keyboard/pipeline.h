@@ -0,0 +1,55 @@
+#pragma once
+#include "event.h"
+#include <stdint.h>
+
+/// Processing of the event at the front of the queue, as a chain of stages composed at compile time.
+///
+/// A stage is a type with a static function 'Result process(const Event& event, Context& context)'. Chain<Stages...> calls them in order until one does not return RESULT_NEXT, and is itself a stage.
+/// Every call is resolved at compile time and inlined into the loop processing the events, and a stage disabled by StageIf compiles to nothing.
+namespace Pipeline {
+
+/// What a stage did with the event.
+enum Result : uint8_t {
+  /// The event goes on to the next stage. When the last stage returns it, the event is removed from the queue.
+  RESULT_NEXT,
+  /// The stage removed the event from the queue itself, e.g. with its opposite edge.
+  RESULT_DONE,
+  /// The event cannot be processed yet, it stays at the front of the queue until the next iteration of the main loop.
+  RESULT_WAIT,
+};
+
+/// State shared by the stages while processing the queue during one iteration of the main loop.
+struct Context {
+  /// Time of the iteration, in micro-seconds.
+  unsigned long m_current;
+  /// Number of keyboard states that can still be sent during this iteration.
+  int m_reportBudget;
+};
+
+/// The stages 'Stages', called in order.
+template <class... Stages>
+struct Chain;
+
+template <>
+struct Chain<> {
+  static inline Result process(const Event&, Context&) {
+    return RESULT_NEXT;
+  }
+};
+
+template <class Stage, class... Rest>
+struct Chain<Stage, Rest...> {
+  static inline Result process(const Event& event, Context& context) {
+    Result result = Stage::process(event, context);
+    if (result != RESULT_NEXT) return result;
+    return Chain<Rest...>::process(event, context);
+  }
+};
+
+/// The stage 'Stage' if 'Enabled', typically a flag of config.h, otherwise a stage doing nothing.
+template <bool Enabled, class Stage>
+struct StageIf : Stage {};
+
+template <class Stage>
+struct StageIf<false, Stage> : Chain<> {};
+}
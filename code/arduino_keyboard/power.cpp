@@ -0,0 +1,43 @@
+#include "power.h"
+#include "heatmap.h"
+#include "keyboard.h"
+#include "perf.h"
+#include <Arduino.h>
+
+/// Namespace containing all the implementation details of the power management.
+namespace PowerImpl {
+
+/// The USB host suspended the bus.
+bool s_suspended = false;
+
+/// The host was already asked to wake up during the current suspend.
+bool s_wakeUpSent = false;
+}
+
+void Power::step() {
+  using namespace PowerImpl;
+
+  bool suspended = KeyboardOutput::isSuspended(micros());
+  if (suspended != s_suspended) {
+    s_suspended = suspended;
+    s_wakeUpSent = false;
+
+    if (suspended) {
+      Perf::count(Perf::COUNTER_USB_SUSPENDS);
+      // The host may sleep for hours and the power may be cut meanwhile, save the counters now rather than waiting for HEATMAP_SAVE_DELAY.
+      Heatmap::save();
+    }
+    ON_DEBUG_LOG(debugPrintln(suspended ? "USB suspended" : "USB resumed"));
+  }
+
+  // Sleeping lets the core wait for interrupts instead of spinning, the USB interrupts still run.
+  if (s_suspended) delay(SUSPEND_SCAN_PERIOD);
+}
+
+void Power::keyPressed() {
+  using namespace PowerImpl;
+
+  if (!s_suspended || s_wakeUpSent) return;
+  s_wakeUpSent = true;
+  if (KeyboardOutput::wakeUp()) Perf::count(Perf::COUNTER_REMOTE_WAKEUPS);
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "config.h"
+
+/// Low power mode while the USB host suspends the bus, e.g. while it sleeps.
+///
+/// While suspended, the switches are scanned every SUSPEND_SCAN_PERIOD and the micro-controller sleeps in between instead of polling the I2C bus continuously. The I2C bus is idle
+/// between the scans since SCL only toggles during transfers, but the I2C peripheral is not clock gated: it stays clocked from clk_sys like the rest of the chip.
+/// The first key press wakes the host up, if it allowed it. Scanning goes back to full rate at most one period after the host resumes the bus.
+namespace Power {
+
+/// Follow the suspend state of the USB bus, and sleep until the next scan while suspended. Must be called at the start of every iteration of the main loop.
+void step();
+
+/// Record a key press. Wake the host up if it is suspended, once per suspend.
+void keyPressed();
+}
@@ -0,0 +1,157 @@
+#include "recorder.h"
+#include "storage.h"
+#include <Arduino.h>
+
+// The index in the ring is then a mask of the head.
+static_assert((RECORDER_SIZE & (RECORDER_SIZE - 1)) == 0, "RECORDER_SIZE must be a power of two");
+
+namespace RecorderImpl {
+Ring s_ring __attribute__((section(RECORDER_SECTION)));
+
+/// Marker of a valid ring.
+static const uint32_t RING_MAGIC = 0x52435244;  // "RCRD"
+
+/// Entry latched by Recorder::latch(), valid while its marker is LATCH_MAGIC. Like the ring it survives a reset.
+struct Latched {
+  uint32_t m_magic;
+  Recorder::Entry m_entry;
+};
+volatile Latched s_latched __attribute__((section(RECORDER_SECTION)));
+
+/// Marker of a latched entry.
+static const uint32_t LATCH_MAGIC = 0x4C415443;  // "LATC"
+
+/// Number of entries saved in each flash record, so that a record fits in a 4 KiB sector with its headers.
+static const int ENTRIES_PER_RECORD = 500;
+
+/// The flash records holding the saved trace, in order.
+static const Storage::Record s_records[] = { Storage::RECORD_RECORDER_0, Storage::RECORD_RECORDER_1, Storage::RECORD_RECORDER_2, Storage::RECORD_RECORDER_3 };
+
+static const int NUM_RECORDS = sizeof(s_records) / sizeof(s_records[0]);
+
+/// Content of a flash record of the saved trace.
+struct SavedRecord {
+  /// Incremented by each save, so that records of different saves are not mixed up.
+  uint32_t m_sequence;
+  uint32_t m_resets;
+  /// Number of entries of the whole saved trace.
+  uint32_t m_size;
+  Recorder::Entry m_entries[ENTRIES_PER_RECORD];
+};
+
+/// The records of the saved trace in the memory-mapped flash, null past the last valid one.
+const SavedRecord* s_saved[NUM_RECORDS];
+
+/// Number of entries of the saved trace, limited to the records that are valid.
+int s_savedSize = 0;
+
+/// Number of entries of the live trace.
+inline int liveSize() {
+  return s_ring.m_head < RECORDER_SIZE ? s_ring.m_head : RECORDER_SIZE;
+}
+
+/// Map the records of the saved trace, and compute how many of its entries can be read.
+void mapSaved() {
+  int available = 0;
+  for (int i = 0; i < NUM_RECORDS; ++i) {
+    s_saved[i] = nullptr;
+    const SavedRecord* record = (const SavedRecord*)Storage::map(s_records[i], sizeof(SavedRecord));
+    // A save interrupted by a reset leaves the records of the previous save after the last one written.
+    if (record == nullptr || available < i || (i > 0 && record->m_sequence != s_saved[0]->m_sequence)) continue;
+    s_saved[i] = record;
+    available++;
+  }
+
+  s_savedSize = 0;
+  if (available == 0) return;
+  s_savedSize = s_saved[0]->m_size;
+  if (s_savedSize > available * ENTRIES_PER_RECORD) s_savedSize = available * ENTRIES_PER_RECORD;
+}
+
+/// Copy the most recent entries of the ring to flash. This takes several erases, only call it at startup.
+void save() {
+  SavedRecord record;
+  record.m_sequence = s_saved[0] != nullptr ? s_saved[0]->m_sequence + 1 : 1;
+  record.m_resets = s_ring.m_resets;
+  record.m_size = liveSize();
+  if (record.m_size > NUM_RECORDS * ENTRIES_PER_RECORD) record.m_size = NUM_RECORDS * ENTRIES_PER_RECORD;
+
+  uint32_t first = s_ring.m_head - record.m_size;
+  for (int i = 0; i < NUM_RECORDS; ++i) {
+    for (int j = 0; j < ENTRIES_PER_RECORD; ++j) {
+      uint32_t index = i * ENTRIES_PER_RECORD + j;
+      if (index < record.m_size) {
+        record.m_entries[j] = s_ring.m_entries[(first + index) % RECORDER_SIZE];
+      } else {
+        record.m_entries[j] = Recorder::Entry{ 0, Recorder::Type(0), 0, 0 };
+      }
+    }
+    if (!Storage::write(s_records[i], &record, sizeof(record))) break;
+  }
+}
+}
+
+void Recorder::init() {
+  using namespace RecorderImpl;
+
+  mapSaved();
+
+  // After a power on the content of the ring is random, it is only valid after a reset.
+  if (s_ring.m_magic == RING_MAGIC && s_ring.m_check == ~RING_MAGIC) {
+    // The entry latched just before the reset, e.g. the overrun of a stage that never returned, is the last one of the trace.
+    flush();
+
+    // A ring holding only its boot entry has nothing worth replacing the previous save.
+    if (s_ring.m_head > 1) {
+      save();
+      mapSaved();
+    }
+    s_ring.m_resets++;
+  } else {
+    s_ring.m_magic = RING_MAGIC;
+    s_ring.m_check = ~RING_MAGIC;
+    s_ring.m_resets = 0;
+  }
+
+  s_latched.m_magic = 0;
+  reset();
+  record(ENTRY_BOOT, 0, s_ring.m_resets, micros());
+}
+
+void Recorder::latch(Type type, uint8_t key, uint16_t value, unsigned long time) {
+  using namespace RecorderImpl;
+  s_latched.m_magic = 0;
+  s_latched.m_entry.m_time = time;
+  s_latched.m_entry.m_type = type;
+  s_latched.m_entry.m_key = key;
+  s_latched.m_entry.m_value = value;
+  s_latched.m_magic = LATCH_MAGIC;
+}
+
+void Recorder::flush() {
+  using namespace RecorderImpl;
+  if (s_latched.m_magic != LATCH_MAGIC) return;
+  record(s_latched.m_entry.m_type, s_latched.m_entry.m_key, s_latched.m_entry.m_value, s_latched.m_entry.m_time);
+  s_latched.m_magic = 0;
+}
+
+void Recorder::reset() {
+  RecorderImpl::s_ring.m_head = 0;
+}
+
+int Recorder::size(Source source) {
+  using namespace RecorderImpl;
+  return source == SOURCE_SAVED ? s_savedSize : liveSize();
+}
+
+uint32_t Recorder::resets(Source source) {
+  using namespace RecorderImpl;
+  if (source == SOURCE_LIVE) return s_ring.m_resets;
+  return s_saved[0] != nullptr ? s_saved[0]->m_resets : 0;
+}
+
+const Recorder::Entry& Recorder::entry(Source source, int index) {
+  using namespace RecorderImpl;
+  if (source == SOURCE_SAVED) return s_saved[index / ENTRIES_PER_RECORD]->m_entries[index % ENTRIES_PER_RECORD];
+  return s_ring.m_entries[(s_ring.m_head - liveSize() + index) % RECORDER_SIZE];
+}
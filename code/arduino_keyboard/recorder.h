@@ -0,0 +1,110 @@
+#pragma once
+#include "config.h"
+#include "pos.h"
+#include <stdint.h>
+
+/// Post-mortem trace of the last events processed by the keyboard, to diagnose a board that hung or reset in the field.
+///
+/// The entries are written in a ring in a RAM section that is not cleared at startup, so it survives a watchdog or software reset. Recording an entry is a few memory writes, so the recorder is always on.
+/// When init() finds the ring of the previous run, it copies it to flash before starting a new one. Both the saved and the live entries are read by the USB host through CONTROL_READ_RECORDER.
+namespace Recorder {
+
+/// What an entry records. The key of an entry is a key index, line * NUM_COLUMNS + column.
+enum Type : uint8_t {
+  /// The keyboard started. Value: number of resets since the last power on.
+  ENTRY_BOOT = 1,
+  /// A switch changed state and was added to the event queue. Value: 1 if pressed, 0 if released.
+  ENTRY_EDGE = 2,
+  /// A switch changed state but the event queue was full. Value: 1 if pressed, 0 if released.
+  ENTRY_DROPPED = 3,
+  /// Two opposite edges of the key were cancelled by the debouncing. Value: time between them, in micro-seconds.
+  ENTRY_BOUNCE = 4,
+  /// An "on release" key was resolved as a tap. Value: how long it was held in milli-seconds, or 0xFFFF if it was resolved at its press by a typing streak.
+  ENTRY_TAP = 5,
+  /// An "on release" key was resolved as a hold. Value: how long it was held in milli-seconds, or 0xFFFF if another key was pressed while it was held.
+  ENTRY_HOLD = 6,
+  /// The I2C bus was reset. Key: index of the chip in error.
+  ENTRY_I2C_RESET = 7,
+  /// A keyboard state was sent to the USB host. Key: mask of the active layers.
+  ENTRY_REPORT = 8,
+  /// An iteration of the main loop overran its deadline. Key: the Deadline::Stage it was in. Value: index of the chip being read in STAGE_SCAN, 0xFFFF otherwise.
+  ENTRY_STALL = 9,
+};
+
+/// One entry of the trace, 8 bytes.
+struct Entry {
+  /// Time of the entry, in micro-seconds, from micros().
+  uint32_t m_time;
+  Type m_type;
+  uint8_t m_key;
+  uint16_t m_value;
+};
+
+/// Which trace to read.
+enum Source : uint8_t {
+  /// The trace of the run before the last reset, saved in flash.
+  SOURCE_SAVED = 0,
+  /// The trace of the current run.
+  SOURCE_LIVE = 1,
+};
+
+/// Save the trace of the previous run if it survived a reset, with the entry it latched last, then start a new one. Must be called once after Storage::init().
+void init();
+
+/// Forget the entries of the current run, in RAM only.
+void reset();
+
+/// Add an entry of 'type' for the key 'key', see Type.
+inline void record(Type type, uint8_t key, uint16_t value, unsigned long time);
+
+/// Add an entry of 'type' for the key at 'pos'.
+inline void record(Type type, Pos pos, uint16_t value, unsigned long time);
+
+/// Latch an entry from an interrupt, which must not write the trace while the main loop may be writing it. It is added by the next flush(), or by init() if the board resets first.
+/// A second entry latched before flush() replaces the first one.
+void latch(Type type, uint8_t key, uint16_t value, unsigned long time);
+
+/// Add the latched entry to the trace, if any. Must be called from the main loop while no interrupt can latch an entry.
+void flush();
+
+/// Number of entries of the trace 'source'.
+int size(Source source);
+
+/// Number of resets since the last power on when the trace 'source' started.
+uint32_t resets(Source source);
+
+/// The entry 'index' of the trace 'source', from the oldest one. 'index' must be lower than size(source).
+const Entry& entry(Source source, int index);
+}
+
+/// Namespace containing all the implementation details of the recorder.
+namespace RecorderImpl {
+
+/// The ring of the current run, in the section RECORDER_SECTION.
+struct Ring {
+  /// RING_MAGIC and its complement when the ring is valid. Anything else after a power on.
+  uint32_t m_magic;
+  uint32_t m_check;
+  uint32_t m_resets;
+  /// Total number of entries recorded, the next one goes at m_head % RECORDER_SIZE.
+  uint32_t m_head;
+  Recorder::Entry m_entries[RECORDER_SIZE];
+};
+
+extern Ring s_ring;
+}
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline void Recorder::record(Type type, uint8_t key, uint16_t value, unsigned long time) {
+  using namespace RecorderImpl;
+  Entry& entry = s_ring.m_entries[s_ring.m_head++ % RECORDER_SIZE];
+  entry.m_time = time;
+  entry.m_type = type;
+  entry.m_key = key;
+  entry.m_value = value;
+}
+
+inline void Recorder::record(Type type, Pos pos, uint16_t value, unsigned long time) {
+  record(type, uint8_t(pos.m_line * NUM_COLUMNS + pos.m_column), value, time);
+}
@@ -0,0 +1,240 @@
+#include "replay.h"
+
+#if REPLAY_LOG
+// Only the replay on the keyboard types the corpus traces, the other builds do not pay for their flash.
+#include "corpusTraces.h"
+#endif
+
+/// Namespace containing all the implementation details of the trace replay.
+namespace ReplayImpl {
+
+// Positions used below are those of keyConfig.h: letters are on lines 1 to 3, {4, 4} is shift, {4, 5} and {4, 6} are "on release" keys that select the accent and function layers.
+
+static const TraceEdge s_fastRolls[] = {
+  { 0, { 1, 5 }, true }, { 29559, { 2, 3 }, true }, { 53541, { 3, 1 }, true }, { 54747, { 1, 5 }, false },
+  { 67441, { 1, 2 }, true }, { 85727, { 2, 3 }, false }, { 141734, { 3, 1 }, false }, { 150696, { 1, 2 }, false },
+  { 236476, { 1, 3 }, true }, { 262386, { 2, 4 }, true }, { 278442, { 1, 8 }, true }, { 292420, { 1, 3 }, false },
+  { 316259, { 2, 4 }, false }, { 343072, { 1, 8 }, false }, { 442469, { 2, 9 }, true }, { 463958, { 2, 3 }, true },
+  { 480684, { 1, 2 }, true }, { 496543, { 1, 8 }, true }, { 501196, { 2, 9 }, false }, { 518651, { 2, 8 }, true },
+  { 541426, { 2, 3 }, false }, { 566118, { 1, 2 }, false }, { 583958, { 1, 8 }, false }, { 605368, { 2, 8 }, false },
+  { 686573, { 2, 9 }, true }, { 701765, { 3, 1 }, true }, { 715822, { 1, 7 }, true }, { 760978, { 2, 9 }, false },
+  { 787661, { 3, 1 }, false }, { 802808, { 1, 7 }, false }, { 879775, { 1, 7 }, true }, { 907031, { 2, 6 }, true },
+  { 933880, { 3, 2 }, true }, { 950362, { 1, 7 }, false }, { 955702, { 2, 8 }, true }, { 973592, { 2, 4 }, true },
+  { 995406, { 2, 6 }, false }, { 1007576, { 3, 2 }, false }, { 1021982, { 2, 8 }, false }, { 1039589, { 2, 4 }, false },
+  { 1138274, { 1, 10 }, true }, { 1159709, { 2, 7 }, true }, { 1174107, { 2, 6 }, true }, { 1202882, { 3, 9 }, true },
+  { 1217688, { 1, 10 }, false }, { 1220287, { 2, 1 }, true }, { 1231844, { 2, 6 }, false }, { 1249617, { 2, 7 }, false },
+  { 1280284, { 3, 9 }, false }, { 1292703, { 2, 1 }, false }, { 1387267, { 2, 4 }, true }, { 1409547, { 1, 2 }, true },
+  { 1433021, { 3, 2 }, true }, { 1461296, { 1, 3 }, true }, { 1473841, { 2, 4 }, false }, { 1481837, { 1, 2 }, false },
+  { 1521973, { 3, 2 }, false }, { 1549300, { 1, 3 }, false }, { 1638244, { 3, 7 }, true }, { 1652373, { 1, 3 }, true },
+  { 1674518, { 1, 9 }, true }, { 1706349, { 1, 3 }, false }, { 1719314, { 3, 7 }, false }, { 1762394, { 1, 9 }, false },
+};
+
+static const TraceEdge s_bouncySwitches[] = {
+  { 0, { 1, 10 }, true }, { 3933, { 1, 10 }, false }, { 6971, { 1, 10 }, true }, { 8692, { 1, 10 }, false },
+  { 9084, { 1, 10 }, true }, { 116964, { 1, 10 }, false }, { 118719, { 1, 10 }, true }, { 119707, { 1, 10 }, false },
+  { 122509, { 1, 10 }, true }, { 123288, { 1, 10 }, false }, { 180000, { 2, 6 }, true }, { 183446, { 2, 6 }, false },
+  { 184923, { 2, 6 }, true }, { 253863, { 2, 6 }, false }, { 257187, { 2, 6 }, true }, { 258501, { 2, 6 }, false },
+  { 360000, { 2, 3 }, true }, { 360630, { 2, 3 }, false }, { 361611, { 2, 3 }, true }, { 363750, { 2, 3 }, false },
+  { 365695, { 2, 3 }, true }, { 455621, { 2, 3 }, false }, { 457059, { 2, 3 }, true }, { 460977, { 2, 3 }, false },
+  { 461837, { 2, 3 }, true }, { 465492, { 2, 3 }, false }, { 467555, { 2, 3 }, true }, { 471393, { 2, 3 }, false },
+  { 540000, { 2, 8 }, true }, { 542001, { 2, 8 }, false }, { 543770, { 2, 8 }, true }, { 546866, { 2, 8 }, false },
+  { 550787, { 2, 8 }, true }, { 552645, { 2, 8 }, false }, { 553890, { 2, 8 }, true }, { 628246, { 2, 8 }, false },
+  { 628885, { 2, 8 }, true }, { 629906, { 2, 8 }, false }, { 720000, { 1, 5 }, true }, { 721255, { 1, 5 }, false },
+  { 721604, { 1, 5 }, true }, { 723890, { 1, 5 }, false }, { 727594, { 1, 5 }, true }, { 730307, { 1, 5 }, false },
+  { 731353, { 1, 5 }, true }, { 805201, { 1, 5 }, false }, { 806655, { 1, 5 }, true }, { 806971, { 1, 5 }, false },
+  { 807867, { 1, 5 }, true }, { 809883, { 1, 5 }, false }, { 900000, { 2, 8 }, true }, { 902619, { 2, 8 }, false },
+  { 904224, { 2, 8 }, true }, { 905038, { 2, 8 }, false }, { 908166, { 2, 8 }, true }, { 911985, { 2, 8 }, false },
+  { 914396, { 2, 8 }, true }, { 994199, { 2, 8 }, false }, { 997181, { 2, 8 }, true }, { 1000250, { 2, 8 }, false },
+  { 1003580, { 2, 8 }, true }, { 1004101, { 2, 8 }, false }, { 1006271, { 2, 8 }, true }, { 1010255, { 2, 8 }, false },
+  { 1080000, { 3, 8 }, true }, { 1081907, { 3, 8 }, false }, { 1083837, { 3, 8 }, true }, { 1085771, { 3, 8 }, false },
+  { 1087685, { 3, 8 }, true }, { 1088409, { 3, 8 }, false }, { 1090681, { 3, 8 }, true }, { 1194602, { 3, 8 }, false },
+  { 1196542, { 3, 8 }, true }, { 1197096, { 3, 8 }, false }, { 1198176, { 3, 8 }, true }, { 1198751, { 3, 8 }, false },
+  { 1199906, { 3, 8 }, true }, { 1202010, { 3, 8 }, false }, { 1260000, { 1, 6 }, true }, { 1262760, { 1, 6 }, false },
+  { 1263275, { 1, 6 }, true }, { 1263994, { 1, 6 }, false }, { 1264294, { 1, 6 }, true }, { 1337204, { 1, 6 }, false },
+  { 1338123, { 1, 6 }, true }, { 1340620, { 1, 6 }, false }, { 1341335, { 1, 6 }, true }, { 1343124, { 1, 6 }, false },
+  { 1345937, { 1, 6 }, true }, { 1346341, { 1, 6 }, false }, { 1440000, { 1, 3 }, true }, { 1441841, { 1, 3 }, false },
+  { 1442749, { 1, 3 }, true }, { 1445647, { 1, 3 }, false }, { 1446980, { 1, 3 }, true }, { 1448702, { 1, 3 }, false },
+  { 1451468, { 1, 3 }, true }, { 1523628, { 1, 3 }, false }, { 1525870, { 1, 3 }, true }, { 1526673, { 1, 3 }, false },
+  { 1527445, { 1, 3 }, true }, { 1531222, { 1, 3 }, false }, { 1620000, { 2, 6 }, true }, { 1622281, { 2, 6 }, false },
+  { 1623858, { 2, 6 }, true }, { 1624509, { 2, 6 }, false }, { 1625399, { 2, 6 }, true }, { 1720539, { 2, 6 }, false },
+  { 1723909, { 2, 6 }, true }, { 1725612, { 2, 6 }, false }, { 1800000, { 3, 4 }, true }, { 1803694, { 3, 4 }, false },
+  { 1806828, { 3, 4 }, true }, { 1807789, { 3, 4 }, false }, { 1810203, { 3, 4 }, true }, { 1887351, { 3, 4 }, false },
+  { 1888491, { 3, 4 }, true }, { 1890954, { 3, 4 }, false }, { 1980000, { 2, 2 }, true }, { 1982524, { 2, 2 }, false },
+  { 1982934, { 2, 2 }, true }, { 1986339, { 2, 2 }, false }, { 1988802, { 2, 2 }, true }, { 1990322, { 2, 2 }, false },
+  { 1993255, { 2, 2 }, true }, { 2059607, { 2, 2 }, false }, { 2062758, { 2, 2 }, true }, { 2066520, { 2, 2 }, false },
+  { 2160000, { 1, 9 }, true }, { 2160984, { 1, 9 }, false }, { 2162740, { 1, 9 }, true }, { 2166201, { 1, 9 }, false },
+  { 2167413, { 1, 9 }, true }, { 2263973, { 1, 9 }, false }, { 2266491, { 1, 9 }, true }, { 2269982, { 1, 9 }, false },
+  { 2272341, { 1, 9 }, true }, { 2273991, { 1, 9 }, false }, { 2276897, { 1, 9 }, true }, { 2278110, { 1, 9 }, false },
+  { 2340000, { 2, 10 }, true }, { 2343601, { 2, 10 }, false }, { 2344881, { 2, 10 }, true }, { 2459697, { 2, 10 }, false },
+  { 2463027, { 2, 10 }, true }, { 2466617, { 2, 10 }, false }, { 2467845, { 2, 10 }, true }, { 2468963, { 2, 10 }, false },
+  { 2520000, { 2, 7 }, true }, { 2523294, { 2, 7 }, false }, { 2523712, { 2, 7 }, true }, { 2524126, { 2, 7 }, false },
+  { 2527662, { 2, 7 }, true }, { 2622294, { 2, 7 }, false }, { 2624528, { 2, 7 }, true }, { 2625889, { 2, 7 }, false },
+  { 2626982, { 2, 7 }, true }, { 2630118, { 2, 7 }, false }, { 2700000, { 2, 10 }, true }, { 2703611, { 2, 10 }, false },
+  { 2706872, { 2, 10 }, true }, { 2708603, { 2, 10 }, false }, { 2710396, { 2, 10 }, true }, { 2792562, { 2, 10 }, false },
+  { 2793765, { 2, 10 }, true }, { 2794483, { 2, 10 }, false },
+};
+
+static const TraceEdge s_tapHold[] = {
+  { 0, { 1, 8 }, true }, { 31696, { 2, 6 }, true }, { 76693, { 1, 7 }, true }, { 82133, { 1, 8 }, false },
+  { 117404, { 4, 6 }, true }, { 123327, { 2, 6 }, false }, { 136818, { 1, 7 }, false }, { 261700, { 4, 6 }, false },
+  { 361700, { 1, 3 }, true }, { 399431, { 3, 7 }, true }, { 429558, { 1, 3 }, false }, { 430962, { 3, 2 }, true },
+  { 461811, { 4, 6 }, true }, { 506059, { 3, 7 }, false }, { 522290, { 3, 2 }, false }, { 605152, { 4, 6 }, false },
+  { 705152, { 2, 1 }, true }, { 743122, { 1, 3 }, true }, { 781274, { 3, 6 }, true }, { 809056, { 4, 5 }, true },
+  { 812457, { 2, 1 }, false }, { 833475, { 1, 3 }, false }, { 869056, { 1, 6 }, true }, { 889990, { 3, 6 }, false },
+  { 899008, { 1, 5 }, true }, { 930861, { 1, 6 }, false }, { 997727, { 1, 5 }, false }, { 1059256, { 4, 5 }, false },
+  { 1159256, { 3, 6 }, true }, { 1203781, { 3, 1 }, true }, { 1240263, { 1, 5 }, true }, { 1259336, { 3, 6 }, false },
+  { 1283241, { 4, 5 }, true }, { 1294868, { 3, 1 }, false }, { 1310480, { 1, 5 }, false }, { 1346045, { 4, 5 }, false },
+  { 1446045, { 1, 1 }, true }, { 1474412, { 3, 6 }, true }, { 1503974, { 3, 4 }, true }, { 1535357, { 4, 5 }, true },
+  { 1548622, { 1, 1 }, false }, { 1568922, { 3, 6 }, false }, { 1592404, { 3, 4 }, false }, { 1599026, { 4, 5 }, false },
+  { 1699026, { 1, 9 }, true }, { 1731907, { 1, 7 }, true }, { 1767589, { 1, 10 }, true }, { 1791870, { 1, 9 }, false },
+  { 1810426, { 4, 6 }, true }, { 1830339, { 1, 7 }, false }, { 1844586, { 1, 10 }, false }, { 1870426, { 3, 7 }, true },
+  { 1907018, { 1, 5 }, true }, { 1934417, { 3, 7 }, false }, { 1997044, { 1, 5 }, false }, { 2071133, { 4, 6 }, false },
+  { 2171133, { 3, 7 }, true }, { 2212571, { 3, 9 }, true }, { 2254997, { 2, 7 }, true }, { 2258699, { 3, 7 }, false },
+  { 2281140, { 3, 9 }, false }, { 2297151, { 4, 5 }, true }, { 2324947, { 2, 7 }, false }, { 2414839, { 4, 5 }, false },
+  { 2514839, { 3, 5 }, true }, { 2544747, { 1, 6 }, true }, { 2574385, { 2, 10 }, true }, { 2575096, { 3, 5 }, false },
+  { 2603328, { 4, 5 }, true }, { 2616041, { 1, 6 }, false }, { 2665415, { 2, 10 }, false }, { 2706055, { 4, 5 }, false },
+  { 2806055, { 3, 2 }, true }, { 2834531, { 2, 7 }, true }, { 2861392, { 2, 8 }, true }, { 2892660, { 4, 6 }, true },
+  { 2897675, { 3, 2 }, false }, { 2931250, { 2, 7 }, false }, { 2937677, { 2, 8 }, false }, { 2952660, { 1, 2 }, true },
+  { 2994296, { 3, 5 }, true }, { 3019065, { 1, 2 }, false }, { 3083929, { 3, 5 }, false }, { 3157702, { 4, 6 }, false },
+  { 3257702, { 1, 1 }, true }, { 3297226, { 3, 5 }, true }, { 3321854, { 1, 1 }, false }, { 3338791, { 3, 9 }, true },
+  { 3378565, { 3, 5 }, false }, { 3380573, { 4, 5 }, true }, { 3438514, { 3, 9 }, false }, { 3476904, { 4, 5 }, false },
+};
+
+static const TraceEdge s_layerChurn[] = {
+  { 0, { 4, 4 }, true }, { 34822, { 2, 8 }, true }, { 62937, { 3, 6 }, true }, { 91460, { 2, 8 }, false },
+  { 100081, { 2, 6 }, true }, { 125848, { 3, 6 }, false }, { 168803, { 2, 6 }, false }, { 175255, { 4, 4 }, false },
+  { 228531, { 4, 6 }, true }, { 263195, { 2, 4 }, true }, { 307180, { 2, 4 }, false }, { 335025, { 4, 6 }, false },
+  { 395733, { 4, 4 }, true }, { 418110, { 1, 8 }, true }, { 448031, { 2, 4 }, true }, { 465079, { 1, 8 }, false },
+  { 472040, { 1, 3 }, true }, { 513719, { 2, 4 }, false }, { 531098, { 4, 4 }, false }, { 541433, { 1, 3 }, false },
+  { 580468, { 4, 6 }, true }, { 608761, { 2, 5 }, true }, { 655956, { 2, 5 }, false }, { 667945, { 4, 6 }, false },
+  { 739878, { 4, 4 }, true }, { 765212, { 3, 7 }, true }, { 799352, { 1, 8 }, true }, { 828356, { 3, 7 }, false },
+  { 832584, { 1, 6 }, true }, { 856247, { 1, 8 }, false }, { 883696, { 1, 6 }, false }, { 889216, { 4, 4 }, false },
+  { 952587, { 4, 6 }, true }, { 983024, { 3, 4 }, true }, { 1035015, { 3, 4 }, false }, { 1035811, { 4, 6 }, false },
+  { 1112121, { 4, 4 }, true }, { 1147150, { 3, 3 }, true }, { 1178012, { 1, 1 }, true }, { 1199744, { 3, 3 }, false },
+  { 1234967, { 1, 1 }, false }, { 1251264, { 4, 4 }, false }, { 1295477, { 4, 6 }, true }, { 1319174, { 3, 9 }, true },
+  { 1362607, { 3, 9 }, false }, { 1369332, { 4, 6 }, false }, { 1427152, { 4, 4 }, true }, { 1448449, { 1, 9 }, true },
+  { 1510366, { 4, 4 }, false }, { 1513214, { 1, 9 }, false }, { 1594666, { 4, 6 }, true }, { 1623140, { 1, 5 }, true },
+  { 1661837, { 2, 8 }, true }, { 1680008, { 1, 5 }, false }, { 1708415, { 4, 6 }, false }, { 1718044, { 2, 8 }, false },
+  { 1766703, { 4, 4 }, true }, { 1788588, { 1, 6 }, true }, { 1817400, { 2, 4 }, true }, { 1830960, { 1, 6 }, false },
+  { 1840302, { 3, 9 }, true }, { 1857951, { 2, 4 }, false }, { 1884327, { 4, 4 }, false }, { 1906569, { 3, 9 }, false },
+  { 1964184, { 4, 6 }, true }, { 1991471, { 1, 9 }, true }, { 2055196, { 4, 6 }, false }, { 2059742, { 1, 9 }, false },
+};
+
+/// Digests of the reference traces, produced by the event processing of arduino_keyboard.ino when the replay was introduced. Only update them for changes that are meant to change what is typed.
+/// They depend on TYPING_STREAK_TIME, which changes what is typed, and only exist for the values below. The replay on the keyboard does not build with another value.
+#if TYPING_STREAK_TIME == 150000
+// The space and enter keys of tap_hold and layer_churn are tapped at their press, and select their layer at the next press while held.
+static const uint32_t s_referenceDigests[Replay::NUM_TRACES] = {
+  0xE1968370,
+  0xBEB75888,
+  0x8D064661,
+  0x66C1C6AA,
+};
+
+/// Digest of the random traces, see s_referenceDigests.
+static const uint32_t FUZZ_DIGEST = 0x6F82D552;
+#elif TYPING_STREAK_TIME == 0 || !REPLAY_LOG
+static const uint32_t s_referenceDigests[Replay::NUM_TRACES] = {
+  0xE1968370,
+  0xBEB75888,
+  0x8307CB2C,
+  0x4948C2A3,
+};
+
+/// Digest of the random traces, see s_referenceDigests.
+static const uint32_t FUZZ_DIGEST = 0x8D447A27;
+#else
+#error "no digests for this TYPING_STREAK_TIME, record them with code/tools/replay_bench.cpp built with it"
+#endif
+
+/// Advance the xorshift32 random generator 'state' and return its new value.
+uint32_t next(uint32_t& state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+/// Position of a key set in 'pressed'. There must be one.
+Pos anyPressed(const bool (&pressed)[NUM_LINES][NUM_COLUMNS]) {
+  for (int8_t line = 0; line < NUM_LINES; ++line) {
+    for (int8_t column = 0; column < NUM_COLUMNS; ++column) {
+      if (pressed[line][column]) return Pos{ line, column };
+    }
+  }
+  return Pos{ -1, -1 };
+}
+
+static const Trace s_traces[Replay::NUM_TRACES] = {
+  { "fast_rolls", s_fastRolls, sizeof(s_fastRolls) / sizeof(TraceEdge) },
+  { "bouncy_switches", s_bouncySwitches, sizeof(s_bouncySwitches) / sizeof(TraceEdge) },
+  { "tap_hold", s_tapHold, sizeof(s_tapHold) / sizeof(TraceEdge) },
+  { "layer_churn", s_layerChurn, sizeof(s_layerChurn) / sizeof(TraceEdge) },
+};
+}
+
+const Trace& Replay::trace(TraceId id) {
+  return ReplayImpl::s_traces[id];
+}
+
+uint16_t Replay::generate(uint32_t seed, TraceEdge* edges, uint16_t maxEdges) {
+  using namespace ReplayImpl;
+
+  // xorshift32 must not be seeded with 0.
+  uint32_t random = seed * 2654435761u + 1;
+
+  bool pressed[NUM_LINES][NUM_COLUMNS] = {};
+  int numPressed = 0;
+  uint16_t count = 0;
+  uint32_t time = 0;
+
+  // Keep room to release every key at the end.
+  while (count + numPressed + 8 <= maxEdges) {
+    time += 5000 + next(random) % 120000;
+
+    // Toggle a random key, or release one when many keys are held.
+    Pos pos{ int8_t(1 + next(random) % (NUM_LINES - 1)), int8_t(next(random) % NUM_COLUMNS) };
+    if (numPressed >= 4) pos = anyPressed(pressed);
+    bool& keyPressed = pressed[pos.m_line][pos.m_column];
+    keyPressed = !keyPressed;
+    numPressed += keyPressed ? 1 : -1;
+    edges[count++] = TraceEdge{ time, pos, keyPressed };
+
+    // Bounce on one edge out of four, always ending in the new state.
+    if (next(random) % 4 == 0) {
+      for (uint32_t bounces = 1 + next(random) % 3; bounces > 0; --bounces) {
+        time += 200 + next(random) % 4000;
+        edges[count++] = TraceEdge{ time, pos, !keyPressed };
+        time += 200 + next(random) % 4000;
+        edges[count++] = TraceEdge{ time, pos, keyPressed };
+      }
+    }
+  }
+
+  while (numPressed > 0) {
+    Pos pos = anyPressed(pressed);
+    pressed[pos.m_line][pos.m_column] = false;
+    numPressed--;
+    time += 5000 + next(random) % 120000;
+    edges[count++] = TraceEdge{ time, pos, false };
+  }
+  return count;
+}
+
+uint32_t Replay::referenceDigest(TraceId id) {
+  return ReplayImpl::s_referenceDigests[id];
+}
+
+#if REPLAY_LOG
+int Replay::numCorpusTraces() {
+  return sizeof(ReplayImpl::s_corpusTraces) / sizeof(CorpusTrace);
+}
+
+const CorpusTrace& Replay::corpusTrace(int index) {
+  return ReplayImpl::s_corpusTraces[index];
+}
+#endif
+
+uint32_t Replay::fuzzDigest() {
+  return ReplayImpl::FUZZ_DIGEST;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "config.h"
+#include "pos.h"
+#include <stdint.h>
+
+/// A switch edge recorded in a trace.
+struct TraceEdge {
+  /// Time of the edge in micro-seconds, from the start of the trace.
+  uint32_t m_time;
+
+  /// Position of the key that was pressed or released.
+  Pos m_pos;
+
+  /// True if the key was pressed, false if it was released.
+  bool m_isPressed;
+};
+
+/// A sequence of switch edges, sorted by time.
+struct Trace {
+  /// Name of the trace, as shown in the benchmark results.
+  const char* m_name;
+
+  const TraceEdge* m_edges;
+  uint16_t m_numEdges;
+};
+
+/// A trace typing a text, made by code/tools/corpus_trace.cpp.
+struct CorpusTrace {
+  Trace m_trace;
+
+  /// Typing speed of the trace, in words per minute.
+  uint16_t m_wpm;
+
+  /// What each character of the text should type, in order: the modifiers in the high byte, the key code in the low byte.
+  const uint16_t* m_typed;
+  uint16_t m_numTyped;
+};
+
+/// Reference traces used to benchmark and check the event processing, see REPLAY_LOG.
+///
+/// The traces are replayed through the same code as the live keyboard under a virtual clock, so that changes to the event processing can be compared on the same input.
+/// On Linux, code/tests/replay_diff.cpp replays them through the host build of the sketch, and checks that it types the same as a frozen copy of the first version of loop().
+/// code/tools/replay_bench.cpp benchmarks them there, as well as traces loaded from files.
+///
+/// The keyboard states built while replaying are summarized in a digest: a CRC-32 of the sequence of distinct states, regardless of when they were built. Changes to the event processing must keep the digests of the current algorithm, given by referenceDigest() and fuzzDigest(), unless they are meant to change what is typed. Changes of timing only, like a shorter wait before processing an event, are allowed.
+namespace Replay {
+
+/// The reference traces.
+enum TraceId : uint8_t {
+  /// Fast typing where each key is pressed before the previous one is released.
+  TRACE_FAST_ROLLS,
+  /// Presses and releases followed by chatter of the switch, up to a few milli-seconds.
+  TRACE_BOUNCY_SWITCHES,
+  /// Typing with "on release" keys, either tapped or held to select their layer.
+  TRACE_TAP_HOLD,
+  /// Layer keys pressed and released around short bursts of keys.
+  TRACE_LAYER_CHURN,
+
+  NUM_TRACES
+};
+
+/// The reference trace 'id'.
+const Trace& trace(TraceId id);
+
+/// Write in 'edges' a random trace of at most 'maxEdges' edges, derived from 'seed', and return the number of edges.
+///
+/// The trace is random typing on every key, including layer and "on release" keys, with bounces injected on some of the edges. Every key is released at the end.
+uint16_t generate(uint32_t seed, TraceEdge* edges, uint16_t maxEdges);
+
+/// Digest of the reference trace 'id' replayed REPLAY_REPEAT times.
+uint32_t referenceDigest(TraceId id);
+
+#if REPLAY_LOG
+/// Number of traces in corpusTraces.h, one for each typing speed.
+int numCorpusTraces();
+
+/// The trace 'index' of corpusTraces.h.
+///
+/// These traces have no digest: they find the typing speed at which keys are lost or added, by comparing what is typed with what the text should type. On Linux, the
+/// trace files written by code/tools/corpus_trace.cpp with --trace-dir are checked the same way by code/tools/replay_bench.cpp.
+const CorpusTrace& corpusTrace(int index);
+#endif
+
+/// Digest of the REPLAY_FUZZ_TRACES traces made by generate() with the seeds 1 to REPLAY_FUZZ_TRACES, replayed one after the other.
+uint32_t fuzzDigest();
+}
@@ -0,0 +1,184 @@
+#pragma once
+#include "controlProtocol.h"
+#include <stdint.h>
+
+// HID report descriptor of the keyboard, shared by the firmware and by the host tools that emulate the keyboard, see tools/uhid_latency.cpp.
+
+#define REPORT_ID_KEYBOARD 1
+#define REPORT_ID_VOLUME 3
+#define REPORT_ID_TELEMETRY TELEMETRY_REPORT_ID
+#define REPORT_ID_CONTROL CONTROL_REPORT_ID
+
+// The item macros of USBHID_Types.h, for the host tools that are built without mbed.
+#ifndef USAGE_PAGE
+#define INPUT(size) (0x80 | size)
+#define OUTPUT(size) (0x90 | size)
+#define FEATURE(size) (0xb0 | size)
+#define COLLECTION(size) (0xa0 | size)
+#define END_COLLECTION(size) (0xc0 | size)
+#define USAGE_PAGE(size) (0x04 | size)
+#define LOGICAL_MINIMUM(size) (0x14 | size)
+#define LOGICAL_MAXIMUM(size) (0x24 | size)
+#define REPORT_SIZE(size) (0x74 | size)
+#define REPORT_ID(size) (0x84 | size)
+#define REPORT_COUNT(size) (0x94 | size)
+#define USAGE(size) (0x08 | size)
+#define USAGE_MINIMUM(size) (0x18 | size)
+#define USAGE_MAXIMUM(size) (0x28 | size)
+#endif
+
+/// The keyboard report is: modifiers (1 byte), reserved (1 byte), 6 keys. The media report is one bit per usage of the media control collection.
+static const uint8_t s_reportDescriptor[] = {
+  USAGE_PAGE(1),
+  0x01,  // Generic Desktop
+  USAGE(1),
+  0x06,  // Keyboard
+  COLLECTION(1),
+  0x01,  // Application
+  REPORT_ID(1),
+  REPORT_ID_KEYBOARD,
+
+  USAGE_PAGE(1),
+  0x07,  // Key Codes
+  USAGE_MINIMUM(1),
+  0xE0,
+  USAGE_MAXIMUM(1),
+  0xE7,
+  LOGICAL_MINIMUM(1),
+  0x00,
+  LOGICAL_MAXIMUM(1),
+  0x01,
+  REPORT_SIZE(1),
+  0x01,
+  REPORT_COUNT(1),
+  0x08,
+  INPUT(1),
+  0x02,  // Data, Variable, Absolute
+  REPORT_COUNT(1),
+  0x01,
+  REPORT_SIZE(1),
+  0x08,
+  INPUT(1),
+  0x01,  // Constant
+
+
+  REPORT_COUNT(1),
+  0x05,
+  REPORT_SIZE(1),
+  0x01,
+  USAGE_PAGE(1),
+  0x08,  // LEDs
+  USAGE_MINIMUM(1),
+  0x01,
+  USAGE_MAXIMUM(1),
+  0x05,
+  OUTPUT(1),
+  0x02,  // Data, Variable, Absolute
+  REPORT_COUNT(1),
+  0x01,
+  REPORT_SIZE(1),
+  0x03,
+  OUTPUT(1),
+  0x01,  // Constant
+
+
+  REPORT_COUNT(1),
+  0x06,
+  REPORT_SIZE(1),
+  0x08,
+  LOGICAL_MINIMUM(1),
+  0x00,
+  LOGICAL_MAXIMUM(1),
+  0x65,
+  USAGE_PAGE(1),
+  0x07,  // Key Codes
+  USAGE_MINIMUM(1),
+  0x00,
+  USAGE_MAXIMUM(1),
+  0x65,
+  INPUT(1),
+  0x00,  // Data, Array
+  END_COLLECTION(0),
+
+  // Media Control
+  USAGE_PAGE(1),
+  0x0C,
+  USAGE(1),
+  0x01,
+  COLLECTION(1),
+  0x01,
+  REPORT_ID(1),
+  REPORT_ID_VOLUME,
+  USAGE_PAGE(1),
+  0x0C,
+  LOGICAL_MINIMUM(1),
+  0x00,
+  LOGICAL_MAXIMUM(1),
+  0x01,
+  REPORT_SIZE(1),
+  0x01,
+  REPORT_COUNT(1),
+  0x07,
+  USAGE(1),
+  0xB5,  // Next Track
+  USAGE(1),
+  0xB6,  // Previous Track
+  USAGE(1),
+  0xB7,  // Stop
+  USAGE(1),
+  0xCD,  // Play / Pause
+  USAGE(1),
+  0xE2,  // Mute
+  USAGE(1),
+  0xE9,  // Volume Up
+  USAGE(1),
+  0xEA,  // Volume Down
+  INPUT(1),
+  0x02,  // Input (Data, Variable, Absolute)
+  REPORT_COUNT(1),
+  0x01,
+  INPUT(1),
+  0x01,
+  END_COLLECTION(0),
+
+  // Per-key telemetry
+  USAGE_PAGE(2),
+  0x00,
+  0xFF,  // Vendor defined
+  USAGE(1),
+  0x01,
+  COLLECTION(1),
+  0x01,  // Application
+  REPORT_ID(1),
+  REPORT_ID_TELEMETRY,
+  LOGICAL_MINIMUM(1),
+  0x00,
+  LOGICAL_MAXIMUM(2),
+  0xFF,
+  0x00,
+  REPORT_SIZE(1),
+  0x08,
+  REPORT_COUNT(1),
+  TELEMETRY_PAGE_SIZE,
+  USAGE(1),
+  0x02,
+  FEATURE(1),
+  0x02,  // Data, Variable, Absolute
+
+  // Control channel, see controlProtocol.h
+  REPORT_ID(1),
+  REPORT_ID_CONTROL,
+  REPORT_COUNT(1),
+  CONTROL_REPORT_SIZE,
+  USAGE(1),
+  0x03,
+  INPUT(1),
+  0x02,  // Data, Variable, Absolute
+  REPORT_COUNT(1),
+  CONTROL_REPORT_SIZE,
+  USAGE(1),
+  0x04,
+  OUTPUT(1),
+  0x02,  // Data, Variable, Absolute
+  END_COLLECTION(0),
+};
@@ -0,0 +1,144 @@
+#pragma once
+#include <stdint.h>
+
+/// A state of the keyboard waiting to be sent to the USB host.
+struct PendingState {
+  uint8_t m_modifiers;
+  uint8_t m_keys[6];
+  uint8_t m_mediaKey;
+};
+
+/// FIFO of the keyboard states waiting to be sent to the USB host, holding 'Size' states plus one waiting for room.
+///
+/// When the host does not poll fast enough the FIFO gets full, and a queued state S(i) is merged into the next one S(i+1), that is dropped, only when the host cannot tell:
+/// S(i-1), S(i) and S(i+1) have the same modifiers and media key, and each key changes at most once from S(i-1) to S(i+1). A key pressed and released, or released and pressed again, or a modifier changing around a key, is never lost or reordered.
+/// When no state can be merged, the new state waits for room. If another one comes before there is room, the waiting state is lost, which is counted as dropped: the host still ends up with the latest state.
+/// The state at the front is the one being sent, it is never merged.
+///
+/// This class does no locking, KeyboardHID uses it inside critical sections.
+template <int Size>
+class ReportFifo {
+public:
+  /// What push() did to make room.
+  enum Push : uint8_t {
+    /// There was room, or the state waits for room.
+    PUSH_QUEUED,
+    /// A queued state was merged into the next one.
+    PUSH_MERGED,
+    /// The state waiting for room was replaced by the new one.
+    PUSH_DROPPED,
+  };
+
+  /// Add 'state' at the end of the FIFO.
+  Push push(const PendingState& state);
+
+  /// Number of states in the FIFO, including the one waiting for room.
+  int count() const;
+
+  /// The oldest state, the FIFO must not be empty.
+  const PendingState& front() const;
+
+  /// Remove the oldest state, the FIFO must not be empty. The state waiting for room, if any, is queued.
+  void pop();
+
+  /// True if S(i) can be dropped between 'previous' and 'next' without the host seeing a difference other than timing.
+  static bool canMerge(const PendingState& previous, const PendingState& current, const PendingState& next);
+
+private:
+  /// The i-th oldest state, where index Size is the state waiting for room.
+  PendingState& at(int i);
+
+  /// True if 'key' is one of the keys of 'state'.
+  static bool isPressed(const PendingState& state, uint8_t key);
+
+  /// True if each key of 'state' changes at most once from 'previous' to 'next'.
+  static bool isMonotonic(const PendingState& previous, const PendingState& current, const PendingState& next, const PendingState& keys);
+
+  PendingState m_states[Size];
+  PendingState m_waiting;
+  uint8_t m_head = 0;
+  uint8_t m_count = 0;
+  bool m_hasWaiting = false;
+};
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+template <int Size>
+inline typename ReportFifo<Size>::Push ReportFifo<Size>::push(const PendingState& state) {
+  if (m_count < Size) {
+    at(m_count++) = state;
+    return PUSH_QUEUED;
+  }
+
+  // Merge the newest state that can be, the head excluded as it is being sent. Index 'last' is the newest one, the state waiting for room if any, and the new state follows it.
+  int last = m_hasWaiting ? Size : Size - 1;
+  for (int i = last; i >= 1; --i) {
+    if (canMerge(at(i - 1), at(i), i == last ? state : at(i + 1))) {
+      for (int j = i; j < last; ++j) {
+        at(j) = at(j + 1);
+      }
+      at(last) = state;
+      return PUSH_MERGED;
+    }
+  }
+
+  if (!m_hasWaiting) {
+    m_waiting = state;
+    m_hasWaiting = true;
+    return PUSH_QUEUED;
+  }
+  m_waiting = state;
+  return PUSH_DROPPED;
+}
+
+template <int Size>
+inline int ReportFifo<Size>::count() const {
+  return m_count + (m_hasWaiting ? 1 : 0);
+}
+
+template <int Size>
+inline const PendingState& ReportFifo<Size>::front() const {
+  return m_states[m_head];
+}
+
+template <int Size>
+inline void ReportFifo<Size>::pop() {
+  m_head = (m_head + 1) % Size;
+  m_count--;
+  if (m_hasWaiting) {
+    at(m_count++) = m_waiting;
+    m_hasWaiting = false;
+  }
+}
+
+template <int Size>
+inline bool ReportFifo<Size>::canMerge(const PendingState& previous, const PendingState& current, const PendingState& next) {
+  if (current.m_modifiers != previous.m_modifiers || current.m_modifiers != next.m_modifiers) return false;
+  if (current.m_mediaKey != previous.m_mediaKey || current.m_mediaKey != next.m_mediaKey) return false;
+
+  // A key that changes twice is in exactly one of the states or in exactly two of them, so it is a key of 'current' or of 'previous'.
+  return isMonotonic(previous, current, next, current) && isMonotonic(previous, current, next, previous);
+}
+
+template <int Size>
+inline PendingState& ReportFifo<Size>::at(int i) {
+  return i < Size ? m_states[(m_head + i) % Size] : m_waiting;
+}
+
+template <int Size>
+inline bool ReportFifo<Size>::isPressed(const PendingState& state, uint8_t key) {
+  for (uint8_t k : state.m_keys) {
+    if (k == key) return true;
+  }
+  return false;
+}
+
+template <int Size>
+inline bool ReportFifo<Size>::isMonotonic(const PendingState& previous, const PendingState& current, const PendingState& next, const PendingState& keys) {
+  for (uint8_t key : keys.m_keys) {
+    if (key == 0) continue;
+    bool inCurrent = isPressed(current, key);
+    if (inCurrent != isPressed(previous, key) && inCurrent != isPressed(next, key)) return false;
+  }
+  return true;
+}
@@ -0,0 +1,114 @@
+#include "settings.h"
+#include "storage.h"
+
+namespace SettingsImpl {
+uint32_t s_values[Settings::NUM_SETTINGS];
+
+/// Description of a setting.
+struct Description {
+  const char* m_name;
+  uint32_t m_default;
+  uint32_t m_minimum;
+  uint32_t m_maximum;
+};
+
+static const Description s_descriptions[Settings::NUM_SETTINGS] = {
+  { "debounce_time", DEBOUNCE_TIME, DEBOUNCE_MIN_TIME, DEBOUNCE_MAX_TIME },
+  { "max_hold_time", MAX_HOLD_TIME, 0, 5000000 },
+  { "key_press_length", KEY_PRESS_LENGTH, 1, 1000 },
+  { "typing_streak_time", TYPING_STREAK_TIME, 0, 1000000 },
+  { "overlap_removal_time", OVERLAP_REMOVAL_TIME, 0, 1000000 },
+  { "i2c_frequency", I2C_FREQUENCY, 100000, 1000000 },
+};
+
+/// Largest number of settings in a saved bank, so that the size of a bank does not change when settings are added.
+static const int MAX_SAVED_SETTINGS = 32;
+static_assert(Settings::NUM_SETTINGS <= MAX_SAVED_SETTINGS, "the settings must fit in a saved bank");
+
+/// The content of a bank.
+struct SavedSettings {
+  /// Incremented at each save. The valid bank with the highest sequence holds the last save.
+  uint32_t m_sequence;
+  /// Number of settings saved, the firmware that saved them may know fewer or more than this one.
+  uint32_t m_count;
+  uint32_t m_values[MAX_SAVED_SETTINGS];
+};
+
+/// Flash records of the two banks.
+static const Storage::Record s_banks[2] = { Storage::RECORD_SETTINGS_0, Storage::RECORD_SETTINGS_1 };
+
+/// Sequence of the last save, 0 if the settings were never saved.
+uint32_t s_sequence = 0;
+
+/// Bank holding the last save.
+int s_bank = 1;
+}
+
+void Settings::init() {
+  using namespace SettingsImpl;
+
+  reset();
+
+  // Use the most recent save, if any.
+  s_sequence = 0;
+  s_bank = 1;
+  SavedSettings saved = {};
+  for (int bank = 0; bank < 2; ++bank) {
+    SavedSettings candidate;
+    if (Storage::read(s_banks[bank], &candidate, sizeof(candidate)) && candidate.m_sequence > s_sequence) {
+      saved = candidate;
+      s_sequence = candidate.m_sequence;
+      s_bank = bank;
+    }
+  }
+  if (s_sequence == 0) return;
+
+  // A value out of the range of this firmware keeps its default.
+  for (uint32_t setting = 0; setting < saved.m_count && setting < NUM_SETTINGS; ++setting) {
+    set(Setting(setting), saved.m_values[setting]);
+  }
+}
+
+void Settings::reset() {
+  using namespace SettingsImpl;
+  for (int setting = 0; setting < NUM_SETTINGS; ++setting) {
+    s_values[setting] = s_descriptions[setting].m_default;
+  }
+}
+
+bool Settings::save() {
+  using namespace SettingsImpl;
+
+  // Write the bank that does not hold the last save, which stays valid if this write is interrupted.
+  SavedSettings saved = {};
+  saved.m_sequence = s_sequence + 1;
+  saved.m_count = NUM_SETTINGS;
+  for (int setting = 0; setting < NUM_SETTINGS; ++setting) {
+    saved.m_values[setting] = s_values[setting];
+  }
+  int bank = 1 - s_bank;
+  if (!Storage::write(s_banks[bank], &saved, sizeof(saved))) return false;
+
+  s_sequence = saved.m_sequence;
+  s_bank = bank;
+  return true;
+}
+
+bool Settings::set(Setting setting, uint32_t value) {
+  using namespace SettingsImpl;
+  if (value < s_descriptions[setting].m_minimum || value > s_descriptions[setting].m_maximum) return false;
+  s_values[setting] = value;
+  return true;
+}
+
+uint32_t Settings::minimum(Setting setting) {
+  return SettingsImpl::s_descriptions[setting].m_minimum;
+}
+
+uint32_t Settings::maximum(Setting setting) {
+  return SettingsImpl::s_descriptions[setting].m_maximum;
+}
+
+const char* Settings::name(Setting setting) {
+  return SettingsImpl::s_descriptions[setting].m_name;
+}
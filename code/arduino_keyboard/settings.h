@@ -0,0 +1,65 @@
+#pragma once
+#include "config.h"
+#include <stdint.h>
+
+/// Timing parameters that can be changed at runtime through the control channel.
+///
+/// They start from the values defined in config.h, replaced by the values saved in flash if any. Reading a setting is a plain load from a RAM array.
+/// The values are saved in two flash banks written in turn, each with its CRC, so that a power loss during save() leaves the values of the previous save.
+namespace Settings {
+
+/// The runtime settings. New settings are added at the end, the index of a setting identifies its saved value across firmware versions.
+enum Setting : uint8_t {
+  /// Debounce time of the keys that have not learned their own yet, in micro-seconds. See DEBOUNCE_TIME.
+  SETTING_DEBOUNCE_TIME,
+  /// See MAX_HOLD_TIME, in micro-seconds.
+  SETTING_MAX_HOLD_TIME,
+  /// See KEY_PRESS_LENGTH, in milli-seconds.
+  SETTING_KEY_PRESS_LENGTH,
+  /// See TYPING_STREAK_TIME, in micro-seconds.
+  SETTING_TYPING_STREAK_TIME,
+  /// See OVERLAP_REMOVAL_TIME, in micro-seconds.
+  SETTING_OVERLAP_REMOVAL_TIME,
+  /// See I2C_FREQUENCY, in Hz. Used at the next start.
+  SETTING_I2C_FREQUENCY,
+
+  NUM_SETTINGS
+};
+
+/// Load the settings saved in flash, or their default values for the settings that were never saved. Must be called once after Storage::init() before any other functions.
+void init();
+
+/// Set every setting to its default value, in RAM only.
+void reset();
+
+/// Save the current value of every setting in flash, to be loaded by the next init(). Return false if the write failed, the previous save is then still loaded.
+///
+/// This erases a flash sector and stall the execution for several milli-seconds. Only call it when the keyboard is idle.
+bool save();
+
+/// Current value of 'setting'.
+inline uint32_t get(Setting setting);
+
+/// Change the value of 'setting'. Return false, leaving the setting unchanged, if 'value' is out of the allowed range.
+bool set(Setting setting, uint32_t value);
+
+/// Smallest allowed value of 'setting'.
+uint32_t minimum(Setting setting);
+
+/// Largest allowed value of 'setting'.
+uint32_t maximum(Setting setting);
+
+/// Name of 'setting', as shown to the user.
+const char* name(Setting setting);
+}
+
+/// Namespace containing all the implementation details of the settings.
+namespace SettingsImpl {
+extern uint32_t s_values[Settings::NUM_SETTINGS];
+}
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline uint32_t Settings::get(Setting setting) {
+  return SettingsImpl::s_values[setting];
+}
@@ -0,0 +1,143 @@
+#include "split.h"
+#include "splitProtocol.h"
+#include "perf.h"
+#include "mbed.h"
+
+/// Namespace containing all the implementation details of the split link.
+namespace SplitImpl {
+
+/// The UART handle, setup by Split::init().
+UnbufferedSerial* s_serial = nullptr;
+
+static_assert(SPLIT_RX_BUFFER_SIZE <= 32768 && (SPLIT_RX_BUFFER_SIZE & (SPLIT_RX_BUFFER_SIZE - 1)) == 0, "SPLIT_RX_BUFFER_SIZE must be a power of two that the indices can count");
+
+/// Bytes received by onReceive() and not read yet. The interrupt only writes s_rxEnd and the main loop only writes s_rxStart, so no lock is needed.
+/// The UART FIFO only holds 32 bytes, about 320 us at 1 Mbaud, which is shorter than an iteration of the main loop with a slow scan.
+uint8_t s_rxBuffer[SPLIT_RX_BUFFER_SIZE];
+volatile uint16_t s_rxStart = 0;
+volatile uint16_t s_rxEnd = 0;
+
+/// Called from the UART interrupt when bytes were received. When the buffer is full the new bytes are dropped, the decoder sees them as a corrupted frame.
+void onReceive() {
+  uint8_t byte;
+  while (s_serial->readable() && s_serial->read(&byte, 1) == 1) {
+    uint16_t end = s_rxEnd;
+    if (uint16_t(end - s_rxStart) == SPLIT_RX_BUFFER_SIZE) continue;
+    s_rxBuffer[end % SPLIT_RX_BUFFER_SIZE] = byte;
+    s_rxEnd = end + 1;
+  }
+}
+
+/// Read the next received byte into 'byte', return false if there is none.
+bool readByte(uint8_t& byte) {
+  uint16_t start = s_rxStart;
+  if (start == s_rxEnd) return false;
+  byte = s_rxBuffer[start % SPLIT_RX_BUFFER_SIZE];
+  s_rxStart = start + 1;
+  return true;
+}
+
+/// Sequence number of the last frame sent or received.
+uint8_t s_sequence = 0;
+
+/// Time of the last frame sent or received.
+unsigned long s_lastFrame = 0;
+
+/// Pressed pins of the secondary half, as last sent or received.
+uint32_t s_pressed = 0;
+
+#if SPLIT_ROLE == SPLIT_PRIMARY
+SplitDecoder s_decoder;
+
+/// True once a full state was received, until the link times out.
+bool s_linkUp = false;
+
+/// True from a lost or corrupted frame until a full state is received: the changes in the frames lost may have left pins pressed or released.
+/// SPLIT_RESYNC is sent again every SPLIT_HEARTBEAT_TIME meanwhile, since the request itself can be lost.
+bool s_resyncPending = false;
+
+/// Time of the last SPLIT_RESYNC request.
+unsigned long s_lastResync = 0;
+#endif
+}
+
+void Split::init() {
+  using namespace SplitImpl;
+  s_serial = new UnbufferedSerial(SPLIT_TX_PIN, SPLIT_RX_PIN, SPLIT_BAUD);
+  s_serial->attach(&onReceive, SerialBase::RxIrq);
+}
+
+#if SPLIT_ROLE == SPLIT_PRIMARY
+uint32_t Split::receive(unsigned long now) {
+  using namespace SplitImpl;
+
+  uint8_t byte;
+  SplitFrame frame;
+  while (readByte(byte)) {
+    if (!s_decoder.push(byte, frame)) continue;
+    Perf::count(Perf::COUNTER_SPLIT_FRAMES);
+    s_lastFrame = now;
+
+    if (frame.m_changed == SPLIT_ALL_PINS) {
+      // The full state repairs whatever the lost frames changed.
+      s_linkUp = true;
+      s_resyncPending = false;
+    } else if (!s_linkUp) {
+      // Changes are meaningless until we know the full state.
+      s_resyncPending = true;
+    } else if (frame.m_sequence != uint8_t(s_sequence + 1)) {
+      // The changes of the missing frames are lost, apply this one anyway and ask for the full state.
+      Perf::count(Perf::COUNTER_SPLIT_LOST_FRAMES, uint8_t(frame.m_sequence - s_sequence - 1));
+      s_resyncPending = true;
+    }
+    s_sequence = frame.m_sequence;
+    s_pressed = (s_pressed & ~frame.m_changed) | (frame.m_pressed & frame.m_changed);
+  }
+
+  if (s_decoder.m_crcErrors > 0) {
+    Perf::count(Perf::COUNTER_SPLIT_CRC_ERRORS, s_decoder.m_crcErrors);
+    s_decoder.m_crcErrors = 0;
+    s_resyncPending = true;
+  }
+
+  if (s_linkUp && now - s_lastFrame > SPLIT_TIMEOUT) {
+    Perf::count(Perf::COUNTER_SPLIT_TIMEOUTS);
+    s_linkUp = false;
+  }
+
+  // Keep asking until the full state comes, but not more often than the heartbeat so that the answers are not flooded.
+  if ((s_resyncPending || !s_linkUp) && now - s_lastResync >= SPLIT_HEARTBEAT_TIME) {
+    uint8_t request = SPLIT_RESYNC;
+    s_serial->write(&request, 1);
+    s_lastResync = now;
+  }
+
+  return s_linkUp ? s_pressed : 0;
+}
+#endif
+
+#if SPLIT_ROLE == SPLIT_SECONDARY
+void Split::send(uint32_t pressed, unsigned long now) {
+  using namespace SplitImpl;
+
+  bool full = false;
+  uint8_t byte;
+  while (readByte(byte)) {
+    if (byte == SPLIT_RESYNC) full = true;
+  }
+
+  uint32_t changed = full ? SPLIT_ALL_PINS : pressed ^ s_pressed;
+  if (changed == 0) {
+    // The heartbeat carries the full state, so that the primary half recovers from lost frames even if its SPLIT_RESYNC requests are lost too.
+    if (now - s_lastFrame < SPLIT_HEARTBEAT_TIME) return;
+    changed = SPLIT_ALL_PINS;
+  }
+
+  // A frame fits in the UART FIFO, this does not wait for the transmission.
+  uint8_t data[SPLIT_FRAME_SIZE];
+  splitEncode(SplitFrame{ ++s_sequence, changed, pressed }, data);
+  s_serial->write(data, sizeof(data));
+  s_pressed = pressed;
+  s_lastFrame = now;
+}
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+#include "config.h"
+#include <stdint.h>
+
+/// The link between the two halves of a split keyboard, see SPLIT_ROLE.
+///
+/// The protocol is described in splitProtocol.h. The quality of the link is tracked by the split_* performance counters.
+namespace Split {
+
+/// Open the UART link. Must be called once before any other functions, and only if SPLIT_ROLE is not SPLIT_NONE.
+void init();
+
+#if SPLIT_ROLE == SPLIT_PRIMARY
+/// Process the frames received from the secondary half, and return its pressed pins. All the pins are released while the link is down.
+///
+/// The received bytes are queued by the UART interrupt, this must be called before SPLIT_RX_BUFFER_SIZE bytes are received (2.5 ms with the default configuration), or the extra bytes are lost and the link resynchronizes.
+uint32_t receive(unsigned long now);
+#endif
+
+#if SPLIT_ROLE == SPLIT_SECONDARY
+/// Send the pressed pins of this half to the primary half if they changed, if a heartbeat is due or if the primary half asked for them.
+void send(uint32_t pressed, unsigned long now);
+#endif
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+// Protocol of the UART link between the two halves of a split keyboard, shared by the firmware and the host tools.
+//
+// The secondary half scans its switches and sends a frame to the primary half each time some of them change, and a heartbeat every SPLIT_HEARTBEAT_TIME otherwise.
+// A frame only describes the pins that changed, a heartbeat describes them all:
+//   SPLIT_SYNC (1 byte), sequence number (1 byte), changed pins (4 bytes), pressed state of the changed pins (4 bytes), CRC-8 of the previous bytes (1 byte).
+// Pins are numbered chip * 8 + pin over the chips of the secondary half. Integers are little endian.
+//
+// The sequence number increases by one on each frame. When the primary half sees a gap, a corrupted frame or no frame for too long, it sends SPLIT_RESYNC and the secondary half answers with a frame where every pin is marked as changed.
+// The primary half sends SPLIT_RESYNC again every SPLIT_HEARTBEAT_TIME until it receives such a frame, and the heartbeats are such frames too, so a lost request only delays the recovery.
+
+/// First byte of a frame.
+#define SPLIT_SYNC 0xA5
+
+/// Byte sent by the primary half to ask for the full state.
+#define SPLIT_RESYNC 0x5A
+
+/// Size of a frame in bytes.
+#define SPLIT_FRAME_SIZE 11
+
+/// Value of the changed pins of a frame holding the full state.
+#define SPLIT_ALL_PINS 0xFFFFFFFF
+
+/// Content of a frame.
+struct SplitFrame {
+  uint8_t m_sequence;
+  /// Bit i is set if the pin i changed.
+  uint32_t m_changed;
+  /// Bit i is set if the pin i is pressed. Only meaningful for the pins set in m_changed.
+  uint32_t m_pressed;
+};
+
+/// CRC-8 (polynomial 0x07) of 'size' bytes of 'data'.
+inline uint8_t splitCrc8(const uint8_t* data, int size) {
+  uint8_t crc = 0;
+  for (int i = 0; i < size; ++i) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+/// Write 'frame' in 'data', SPLIT_FRAME_SIZE bytes.
+inline void splitEncode(const SplitFrame& frame, uint8_t* data) {
+  data[0] = SPLIT_SYNC;
+  data[1] = frame.m_sequence;
+  for (int i = 0; i < 4; ++i) {
+    data[2 + i] = frame.m_changed >> (8 * i);
+    data[6 + i] = frame.m_pressed >> (8 * i);
+  }
+  data[10] = splitCrc8(data, SPLIT_FRAME_SIZE - 1);
+}
+
+/// Rebuild frames from the bytes received on the link.
+class SplitDecoder {
+public:
+  /// Add a received byte. Return true, with the frame in 'frame', if it completed a valid frame.
+  inline bool push(uint8_t byte, SplitFrame& frame);
+
+  /// Number of frames dropped because their CRC did not match.
+  uint32_t m_crcErrors = 0;
+
+private:
+  uint8_t m_buffer[SPLIT_FRAME_SIZE];
+  int m_size = 0;
+};
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline bool SplitDecoder::push(uint8_t byte, SplitFrame& frame) {
+  // Wait for the start of a frame.
+  if (m_size == 0 && byte != SPLIT_SYNC) return false;
+
+  m_buffer[m_size++] = byte;
+  if (m_size < SPLIT_FRAME_SIZE) return false;
+
+  if (splitCrc8(m_buffer, SPLIT_FRAME_SIZE - 1) != m_buffer[SPLIT_FRAME_SIZE - 1]) {
+    // We may have synchronized on a byte inside a frame, look for the next SPLIT_SYNC in what we received.
+    m_crcErrors++;
+    int next = 1;
+    while (next < SPLIT_FRAME_SIZE && m_buffer[next] != SPLIT_SYNC) ++next;
+    m_size = SPLIT_FRAME_SIZE - next;
+    memmove(m_buffer, m_buffer + next, m_size);
+    return false;
+  }
+
+  frame.m_sequence = m_buffer[1];
+  frame.m_changed = 0;
+  frame.m_pressed = 0;
+  for (int i = 0; i < 4; ++i) {
+    frame.m_changed |= uint32_t(m_buffer[2 + i]) << (8 * i);
+    frame.m_pressed |= uint32_t(m_buffer[6 + i]) << (8 * i);
+  }
+  m_size = 0;
+  return true;
+}
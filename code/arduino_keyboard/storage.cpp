@@ -0,0 +1,140 @@
+#include "storage.h"
+#if FLASH_EMULATION
+#include <string.h>
+#else
+#include "mbed.h"
+#endif
+
+/// Namespace containing all the implementation details of the persistent storage.
+namespace StorageImpl {
+
+/// Marker written at the start of every valid record.
+static const uint32_t RECORD_MAGIC = 0x4B425244;  // "KBRD"
+
+/// Largest flash page size supported.
+static const uint32_t MAX_PAGE_SIZE = 256;
+
+/// Header written in front of the content of a record.
+struct RecordHeader {
+  uint32_t m_magic;
+  /// The Storage::Record written, so that a sector read as another record is invalid.
+  uint32_t m_record;
+  uint32_t m_size;
+  uint32_t m_crc;
+};
+
+/// The flash handle.
+#if FLASH_EMULATION
+EmulatedFlash s_flash;
+static_assert(Storage::NUM_RECORDS * EmulatedFlash::SECTOR_SIZE <= FLASH_EMULATION_SIZE, "the emulated flash must hold every record");
+#else
+FlashIAP s_flash;
+#endif
+
+/// Address of the end of the flash, the records are laid out backwards from there.
+uint32_t s_endAddress = 0;
+
+/// Size of an erase sector.
+uint32_t s_sectorSize = 0;
+
+/// Size of a program page.
+uint32_t s_pageSize = 0;
+
+/// Address of the sector of 'record'. The record k is in the k-th sector from the end, so that adding a record does not move the others.
+uint32_t recordAddress(Storage::Record record) {
+  return s_endAddress - (record + 1) * s_sectorSize;
+}
+
+/// The content of the flash at 'address'.
+const uint8_t* mapped(uint32_t address) {
+#if FLASH_EMULATION
+  return s_flash.memory(address);
+#else
+  // The flash is memory mapped (XIP) at the addresses used by FlashIAP.
+  return (const uint8_t*)(uintptr_t)address;
+#endif
+}
+}
+
+void Storage::init() {
+  using namespace StorageImpl;
+
+  s_flash.init();
+  s_endAddress = s_flash.get_flash_start() + s_flash.get_flash_size();
+  s_sectorSize = s_flash.get_sector_size(s_endAddress - 1);
+  s_pageSize = s_flash.get_page_size();
+}
+
+bool Storage::read(Record record, void* data, uint32_t size) {
+  using namespace StorageImpl;
+
+  uint32_t address = recordAddress(record);
+  RecordHeader header;
+  if (s_flash.read(&header, address, sizeof(header)) != 0) return false;
+  if (header.m_magic != RECORD_MAGIC || header.m_record != record || header.m_size != size) return false;
+
+  // Check the content before copying it so that 'data' is left untouched if the record is corrupted.
+  uint8_t chunk[64];
+  uint32_t crc = 0;
+  for (uint32_t offset = 0; offset < size; offset += sizeof(chunk)) {
+    uint32_t length = size - offset < sizeof(chunk) ? size - offset : sizeof(chunk);
+    if (s_flash.read(chunk, address + sizeof(header) + offset, length) != 0) return false;
+    crc = crc32(chunk, length, crc);
+  }
+  if (crc != header.m_crc) return false;
+
+  return s_flash.read(data, address + sizeof(header), size) == 0;
+}
+
+const void* Storage::map(Record record, uint32_t size) {
+  using namespace StorageImpl;
+
+  uint32_t address = recordAddress(record);
+  const RecordHeader* header = (const RecordHeader*)mapped(address);
+  if (header->m_magic != RECORD_MAGIC || header->m_record != record || header->m_size != size) return nullptr;
+
+  const uint8_t* content = mapped(address + sizeof(RecordHeader));
+  if (crc32(content, size) != header->m_crc) return nullptr;
+  return content;
+}
+
+bool Storage::write(Record record, const void* data, uint32_t size) {
+  using namespace StorageImpl;
+
+  uint32_t address = recordAddress(record);
+  uint32_t total = sizeof(RecordHeader) + size;
+  if (total > s_sectorSize || s_pageSize > MAX_PAGE_SIZE) return false;
+
+  RecordHeader header{ RECORD_MAGIC, record, size, crc32(data, size) };
+  if (s_flash.erase(address, s_sectorSize) != 0) return false;
+
+  // Program page by page the header followed by the content.
+  uint8_t page[MAX_PAGE_SIZE];
+  for (uint32_t offset = 0; offset < total; offset += s_pageSize) {
+    memset(page, 0xFF, s_pageSize);
+    for (uint32_t i = 0; i < s_pageSize && offset + i < total; ++i) {
+      uint32_t index = offset + i;
+      page[i] = index < sizeof(header) ? ((const uint8_t*)&header)[index] : ((const uint8_t*)data)[index - sizeof(header)];
+    }
+    if (s_flash.program(page, address + offset, s_pageSize) != 0) return false;
+  }
+  return true;
+}
+
+#if FLASH_EMULATION
+EmulatedFlash& Storage::emulatedFlash() {
+  return StorageImpl::s_flash;
+}
+#endif
+
+uint32_t Storage::crc32(const void* data, uint32_t size, uint32_t crc) {
+  const uint8_t* bytes = (const uint8_t*)data;
+  crc = ~crc;
+  for (uint32_t i = 0; i < size; ++i) {
+    crc ^= bytes[i];
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
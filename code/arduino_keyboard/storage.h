@@ -0,0 +1,60 @@
+#pragma once
+#include "config.h"
+#include "flashEmulation.h"
+#include <stdint.h>
+
+/// Persistent records stored in the flash memory.
+///
+/// Each record lives in its own erase sector, reserved at the end of the flash: the record k is in the k-th sector from the end. Records are written with a header holding the record and a checksum so that a sector that was never written, whose write was interrupted, or that holds another record, is reported as invalid.
+namespace Storage {
+
+/// The records that can be stored. Each one uses a flash sector.
+///
+/// The value of a record is its place in the flash, so that a firmware update finds the records of the previous one: new records go at the end, and records are never removed or reordered.
+enum Record : uint8_t {
+  /// Learned per-key debounce times.
+  RECORD_DEBOUNCE,
+  /// The two banks of keymap images.
+  RECORD_KEYMAP_0,
+  RECORD_KEYMAP_1,
+  /// The banks of the usage heatmap, written in turn.
+  RECORD_HEATMAP_0,
+  RECORD_HEATMAP_1,
+  RECORD_HEATMAP_2,
+  RECORD_HEATMAP_3,
+  /// The post-mortem trace saved after a reset, split in several records.
+  RECORD_RECORDER_0,
+  RECORD_RECORDER_1,
+  RECORD_RECORDER_2,
+  RECORD_RECORDER_3,
+  /// The two banks of saved settings, see Settings::save().
+  RECORD_SETTINGS_0,
+  RECORD_SETTINGS_1,
+
+  NUM_RECORDS
+};
+
+/// Initialize the flash access. Must be called once before any other functions.
+void init();
+
+/// Read the content of 'record' into 'data'. Return false, leaving 'data' untouched, if the record is missing, corrupted or of a different size.
+bool read(Record record, void* data, uint32_t size);
+
+/// Replace the content of 'record' with 'size' bytes from 'data'.
+///
+/// This erases a flash sector and stall the execution for several milli-seconds. Only call it when the keyboard is idle.
+bool write(Record record, const void* data, uint32_t size);
+
+/// Return a pointer to the content of 'record' in the memory-mapped flash, or nullptr if the record is missing, corrupted or of a different size.
+///
+/// The pointer stays valid until the record is written again.
+const void* map(Record record, uint32_t size);
+
+#if FLASH_EMULATION
+/// The flash in RAM used instead of the flash of the micro-controller, e.g. to cut the power during a write.
+EmulatedFlash& emulatedFlash();
+#endif
+
+/// Compute the CRC-32 of 'size' bytes of 'data'.
+uint32_t crc32(const void* data, uint32_t size, uint32_t crc = 0);
+}
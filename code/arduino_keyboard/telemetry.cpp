@@ -0,0 +1,61 @@
+#include "telemetry.h"
+
+namespace TelemetryImpl {
+uint16_t s_presses[NUM_LINES][NUM_COLUMNS];
+uint16_t s_bounces[NUM_LINES][NUM_COLUMNS];
+uint16_t s_minBounce[NUM_LINES][NUM_COLUMNS];
+uint16_t s_longestHold[NUM_LINES][NUM_COLUMNS];
+unsigned long s_pressTime[NUM_LINES][NUM_COLUMNS];
+
+/// Write 'value' in little endian at 'data'.
+inline void write16(uint8_t* data, uint16_t value) {
+  data[0] = value & 0xFF;
+  data[1] = value >> 8;
+}
+}
+
+void Telemetry::init() {
+  using namespace TelemetryImpl;
+
+  for (int line = 0; line < NUM_LINES; ++line) {
+    for (int column = 0; column < NUM_COLUMNS; ++column) {
+      s_presses[line][column] = 0;
+      s_bounces[line][column] = 0;
+      s_minBounce[line][column] = 0xFFFF;
+      s_longestHold[line][column] = 0;
+      s_pressTime[line][column] = 0;
+    }
+  }
+}
+
+int Telemetry::fillPage(uint8_t firstKey, uint8_t* data, unsigned long now) {
+  using namespace TelemetryImpl;
+
+  static const int numKeys = NUM_LINES * NUM_COLUMNS;
+  if (firstKey >= numKeys) firstKey = 0;
+  uint8_t count = numKeys - firstKey < TELEMETRY_KEYS_PER_PAGE ? numKeys - firstKey : TELEMETRY_KEYS_PER_PAGE;
+
+  data[0] = firstKey;
+  data[1] = count;
+  uint8_t* entry = data + 2;
+  for (uint8_t key = firstKey; key < firstKey + count; ++key, entry += 8) {
+    int line = key / NUM_COLUMNS;
+    int column = key % NUM_COLUMNS;
+
+    unsigned long longestHold = s_longestHold[line][column];
+    unsigned long pressTime = s_pressTime[line][column];
+    if (pressTime != 0 && (now - pressTime) / 1000 > longestHold) {
+      longestHold = (now - pressTime) / 1000;
+      if (longestHold > 0xFFFF) longestHold = 0xFFFF;
+    }
+
+    write16(entry + 0, s_presses[line][column]);
+    write16(entry + 2, s_bounces[line][column]);
+    write16(entry + 4, s_minBounce[line][column]);
+    write16(entry + 6, longestHold);
+  }
+
+  // Unused entries of the last page are left zeroed.
+  for (; entry < data + TELEMETRY_PAGE_SIZE; ++entry) *entry = 0;
+  return TELEMETRY_PAGE_SIZE;
+}
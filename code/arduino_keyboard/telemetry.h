@@ -0,0 +1,69 @@
+#pragma once
+#include "config.h"
+#include "controlProtocol.h"
+#include "pos.h"
+#include <stdint.h>
+
+/// Per-key health counters, used to find failing switches.
+///
+/// Counters saturate instead of wrapping. They are read by the USB host through the telemetry feature report, see Telemetry::fillPage().
+namespace Telemetry {
+
+/// Reset all the counters. Must be called once before any other functions.
+void init();
+
+/// Record a press of the key at 'pos' that passed the debouncing.
+inline void recordPress(Pos pos, unsigned long time);
+
+/// Record a release of the key at 'pos' that passed the debouncing.
+inline void recordRelease(Pos pos, unsigned long time);
+
+/// Record a bounce of the key at 'pos': two opposite edges 'interval' micro-seconds apart were cancelled.
+inline void recordBounce(Pos pos, unsigned long interval);
+
+/// Write in 'data' the page of the telemetry report starting at key index 'firstKey', where the key index is line * NUM_COLUMNS + column. Return the number of bytes written.
+///
+/// The page is: first key index (1 byte), number of keys (1 byte), then for each key: presses, cancelled bounces, shortest bounce in micro-seconds (0xFFFF if none), longest hold in milli-seconds; all 2 bytes little endian.
+/// The longest hold includes the current one if the key is held, which is how stuck keys show up.
+int fillPage(uint8_t firstKey, uint8_t* data, unsigned long now);
+}
+
+/// Namespace containing all the implementation details of the telemetry.
+namespace TelemetryImpl {
+extern uint16_t s_presses[NUM_LINES][NUM_COLUMNS];
+extern uint16_t s_bounces[NUM_LINES][NUM_COLUMNS];
+extern uint16_t s_minBounce[NUM_LINES][NUM_COLUMNS];
+extern uint16_t s_longestHold[NUM_LINES][NUM_COLUMNS];
+
+/// Time at which each key was pressed, 0 if the key is released.
+extern unsigned long s_pressTime[NUM_LINES][NUM_COLUMNS];
+}
+
+// BELOW IS IMPLEMENTATION OF INLINE FUNCTIONS
+
+inline void Telemetry::recordPress(Pos pos, unsigned long time) {
+  using namespace TelemetryImpl;
+  uint16_t& presses = s_presses[pos.m_line][pos.m_column];
+  if (presses != 0xFFFF) presses++;
+  // Force the lowest bit so that a press at time 0 is not mistaken for a released key.
+  s_pressTime[pos.m_line][pos.m_column] = time | 1;
+}
+
+inline void Telemetry::recordRelease(Pos pos, unsigned long time) {
+  using namespace TelemetryImpl;
+  unsigned long& pressTime = s_pressTime[pos.m_line][pos.m_column];
+  if (pressTime == 0) return;
+
+  unsigned long hold = (time - pressTime) / 1000;
+  uint16_t& longestHold = s_longestHold[pos.m_line][pos.m_column];
+  if (hold > longestHold) longestHold = hold > 0xFFFF ? 0xFFFF : hold;
+  pressTime = 0;
+}
+
+inline void Telemetry::recordBounce(Pos pos, unsigned long interval) {
+  using namespace TelemetryImpl;
+  uint16_t& bounces = s_bounces[pos.m_line][pos.m_column];
+  if (bounces != 0xFFFF) bounces++;
+  uint16_t& minBounce = s_minBounce[pos.m_line][pos.m_column];
+  if (interval < minBounce) minBounce = interval;
+}
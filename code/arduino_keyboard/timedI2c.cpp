@@ -0,0 +1,32 @@
+#include "timedI2c.h"
+#include "hardware/gpio.h"
+
+TimedI2c::TimedI2c(PinName sda, PinName scl) : m_sda(uint(sda)), m_scl(uint(scl)) {
+  // The pins 4n and 4n + 1 are on I2C0, the pins 4n + 2 and 4n + 3 on I2C1.
+  m_i2c = (m_sda / 2) % 2 == 0 ? i2c0 : i2c1;
+  i2c_init(m_i2c, 100000);
+  gpio_set_function(m_sda, GPIO_FUNC_I2C);
+  gpio_set_function(m_scl, GPIO_FUNC_I2C);
+  gpio_pull_up(m_sda);
+  gpio_pull_up(m_scl);
+}
+
+TimedI2c::~TimedI2c() {
+  i2c_deinit(m_i2c);
+  gpio_set_function(m_sda, GPIO_FUNC_NULL);
+  gpio_set_function(m_scl, GPIO_FUNC_NULL);
+}
+
+void TimedI2c::frequency(int hz) {
+  i2c_set_baudrate(m_i2c, uint(hz));
+}
+
+int TimedI2c::write(int address, const char* data, int length, bool repeated) {
+  int written = i2c_write_timeout_us(m_i2c, uint8_t(address >> 1), reinterpret_cast<const uint8_t*>(data), size_t(length), repeated, I2C_TRANSFER_TIMEOUT);
+  return written == length ? 0 : 1;
+}
+
+int TimedI2c::read(int address, char* data, int length, bool repeated) {
+  int read = i2c_read_timeout_us(m_i2c, uint8_t(address >> 1), reinterpret_cast<uint8_t*>(data), size_t(length), repeated, I2C_TRANSFER_TIMEOUT);
+  return read == length ? 0 : 1;
+}
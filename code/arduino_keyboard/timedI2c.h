@@ -0,0 +1,30 @@
+#pragma once
+#include "config.h"
+#include "mbed.h"
+#include "hardware/i2c.h"
+
+/// An I2C bus of the RP2040 where each transfer fails after I2C_TRANSFER_TIMEOUT, with the interface of mbed's I2C used by the MCP drivers.
+///
+/// mbed's I2C waits for the bus as long as it takes: a chip holding SDA or SCL low, or a transfer cut in the middle, stalls the scan until the watchdog resets the board.
+/// With the timeout the transfer fails instead, and the input backend resets the bus within the deadline of the iteration, see Deadline.
+/// Creating the bus resets the I2C peripheral, the backends create it again to recover from errors.
+class TimedI2c {
+public:
+  /// Set up the I2C peripheral of the pins 'sda' and 'scl' at 100 kHz.
+  TimedI2c(PinName sda, PinName scl);
+  ~TimedI2c();
+
+  /// Set the clock of the bus to 'hz'.
+  void frequency(int hz);
+
+  /// Write 'length' bytes of 'data' to the chip at the 8 bits address 'address', without a stop if 'repeated'. Return 0 if every byte was acknowledged in time.
+  int write(int address, const char* data, int length, bool repeated = false);
+
+  /// Read 'length' bytes into 'data' from the chip at the 8 bits address 'address', without a stop if 'repeated'. Return 0 if every byte came in time.
+  int read(int address, char* data, int length, bool repeated = false);
+
+private:
+  i2c_inst_t* m_i2c;
+  uint m_sda;
+  uint m_scl;
+};
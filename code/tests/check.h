@@ -0,0 +1,26 @@
+#pragma once
+// The checks shared by the host tests: each failed CHECK prints its location and condition, and checkResult() gives the
+// exit code of the test.
+
+#include <stdio.h>
+
+/// Number of failed checks since the start of the test.
+static int s_failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+      ++s_failures; \
+    } \
+  } while (0)
+
+/// Print the summary of the checks and return the exit code of the test: 1 if a check failed, else 0.
+static inline int checkResult() {
+  if (s_failures > 0) {
+    printf("%d checks failed\n", s_failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
@@ -0,0 +1,98 @@
+// Test of the event queue of the sketch under the worst burst of edges: every switch changes at every scan, much faster than loop() processes the events, so that the queue
+// is full for many scans. Once the switches settle, the host must see their state, whatever edges did not fit in the queue.
+//
+// Build: g++ -O2 -Ihost -DFLASH_EMULATION=1 -DINPUT_BACKEND=2 -o event_burst_test event_burst_test.cpp host/sketch.cpp
+// Usage: event_burst_test
+//
+// The host build of the sketch, see host/sketch.h, runs loop() under a virtual clock with a start of frame and a poll of the host every milli-second. Prints each failed
+// check and exits with 1 if there is one.
+
+#include "host/sketch.h"
+#include "check.h"
+#include "../arduino_keyboard/perf.h"
+
+#include <stdio.h>
+#include <vector>
+
+/// Length of a full speed USB frame, in micro-seconds.
+static const unsigned long FRAME_LENGTH = 1000;
+
+/// Every input of the matrix.
+static const InputFrame ALL_INPUTS = NUM_INPUTS == 64 ? ~InputFrame(0) : (InputFrame(1) << NUM_INPUTS) - 1;
+
+/// Next start of frame, and the number of the next frame.
+static unsigned long s_nextFrame = FRAME_LENGTH;
+static uint16_t s_frameNumber = 1;
+
+/// States received by the host.
+static std::vector<HostSketch::State> s_states;
+
+/// Send the starts of frame between 'from' and 'to', each followed by a poll, see HostSketch::setClockListener().
+static void onClock(unsigned long, unsigned long to) {
+  while (long(s_nextFrame - to) <= 0) {
+    HostSketch::setNow(s_nextFrame);
+    HostSketch::startOfFrame(s_frameNumber++);
+    HostSketch::pollOnce(s_states);
+    s_nextFrame += FRAME_LENGTH;
+  }
+}
+
+/// Input of the switch at 'line', 'column', see InputBackend::pos().
+static InputFrame input(int line, int column) {
+  return InputFrame(1) << (column * NUM_LINES + line);
+}
+
+/// Flip every switch at each of 'scans' scans, then hold 'settled' until the queue is empty and a second has passed.
+static void burst(int scans, InputFrame settled) {
+  InputFrame inputs = settled;
+  for (int i = 0; i < scans; ++i) {
+    inputs ^= ALL_INPUTS;
+    HostSketch::setInputs(inputs);
+    HostSketch::loop();
+  }
+
+  HostSketch::setInputs(settled);
+  unsigned long end = HostSketch::now() + 1000000;
+  while (!HostSketch::isIdle() || long(HostSketch::now() - end) < 0) HostSketch::loop();
+}
+
+/// Number of keys in the last state received by the host. Before the first report, the host has nothing pressed.
+static int keysReceived() {
+  int count = 0;
+  if (s_states.empty()) return count;
+  for (int i = 1; i <= 6; ++i) count += s_states.back().m_data[i] != 0;
+  return count;
+}
+
+/// Modifiers of the last state received by the host.
+static uint8_t modifiersReceived() {
+  return s_states.empty() ? 0 : s_states.back().m_data[0];
+}
+
+int main() {
+  HostSketch::setup();
+  HostSketch::setScanTime(230);
+  HostSketch::setClockListener(&onClock);
+
+  // Every switch is released at the end: nothing may be left held, whichever edges were dropped.
+  for (int scans : { 6, 20, 101 }) {
+    Perf::reset();
+    burst(scans, 0);
+    CHECK(Perf::counter(Perf::COUNTER_EVENTS_DROPPED) > 0);
+    CHECK(modifiersReceived() == 0 && keysReceived() == 0);
+  }
+
+  // Three letters are held at the end, they must all reach the host.
+  InputFrame letters = input(1, 2) | input(2, 4) | input(3, 6);
+  for (int scans : { 6, 21, 100 }) {
+    Perf::reset();
+    burst(scans, letters);
+    CHECK(Perf::counter(Perf::COUNTER_EVENTS_DROPPED) > 0);
+    CHECK(modifiersReceived() == 0 && keysReceived() == 3);
+
+    burst(0, 0);
+    CHECK(modifiersReceived() == 0 && keysReceived() == 0);
+  }
+
+  return checkResult();
+}
@@ -0,0 +1,46 @@
+#pragma once
+// The part of the Arduino API used by the firmware sources compiled into the host tests and tools. The time functions are defined by each test, or by the host build of
+// the sketch, see sketch.h.
+
+#include <stdint.h>
+#include <stdio.h>
+
+/// Time since the start of the test, in micro-seconds.
+unsigned long micros();
+
+/// Time since the start of the test, in milli-seconds.
+unsigned long millis();
+
+/// Wait for 'ms' milli-seconds.
+void delay(unsigned long ms);
+
+#define HEX 16
+
+/// The serial port of the debug output, written to the standard output.
+class HostSerial {
+public:
+  void begin(unsigned long) {}
+
+  void print(const char* text) { fputs(text, stdout); }
+  void print(char c) { putchar(c); }
+  void print(long long value, int base = 10) { printf(base == HEX ? "%llX" : "%lld", value); }
+  void print(unsigned long long value, int base = 10) { printf(base == HEX ? "%llX" : "%llu", value); }
+  void print(int value, int base = 10) { print((long long)value, base); }
+  void print(long value, int base = 10) { print((long long)value, base); }
+  void print(unsigned int value, int base = 10) { print((unsigned long long)value, base); }
+  void print(unsigned long value, int base = 10) { print((unsigned long long)value, base); }
+
+  void println() { putchar('\n'); }
+  template <typename T>
+  void println(T value) {
+    print(value);
+    println();
+  }
+  template <typename T>
+  void println(T value, int base) {
+    print(value, base);
+    println();
+  }
+};
+
+inline HostSerial Serial;
@@ -0,0 +1,3 @@
+#pragma once
+// The sketch includes its keyboard.h with this name, which only works on a case insensitive file system.
+#include "../../arduino_keyboard/keyboard.h"
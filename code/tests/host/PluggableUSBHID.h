@@ -0,0 +1,154 @@
+#pragma once
+// The part of the HID class of the Arduino mbed core used by the sketch, for the host build of the sketch, see sketch.h.
+//
+// There is no USB stack: the host build plays the USB host and the interrupts, it takes the report handed to the IN endpoint with hostPoll() and writes the output reports
+// with hostWrite().
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MAX_HID_REPORT_SIZE 64
+
+typedef struct {
+  uint32_t length;
+  uint8_t data[MAX_HID_REPORT_SIZE];
+} HID_REPORT;
+
+// Items of the report descriptors, see the HID specification.
+#define USAGE_PAGE(s) (0x04 | (s))
+#define USAGE(s) (0x08 | (s))
+#define COLLECTION(s) (0xA0 | (s))
+#define END_COLLECTION(s) (0xC0 | (s))
+#define REPORT_ID(s) (0x84 | (s))
+#define USAGE_MINIMUM(s) (0x18 | (s))
+#define USAGE_MAXIMUM(s) (0x28 | (s))
+#define LOGICAL_MINIMUM(s) (0x14 | (s))
+#define LOGICAL_MAXIMUM(s) (0x24 | (s))
+#define REPORT_SIZE(s) (0x74 | (s))
+#define REPORT_COUNT(s) (0x94 | (s))
+#define INPUT(s) (0x80 | (s))
+#define OUTPUT(s) (0x90 | (s))
+#define FEATURE(s) (0xB0 | (s))
+
+// Descriptors and requests, see the USB specification.
+#define CONFIGURATION_DESCRIPTOR_LENGTH 9
+#define INTERFACE_DESCRIPTOR_LENGTH 9
+#define HID_DESCRIPTOR_LENGTH 9
+#define ENDPOINT_DESCRIPTOR_LENGTH 7
+#define CONFIGURATION_DESCRIPTOR 2
+#define INTERFACE_DESCRIPTOR 4
+#define ENDPOINT_DESCRIPTOR 5
+#define HID_DESCRIPTOR 0x21
+#define REPORT_DESCRIPTOR 0x22
+#define HID_CLASS 3
+#define HID_SUBCLASS_BOOT 1
+#define HID_PROTOCOL_KEYBOARD 1
+#define HID_VERSION_1_11 0x0111
+#define C_RESERVED 0x80
+#define C_SELF_POWERED 0x40
+#define C_REMOTE_WAKEUP 0x20
+#define C_POWER(x) (x)
+#define E_INTERRUPT 3
+#define LSB(x) ((x) & 0xff)
+#define MSB(x) (((x) >> 8) & 0xff)
+#define GET_REPORT 0x01
+#define SET_REPORT 0x09
+#define CLASS_TYPE 1
+#define STANDARD_TYPE 0
+#define DEVICE_RECIPIENT 0
+#define INTERFACE_RECIPIENT 1
+#define CLEAR_FEATURE 1
+#define SET_FEATURE 3
+#define DEVICE_REMOTE_WAKEUP 1
+
+class USBDevice {
+public:
+  enum RequestResult { Receive = 0, Send = 1, Success = 2, Failure = 3, PassThrough = 4 };
+  enum DeviceState { Attached, Powered, Default, Address, Configured };
+  struct setup_packet_t {
+    struct {
+      uint8_t dataTransferDirection;
+      uint8_t Type;
+      uint8_t Recipient;
+    } bmRequestType;
+    uint8_t bRequest;
+    uint16_t wValue;
+    uint16_t wIndex;
+    uint16_t wLength;
+  };
+};
+
+namespace arduino {
+namespace internal {
+class PluggableUSBModule {
+protected:
+  uint8_t pluggedInterface = 0;
+};
+}
+
+class USBHID : public internal::PluggableUSBModule {
+public:
+  USBHID(uint8_t, uint8_t, uint16_t, uint16_t, uint16_t) {}
+  virtual ~USBHID() {}
+
+  /// Hand 'report' to the IN endpoint. Return false if the endpoint still owns the previous one.
+  bool send_nb(const HID_REPORT* report) {
+    if (m_hostInFlight) return false;
+    m_hostReport = *report;
+    m_hostSubmitTime = micros();
+    m_hostInFlight = true;
+    return true;
+  }
+
+  /// Take the oldest output report written by the host. Return false if there is none.
+  bool read_nb(HID_REPORT* report) {
+    if (!m_hostOutput) return false;
+    *report = m_hostOutputReport;
+    m_hostOutput = false;
+    return true;
+  }
+
+  uint16_t report_desc_length() {
+    report_desc();
+    return reportLength;
+  }
+
+  /// Poll the IN endpoint as the USB host does: take the report handed to it into 'report', with the time it was handed in 'submitTime', and call report_tx() like the
+  /// interrupt of the end of the transfer. Return false if the endpoint has no report.
+  bool hostPoll(HID_REPORT& report, unsigned long& submitTime) {
+    if (!m_hostInFlight) return false;
+    report = m_hostReport;
+    submitTime = m_hostSubmitTime;
+    m_hostInFlight = false;
+    report_tx();
+    return true;
+  }
+
+  /// Write an output report as the USB host does, it is read by read_nb(). Only the last one is kept.
+  void hostWrite(const HID_REPORT& report) {
+    m_hostOutputReport = report;
+    m_hostOutput = true;
+  }
+
+protected:
+  virtual const uint8_t* report_desc() = 0;
+  virtual const uint8_t* configuration_desc(uint8_t index) = 0;
+  virtual void report_tx() {}
+  virtual uint32_t callback_request(const USBDevice::setup_packet_t*, USBDevice::RequestResult* result, uint8_t**) {
+    *result = USBDevice::PassThrough;
+    return 0;
+  }
+
+  uint8_t _int_in = 0x81;
+  uint8_t _int_out = 0x01;
+  uint16_t reportLength = 0;
+
+private:
+  HID_REPORT m_hostReport;
+  unsigned long m_hostSubmitTime = 0;
+  bool m_hostInFlight = false;
+  HID_REPORT m_hostOutputReport;
+  bool m_hostOutput = false;
+};
+}
@@ -0,0 +1,7 @@
+#pragma once
+// The bits of the registers of the USB controller of the RP2040 used by the sketch.
+
+#define USB_SOF_RD_BITS 0x000007ff
+#define USB_SIE_CTRL_RESUME_BITS 0x00001000
+#define USB_INTS_DEV_SOF_BITS 0x00020000
+#define USB_INTE_DEV_SOF_BITS 0x00020000
@@ -0,0 +1,18 @@
+#pragma once
+// The registers of the USB controller of the RP2040 used by the sketch. On the host they are plain memory, written by the host build of the sketch, see sketch.h.
+
+#include "hardware/regs/usb.h"
+#include <stdint.h>
+
+typedef struct {
+  uint32_t sof_rd;
+  uint32_t sie_ctrl;
+  uint32_t inte;
+  uint32_t ints;
+} usb_hw_t;
+
+/// The registers, and their aliases that set bits. Writes to the set alias are kept as is, the host build reads them back.
+inline usb_hw_t s_usbRegisters;
+inline usb_hw_t s_usbSetRegisters;
+#define usb_hw (&s_usbRegisters)
+#define usb_hw_set (&s_usbSetRegisters)
@@ -0,0 +1,112 @@
+#pragma once
+// The part of mbed used by the sketch sources compiled into the host build of the sketch, see sketch.h. There is a single thread, the interrupts are called by the host
+// build itself.
+
+#include <chrono>
+#include <deque>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+typedef int PinName;
+
+/// Stop on a fatal error, like mbed's error().
+[[noreturn]] inline void error(const char* message) {
+  fprintf(stderr, "error: %s\n", message);
+  abort();
+}
+
+#define MBED_ASSERT(condition)
+
+inline void core_util_critical_section_enter() {}
+inline void core_util_critical_section_exit() {}
+
+/// Wait for 'us' micro-seconds.
+void wait_us(int us);
+
+/// The vectors of the interrupts installed with NVIC_SetVector(). The host build only uses the one of the USB controller.
+enum IRQn_Type { USBCTRL_IRQ_IRQn = 5 };
+inline uint32_t s_vectors[32];
+inline uint32_t NVIC_GetVector(IRQn_Type irq) {
+  return s_vectors[irq];
+}
+inline void NVIC_SetVector(IRQn_Type irq, uint32_t vector) {
+  s_vectors[irq] = vector;
+}
+
+namespace mbed {
+
+/// A periodic interrupt. The host build calls the handler itself, see HostSketch::tick().
+class Ticker {
+public:
+  void attach(void (*handler)(), std::chrono::microseconds period) {
+    m_handler = handler;
+    m_period = (unsigned long)period.count();
+  }
+  void detach() {
+    m_handler = nullptr;
+  }
+
+  void (*m_handler)() = nullptr;
+  unsigned long m_period = 0;
+};
+
+/// The interrupts of a serial port.
+class SerialBase {
+public:
+  enum IrqType { RxIrq = 0, TxIrq };
+};
+
+/// A serial port. The host plays the other end: it queues the bytes received in m_received and calls the receive handler itself, and finds the bytes written in
+/// m_written.
+class UnbufferedSerial : public SerialBase {
+public:
+  UnbufferedSerial(PinName, PinName, int) {}
+
+  void attach(void (*handler)(), IrqType type) {
+    if (type == RxIrq) m_handler = handler;
+  }
+  bool readable() {
+    return !m_received.empty();
+  }
+  ssize_t read(void* buffer, size_t length) {
+    size_t count = 0;
+    for (; count < length && !m_received.empty(); ++count) {
+      static_cast<uint8_t*>(buffer)[count] = m_received.front();
+      m_received.pop_front();
+    }
+    return count;
+  }
+  ssize_t write(const void* buffer, size_t length) {
+    m_written.insert(m_written.end(), static_cast<const uint8_t*>(buffer), static_cast<const uint8_t*>(buffer) + length);
+    return length;
+  }
+
+  std::deque<uint8_t> m_received;
+  std::deque<uint8_t> m_written;
+  void (*m_handler)() = nullptr;
+};
+
+/// The watchdog, which only counts the kicks on the host.
+class Watchdog {
+public:
+  static Watchdog& get_instance() {
+    static Watchdog s_watchdog;
+    return s_watchdog;
+  }
+  bool start(uint32_t timeout) {
+    m_timeout = timeout;
+    return true;
+  }
+  void kick() {
+    ++m_kicks;
+  }
+
+  uint32_t m_timeout = 0;
+  uint32_t m_kicks = 0;
+};
+}
+
+using namespace mbed;
@@ -0,0 +1,2 @@
+#pragma once
+// Nothing of it is used by the host build of the sketch.
@@ -0,0 +1,278 @@
+// The host build of the sketch, see sketch.h.
+
+#include "sketch.h"
+
+#include <chrono>
+
+// The sketch and the modules it uses, except the input backends: the switches are the inputs set by HostSketch::setInputs().
+#include "../../arduino_keyboard/arduino_keyboard.ino"
+#include "../../arduino_keyboard/bench.cpp"
+#include "../../arduino_keyboard/control.cpp"
+#include "../../arduino_keyboard/deadline.cpp"
+#include "../../arduino_keyboard/debounce.cpp"
+#include "../../arduino_keyboard/event.cpp"
+#include "../../arduino_keyboard/flashEmulation.cpp"
+#include "../../arduino_keyboard/frameSync.cpp"
+#include "../../arduino_keyboard/heatmap.cpp"
+#include "../../arduino_keyboard/input.cpp"
+#include "../../arduino_keyboard/keyboard.cpp"
+#include "../../arduino_keyboard/keymap.cpp"
+#include "../../arduino_keyboard/perf.cpp"
+#include "../../arduino_keyboard/power.cpp"
+#include "../../arduino_keyboard/recorder.cpp"
+#include "../../arduino_keyboard/replay.cpp"
+#include "../../arduino_keyboard/settings.cpp"
+#include "../../arduino_keyboard/storage.cpp"
+#include "../../arduino_keyboard/telemetry.cpp"
+
+namespace HostSketchImpl {
+
+/// Time of the virtual clock, in micro-seconds.
+unsigned long s_now = 0;
+
+/// The inputs of the matrix read by the next scan.
+InputFrame s_inputs = 0;
+
+/// True if the time is the one of the host, see HostSketch::setRealClock().
+bool s_realClock = false;
+
+/// Start of the time of the host.
+const std::chrono::steady_clock::time_point s_start = std::chrono::steady_clock::now();
+
+/// Duration of a scan, see HostSketch::setScanTime().
+unsigned long s_scanTime = 0;
+
+/// See HostSketch::setClockListener().
+void (*s_clockListener)(unsigned long from, unsigned long to) = nullptr;
+
+/// Move the virtual clock forward by 'duration', through the clock listener.
+void advance(unsigned long duration) {
+  if (s_realClock) return;
+
+  unsigned long to = s_now + duration;
+  if (s_clockListener != nullptr) s_clockListener(s_now, to);
+  s_now = to;
+}
+
+/// The USB interrupt installed by the USB stack, that FrameSync chains: the host build has no USB stack.
+void usbInterrupt() {
+}
+}
+
+unsigned long micros() {
+  using namespace HostSketchImpl;
+
+  if (s_realClock) return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_start).count();
+  return s_now;
+}
+
+unsigned long millis() {
+  return micros() / 1000;
+}
+
+void delay(unsigned long ms) {
+  HostSketchImpl::advance(ms * 1000);
+}
+
+void wait_us(int us) {
+  HostSketchImpl::advance(us);
+}
+
+void InputBackend::init() {
+}
+
+bool InputBackend::scan(InputFrame& pressed) {
+  // The switches are read at the end of the scan.
+  HostSketchImpl::advance(HostSketchImpl::s_scanTime);
+  pressed = HostSketchImpl::s_inputs;
+  return true;
+}
+
+void InputBackend::reset() {
+}
+
+Pos InputBackend::pos(int input) {
+  // The same order as the matrix backend.
+  return Pos{ int8_t(input % NUM_LINES), int8_t(input / NUM_LINES) };
+}
+
+void HostSketch::setup() {
+  HostSketchImpl::s_now = 0;
+  ::setup();
+
+#if SOF_SYNC
+  // The vectors of the interrupts are 32 bits, too short for the address of a function of the host: FrameSync chains this one instead of the one it read.
+  FrameSyncImpl::s_usbHandler = &HostSketchImpl::usbInterrupt;
+#endif
+}
+
+unsigned long HostSketch::now() {
+  return micros();
+}
+
+void HostSketch::setRealClock(bool isReal) {
+  HostSketchImpl::s_realClock = isReal;
+}
+
+void HostSketch::setNow(unsigned long now) {
+  HostSketchImpl::s_now = now;
+}
+
+void HostSketch::reset() {
+  // The same state as at the start of replay() in arduino_keyboard.ino.
+  while (!s_events.isEmpty()) s_events.popFront();
+  for (int line = 0; line < NUM_LINES; ++line) {
+    for (int column = 0; column < NUM_COLUMNS; ++column) {
+      s_currentPressCount[line][column] = 0;
+      s_streakPressTime[line][column] = 0;
+    }
+  }
+  s_lastTypedTime = 0;
+  s_layerTracker = LayerTracker();
+  s_forcedKey = Key::NONE;
+  s_tapPos = Pos{ -1, -1 };
+  Settings::reset();
+  Debounce::reset();
+
+  std::vector<State> discarded;
+  poll(discarded);
+}
+
+bool HostSketch::addEdge(Pos pos, bool isPressed, unsigned long time) {
+  // Like the live keyboard, edges are lost while the queue is full.
+  if (s_events.isFull()) {
+    Perf::count(Perf::COUNTER_EVENTS_DROPPED);
+    return false;
+  }
+
+  Event& event = s_events.emplaceBack();
+  event.m_pos = pos;
+  event.m_isPressed = isPressed;
+  event.m_time = time;
+  return true;
+}
+
+void HostSketch::processEvents() {
+  ::processEvents(HostSketchImpl::s_now);
+}
+
+bool HostSketch::isIdle() {
+  return s_events.isEmpty() && s_tapPos.m_line < 0;
+}
+
+void HostSketch::poll(std::vector<State>& states) {
+  while (pollOnce(states)) {
+  }
+}
+
+bool HostSketch::pollOnce(std::vector<State>& states) {
+  HID_REPORT report;
+  unsigned long submitTime;
+  if (!KeyboardImpl::s_keyboard.hostPoll(report, submitTime)) return false;
+
+  if (report.data[0] == REPORT_ID_KEYBOARD) {
+    // The media key of the state is the one of the previous state, unless a media report follows.
+    State state;
+    state.m_time = submitTime;
+    state.m_data[0] = report.data[1];
+    memcpy(state.m_data + 1, report.data + 3, 6);
+    state.m_data[7] = states.empty() ? 0 : states.back().m_data[7];
+    states.push_back(state);
+  } else if (report.data[0] == REPORT_ID_VOLUME && !states.empty()) {
+    states.back().m_data[7] = report.data[1];
+  }
+  return true;
+}
+
+bool HostSketch::pollReport(std::vector<uint8_t>& report, unsigned long& submitTime) {
+  HID_REPORT raw;
+  if (!KeyboardImpl::s_keyboard.hostPoll(raw, submitTime)) return false;
+
+  report.assign(raw.data, raw.data + raw.length);
+  return true;
+}
+
+void HostSketch::startOfFrame(uint16_t number) {
+  usb_hw->sof_rd = number & USB_SOF_RD_BITS;
+  if ((usb_hw_set->inte & USB_INTE_DEV_SOF_BITS) == 0) return;
+
+  usb_hw->ints |= USB_INTS_DEV_SOF_BITS;
+#if SOF_SYNC
+  FrameSyncImpl::onUsbInterrupt();
+#endif
+  usb_hw->ints &= ~USB_INTS_DEV_SOF_BITS;
+}
+
+void HostSketch::setScanTime(unsigned long duration) {
+  HostSketchImpl::s_scanTime = duration;
+}
+
+void HostSketch::setClockListener(void (*listener)(unsigned long from, unsigned long to)) {
+  HostSketchImpl::s_clockListener = listener;
+}
+
+HostSketch::ReplayStats HostSketch::replay(const Trace& trace, int repeat, unsigned long scanPeriod, bool learnDebounce, std::vector<State>& states) {
+  using namespace HostSketchImpl;
+
+  reset();
+  ReplayStats stats = { 0, 0 };
+
+  // Each repetition starts one second after the last edge of the previous one, as in replay() of arduino_keyboard.ino.
+  unsigned long period = trace.m_edges[trace.m_numEdges - 1].m_time + 1000000;
+  unsigned long lastTime = (repeat - 1) * period + trace.m_edges[trace.m_numEdges - 1].m_time;
+  uint32_t numEdges = uint32_t(trace.m_numEdges) * repeat;
+  uint32_t next = 0;
+
+  // The virtual clock stops after the last edge once everything has been processed, or after a second if the trace leaves a key held.
+  unsigned long now = 0;
+  while (next < numEdges || (!isIdle() && now - lastTime < 1000000)) {
+    s_now = now;
+    while (next < numEdges) {
+      const TraceEdge& edge = trace.m_edges[next % trace.m_numEdges];
+      unsigned long time = (next / trace.m_numEdges) * period + edge.m_time;
+      if (time > now) break;
+      addEdge(edge.m_pos, edge.m_isPressed, time);
+      ++next;
+    }
+
+    if (!learnDebounce) {
+      for (auto& times : DebounceImpl::s_time) {
+        for (uint16_t& time : times) time = Settings::get(Settings::SETTING_DEBOUNCE_TIME);
+      }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    processEvents();
+    stats.m_cpuTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    Perf::record(Perf::HISTOGRAM_QUEUE_DEPTH, s_events.size());
+    poll(states);
+
+    // While idle, jump to the scan of the next edge.
+    now += scanPeriod;
+    if (isIdle() && next < numEdges) {
+      const TraceEdge& edge = trace.m_edges[next % trace.m_numEdges];
+      unsigned long time = (next / trace.m_numEdges) * period + edge.m_time;
+      if (time > now) now += (time - now + scanPeriod - 1) / scanPeriod * scanPeriod;
+    }
+  }
+
+  stats.m_edges = numEdges;
+  return stats;
+}
+
+uint32_t HostSketch::digest(const std::vector<State>& states, uint8_t (&last)[KEYBOARD_STATE_SIZE], uint32_t digest) {
+  for (const State& state : states) {
+    if (memcmp(state.m_data, last, sizeof(last)) == 0) continue;
+    memcpy(last, state.m_data, sizeof(last));
+    digest = Storage::crc32(state.m_data, sizeof(state.m_data), digest);
+  }
+  return digest;
+}
+
+void HostSketch::setInputs(InputFrame pressed) {
+  HostSketchImpl::s_inputs = pressed;
+}
+
+void HostSketch::loop() {
+  ::loop();
+}
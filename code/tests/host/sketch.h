@@ -0,0 +1,104 @@
+#pragma once
+// The sketch built for Linux, for the host tests and tools that run the real event processing.
+//
+// sketch.cpp compiles arduino_keyboard.ino and the modules it uses in a single translation unit, against the stubs of this directory. It is built with the tool using it:
+//   g++ -O2 -Ihost -DFLASH_EMULATION=1 -DINPUT_BACKEND=2 -o tool tool.cpp host/sketch.cpp
+// The flash is emulated in RAM, micros() is a virtual clock set by the tool, and the tool plays the USB host: it takes the reports of KeyboardHID as the host would poll
+// them. The switches are the inputs of a matrix, set by the tool.
+
+#include "../../arduino_keyboard/config.h"
+#include "../../arduino_keyboard/inputBackend.h"
+#include "../../arduino_keyboard/keyboard.h"
+#include "../../arduino_keyboard/pos.h"
+#include "../../arduino_keyboard/replay.h"
+
+#include <stdint.h>
+#include <vector>
+
+#if !FLASH_EMULATION || INPUT_BACKEND != INPUT_BACKEND_MATRIX
+#error "build with -DFLASH_EMULATION=1 -DINPUT_BACKEND=2"
+#endif
+
+namespace HostSketch {
+
+/// A keyboard state received by the USB host: the KEYBOARD_STATE_SIZE bytes of KeyboardOutput::getState(), rebuilt from the keyboard and media reports.
+struct State {
+  /// Time at which the keyboard report of the state was handed to the USB endpoint, in micro-seconds.
+  unsigned long m_time;
+
+  uint8_t m_data[KEYBOARD_STATE_SIZE];
+};
+
+/// What replay() measured.
+struct ReplayStats {
+  /// Number of edges of the trace fed to the event queue, including the ones lost because it was full.
+  uint32_t m_edges;
+
+  /// Time spent in processEvents(), in nano-seconds of the host.
+  uint64_t m_cpuTime;
+};
+
+/// Run setup() of the sketch with an empty flash, at the time 0. Must be called once before any other functions.
+void setup();
+
+/// Time returned by micros(), in micro-seconds: the virtual clock, or the time of the host with setRealClock().
+unsigned long now();
+
+/// If 'isReal', micros() and millis() return the time of the host since the start of the program instead of the virtual clock, as the benchmarks of BENCH_LOG need.
+/// delay() and wait_us() then do not move the virtual clock.
+void setRealClock(bool isReal);
+
+/// Move the virtual clock to 'now'.
+void setNow(unsigned long now);
+
+/// Put the event processing back to an idle keyboard with the default settings that has not learned anything, as replay() of REPLAY_LOG does. The reports not polled yet are
+/// discarded.
+void reset();
+
+/// Add the edge of the key at 'pos' to the event queue with its exact time 'time', as a scan would. Return false if it was lost because the queue was full.
+bool addEdge(Pos pos, bool isPressed, unsigned long time);
+
+/// Run processEvents() of the sketch at the current time.
+void processEvents();
+
+/// True if no event is waiting and no tap is being held, i.e. processEvents() has nothing to do until the next edge.
+bool isIdle();
+
+/// Poll the USB endpoint until it has no report left, and append the states received to 'states'.
+void poll(std::vector<State>& states);
+
+/// Poll the USB endpoint once, as the host does once per frame. Return false if it had no report, otherwise append the state received, if it was a keyboard report, to
+/// 'states'.
+bool pollOnce(std::vector<State>& states);
+
+/// Poll the USB endpoint once, as pollOnce() does, and give the raw report. Return false if it had no report, otherwise set 'report' to the report handed to the endpoint,
+/// starting with its report ID, and 'submitTime' to the time it was handed.
+bool pollReport(std::vector<uint8_t>& report, unsigned long& submitTime);
+
+/// Send the start of frame 'number' at the current time: the frame number register of the USB controller is updated, and its interrupt runs if it was enabled.
+void startOfFrame(uint16_t number);
+
+/// Make every scan of the switches take 'duration' micro-seconds of the virtual clock, 0 by default.
+void setScanTime(unsigned long duration);
+
+/// Call 'listener' each time the sketch moves the virtual clock, in a scan, delay() or wait_us(), with the times it moves from and to. The listener plays what happens
+/// meanwhile, e.g. the frames and the polls of the USB host, with setNow() to the time of each. The clock then moves to 'to'. Null removes the listener.
+void setClockListener(void (*listener)(unsigned long from, unsigned long to));
+
+/// Replay 'trace' 'repeat' times as replay() of REPLAY_LOG does, and append the states received to 'states'.
+///
+/// The edges are queued with their exact time, the events are processed every 'scanPeriod' micro-seconds, and the host polls the reports after each scan so that the
+/// report FIFO never merges states. Scans with nothing to process are skipped, which does not change what is typed. Unless 'learnDebounce', every key keeps the debounce
+/// time SETTING_DEBOUNCE_TIME instead of the one learned by Debounce.
+ReplayStats replay(const Trace& trace, int repeat, unsigned long scanPeriod, bool learnDebounce, std::vector<State>& states);
+
+/// Add to 'digest' the states of 'states' that differ from the one before them, the first one is compared with 'last'. 'last' is updated to the last state. This is the
+/// digest of Replay::referenceDigest() when 'last' and 'digest' start at 0.
+uint32_t digest(const std::vector<State>& states, uint8_t (&last)[KEYBOARD_STATE_SIZE], uint32_t digest);
+
+/// Set the inputs of the matrix read by the next scan, bit i is the input at InputBackend::pos(i).
+void setInputs(InputFrame pressed);
+
+/// Run loop() of the sketch once at the current time.
+void loop();
+}
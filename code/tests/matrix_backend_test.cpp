@@ -0,0 +1,206 @@
+// Test of the matrix input backend against fake pins: the setup of the pins, the scan of every switch and its position, and the reset after a scan stopped in the middle.
+//
+// Build: g++ -O2 -Ihost -DINPUT_BACKEND=2 -o matrix_backend_test matrix_backend_test.cpp
+//        g++ -O2 -Ihost -DINPUT_BACKEND=2 -DSPLIT_ROLE=1 -o matrix_primary_test matrix_backend_test.cpp
+//        g++ -O2 -Ihost -DINPUT_BACKEND=2 -DSPLIT_ROLE=2 -o matrix_secondary_test matrix_backend_test.cpp
+// Usage: matrix_backend_test
+//        matrix_primary_test
+//        matrix_secondary_test
+//
+// inputMatrix.cpp is compiled in this file with the fake pins as its GpioInOut and GpioIn, see gpio.h, for the half of the keyboard selected by SPLIT_ROLE. Prints each
+// failed check and exits with 1 if there is one.
+
+#include "../arduino_keyboard/config.h"
+#include "check.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#if INPUT_BACKEND != INPUT_BACKEND_MATRIX
+#error "INPUT_BACKEND must be the matrix backend"
+#endif
+
+/// The pins of the micro-controller, as named by mbed.
+enum PinName { p2 = 2, p3, p4, p5, p6, p10 = 10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21 };
+
+/// The pull resistor of a pin, as named by mbed.
+enum PinMode { PullNone = 0, PullUp, PullDown };
+
+/// The wires of the pins and the switches of the matrix between them. They outlive the fake pins, which only hold their pin number.
+namespace FakeWires {
+
+static const int NUM_PINS = 32;
+
+/// State of each pin: created, driven by the micro-controller and the level it drives, and its pull resistor.
+bool s_isCreated[NUM_PINS];
+bool s_isOutput[NUM_PINS];
+int s_level[NUM_PINS];
+PinMode s_mode[NUM_PINS];
+
+/// The switches that are pressed, each one connects the pins of its line and its column.
+bool s_isClosed[NUM_LINES][NUM_COLUMNS];
+
+/// Pins of the lines and of the columns, from config.h.
+const PinName s_linePins[] = { MATRIX_LINE_PINS };
+const PinName s_columnPins[] = { MATRIX_COLUMN_PINS };
+
+/// Most lines driven at the same time, and the time waited, in micro-seconds.
+int s_mostDriven = 0;
+unsigned long s_waited = 0;
+
+/// Number of lines driven.
+int driven() {
+  int count = 0;
+  for (PinName pin : s_linePins) count += s_isOutput[pin];
+  return count;
+}
+
+/// Level of the pin of 'column': low if a pressed switch connects it to a line driven low, else the one of its pull resistor.
+int columnLevel(int column) {
+  for (int line = 0; line < NUM_LINES; ++line) {
+    PinName pin = s_linePins[line];
+    if (s_isClosed[line][column] && s_isOutput[pin] && s_level[pin] == 0) return 0;
+  }
+  return s_mode[s_columnPins[column]] == PullUp ? 1 : 0;
+}
+}
+
+/// A pin with the interface of mbed's DigitalInOut.
+class FakeInOut {
+public:
+  explicit FakeInOut(PinName pin) : m_pin(pin) {
+    FakeWires::s_isCreated[pin] = true;
+  }
+
+  void input() {
+    FakeWires::s_isOutput[m_pin] = false;
+  }
+
+  void output() {
+    FakeWires::s_isOutput[m_pin] = true;
+    int driven = FakeWires::driven();
+    if (driven > FakeWires::s_mostDriven) FakeWires::s_mostDriven = driven;
+  }
+
+  void mode(PinMode mode) {
+    FakeWires::s_mode[m_pin] = mode;
+  }
+
+  void write(int level) {
+    FakeWires::s_level[m_pin] = level;
+  }
+
+  int read() {
+    return FakeWires::s_isOutput[m_pin] ? FakeWires::s_level[m_pin] : 1;
+  }
+
+private:
+  PinName m_pin;
+};
+
+/// A pin with the interface of mbed's DigitalIn, only used for the columns.
+class FakeIn {
+public:
+  FakeIn(PinName pin, PinMode mode) : m_pin(pin) {
+    FakeWires::s_isCreated[pin] = true;
+    FakeWires::s_mode[pin] = mode;
+  }
+
+  int read() {
+    for (int column = 0; column < NUM_COLUMNS; ++column) {
+      if (FakeWires::s_columnPins[column] == m_pin) return FakeWires::columnLevel(column);
+    }
+    return 1;
+  }
+
+private:
+  PinName m_pin;
+};
+
+void wait_us(int us) {
+  FakeWires::s_waited += us;
+}
+
+#define GPIO_IN_OUT FakeInOut
+#define GPIO_IN FakeIn
+
+#include "../arduino_keyboard/inputMatrix.cpp"
+
+/// Return true if 'input' is read by this half of the keyboard.
+static bool isLocal(int input) {
+  return input >= FIRST_LOCAL_INPUT && input < END_LOCAL_INPUT;
+}
+
+static void testInit() {
+  using namespace FakeWires;
+  InputBackend::init();
+
+  // The lines float until they are read, the columns of this half have pull-ups and the others are left alone.
+  for (PinName pin : s_linePins) {
+    CHECK(s_isCreated[pin] && !s_isOutput[pin] && s_mode[pin] == PullNone);
+  }
+  for (int column = 0; column < NUM_COLUMNS; ++column) {
+    PinName pin = s_columnPins[column];
+    bool isLocalColumn = isLocal(column * NUM_LINES);
+    CHECK(s_isCreated[pin] == isLocalColumn);
+    CHECK(!isLocalColumn || s_mode[pin] == PullUp);
+  }
+}
+
+static void testScan() {
+  using namespace FakeWires;
+  InputFrame pressed = ~InputFrame(0);
+  s_waited = 0;
+  CHECK(InputBackend::scan(pressed));
+  CHECK(pressed == 0);
+
+  // Each line waits to settle, is the only one driven, and floats again after the scan.
+  CHECK(s_waited == NUM_LINES * MATRIX_SETTLE_TIME);
+  CHECK(s_mostDriven == 1);
+  CHECK(driven() == 0);
+
+  // Each switch alone sets the input whose position is its own, if it is on this half.
+  for (int line = 0; line < NUM_LINES; ++line) {
+    for (int column = 0; column < NUM_COLUMNS; ++column) {
+      s_isClosed[line][column] = true;
+      CHECK(InputBackend::scan(pressed));
+      s_isClosed[line][column] = false;
+
+      int input = column * NUM_LINES + line;
+      CHECK(pressed == (isLocal(input) ? InputFrame(1) << input : 0));
+      CHECK(InputBackend::pos(input) == (Pos{ int8_t(line), int8_t(column) }));
+    }
+  }
+
+  // Two switches of a column on driven lines would short them, the lines are driven one at a time so they are read apart.
+  int column = FIRST_LOCAL_INPUT / NUM_LINES;
+  s_isClosed[0][column] = true;
+  s_isClosed[NUM_LINES - 1][column] = true;
+  CHECK(InputBackend::scan(pressed));
+  CHECK(pressed == ((InputFrame(1) << (column * NUM_LINES)) | (InputFrame(1) << (column * NUM_LINES + NUM_LINES - 1))));
+  CHECK(s_mostDriven == 1);
+  s_isClosed[0][column] = false;
+  s_isClosed[NUM_LINES - 1][column] = false;
+}
+
+static void testReset() {
+  using namespace FakeWires;
+
+  // A scan stopped while a line was driven leaves it driven, which would short it with the line read next: the reset lets it float again.
+  InputMatrixImpl::s_lines[2]->output();
+  InputMatrixImpl::s_lines[2]->write(0);
+  InputBackend::reset();
+  CHECK(driven() == 0);
+
+  InputFrame pressed = ~InputFrame(0);
+  CHECK(InputBackend::scan(pressed));
+  CHECK(pressed == 0);
+}
+
+int main() {
+  testInit();
+  testScan();
+  testReset();
+
+  return checkResult();
+}
@@ -0,0 +1,294 @@
+// Test of the MCP input backends against a fake I2C bus: the setup of the chips, the scan, and the recovery from a chip that does not answer.
+//
+// Build: g++ -O2 -Ihost -DINPUT_BACKEND=0 -o mcp23008_backend_test mcp_backend_test.cpp
+//        g++ -O2 -Ihost -DINPUT_BACKEND=1 -o mcp23017_backend_test mcp_backend_test.cpp
+// Usage: mcp23008_backend_test
+//        mcp23017_backend_test
+//
+// The backend selected by INPUT_BACKEND is compiled in this file with the fake bus as its I2cBus, for the board of VERSION. Prints each failed check and exits with 1 if there is one.
+
+#include "../arduino_keyboard/config.h"
+#include "check.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/// The pins of the bus, as named by mbed.
+enum PinName { p8 = 8, p9 = 9 };
+
+/// Called by the drivers on a fatal error, like mbed's error().
+static void error(const char* message) {
+  printf("error: %s", message);
+  ++s_failures;
+}
+
+/// The wires of the bus and the registers of the chips on it. They outlive the FakeI2c handles, which the backends delete and create again to reset the bus.
+namespace FakeWires {
+
+/// Registers of the chip at each address, and the register the next byte goes to or comes from.
+uint8_t s_registers[8][32];
+uint8_t s_pointer[8];
+
+/// Registers that read the pins, writing them goes to the output latch instead.
+bool s_isPinRegister[32];
+
+/// Number of the next transfers to the chip at each address that are not acknowledged.
+int s_nacks[8];
+
+/// Number of handles created, of read transfers and of bytes read.
+int s_created = 0;
+int s_reads = 0;
+int s_readBytes = 0;
+
+/// Clock of the bus, in Hz.
+int s_frequency = 0;
+
+/// Index of the chip at the 8 bits I2C address 'address', or -1 if it is not an MCP230xx.
+int chip(int address) {
+  return (address >> 1 & 0xF8) == 0x20 ? address >> 1 & 7 : -1;
+}
+}
+
+/// A bus with the interface of mbed's I2C, where MCP230xx chips with IOCON.BANK = 0 and IOCON.SEQOP = 0 answer at every address.
+class FakeI2c {
+public:
+  FakeI2c(PinName, PinName) {
+    ++FakeWires::s_created;
+  }
+
+  void frequency(int hz) {
+    FakeWires::s_frequency = hz;
+  }
+
+  /// Set the register pointer to the first byte, and write the next ones from there. Return 0 if the chip acknowledged.
+  int write(int address, const char* data, int length, bool = false) {
+    using namespace FakeWires;
+    int index = chip(address);
+    if (index < 0 || length < 1 || s_nacks[index]-- > 0) return 1;
+
+    s_pointer[index] = uint8_t(data[0]);
+    for (int i = 1; i < length; ++i) {
+      int reg = s_pointer[index]++ % 32;
+      if (!s_isPinRegister[reg]) s_registers[index][reg] = uint8_t(data[i]);
+    }
+    return 0;
+  }
+
+  /// Read 'length' bytes from the register pointer. Return 0 if the chip acknowledged.
+  int read(int address, char* data, int length, bool = false) {
+    using namespace FakeWires;
+    int index = chip(address);
+    if (index < 0 || s_nacks[index]-- > 0) return 1;
+
+    ++s_reads;
+    s_readBytes += length;
+    for (int i = 0; i < length; ++i) {
+      data[i] = char(s_registers[index][s_pointer[index]++ % 32]);
+    }
+    return 0;
+  }
+};
+
+#define I2C_BUS FakeI2c
+
+#if INPUT_BACKEND == INPUT_BACKEND_MCP23008
+#include "../arduino_keyboard/MCP23008.cpp"
+#include "../arduino_keyboard/inputMcp23008.cpp"
+
+/// Inputs of each chip, and its registers used by the backend. There is one register per 8 pins.
+static const int PINS_PER_CHIP = 8;
+static const uint8_t REGISTER_IODIR = 0x00;
+static const uint8_t REGISTER_GPPU = 0x06;
+static const uint8_t REGISTER_GPIO = 0x09;
+static const uint8_t (&s_addresses)[NUM_MCP_PORTS] = s_board.m_mcp23008Addresses;
+#elif INPUT_BACKEND == INPUT_BACKEND_MCP23017
+#include "../arduino_keyboard/MCP23017.cpp"
+#include "../arduino_keyboard/inputMcp23017.cpp"
+
+static const int PINS_PER_CHIP = 16;
+static const uint8_t REGISTER_IODIR = 0x00;
+static const uint8_t REGISTER_GPPU = 0x0C;
+static const uint8_t REGISTER_GPIO = 0x12;
+static const uint8_t (&s_addresses)[NUM_MCP_PORTS / 2] = s_board.m_mcp23017Addresses;
+#else
+#error "INPUT_BACKEND must be one of the MCP backends"
+#endif
+
+#include "../arduino_keyboard/i2cClock.cpp"
+
+static const int NUM_CHIPS = NUM_INPUTS / PINS_PER_CHIP;
+
+// The globals of the firmware used by the backend, without the rest of their modules.
+namespace PerfImpl {
+uint32_t s_counters[Perf::NUM_COUNTERS];
+uint32_t s_histograms[Perf::NUM_HISTOGRAMS][PERF_HISTOGRAM_BUCKETS];
+uint32_t s_maximums[Perf::NUM_HISTOGRAMS];
+}
+
+namespace RecorderImpl {
+Ring s_ring;
+}
+
+namespace SettingsImpl {
+uint32_t s_values[Settings::NUM_SETTINGS];
+}
+
+namespace DeadlineImpl {
+volatile Deadline::Stage s_stage;
+volatile int8_t s_chip;
+}
+
+unsigned long micros() {
+  return 0;
+}
+
+/// The register 'reg' of the chip 'chip', with one register per 8 pins.
+static uint8_t& chipRegister(int chip, uint8_t reg, int port = 0) {
+  return FakeWires::s_registers[s_addresses[chip]][reg + port];
+}
+
+/// Press or release the switch on 'input'. The pins have pull-ups, a pressed switch pulls its pin low.
+static void setInput(int input, bool pressed) {
+  int pin = input % PINS_PER_CHIP;
+  uint8_t& gpio = chipRegister(input / PINS_PER_CHIP, REGISTER_GPIO, pin / 8);
+  if (pressed) {
+    gpio &= ~(1 << pin % 8);
+  } else {
+    gpio |= 1 << pin % 8;
+  }
+}
+
+/// Power on the chips, with every switch released.
+static void powerOn() {
+  memset(FakeWires::s_registers, 0, sizeof(FakeWires::s_registers));
+  for (int port = 0; port < PINS_PER_CHIP / 8; ++port) {
+    FakeWires::s_isPinRegister[REGISTER_GPIO + port] = true;
+  }
+  for (int input = 0; input < NUM_INPUTS; ++input) {
+    setInput(input, false);
+  }
+}
+
+static void testInit() {
+  powerOn();
+  SettingsImpl::s_values[Settings::SETTING_I2C_FREQUENCY] = 2 * s_board.m_i2cFrequency;
+  InputBackend::init();
+
+  // The clock is the one of the board if the setting is above it, and every pin is an input with a pull-up.
+  CHECK(FakeWires::s_created == 1);
+  CHECK(FakeWires::s_frequency == int(s_board.m_i2cFrequency));
+  for (int chip = 0; chip < NUM_CHIPS; ++chip) {
+    for (int port = 0; port < PINS_PER_CHIP / 8; ++port) {
+      CHECK(chipRegister(chip, REGISTER_IODIR, port) == 0xFF);
+      CHECK(chipRegister(chip, REGISTER_GPPU, port) == 0xFF);
+    }
+  }
+}
+
+static void testScan() {
+  InputFrame pressed = ~InputFrame(0);
+  CHECK(InputBackend::scan(pressed));
+  CHECK(pressed == 0);
+
+  // One transfer per chip, reading all of its pins. On the MCP23017 this includes a pin of port B.
+  int reads = FakeWires::s_reads;
+  int readBytes = FakeWires::s_readBytes;
+  setInput(3, true);
+  setInput(PINS_PER_CHIP + 10 % PINS_PER_CHIP, true);
+  setInput(NUM_INPUTS - 1, true);
+  CHECK(InputBackend::scan(pressed));
+  CHECK(pressed == ((InputFrame(1) << 3) | (InputFrame(1) << (PINS_PER_CHIP + 10 % PINS_PER_CHIP)) | (InputFrame(1) << (NUM_INPUTS - 1))));
+  CHECK(FakeWires::s_reads - reads == NUM_CHIPS);
+  CHECK(FakeWires::s_readBytes - readBytes == NUM_CHIPS * PINS_PER_CHIP / 8);
+
+  setInput(3, false);
+  setInput(PINS_PER_CHIP + 10 % PINS_PER_CHIP, false);
+  setInput(NUM_INPUTS - 1, false);
+}
+
+static void testError() {
+  // The chip lost its configuration and does not acknowledge the next transfer.
+  const int failing = NUM_CHIPS - 1;
+  chipRegister(failing, REGISTER_IODIR) = 0;
+  FakeWires::s_nacks[s_addresses[failing]] = 1;
+  int created = FakeWires::s_created;
+  uint32_t errors = Perf::counter(Perf::COUNTER_I2C_ERRORS);
+  uint32_t entries = RecorderImpl::s_ring.m_head;
+
+  InputFrame pressed;
+  CHECK(!InputBackend::scan(pressed));
+  CHECK(DeadlineImpl::s_chip == failing);
+
+  // The bus is created again, the error is counted by the clock and recorded, and the chips are set up again.
+  CHECK(FakeWires::s_created - created == 11);
+  CHECK(Perf::counter(Perf::COUNTER_I2C_ERRORS) == errors + 1);
+  CHECK(RecorderImpl::s_ring.m_head == entries + 1);
+  const Recorder::Entry& entry = RecorderImpl::s_ring.m_entries[entries % RECORDER_SIZE];
+  CHECK(entry.m_type == Recorder::ENTRY_I2C_RESET);
+  CHECK(entry.m_key == failing);
+  CHECK(chipRegister(failing, REGISTER_IODIR) == 0xFF);
+
+  // The next scan works.
+  setInput(0, true);
+  CHECK(InputBackend::scan(pressed));
+  CHECK(pressed == 1);
+  setInput(0, false);
+}
+
+static void testSlowdown() {
+  // A chip failing I2C_ERROR_THRESHOLD reads in a window steps the clock down, the bus is created again at the lower clock.
+  int frequency = FakeWires::s_frequency;
+  InputFrame pressed;
+  for (int i = 0; i < I2C_ERROR_THRESHOLD; ++i) {
+    FakeWires::s_nacks[s_addresses[0]] = 1;
+    CHECK(!InputBackend::scan(pressed));
+  }
+  CHECK(FakeWires::s_frequency < frequency);
+  CHECK(FakeWires::s_frequency == int(I2cClock::frequency()));
+  CHECK(InputBackend::scan(pressed));
+  CHECK(pressed == 0);
+}
+
+/// Scan without errors until the end of the current window of I2cClock.
+static void finishWindow() {
+  InputFrame pressed;
+  do {
+    CHECK(InputBackend::scan(pressed));
+  } while (I2cClockImpl::s_scans != 0);
+}
+
+static void testProbe() {
+  // After the slowdown, the clock steps up again once I2C_PROBE_WINDOWS windows were clean.
+  int slow = FakeWires::s_frequency;
+  for (int i = 0; i < I2C_PROBE_WINDOWS - 1; ++i) finishWindow();
+  CHECK(FakeWires::s_frequency == slow);
+  finishWindow();
+  CHECK(FakeWires::s_frequency > slow);
+
+  // A single error in the first window at the new clock, below I2C_ERROR_THRESHOLD, undoes the step up.
+  FakeWires::s_nacks[s_addresses[0]] = 1;
+  InputFrame pressed;
+  CHECK(!InputBackend::scan(pressed));
+  finishWindow();
+  CHECK(FakeWires::s_frequency == slow);
+
+  // The next step up waits twice as long, and is kept after a window without errors.
+  for (int i = 0; i < 2 * I2C_PROBE_WINDOWS - 1; ++i) finishWindow();
+  CHECK(FakeWires::s_frequency == slow);
+  finishWindow();
+  CHECK(FakeWires::s_frequency > slow);
+  finishWindow();
+  CHECK(FakeWires::s_frequency > slow);
+  CHECK(FakeWires::s_frequency == int(I2cClock::frequency()));
+}
+
+int main() {
+  testInit();
+  testScan();
+  testError();
+  testSlowdown();
+  testProbe();
+
+  return checkResult();
+}
@@ -0,0 +1,356 @@
+// Differential test of the event processing of the sketch against a frozen copy of the event processing of the first version of loop().
+//
+// Build: g++ -O2 -pthread -Ihost -DFLASH_EMULATION=1 -DINPUT_BACKEND=2 -o replay_diff replay_diff.cpp host/sketch.cpp
+// Usage: replay_diff [options]
+//
+// Options:
+//   --seeds <n>       Number of random traces (REPLAY_FUZZ_TRACES by default).
+//   --first-seed <n>  Seed of the first random trace (1 by default).
+//   --edges <n>       Maximum number of edges of each random trace (REPLAY_FUZZ_EDGES by default).
+//   --learn-debounce  Let the sketch learn the debounce time of each key, see Debounce. The baseline debounces every key for DEBOUNCE_TIME, so this also shows where
+//                     the learned debounce types something else.
+//
+// The reference traces of Replay, then the random traces of Replay::generate(), are replayed through the host build of the sketch and through BaselineLoop below, each
+// trace on both at the same time on two threads. The keyboard states received by the USB host must be the same, in the same order: only their timing may differ, see
+// BaselineLoop. The debounce time of every key is kept at its default in the sketch unless --learn-debounce is given. The first state that differs is printed with its
+// time and the index of its trace, and the test exits with 1.
+//
+// The digests of the states of the reference traces, and of the random traces with the default options, are also checked against Replay::referenceDigest() and
+// Replay::fuzzDigest(), as REPLAY_LOG does on the keyboard.
+
+#include "host/sketch.h"
+#include "../arduino_keyboard/keymap.h"
+
+#include <chrono>
+#include <deque>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#if TYPING_STREAK_TIME != 0
+#error "BaselineLoop has no typing streak, build without TYPING_STREAK_TIME"
+#endif
+
+using HostSketch::State;
+
+/// The event processing of loop() in the first version of arduino_keyboard.ino, frozen as the reference of this test: do not change it along with the sketch.
+///
+/// Only what feeds it changed: the edges come from a trace with their exact time, as for the sketch, and the states are recorded instead of sent. The tap of an "on release"
+/// key still blocks for KEY_PRESS_LENGTH, during which the baseline did not scan: the edges of that time are queued with their exact time anyway, so that the states only
+/// differ by their timing. The baseline lost them, it was a bug and not something to keep.
+class BaselineLoop {
+public:
+  explicit BaselineLoop(const KeymapTables& tables)
+    : m_tables(tables) {
+  }
+
+  /// Replay 'trace' as HostSketch::replay() does, from an idle keyboard, and append the states sent to 'states'.
+  void replay(const Trace& trace, unsigned long scanPeriod, std::vector<State>& states) {
+    m_states = &states;
+    unsigned long lastTime = trace.m_edges[trace.m_numEdges - 1].m_time;
+    uint16_t next = 0;
+
+    unsigned long now = 0;
+    while (next < trace.m_numEdges || (!m_events.empty() && now - lastTime < 1000000)) {
+      m_clock = now;
+      while (next < trace.m_numEdges && trace.m_edges[next].m_time <= now) {
+        const TraceEdge& edge = trace.m_edges[next++];
+        m_events.push_back(QueuedEvent{ edge.m_pos, edge.m_isPressed, edge.m_time, false });
+      }
+
+      process(now);
+
+      // The next scan once the taps are over. While idle, jump to the scan of the next edge.
+      now += scanPeriod;
+      if (m_clock > now) now += (m_clock - now + scanPeriod - 1) / scanPeriod * scanPeriod;
+      if (m_events.empty() && next < trace.m_numEdges && trace.m_edges[next].m_time > now) {
+        now += (trace.m_edges[next].m_time - now + scanPeriod - 1) / scanPeriod * scanPeriod;
+      }
+    }
+  }
+
+private:
+  struct QueuedEvent {
+    Pos m_pos;
+    bool m_isPressed;
+    unsigned long m_time;
+    bool m_deleted;
+  };
+
+  /// Remove the event at the front of the queue, and the removed events that follow it.
+  void popFront() {
+    m_events.pop_front();
+    while (!m_events.empty() && m_events.front().m_deleted) m_events.pop_front();
+  }
+
+  void process(unsigned long current) {
+    while (!m_events.empty()) {
+      const QueuedEvent event = m_events.front();
+
+      // Debouncing.
+      {
+        if (current - event.m_time < DEBOUNCE_TIME) break;
+
+        bool debounced = false;
+        for (size_t it = 0; it < m_events.size(); ++it) {
+          if (m_events[it].m_deleted) continue;
+          if (m_events[it].m_time - event.m_time > DEBOUNCE_TIME) break;
+
+          if (m_events[it].m_pos == event.m_pos && m_events[it].m_isPressed != event.m_isPressed) {
+            m_events[it].m_deleted = true;
+            popFront();
+            debounced = true;
+            break;
+          }
+        }
+        if (debounced) continue;
+      }
+
+      // "On release" keys.
+      if (m_tables.m_onRelease[event.m_pos.m_line][event.m_pos.m_column] && event.m_isPressed) {
+        bool foundRelease = false;
+        size_t releaseIndex = 0;
+        bool foundAnotherPress = false;
+        for (size_t it = 1; it < m_events.size(); ++it) {
+          if (m_events[it].m_deleted) continue;
+          if (m_events[it].m_pos == event.m_pos && !m_events[it].m_isPressed) {
+            foundRelease = true;
+            releaseIndex = it;
+            break;
+          }
+          if (m_events[it].m_pos != event.m_pos && m_events[it].m_isPressed) {
+            foundAnotherPress = true;
+            break;
+          }
+        }
+
+        if (!foundAnotherPress) {
+          if (!foundRelease) break;
+
+          if (m_events[releaseIndex].m_time - event.m_time < MAX_HOLD_TIME) {
+            m_pressCount[event.m_pos.m_line][event.m_pos.m_column]++;
+            send();
+
+            m_clock += KEY_PRESS_LENGTH * 1000UL;
+
+            m_pressCount[event.m_pos.m_line][event.m_pos.m_column]--;
+            send();
+          }
+
+          m_events[releaseIndex].m_deleted = true;
+          popFront();
+          continue;
+        }
+      }
+
+      // Press count.
+      uint8_t& pressCount = m_pressCount[event.m_pos.m_line][event.m_pos.m_column];
+      if (event.m_isPressed) {
+        pressCount++;
+      } else {
+        if (pressCount > 0) pressCount--;
+      }
+
+      // Forced key.
+      Key forced = m_tables.m_layers[m_layerMask][event.m_pos.m_line][event.m_pos.m_column].m_forcedKey;
+      if (forced != Key::NONE) m_forcedKey = forced;
+
+      // Layers.
+      LayerBit layer = m_tables.m_layerKeys[event.m_pos.m_line][event.m_pos.m_column];
+      if (layer != LAYER_NONE) {
+        m_layerCount[layer - 1] += event.m_isPressed ? +1 : -1;
+        m_layerMask = 0;
+        for (int i = 0; i < 8; ++i) {
+          if (m_layerCount[i] > 0) m_layerMask |= 1 << i;
+        }
+
+        for (int line = 0; line < NUM_LINES; ++line) {
+          for (int column = 0; column < NUM_COLUMNS; ++column) {
+            if (m_tables.m_immuneToReset[line][column]) continue;
+            m_pressCount[line][column] = 0;
+          }
+        }
+        m_forcedKey = Key::NONE;
+      }
+
+      send();
+      popFront();
+    }
+  }
+
+  /// sendCurrentKeyPress() of the baseline.
+  void send() {
+    State state;
+    state.m_time = m_clock;
+    memset(state.m_data, 0, sizeof(state.m_data));
+    m_nextKey = 0;
+
+    for (int line = 0; line < NUM_LINES; ++line) {
+      for (int column = 0; column < NUM_COLUMNS; ++column) {
+        if (m_pressCount[line][column] > 0) add(state, m_tables.m_layers[m_layerMask][line][column]);
+      }
+    }
+    if (m_forcedKey != Key::NONE) add(state, K(m_forcedKey));
+
+    // The shift hack.
+    if (state.m_data[0] == 0 && m_nextKey == 0 && m_layerMask == 1) add(state, K(Key::SHIFT));
+
+    m_states->push_back(state);
+  }
+
+  /// addK() and KeyboardOutput::add() of the baseline.
+  void add(State& state, const K& keys) {
+    if (keys.m_key0 != Key::NONE) add(state, keys.m_key0);
+    if (keys.m_key1 != Key::NONE) add(state, keys.m_key1);
+    if (keys.m_mediaKey != MediaKey::NONE) state.m_data[7] = uint8_t(keys.m_mediaKey);
+  }
+
+  void add(State& state, Key key) {
+    if (key >= Key::CTRL && key <= Key::RWIN) {
+      state.m_data[0] |= 1 << (uint8_t(key) - uint8_t(Key::CTRL));
+    } else if (m_nextKey < 6) {
+      state.m_data[1 + m_nextKey++] = uint8_t(key);
+    }
+  }
+
+  const KeymapTables& m_tables;
+  std::deque<QueuedEvent> m_events;
+  uint8_t m_pressCount[NUM_LINES][NUM_COLUMNS] = {};
+  int8_t m_layerCount[8] = {};
+  uint8_t m_layerMask = 0;
+  Key m_forcedKey = Key::NONE;
+  int m_nextKey = 0;
+  unsigned long m_clock = 0;
+  std::vector<State>* m_states = nullptr;
+};
+
+/// Remove from 'states' the states equal to the one before them: the USB host cannot see them.
+static std::vector<State> distinct(const std::vector<State>& states) {
+  std::vector<State> result;
+  uint8_t last[KEYBOARD_STATE_SIZE] = {};
+  for (const State& state : states) {
+    if (memcmp(state.m_data, last, sizeof(last)) == 0) continue;
+    memcpy(last, state.m_data, sizeof(last));
+    result.push_back(state);
+  }
+  return result;
+}
+
+static void printState(const char* name, const std::vector<State>& states, size_t index) {
+  printf("  %-9s ", name);
+  if (index >= states.size()) {
+    printf("no more states\n");
+    return;
+  }
+  printf("at %lu.%03lu ms:", states[index].m_time / 1000, states[index].m_time % 1000);
+  for (uint8_t byte : states[index].m_data) printf(" %02X", byte);
+  printf("\n");
+}
+
+/// Replay 'trace' on the sketch and on the baseline. Return false, after printing the first state that differs, if they do not send the same states.
+static bool compare(int index, const Trace& trace, int repeat, bool learnDebounce) {
+  // The baseline replays the repetitions as a single trace.
+  std::vector<TraceEdge> edges;
+  unsigned long period = trace.m_edges[trace.m_numEdges - 1].m_time + 1000000;
+  for (int i = 0; i < repeat; ++i) {
+    for (int edge = 0; edge < trace.m_numEdges; ++edge) {
+      edges.push_back(trace.m_edges[edge]);
+      edges.back().m_time += i * period;
+    }
+  }
+
+  std::vector<State> reference;
+  std::thread baseline([&]() {
+    BaselineLoop loop(Keymap::tables());
+    loop.replay(Trace{ trace.m_name, edges.data(), uint16_t(edges.size()) }, REPLAY_SCAN_PERIOD, reference);
+  });
+  std::vector<State> states;
+  HostSketch::replay(trace, repeat, REPLAY_SCAN_PERIOD, learnDebounce, states);
+  baseline.join();
+
+  std::vector<State> expected = distinct(reference);
+  std::vector<State> actual = distinct(states);
+  size_t state = 0;
+  while (state < expected.size() && state < actual.size() && memcmp(expected[state].m_data, actual[state].m_data, KEYBOARD_STATE_SIZE) == 0) ++state;
+  if (state == expected.size() && state == actual.size()) return true;
+
+  printf("trace %d (%s): state %zu differs\n", index, trace.m_name, state);
+  printState("baseline", expected, state);
+  printState("sketch", actual, state);
+  return false;
+}
+
+int main(int argc, char** argv) {
+  uint32_t numSeeds = REPLAY_FUZZ_TRACES;
+  uint32_t firstSeed = 1;
+  uint16_t maxEdges = REPLAY_FUZZ_EDGES;
+  bool learnDebounce = false;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--seeds") == 0 && i + 1 < argc) {
+      numSeeds = strtoul(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--first-seed") == 0 && i + 1 < argc) {
+      firstSeed = strtoul(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--edges") == 0 && i + 1 < argc) {
+      maxEdges = uint16_t(strtoul(argv[++i], nullptr, 0));
+    } else if (strcmp(argv[i], "--learn-debounce") == 0) {
+      learnDebounce = true;
+    } else {
+      fprintf(stderr, "usage: %s [--seeds <n>] [--first-seed <n>] [--edges <n>] [--learn-debounce]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  HostSketch::setup();
+  auto start = std::chrono::steady_clock::now();
+  int failures = 0;
+  uint64_t numEdges = 0;
+
+  for (int id = 0; id < Replay::NUM_TRACES; ++id) {
+    const Trace& trace = Replay::trace(Replay::TraceId(id));
+    if (!compare(id, trace, REPLAY_REPEAT, learnDebounce)) ++failures;
+    numEdges += uint64_t(trace.m_numEdges) * REPLAY_REPEAT;
+
+    // The digests are those of the keyboard, which learns the debounce times.
+    std::vector<State> states;
+    HostSketch::replay(trace, REPLAY_REPEAT, REPLAY_SCAN_PERIOD, true, states);
+    uint8_t last[KEYBOARD_STATE_SIZE] = {};
+    uint32_t digest = HostSketch::digest(states, last, 0);
+    uint32_t expected = Replay::referenceDigest(Replay::TraceId(id));
+    printf("trace %d (%s): digest=%08X %s\n", id, trace.m_name, digest, digest == expected ? "ok" : "DIFFERS");
+    if (digest != expected) ++failures;
+  }
+
+  std::vector<TraceEdge> edges(maxEdges);
+  for (uint32_t seed = firstSeed; seed < firstSeed + numSeeds; ++seed) {
+    uint16_t count = Replay::generate(seed, edges.data(), maxEdges);
+    char name[32];
+    snprintf(name, sizeof(name), "fuzz seed %u", seed);
+    if (!compare(Replay::NUM_TRACES + (seed - firstSeed), Trace{ name, edges.data(), count }, 1, learnDebounce)) ++failures;
+    numEdges += count;
+  }
+
+  // The states of the default random traces are summarized in a single digest, as in replayAll() of arduino_keyboard.ino.
+  if (firstSeed == 1 && numSeeds == REPLAY_FUZZ_TRACES && maxEdges == REPLAY_FUZZ_EDGES) {
+    uint8_t last[KEYBOARD_STATE_SIZE] = {};
+    uint32_t digest = 0;
+    for (uint32_t seed = 1; seed <= REPLAY_FUZZ_TRACES; ++seed) {
+      uint16_t count = Replay::generate(seed, edges.data(), maxEdges);
+      std::vector<State> states;
+      HostSketch::replay(Trace{ "fuzz", edges.data(), count }, 1, REPLAY_SCAN_PERIOD, true, states);
+      digest = HostSketch::digest(states, last, digest);
+    }
+    printf("fuzz: digest=%08X %s\n", digest, digest == Replay::fuzzDigest() ? "ok" : "DIFFERS");
+    if (digest != Replay::fuzzDigest()) ++failures;
+  }
+
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  printf("%u traces, %llu edges in %.1f s, %.0f edges/s\n", Replay::NUM_TRACES + numSeeds, (unsigned long long)numEdges, seconds, numEdges / seconds);
+  if (failures > 0) {
+    printf("%d traces differ\n", failures);
+    return 1;
+  }
+  printf("all traces match\n");
+  return 0;
+}
@@ -0,0 +1,223 @@
+// Test of the merging of the keyboard states in the report FIFO, see ReportFifo.
+//
+// Build: g++ -O2 -o report_fifo_test report_fifo_test.cpp
+// Usage: report_fifo_test
+//
+// Prints each failed check and exits with 1 if there is one.
+
+#include "../arduino_keyboard/reportFifo.h"
+#include "check.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static const uint8_t KEY_A = 4;
+static const uint8_t KEY_B = 5;
+static const uint8_t KEY_C = 6;
+static const uint8_t KEY_D = 7;
+static const uint8_t MOD_SHIFT = 0x02;
+static const uint8_t MEDIA_MUTE = 0xE2;
+
+/// A state with the given modifiers, media key and up to 3 keys.
+static PendingState state(uint8_t modifiers, uint8_t mediaKey, uint8_t key0 = 0, uint8_t key1 = 0, uint8_t key2 = 0) {
+  PendingState result;
+  memset(&result, 0, sizeof(result));
+  result.m_modifiers = modifiers;
+  result.m_mediaKey = mediaKey;
+  result.m_keys[0] = key0;
+  result.m_keys[1] = key1;
+  result.m_keys[2] = key2;
+  return result;
+}
+
+static bool operator==(const PendingState& a, const PendingState& b) {
+  return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+typedef ReportFifo<4> Fifo;
+
+/// Remove every state of 'fifo', in order.
+static std::vector<PendingState> drain(Fifo& fifo) {
+  std::vector<PendingState> states;
+  while (fifo.count() > 0) {
+    states.push_back(fifo.front());
+    fifo.pop();
+  }
+  return states;
+}
+
+static void testCanMerge() {
+  PendingState none = state(0, 0);
+
+  // A modifier is never sent with a key pressed before it, or without it.
+  CHECK(!Fifo::canMerge(none, state(0, 0, KEY_A), state(MOD_SHIFT, 0, KEY_A)));
+  CHECK(!Fifo::canMerge(state(MOD_SHIFT, 0), state(MOD_SHIFT, 0, KEY_A), state(0, 0, KEY_A)));
+
+  // A key released and pressed again, or pressed and released, is never lost.
+  CHECK(!Fifo::canMerge(state(0, 0, KEY_A), none, state(0, 0, KEY_A)));
+  CHECK(!Fifo::canMerge(none, state(0, 0, KEY_A), none));
+  CHECK(!Fifo::canMerge(state(0, 0, KEY_A), state(0, 0, KEY_A, KEY_B), state(0, 0, KEY_A)));
+
+  // A media key tap is never lost.
+  CHECK(!Fifo::canMerge(none, state(0, MEDIA_MUTE), none));
+  CHECK(!Fifo::canMerge(none, state(0, MEDIA_MUTE, KEY_A), state(0, 0, KEY_A)));
+
+  // Keys that change once each only lose their timing.
+  CHECK(Fifo::canMerge(none, state(0, 0, KEY_A), state(0, 0, KEY_A, KEY_B)));
+  CHECK(Fifo::canMerge(state(0, 0, KEY_A), state(0, 0, KEY_A, KEY_B), state(0, 0, KEY_B)));
+  CHECK(Fifo::canMerge(state(MOD_SHIFT, MEDIA_MUTE, KEY_A), state(MOD_SHIFT, MEDIA_MUTE, KEY_A, KEY_B), state(MOD_SHIFT, MEDIA_MUTE, KEY_B, KEY_A)));
+}
+
+static void testMergesNewest() {
+  Fifo fifo;
+  CHECK(fifo.push(state(0, 0)) == Fifo::PUSH_QUEUED);
+  CHECK(fifo.push(state(0, 0, KEY_A)) == Fifo::PUSH_QUEUED);
+  CHECK(fifo.push(state(0, 0, KEY_A, KEY_B)) == Fifo::PUSH_QUEUED);
+  CHECK(fifo.push(state(0, 0, KEY_A, KEY_B, KEY_C)) == Fifo::PUSH_QUEUED);
+
+  // Full: the newest state that can be merged is dropped.
+  CHECK(fifo.push(state(0, 0, KEY_B, KEY_C, KEY_D)) == Fifo::PUSH_MERGED);
+  CHECK(fifo.count() == 4);
+
+  std::vector<PendingState> sent = drain(fifo);
+  CHECK(sent.size() == 4);
+  CHECK(sent[0] == state(0, 0));
+  CHECK(sent[1] == state(0, 0, KEY_A));
+  CHECK(sent[2] == state(0, 0, KEY_A, KEY_B));
+  CHECK(sent[3] == state(0, 0, KEY_B, KEY_C, KEY_D));
+}
+
+static void testNeverMergesModifierChange() {
+  // {} -> {A} -> {Shift, A}: 'a' must not become 'A'.
+  Fifo fifo;
+  fifo.push(state(0, 0));
+  fifo.push(state(0, 0, KEY_A));
+  fifo.push(state(MOD_SHIFT, 0, KEY_A));
+  fifo.push(state(MOD_SHIFT, 0));
+  CHECK(fifo.push(state(0, 0)) == Fifo::PUSH_QUEUED);
+  CHECK(fifo.count() == 5);
+
+  std::vector<PendingState> sent = drain(fifo);
+  CHECK(sent.size() == 5);
+  CHECK(sent[1] == state(0, 0, KEY_A));
+  CHECK(sent[2] == state(MOD_SHIFT, 0, KEY_A));
+}
+
+static void testWaitingStateIsReplaced() {
+  // {A} -> {} -> {A}: every queued state is a tap, nothing can be merged.
+  Fifo fifo;
+  fifo.push(state(0, 0));
+  fifo.push(state(0, 0, KEY_A));
+  fifo.push(state(0, 0));
+  fifo.push(state(0, 0, KEY_A));
+  CHECK(fifo.push(state(0, 0)) == Fifo::PUSH_QUEUED);
+
+  // The state waiting for room can be merged like the others.
+  CHECK(fifo.push(state(0, 0, KEY_B)) == Fifo::PUSH_MERGED);
+
+  // Otherwise it is replaced, so that the host ends up with the latest state.
+  CHECK(fifo.push(state(MOD_SHIFT, 0)) == Fifo::PUSH_DROPPED);
+  CHECK(fifo.count() == 5);
+
+  std::vector<PendingState> sent = drain(fifo);
+  CHECK(sent.size() == 5);
+  CHECK(sent[3] == state(0, 0, KEY_A));
+  CHECK(sent[4] == state(MOD_SHIFT, 0));
+}
+
+static void testWrapsAround() {
+  // The merge works across the end of the circular buffer.
+  Fifo fifo;
+  fifo.push(state(0, 0));
+  fifo.push(state(0, 0));
+  fifo.pop();
+  fifo.pop();
+  fifo.push(state(0, 0));
+  fifo.push(state(0, 0, KEY_A));
+  fifo.push(state(0, 0, KEY_A, KEY_B));
+  fifo.push(state(0, MEDIA_MUTE, KEY_A, KEY_B));
+  CHECK(fifo.push(state(0, 0, KEY_A, KEY_B)) == Fifo::PUSH_MERGED);
+  CHECK(fifo.push(state(0, 0, KEY_A, KEY_B, KEY_C)) == Fifo::PUSH_QUEUED);
+
+  std::vector<PendingState> sent = drain(fifo);
+  CHECK(sent.size() == 5);
+  CHECK(sent[1] == state(0, 0, KEY_A, KEY_B));
+  CHECK(sent[2] == state(0, MEDIA_MUTE, KEY_A, KEY_B));
+  CHECK(sent[3] == state(0, 0, KEY_A, KEY_B));
+  CHECK(sent[4] == state(0, 0, KEY_A, KEY_B, KEY_C));
+}
+
+/// True if the host cannot tell 'states' from its first and last states: the modifiers and media key never change and each key changes at most once.
+static bool isInvisible(const std::vector<PendingState>& states) {
+  for (size_t i = 1; i < states.size(); ++i) {
+    if (states[i].m_modifiers != states[0].m_modifiers || states[i].m_mediaKey != states[0].m_mediaKey) return false;
+  }
+  for (uint8_t key = KEY_A; key <= KEY_D; ++key) {
+    int changes = 0;
+    for (size_t i = 1; i < states.size(); ++i) {
+      bool was = memchr(states[i - 1].m_keys, key, sizeof(states[i - 1].m_keys)) != nullptr;
+      bool is = memchr(states[i].m_keys, key, sizeof(states[i].m_keys)) != nullptr;
+      if (was != is) ++changes;
+    }
+    if (changes > 1) return false;
+  }
+  return true;
+}
+
+static void testRandomSequences() {
+  // Whatever the timing of the polls, the host gets the states in order, each merge is invisible and the last state always arrives.
+  srand(1);
+  int merges = 0;
+  for (int run = 0; run < 1000; ++run) {
+    Fifo fifo;
+    std::vector<PendingState> pushed;
+    std::vector<PendingState> sent;
+    int dropped = 0;
+    int pollRate = 1 + rand() % 4;
+    for (int i = 0; i < 64; ++i) {
+      PendingState next = state(rand() % 8 == 0 ? MOD_SHIFT : 0, rand() % 16 == 0 ? MEDIA_MUTE : 0, rand() % 2 ? KEY_A : 0, rand() % 2 ? KEY_B : 0, rand() % 2 ? KEY_C : 0);
+      pushed.push_back(next);
+      Fifo::Push push = fifo.push(next);
+      if (push == Fifo::PUSH_DROPPED) ++dropped;
+      if (push == Fifo::PUSH_MERGED) ++merges;
+      if (fifo.count() > 0 && rand() % pollRate == 0) {
+        sent.push_back(fifo.front());
+        fifo.pop();
+      }
+    }
+    std::vector<PendingState> rest = drain(fifo);
+    sent.insert(sent.end(), rest.begin(), rest.end());
+
+    CHECK(sent.back() == pushed.back());
+
+    // Without a drop, the states sent are the pushed ones where the states skipped in between are invisible. 'matches[s][p]' is true if sent[s] can be pushed[p].
+    if (dropped > 0) continue;
+    std::vector<std::vector<bool>> matches(sent.size(), std::vector<bool>(pushed.size(), false));
+    matches[0][0] = sent[0] == pushed[0];
+    for (size_t s = 1; s < sent.size(); ++s) {
+      for (size_t p = s; p < pushed.size(); ++p) {
+        if (!(sent[s] == pushed[p])) continue;
+        std::vector<PendingState> chain = {sent[s - 1], pushed[p]};
+        for (size_t q = p; q-- > 0 && !matches[s][p];) {
+          if (matches[s - 1][q] && (q + 1 == p || isInvisible(chain))) matches[s][p] = true;
+          chain.insert(chain.begin() + 1, pushed[q]);
+        }
+      }
+    }
+    CHECK(matches[sent.size() - 1][pushed.size() - 1]);
+  }
+  CHECK(merges > 0);
+}
+
+int main() {
+  testCanMerge();
+  testMergesNewest();
+  testNeverMergesModifierChange();
+  testWaitingStateIsReplaced();
+  testWrapsAround();
+  testRandomSequences();
+
+  return checkResult();
+}
@@ -0,0 +1,91 @@
+// Test that the saved settings survive a power loss at any point of Settings::save(), on the emulated flash.
+//
+// Build: g++ -O2 -DFLASH_EMULATION=1 -o settings_power_cut_test settings_power_cut_test.cpp ../arduino_keyboard/settings.cpp ../arduino_keyboard/storage.cpp ../arduino_keyboard/flashEmulation.cpp
+// Usage: settings_power_cut_test
+//
+// The power is cut after each page programmed and each sector erased by a save, then the keyboard reboots: it must find either the settings of the previous save or the new ones, never a mix
+// or the defaults. Prints each failed check and exits with 1 if there is one.
+
+#include "../arduino_keyboard/settings.h"
+#include "../arduino_keyboard/storage.h"
+#include "check.h"
+
+#include <stdio.h>
+
+#if !FLASH_EMULATION
+#error "build with -DFLASH_EMULATION=1"
+#endif
+
+/// Set every setting to its minimum if 'isLow', otherwise to its maximum.
+static void setAll(bool isLow) {
+  for (int setting = 0; setting < Settings::NUM_SETTINGS; ++setting) {
+    Settings::Setting s = Settings::Setting(setting);
+    Settings::set(s, isLow ? Settings::minimum(s) : Settings::maximum(s));
+  }
+}
+
+/// True if every setting is at its minimum if 'isLow', otherwise at its maximum.
+static bool hasAll(bool isLow) {
+  for (int setting = 0; setting < Settings::NUM_SETTINGS; ++setting) {
+    Settings::Setting s = Settings::Setting(setting);
+    if (Settings::get(s) != (isLow ? Settings::minimum(s) : Settings::maximum(s))) return false;
+  }
+  return true;
+}
+
+/// Turn the keyboard off and on again: the settings are loaded from the flash.
+static void reboot() {
+  Storage::emulatedFlash().powerOn();
+  Storage::init();
+  Settings::init();
+}
+
+int main() {
+  Storage::init();
+  Settings::init();
+
+  // A first save that completes, so that there is a previous save to fall back on.
+  setAll(true);
+  CHECK(Settings::save());
+  reboot();
+  CHECK(hasAll(true));
+
+  // Cut the power after each operation of a save until one completes. Each round saves the opposite values, so that both banks are interrupted in turn.
+  bool isLow = true;
+  int completed = 0;
+  for (int round = 0; round < 4; ++round) {
+    for (int operations = 0;; ++operations) {
+      setAll(!isLow);
+      Storage::emulatedFlash().cutPowerAfter(operations);
+      bool saved = Settings::save();
+      reboot();
+
+      if (saved) {
+        // The save completed before the power was cut.
+        CHECK(hasAll(!isLow));
+        isLow = !isLow;
+        ++completed;
+        break;
+      }
+      CHECK(hasAll(isLow) || hasAll(!isLow));
+      if (operations > 64) {
+        printf("a save never completes\n");
+        return 1;
+      }
+    }
+  }
+  CHECK(completed == 4);
+
+  // An interrupted save right after a completed one, then a save that completes.
+  setAll(!isLow);
+  Storage::emulatedFlash().cutPowerAfter(1);
+  CHECK(!Settings::save());
+  reboot();
+  CHECK(hasAll(isLow));
+  setAll(!isLow);
+  CHECK(Settings::save());
+  reboot();
+  CHECK(hasAll(!isLow));
+
+  return checkResult();
+}
@@ -0,0 +1,214 @@
+// Test of the split link against a fake UART: the recovery of the primary half from lost frames, lost SPLIT_RESYNC requests and corrupted frames, and the frames of the
+// secondary half.
+//
+// Build: g++ -O2 -Ihost -DSPLIT_ROLE=1 -o split_primary_test split_link_test.cpp
+//        g++ -O2 -Ihost -DSPLIT_ROLE=2 -o split_secondary_test split_link_test.cpp
+// Usage: split_primary_test
+//        split_secondary_test
+//
+// split.cpp is compiled in this file for the role selected by SPLIT_ROLE, the test plays the other half. Prints each failed check and exits with 1 if there is one.
+
+#include "../arduino_keyboard/config.h"
+#include "check.h"
+#include "mbed.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+/// The pins of the link, as named by mbed.
+static const PinName p0 = 0;
+static const PinName p1 = 1;
+
+#include "../arduino_keyboard/split.cpp"
+
+// The globals of the firmware used by the link, without the rest of their modules.
+namespace PerfImpl {
+uint32_t s_counters[Perf::NUM_COUNTERS];
+uint32_t s_histograms[Perf::NUM_HISTOGRAMS][PERF_HISTOGRAM_BUCKETS];
+uint32_t s_maximums[Perf::NUM_HISTOGRAMS];
+}
+
+/// Receive 'length' bytes of 'data' from the other half, through the interrupt of the UART.
+static void receiveBytes(const uint8_t* data, int length) {
+  using namespace SplitImpl;
+  s_serial->m_received.insert(s_serial->m_received.end(), data, data + length);
+  s_serial->m_handler();
+}
+
+/// Take the bytes written to the other half.
+static std::deque<uint8_t> takeWritten() {
+  std::deque<uint8_t> written;
+  written.swap(SplitImpl::s_serial->m_written);
+  return written;
+}
+
+#if SPLIT_ROLE == SPLIT_PRIMARY
+/// Sequence number of the last frame sent by the fake secondary half.
+static uint8_t s_sequence = 0;
+
+/// Send a frame from the fake secondary half. If 'isLost', only its sequence number is used, as if the link dropped it.
+static void sendFrame(uint32_t changed, uint32_t pressed, bool isLost = false) {
+  uint8_t data[SPLIT_FRAME_SIZE];
+  splitEncode(SplitFrame{ ++s_sequence, changed, pressed }, data);
+  if (!isLost) receiveBytes(data, sizeof(data));
+}
+
+/// Return true if the primary half asked for the full state since the last call.
+static bool askedResync() {
+  std::deque<uint8_t> written = takeWritten();
+  return !written.empty() && written.back() == SPLIT_RESYNC;
+}
+
+/// The link comes up with the first full state, and the changes apply to it.
+static unsigned long testLinkUp(unsigned long now) {
+  // Changes are ignored until the full state is known.
+  sendFrame(0x1, 0x1);
+  CHECK(Split::receive(now) == 0);
+  CHECK(askedResync());
+
+  sendFrame(SPLIT_ALL_PINS, 0x2);
+  now += 1000;
+  CHECK(Split::receive(now) == 0x2);
+  sendFrame(0x4, 0x4);
+  now += 1000;
+  CHECK(Split::receive(now) == 0x6);
+  takeWritten();
+
+  // Nothing is asked once the state is known.
+  now += SPLIT_HEARTBEAT_TIME;
+  sendFrame(SPLIT_ALL_PINS, 0x6);
+  CHECK(Split::receive(now) == 0x6);
+  CHECK(!askedResync());
+  return now;
+}
+
+/// A lost release leaves the key pressed until the full state comes. The SPLIT_RESYNC request is lost, it must be sent again.
+static unsigned long testLostResync(unsigned long now) {
+  sendFrame(0x2, 0x0, true);
+  sendFrame(0x8, 0x8);
+  now += 1000;
+  CHECK(Split::receive(now) == 0xE);
+  CHECK(askedResync());
+
+  // The request was lost: no answer comes, only changes. The request is repeated every SPLIT_HEARTBEAT_TIME.
+  for (int i = 0; i < 3; ++i) {
+    sendFrame(0x8, i % 2 == 0 ? 0x0 : 0x8);
+    now += SPLIT_HEARTBEAT_TIME / 2;
+    Split::receive(now);
+    now += SPLIT_HEARTBEAT_TIME / 2;
+    Split::receive(now);
+    CHECK(askedResync());
+  }
+
+  // The full state releases the key and stops the requests.
+  sendFrame(SPLIT_ALL_PINS, 0x4);
+  now += 1000;
+  CHECK(Split::receive(now) == 0x4);
+  takeWritten();
+  now += 2 * SPLIT_HEARTBEAT_TIME;
+  sendFrame(SPLIT_ALL_PINS, 0x4);
+  CHECK(Split::receive(now) == 0x4);
+  CHECK(!askedResync());
+  return now;
+}
+
+/// A corrupted frame is dropped, and the full state is asked until it comes.
+static unsigned long testCrcError(unsigned long now) {
+  uint8_t data[SPLIT_FRAME_SIZE];
+  splitEncode(SplitFrame{ ++s_sequence, 0x4, 0x0 }, data);
+  data[5] ^= 0x10;
+  receiveBytes(data, sizeof(data));
+  now += SPLIT_HEARTBEAT_TIME;
+  CHECK(Split::receive(now) == 0x4);
+  CHECK(askedResync());
+  CHECK(Perf::counter(Perf::COUNTER_SPLIT_CRC_ERRORS) == 1);
+
+  // A heartbeat carries the full state too.
+  sendFrame(SPLIT_ALL_PINS, 0x0);
+  now += SPLIT_HEARTBEAT_TIME;
+  CHECK(Split::receive(now) == 0x0);
+  CHECK(!askedResync());
+  return now;
+}
+
+/// Without frames the link goes down and every pin is released.
+static unsigned long testTimeout(unsigned long now) {
+  sendFrame(0x1, 0x1);
+  now += 1000;
+  CHECK(Split::receive(now) == 0x1);
+  now += SPLIT_TIMEOUT + 1;
+  CHECK(Split::receive(now) == 0);
+  CHECK(Perf::counter(Perf::COUNTER_SPLIT_TIMEOUTS) == 1);
+  CHECK(askedResync());
+  return now;
+}
+
+int main() {
+  Split::init();
+
+  unsigned long now = 100000;
+  now = testLinkUp(now);
+  now = testLostResync(now);
+  now = testCrcError(now);
+  testTimeout(now);
+
+  return checkResult();
+}
+#endif
+
+#if SPLIT_ROLE == SPLIT_SECONDARY
+/// Decode the frames written to the primary half.
+static std::vector<SplitFrame> takeFrames() {
+  static SplitDecoder s_decoder;
+  std::vector<SplitFrame> frames;
+  for (uint8_t byte : takeWritten()) {
+    SplitFrame frame;
+    if (s_decoder.push(byte, frame)) frames.push_back(frame);
+  }
+  return frames;
+}
+
+/// The changes are sent as soon as they happen, with increasing sequence numbers.
+static unsigned long testChanges(unsigned long now) {
+  Split::send(0x1, now);
+  std::vector<SplitFrame> frames = takeFrames();
+  CHECK(frames.size() == 1 && frames[0].m_changed == 0x1 && frames[0].m_pressed == 0x1);
+
+  now += 1000;
+  Split::send(0x1, now);
+  CHECK(takeFrames().empty());
+
+  Split::send(0x3, now);
+  std::vector<SplitFrame> next = takeFrames();
+  CHECK(next.size() == 1 && next[0].m_changed == 0x2 && (next[0].m_pressed & 0x2) != 0);
+  CHECK(next.size() == 1 && frames.size() == 1 && next[0].m_sequence == uint8_t(frames[0].m_sequence + 1));
+  return now;
+}
+
+/// The heartbeats and the answers to SPLIT_RESYNC hold the full state.
+static unsigned long testFullState(unsigned long now) {
+  now += SPLIT_HEARTBEAT_TIME;
+  Split::send(0x3, now);
+  std::vector<SplitFrame> frames = takeFrames();
+  CHECK(frames.size() == 1 && frames[0].m_changed == SPLIT_ALL_PINS && frames[0].m_pressed == 0x3);
+
+  uint8_t request = SPLIT_RESYNC;
+  receiveBytes(&request, 1);
+  now += 1000;
+  Split::send(0x3, now);
+  frames = takeFrames();
+  CHECK(frames.size() == 1 && frames[0].m_changed == SPLIT_ALL_PINS && frames[0].m_pressed == 0x3);
+  return now;
+}
+
+int main() {
+  Split::init();
+
+  unsigned long now = 100000;
+  now = testChanges(now);
+  testFullState(now);
+
+  return checkResult();
+}
+#endif
@@ -0,0 +1,145 @@
+// Compare the results of the BENCH_LOG benchmarks with baselines, to catch a hot path that got slower before it ships.
+//
+// Build: g++ -O2 -o bench_compare bench_compare.cpp
+// Usage: bench_compare record <log> <baselines>
+//        bench_compare check <log> <baselines> [tolerance]
+//
+// <log> is the debug output of a keyboard built with BENCH_LOG, where each benchmark wrote a line "bench <name>: iterations=<n> ns_per_op=<time>".
+// <baselines> holds one line "<name> <ns_per_op>" per benchmark.
+//
+// The timings depend on the board and its clock, so they only compare on the same board, and no baselines of a board are committed. A CI job with a board attached gets
+// them from the base branch:
+//   1. Build and flash the base branch with BENCH_LOG, save the debug output as base.log, and run "bench_compare record base.log baselines.txt".
+//   2. Build and flash the change with BENCH_LOG, save the debug output as change.log, and run "bench_compare check change.log baselines.txt".
+// Without a board, tools/bench_host.cpp runs the same benchmarks on Linux and writes the same lines. Its baselines on a x86-64 computer are in bench_baselines_host.txt.
+//
+// Commands:
+//   record   Write the results found in the log as the new baselines.
+//   check    Print each result next to its baseline. Fail if one is slower than its baseline by more than the tolerance, in percent (10 by default), or if a benchmark with a baseline is missing from the log.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// Largest number of benchmarks.
+static const int MAX_BENCHMARKS = 64;
+
+/// Result or baseline of one benchmark.
+struct Result {
+  char m_name[64];
+  unsigned m_nsPerOp;
+};
+
+/// Read the benchmark lines of a debug output. Other lines are skipped. Return the number of results, or -1 on error.
+static int readLog(const char* path, Result* results) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    perror(path);
+    return -1;
+  }
+
+  int count = 0;
+  char line[256];
+  while (fgets(line, sizeof(line), file) != nullptr && count < MAX_BENCHMARKS) {
+    Result& result = results[count];
+    unsigned iterations;
+    if (sscanf(line, "bench %63[^:]: iterations=%u ns_per_op=%u", result.m_name, &iterations, &result.m_nsPerOp) == 3) count++;
+  }
+  fclose(file);
+  return count;
+}
+
+/// Read a baselines file. Return the number of baselines, or -1 on error.
+static int readBaselines(const char* path, Result* baselines) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    perror(path);
+    return -1;
+  }
+
+  int count = 0;
+  char line[256];
+  while (fgets(line, sizeof(line), file) != nullptr && count < MAX_BENCHMARKS) {
+    Result& baseline = baselines[count];
+    if (sscanf(line, "%63s %u", baseline.m_name, &baseline.m_nsPerOp) == 2) count++;
+  }
+  fclose(file);
+  return count;
+}
+
+/// Return the entry of 'results' named 'name', or nullptr if there is none.
+static const Result* find(const Result* results, int count, const char* name) {
+  for (int i = 0; i < count; ++i) {
+    if (strcmp(results[i].m_name, name) == 0) return &results[i];
+  }
+  return nullptr;
+}
+
+static int record(const char* logPath, const char* baselinesPath) {
+  Result results[MAX_BENCHMARKS];
+  int count = readLog(logPath, results);
+  if (count < 0) return 1;
+  if (count == 0) {
+    fprintf(stderr, "no benchmark result in %s, was the firmware built with BENCH_LOG?\n", logPath);
+    return 1;
+  }
+
+  FILE* file = fopen(baselinesPath, "w");
+  if (file == nullptr) {
+    perror(baselinesPath);
+    return 1;
+  }
+  for (int i = 0; i < count; ++i) {
+    fprintf(file, "%s %u\n", results[i].m_name, results[i].m_nsPerOp);
+  }
+  fclose(file);
+  printf("recorded %d baselines\n", count);
+  return 0;
+}
+
+static int check(const char* logPath, const char* baselinesPath, unsigned tolerance) {
+  Result results[MAX_BENCHMARKS];
+  Result baselines[MAX_BENCHMARKS];
+  int numResults = readLog(logPath, results);
+  int numBaselines = readBaselines(baselinesPath, baselines);
+  if (numResults < 0 || numBaselines < 0) return 1;
+
+  int failures = 0;
+  printf("%-32s %10s %10s %8s\n", "benchmark", "baseline", "ns_per_op", "change");
+  for (int i = 0; i < numBaselines; ++i) {
+    const Result& baseline = baselines[i];
+    const Result* result = find(results, numResults, baseline.m_name);
+    if (result == nullptr) {
+      printf("%-32s %10u %10s %8s MISSING\n", baseline.m_name, baseline.m_nsPerOp, "-", "-");
+      failures++;
+      continue;
+    }
+
+    // Timings of a few nano-seconds are at the resolution of the clock, allow them one extra nano-second.
+    double change = baseline.m_nsPerOp == 0 ? 0 : 100.0 * (double(result->m_nsPerOp) - baseline.m_nsPerOp) / baseline.m_nsPerOp;
+    bool slower = result->m_nsPerOp > baseline.m_nsPerOp + 1 && result->m_nsPerOp * 100 > baseline.m_nsPerOp * (100 + tolerance);
+    printf("%-32s %10u %10u %+7.1f%%%s\n", baseline.m_name, baseline.m_nsPerOp, result->m_nsPerOp, change, slower ? " SLOWER" : "");
+    if (slower) failures++;
+  }
+
+  // New benchmarks are reported but do not fail the check, record them to start tracking them.
+  for (int i = 0; i < numResults; ++i) {
+    if (find(baselines, numBaselines, results[i].m_name) == nullptr) {
+      printf("%-32s %10s %10u %8s NEW\n", results[i].m_name, "-", results[i].m_nsPerOp, "-");
+    }
+  }
+
+  if (failures != 0) {
+    printf("%d benchmarks regressed\n", failures);
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  if (argc >= 4 && strcmp(argv[1], "record") == 0) return record(argv[2], argv[3]);
+  if (argc >= 4 && strcmp(argv[1], "check") == 0) return check(argv[2], argv[3], argc >= 5 ? strtoul(argv[4], nullptr, 0) : 10);
+
+  fprintf(stderr, "usage: %s record <log> <baselines>\n       %s check <log> <baselines> [tolerance]\n", argv[0], argv[0]);
+  return 2;
+}
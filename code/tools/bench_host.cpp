@@ -0,0 +1,27 @@
+// Run the benchmarks of BENCH_LOG on Linux, through the host build of the sketch, and write their results as the keyboard writes them in its debug output.
+//
+// Build: g++ -O2 -I../tests/host -DFLASH_EMULATION=1 -DINPUT_BACKEND=2 -DBENCH_LOG=1 -DBENCH_ITERATIONS=10000000 -o bench_host bench_host.cpp ../tests/host/sketch.cpp
+// Usage: bench_host > bench.log
+//        bench_compare check bench.log bench_baselines_host.txt 50
+//
+// The benchmarks are the ones of the keyboard, see bench.h and benchAll() in arduino_keyboard.ino: the event queue with and without removed events, LayerTracker::delta(),
+// KeyboardOutput::add(), Input::update() that maps the inputs to the switches, Recorder::record(), and sendCurrentKeyPress() with 0 to 10 keys held. They are timed with
+// the clock of the host, so BENCH_ITERATIONS is much larger than on the keyboard: each benchmark lasts tens of milli-seconds, far above the resolution of micros().
+//
+// bench_baselines_host.txt holds the baselines recorded with the build line above on a x86-64 computer. The timings only compare on the same computer: record new baselines
+// from the base branch with "bench_compare record" before checking a change on another one. A shared computer is noisier than a board, hence the tolerance of 50 percent:
+// the check catches a change that makes a primitive much slower, not the cost on the keyboard, which still needs a board. The benchmarks of one or two nano-seconds per
+// operation are at the resolution of the results, the compiler of the host optimizes most of their work out.
+
+#include "../tests/host/sketch.h"
+
+#if !BENCH_LOG
+#error "build with -DBENCH_LOG=1"
+#endif
+
+int main() {
+  // setup() runs the benchmarks when BENCH_LOG is enabled.
+  HostSketch::setRealClock(true);
+  HostSketch::setup();
+  return 0;
+}
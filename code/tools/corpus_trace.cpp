@@ -0,0 +1,429 @@
+// Turn a text into traces of switch edges that type it, to find the typing speed at which the event processing starts to lose or add keys.
+//
+// Build: g++ -O2 -o corpus_trace corpus_trace.cpp
+// Usage: corpus_trace [options] <corpus> <output header>
+//
+// Options:
+//   --wpm <list>         Typing speeds of the traces, in words per minute of 5 characters, separated by commas (60,100,140,180,220,260 by default).
+//   --dwell <us>         Average time a key is held, in micro-seconds (90000 by default). It does not depend on the speed, so the keys overlap more as the speed increases.
+//   --bounce <us>        Longest chatter of a switch, in micro-seconds (3000 by default).
+//   --bounce-rate <p>    Probability that an edge chatters, between 0 and 1 (0.1 by default).
+//   --max-chars <n>      Number of characters of the corpus that are typed (300 by default).
+//   --seed <n>           Seed of the random timings (1 by default).
+//   --trace-dir <dir>    Also write each trace in <dir>, as a corpus_<wpm>wpm.trace file for tools/replay_bench.cpp.
+//
+// The keys are found in the compiled-in keymap of keyConfig.h: each character is typed with the switch, and the layer keys, that produce it with the fewest layers. Characters that the keymap
+// cannot type are skipped. The timings are random around the typing speed: layer keys are pressed before the key they modify and released after it, each switch has its own chatter duration.
+//
+// The output is a header to write as arduino_keyboard/corpusTraces.h. The traces are replayed with REPLAY_LOG, which compares what they typed with what the text should type, see Replay.
+// The trace files of --trace-dir hold the same traces, followed by a "typed <hex>" line for each character, and are checked the same way on Linux by tools/replay_bench.cpp.
+
+#include "../arduino_keyboard/keyConfig.h"
+#include "../arduino_keyboard/replay.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/// Largest number of traces, i.e. of typing speeds.
+static const int MAX_TRACES = 16;
+
+/// Shortest time a key is held, and shortest time between a release and the next press of the same switch, in micro-seconds. Fingers are not faster than that.
+static const double MIN_HOLD = 20000;
+static const double MIN_GAP = 10000;
+
+/// How long before a key its layer keys are pressed, and how long after they are released, as a ratio of the dwell time.
+static const double LAYER_LEAD = 0.5;
+static const double LAYER_LAG = 0.3;
+
+/// How a character is typed.
+struct Stroke {
+  /// Switch producing the character.
+  Pos m_pos;
+  /// Layer keys to hold while the switch is pressed.
+  std::vector<Pos> m_layerKeys;
+  /// What the keyboard should type: the modifiers in the high byte, the key code in the low byte.
+  uint16_t m_typed;
+};
+
+/// A switch held between two times.
+struct Hold {
+  Pos m_pos;
+  double m_press;
+  double m_release;
+  bool m_isLayerKey;
+};
+
+/// Random generator state, see nextRandom().
+static uint32_t s_random = 1;
+
+/// Uniform random number in [0, 1), from a xorshift32 generator like Replay::generate().
+static double nextRandom() {
+  s_random ^= s_random << 13;
+  s_random ^= s_random >> 17;
+  s_random ^= s_random << 5;
+  return s_random / 4294967296.0;
+}
+
+/// The keys that type 'c', as written in a keymap. Return false if the character is not supported.
+static bool keysOf(char c, Key& key0, Key& key1) {
+  static const Key letters[26] = { Key::A, Key::B, Key::C, Key::D, Key::E, Key::F, Key::G, Key::H, Key::I, Key::J, Key::K, Key::L, Key::M,
+                                   Key::N, Key::O, Key::P, Key::Q, Key::R, Key::S, Key::T, Key::U, Key::V, Key::W, Key::X, Key::Y, Key::Z };
+  static const Key digits[10] = { Key::NUM_0, Key::NUM_1, Key::NUM_2, Key::NUM_3, Key::NUM_4, Key::NUM_5, Key::NUM_6, Key::NUM_7, Key::NUM_8, Key::NUM_9 };
+
+  key1 = Key::NONE;
+  if (c >= 'a' && c <= 'z') {
+    key0 = letters[c - 'a'];
+    return true;
+  }
+  if (c >= 'A' && c <= 'Z') {
+    key0 = Key::SHIFT;
+    key1 = letters[c - 'A'];
+    return true;
+  }
+  if (c >= '0' && c <= '9') {
+    key0 = digits[c - '0'];
+    return true;
+  }
+
+  // Punctuation of a french AZERTY layout, as the host interprets the key codes.
+  switch (c) {
+    case ' ': key0 = Key::SPACE; return true;
+    case '\n': key0 = Key::ENTER; return true;
+    case ',': key0 = Key::N1; return true;
+    case '?': key0 = Key::SHIFT; key1 = Key::N1; return true;
+    case ';': key0 = Key::N2; return true;
+    case '.': key0 = Key::SHIFT; key1 = Key::N2; return true;
+    case ':': key0 = Key::N3; return true;
+    case '!': key0 = Key::N4; return true;
+    case '\'': key0 = Key::D4; return true;
+    case '-': key0 = Key::NUM_MINUS; return true;
+    case '+': key0 = Key::NUM_PLUS; return true;
+    default: return false;
+  }
+}
+
+/// Add 'key' to the keyboard state 'typed', like KeyboardOutput::add().
+static void addKey(Key key, uint16_t& typed) {
+  if (key >= Key::CTRL && key <= Key::RWIN) {
+    typed |= 1 << (8 + uint8_t(key) - uint8_t(Key::CTRL));
+  } else if (key != Key::NONE) {
+    typed |= uint8_t(key);
+  }
+}
+
+/// Find how to type 'c' with 'tables'. Return false if the keymap cannot type it.
+static bool findStroke(const KeymapTables& tables, char c, Stroke& stroke) {
+  Key key0, key1;
+  if (!keysOf(c, key0, key1)) return false;
+
+  // Try the layer combinations with the fewest layers first.
+  for (int numLayers = 0; numLayers <= 3; ++numLayers) {
+    for (int mask = 0; mask < NUM_LAYER_MASKS; ++mask) {
+      if (__builtin_popcount(mask) != numLayers) continue;
+
+      for (int8_t line = 0; line < NUM_LINES; ++line) {
+        for (int8_t column = 0; column < NUM_COLUMNS; ++column) {
+          const K& k = tables.m_layers[mask][line][column];
+          bool matches = (k.m_key0 == key0 && k.m_key1 == key1) || (k.m_key0 == key1 && k.m_key1 == key0);
+          if (!matches || k.m_mediaKey != MediaKey::NONE || k.m_forcedKey != Key::NONE) continue;
+
+          // Layer keys only type when tapped, which selects no layer.
+          if (tables.m_layerKeys[line][column] != LAYER_NONE && (!tables.m_onRelease[line][column] || mask != 0)) continue;
+
+          // Find a switch for each layer of the combination, preferably one that is not an "on release" key.
+          stroke.m_layerKeys.clear();
+          for (int layer = LAYER_SHIFT; layer <= LAYER_ACCENT; ++layer) {
+            if ((mask & LAYER_MASK(layer)) == 0) continue;
+
+            Pos layerKey{ -1, -1 };
+            for (int8_t l = 0; l < NUM_LINES; ++l) {
+              for (int8_t col = 0; col < NUM_COLUMNS; ++col) {
+                if (tables.m_layerKeys[l][col] != layer || tables.m_layerActivations[l][col] != LAYER_MOMENTARY) continue;
+                if (l == line && col == column) continue;
+                if (layerKey.m_line < 0 || tables.m_onRelease[layerKey.m_line][layerKey.m_column]) layerKey = Pos{ l, col };
+              }
+            }
+            if (layerKey.m_line < 0) break;
+            stroke.m_layerKeys.push_back(layerKey);
+          }
+          if (int(stroke.m_layerKeys.size()) != numLayers) continue;
+
+          stroke.m_pos = Pos{ line, column };
+          stroke.m_typed = 0;
+          addKey(k.m_key0, stroke.m_typed);
+          addKey(k.m_key1, stroke.m_typed);
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+/// Add 'hold' to 'holds'. A switch must be released before it is pressed again: a layer key held for consecutive characters stays held, otherwise the previous hold is cut short.
+static void addHold(std::vector<Hold>& holds, Hold hold) {
+  for (auto it = holds.rbegin(); it != holds.rend(); ++it) {
+    if (it->m_pos != hold.m_pos) continue;
+    if (it->m_release + MIN_GAP <= hold.m_press) break;
+
+    if (it->m_isLayerKey && hold.m_isLayerKey) {
+      it->m_release = std::max(it->m_release, hold.m_release);
+      return;
+    }
+    it->m_release = std::max(it->m_press + MIN_HOLD, hold.m_press - MIN_GAP);
+    hold.m_press = std::max(hold.m_press, it->m_release + MIN_GAP);
+    hold.m_release = std::max(hold.m_release, hold.m_press + MIN_HOLD);
+    break;
+  }
+  holds.push_back(hold);
+}
+
+/// Add the edges of 'holds' to 'edges', with chatter after some of them. 'bounces' is the longest chatter of each switch.
+static void addEdges(const std::vector<Hold>& holds, const double (&bounces)[NUM_LINES][NUM_COLUMNS], double bounceRate, std::vector<TraceEdge>& edges) {
+  // Chatter must end before the next edge of the same switch.
+  std::vector<Hold> sorted(holds);
+  std::stable_sort(sorted.begin(), sorted.end(), [](const Hold& a, const Hold& b) { return a.m_press < b.m_press; });
+
+  for (size_t i = 0; i < sorted.size(); ++i) {
+    const Hold& hold = sorted[i];
+    double nextPress = 1e18;
+    for (size_t j = i + 1; j < sorted.size(); ++j) {
+      if (sorted[j].m_pos == hold.m_pos) {
+        nextPress = sorted[j].m_press;
+        break;
+      }
+    }
+
+    double limits[2] = { (hold.m_release - hold.m_press) / 2, (nextPress - hold.m_release) / 2 };
+    double times[2] = { hold.m_press, hold.m_release };
+    for (int edge = 0; edge < 2; ++edge) {
+      bool isPressed = edge == 0;
+      edges.push_back(TraceEdge{ uint32_t(times[edge]), hold.m_pos, isPressed });
+
+      double window = std::min(bounces[hold.m_pos.m_line][hold.m_pos.m_column], limits[edge]);
+      if (window < 200 || nextRandom() >= bounceRate) continue;
+
+      // One to three bounces, each one opposite edge followed by the edge again, spread over the chatter of the switch.
+      int numBounces = 1 + int(nextRandom() * 3);
+      double time = times[edge];
+      for (int bounce = 0; bounce < numBounces; ++bounce) {
+        time += 50 + nextRandom() * window / (2 * numBounces);
+        edges.push_back(TraceEdge{ uint32_t(time), hold.m_pos, !isPressed });
+        time += 50 + nextRandom() * window / (2 * numBounces);
+        edges.push_back(TraceEdge{ uint32_t(time), hold.m_pos, isPressed });
+      }
+    }
+  }
+
+  std::stable_sort(edges.begin(), edges.end(), [](const TraceEdge& a, const TraceEdge& b) { return a.m_time < b.m_time; });
+}
+
+/// Write the trace 'name' of 'edges', whose times start at 'start', and the characters of 'strokes' in the file '<directory>/<name>.trace', see tools/replay_bench.cpp.
+/// Return false, after printing why, if it cannot be written.
+static bool writeTraceFile(const char* directory, const char* name, const std::vector<TraceEdge>& edges, uint32_t start, const std::vector<Stroke>& strokes) {
+  char path[512];
+  snprintf(path, sizeof(path), "%s/%s.trace", directory, name);
+  FILE* file = fopen(path, "w");
+  if (file == nullptr) {
+    perror(path);
+    return false;
+  }
+
+  fprintf(file, "# %s, generated by code/tools/corpus_trace.cpp: <time in micro-seconds> <line> <column> press|release, then the characters typed\n", name);
+  for (const TraceEdge& edge : edges) {
+    fprintf(file, "%u %d %d %s\n", edge.m_time - start, edge.m_pos.m_line, edge.m_pos.m_column, edge.m_isPressed ? "press" : "release");
+  }
+  for (const Stroke& stroke : strokes) fprintf(file, "typed 0x%04X\n", stroke.m_typed);
+
+  if (fclose(file) != 0) {
+    perror(path);
+    return false;
+  }
+  return true;
+}
+
+/// Parse a list of numbers separated by commas. Return the number of values.
+static int parseList(const char* text, int* values, int maxValues) {
+  int count = 0;
+  for (const char* p = text; *p != 0 && count < maxValues;) {
+    values[count++] = atoi(p);
+    p = strchr(p, ',');
+    if (p == nullptr) break;
+    ++p;
+  }
+  return count;
+}
+
+int main(int argc, char** argv) {
+  int wpms[MAX_TRACES] = { 60, 100, 140, 180, 220, 260 };
+  int numWpms = 6;
+  double dwell = 90000;
+  double bounceMax = 3000;
+  double bounceRate = 0.1;
+  int maxChars = 300;
+  uint32_t seed = 1;
+  const char* traceDirectory = nullptr;
+
+  int arg = 1;
+  for (; arg + 1 < argc && strncmp(argv[arg], "--", 2) == 0; arg += 2) {
+    const char* option = argv[arg];
+    const char* value = argv[arg + 1];
+    if (strcmp(option, "--wpm") == 0) {
+      numWpms = parseList(value, wpms, MAX_TRACES);
+    } else if (strcmp(option, "--dwell") == 0) {
+      dwell = atof(value);
+    } else if (strcmp(option, "--bounce") == 0) {
+      bounceMax = atof(value);
+    } else if (strcmp(option, "--bounce-rate") == 0) {
+      bounceRate = atof(value);
+    } else if (strcmp(option, "--max-chars") == 0) {
+      maxChars = atoi(value);
+    } else if (strcmp(option, "--seed") == 0) {
+      seed = strtoul(value, nullptr, 0);
+    } else if (strcmp(option, "--trace-dir") == 0) {
+      traceDirectory = value;
+    } else {
+      fprintf(stderr, "unknown option %s\n", option);
+      return 2;
+    }
+  }
+  if (argc - arg != 2 || numWpms == 0) {
+    fprintf(stderr, "usage: %s [--wpm <list>] [--dwell <us>] [--bounce <us>] [--bounce-rate <p>] [--max-chars <n>] [--seed <n>] [--trace-dir <dir>] <corpus> <output header>\n", argv[0]);
+    return 2;
+  }
+  const char* corpusPath = argv[arg];
+  const char* outputPath = argv[arg + 1];
+
+  static KeymapTables tables;
+  Keymap::flatten(s_layers, sizeof(s_layers) / sizeof(Layer), tables);
+  memcpy(tables.m_onRelease, onRelease, sizeof(tables.m_onRelease));
+  memcpy(tables.m_layerKeys, s_layerKeys, sizeof(tables.m_layerKeys));
+  memcpy(tables.m_layerActivations, s_layerActivations, sizeof(tables.m_layerActivations));
+
+  // Find the strokes of the corpus once, they are the same at every speed.
+  FILE* corpus = fopen(corpusPath, "r");
+  if (corpus == nullptr) {
+    perror(corpusPath);
+    return 1;
+  }
+  std::vector<Stroke> strokes;
+  int skipped = 0;
+  for (int c; int(strokes.size()) < maxChars && (c = fgetc(corpus)) != EOF;) {
+    Stroke stroke;
+    if (findStroke(tables, char(c), stroke)) {
+      strokes.push_back(stroke);
+    } else if (c != '\r') {
+      skipped++;
+    }
+  }
+  fclose(corpus);
+  if (strokes.empty()) {
+    fprintf(stderr, "%s: nothing that the keymap can type\n", corpusPath);
+    return 1;
+  }
+  if (skipped > 0) fprintf(stderr, "skipped %d characters that the keymap cannot type\n", skipped);
+
+  FILE* output = fopen(outputPath, "w");
+  if (output == nullptr) {
+    perror(outputPath);
+    return 1;
+  }
+  fprintf(output, "#pragma once\n#include \"replay.h\"\n\n");
+  fprintf(output, "// Generated by code/tools/corpus_trace.cpp from %zu characters of %s, do not edit.\n", strokes.size(), corpusPath);
+  fprintf(output, "// Options: --dwell %g --bounce %g --bounce-rate %g --seed %u\n\n", dwell, bounceMax, bounceRate, seed);
+  fprintf(output, "namespace ReplayImpl {\n");
+
+  for (int trace = 0; trace < numWpms; ++trace) {
+    int wpm = wpms[trace];
+    s_random = seed * 2654435761u + trace + 1;
+
+    // Each switch chatters for its own duration, most of them are clean and a few are worn out.
+    double bounces[NUM_LINES][NUM_COLUMNS];
+    for (int line = 0; line < NUM_LINES; ++line) {
+      for (int column = 0; column < NUM_COLUMNS; ++column) {
+        double u = nextRandom();
+        bounces[line][column] = bounceMax * u * u;
+      }
+    }
+
+    // A word is 5 characters.
+    double interval = 60e6 / (wpm * 5.0);
+    std::vector<double> presses;
+    double lastPress[NUM_LINES][NUM_COLUMNS] = {};
+    double time = 200000;
+    for (const Stroke& stroke : strokes) {
+      time += interval * (0.6 + 0.8 * nextRandom());
+
+      // The same finger cannot press a switch again before it was released.
+      double& last = lastPress[stroke.m_pos.m_line][stroke.m_pos.m_column];
+      time = std::max(time, last + MIN_HOLD + MIN_GAP);
+      last = time;
+      presses.push_back(time);
+    }
+
+    std::vector<Hold> holds;
+    for (size_t i = 0; i < strokes.size(); ++i) {
+      const Stroke& stroke = strokes[i];
+      double press = presses[i];
+      double release = press + std::max(MIN_HOLD, dwell * (0.7 + 0.6 * nextRandom()));
+      double nextPress = i + 1 < strokes.size() ? presses[i + 1] : 1e18;
+
+      for (Pos layerKey : stroke.m_layerKeys) {
+        double lead = LAYER_LEAD * dwell * (0.5 + nextRandom());
+        double layerRelease = release + LAYER_LAG * dwell * (0.5 + nextRandom());
+
+        // A layer key that the next character does not use is released before the next press, but not before the key it modifies is pressed.
+        bool isUsedNext = i + 1 < strokes.size() && std::find(strokes[i + 1].m_layerKeys.begin(), strokes[i + 1].m_layerKeys.end(), layerKey) != strokes[i + 1].m_layerKeys.end();
+        if (!isUsedNext) layerRelease = std::max(press + MIN_HOLD, std::min(layerRelease, nextPress - MIN_GAP));
+        addHold(holds, Hold{ layerKey, press - lead, layerRelease, true });
+      }
+      addHold(holds, Hold{ stroke.m_pos, press, release, false });
+    }
+
+    std::vector<TraceEdge> edges;
+    addEdges(holds, bounces, bounceRate, edges);
+    if (edges.size() > 65535) {
+      fprintf(stderr, "%d wpm: %zu edges, a trace has at most 65535, use --max-chars\n", wpm, edges.size());
+      fclose(output);
+      return 1;
+    }
+
+    fprintf(output, "\nstatic const TraceEdge s_corpus%d[] = {", wpm);
+    uint32_t start = edges[0].m_time;
+    for (size_t i = 0; i < edges.size(); ++i) {
+      const TraceEdge& edge = edges[i];
+      fprintf(output, "%s{ %u, { %d, %d }, %s },", i % 4 == 0 ? "\n  " : " ", edge.m_time - start, edge.m_pos.m_line, edge.m_pos.m_column, edge.m_isPressed ? "true" : "false");
+    }
+    fprintf(output, "\n};\n");
+
+    fprintf(output, "\nstatic const uint16_t s_corpus%dTyped[] = {", wpm);
+    for (size_t i = 0; i < strokes.size(); ++i) {
+      fprintf(output, "%s0x%04X,", i % 12 == 0 ? "\n  " : " ", strokes[i].m_typed);
+    }
+    fprintf(output, "\n};\n");
+
+    char name[32];
+    snprintf(name, sizeof(name), "corpus_%dwpm", wpm);
+    if (traceDirectory != nullptr && !writeTraceFile(traceDirectory, name, edges, start, strokes)) {
+      fclose(output);
+      return 1;
+    }
+    printf("%d wpm: %zu edges over %.1f s\n", wpm, edges.size(), (edges.back().m_time - start) / 1e6);
+  }
+
+  fprintf(output, "\nstatic const CorpusTrace s_corpusTraces[] = {\n");
+  for (int trace = 0; trace < numWpms; ++trace) {
+    int wpm = wpms[trace];
+    fprintf(output, "  { { \"corpus_%dwpm\", s_corpus%d, sizeof(s_corpus%d) / sizeof(TraceEdge) }, %d, s_corpus%dTyped, sizeof(s_corpus%dTyped) / sizeof(uint16_t) },\n", wpm, wpm, wpm, wpm, wpm, wpm);
+  }
+  fprintf(output, "};\n}\n");
+
+  if (fclose(output) != 0) {
+    perror(outputPath);
+    return 1;
+  }
+  return 0;
+}
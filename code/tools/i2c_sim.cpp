@@ -0,0 +1,692 @@
+// Simulate the I2C bus of the MCP23008 input backend with injected faults, to compare ways to recover from bus errors.
+//
+// Build: g++ -O2 -I../tests/host -o i2c_sim i2c_sim.cpp
+// Usage: i2c_sim [options]
+//
+// Options:
+//   --freq <list>         Bus frequencies in Hz, separated by commas (100000,400000,1000000 by default). The backend lowers them to the highest one of the board.
+//   --duration <ms>       Simulated time of each run (2000 by default).
+//   --schedule <file>     Faults to inject, instead of one run per kind of fault. Each line is "<kind> <chip> <start ms> <duration ms> [parameter]", where <chip> is a port of board.h.
+//   --recreate-pulses <n> SCL pulses produced when the I2C peripheral is created again (1 by default), see below.
+//   --recovered <n>       Consecutive correct frames that end a recovery (10 by default), see below.
+//   --seed <n>            Seed of the typing and of the floating pins (1 by default).
+//
+// Kinds of faults:
+//   nack        The chip does not acknowledge its address.
+//   stuck_sda   A chip holds SDA low, as if a transfer had been cut in the middle of a byte. Every transfer fails until SCL is pulsed up to 9 times. The duration is ignored.
+//   power_loss  The chip does not answer, then comes back with the registers at their power-on values: its pins have no pull-up and float. With a duration of 0, the chip resets
+//               between two transfers without any of them failing, like after a brown-out.
+//   stretch     The chip stretches the clock by <parameter> micro-seconds on each byte (200 by default). Transfers fail after I2C_TRANSFER_TIMEOUT, see timedI2c.h.
+//
+// The backend of inputMcp23008.cpp, with the MCP23008 driver and I2cClock, is compiled in this file with SimI2c as its I2cBus, see i2cBus.h, for the board of VERSION.
+// SimI2c plays the transfers on a bus simulated bit by bit: a byte takes 9 clock periods, a transfer adds a start, a stop and the driver overhead, at the clock set by the
+// backend. The registers of the chips behave like an MCP23008 and their GPIO register reads the switches of a random typing. Each run scans the chips in a loop, and prints
+// for each recovery strategy:
+//   frames    Frames the run had time for without faults: its duration divided by the period of a fault-free scan loop.
+//   lost      Frames among them with no successful scan, spent on failed scans and on the recoveries. The firmware keeps the previous state of every key meanwhile.
+//   wrong     Scan frames that succeeded but read a key in the wrong state.
+//   missed    Key edges that were never seen, because every frame between them was lost or wrong.
+//   recovery  Longest time from the end of a fault (its start for stuck_sda) to the end of the first --recovered consecutive correct frames, counted from the frame after
+//             the registers of the chip were set up again. The floating pins of a chip that lost its pull-ups read at random, so a frame can be right by chance: "never"
+//             if the registers were not set up again, or if no such run of frames followed.
+//   scan      Average duration of a successful scan.
+//
+// Recovery strategies:
+//   current     InputBackend::scan() of inputMcp23008.cpp: create the I2C peripheral ten times, then reset every chip, and lose the frame. After I2C_ERROR_THRESHOLD errors
+//               I2cClock also steps the clock down for many windows, the slower scans count as lost frames.
+//   reinit      Create the I2C peripheral once and reset every chip, and lose the frame.
+//   bus_clear   Pulse SCL 9 times and send a stop, reset the chip in error only and read it again.
+//   verify      Like bus_clear, and read back the pull-ups of one chip per frame to reset the chips that lost their configuration.
+// The other strategies are candidate changes of the recovery of the backend, written below on its MCP23008 handles and bus. They keep the clock of the bus.
+//
+// The simulation cannot tell why creating the I2C peripheral again helps on the real keyboard. It assumes that each creation pulses SCL once while the pins are switched to the I2C function,
+// which would release a stuck SDA after at most 9 creations. Use --recreate-pulses 0 to see the strategies without this effect.
+
+#include "../arduino_keyboard/board.h"
+
+#include <algorithm>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#if INPUT_BACKEND != INPUT_BACKEND_MCP23008
+#error "the simulation runs the MCP23008 backend"
+#endif
+
+/// Number of chips, one per port of the board.
+static const int MAX_CHIPS = NUM_MCP_PORTS;
+
+/// Largest number of bus frequencies.
+static const int MAX_FREQUENCIES = 8;
+
+/// Time spent by the driver on each transfer, in micro-seconds.
+static const double TRANSFER_OVERHEAD = 5;
+
+/// Time to delete and create again the I2C peripheral, in micro-seconds.
+static const double RECREATE_TIME = 20;
+
+/// Time spent by the main loop outside of the scan, in micro-seconds.
+static const double LOOP_TIME = 300;
+
+/// MCP23008 registers, see MCP23008.cpp.
+static const uint8_t REGISTER_IODIR = 0x00;
+static const uint8_t REGISTER_IPOL = 0x01;
+static const uint8_t REGISTER_GPPU = 0x06;
+static const uint8_t REGISTER_GPIO = 0x09;
+static const int NUM_REGISTERS = 11;
+
+enum FaultKind {
+  FAULT_NACK,
+  FAULT_STUCK_SDA,
+  FAULT_POWER_LOSS,
+  FAULT_STRETCH,
+
+  NUM_FAULT_KINDS
+};
+
+static const char* const s_faultNames[NUM_FAULT_KINDS] = { "nack", "stuck_sda", "power_loss", "stretch" };
+
+/// A fault injected at a time, in micro-seconds.
+struct Fault {
+  FaultKind m_kind;
+  int m_chip;
+  double m_start;
+  double m_end;
+  double m_parameter;
+
+  /// Set once the fault took effect.
+  bool m_applied;
+};
+
+enum Strategy {
+  STRATEGY_CURRENT,
+  STRATEGY_REINIT,
+  STRATEGY_BUS_CLEAR,
+  STRATEGY_VERIFY,
+
+  NUM_STRATEGIES
+};
+
+static const char* const s_strategyNames[NUM_STRATEGIES] = { "current", "reinit", "bus_clear", "verify" };
+
+/// A switch edge of the typing.
+struct Edge {
+  double m_time;
+  int m_chip;
+  int m_pin;
+  bool m_isPressed;
+};
+
+/// Random generator state, see nextRandom().
+static uint32_t s_random = 1;
+
+/// Random number, from a xorshift32 generator like Replay::generate().
+static uint32_t nextRandom() {
+  s_random ^= s_random << 13;
+  s_random ^= s_random >> 17;
+  s_random ^= s_random << 5;
+  return s_random;
+}
+
+/// The switches, as a sorted list of edges.
+class Typing {
+public:
+  /// Random typing on 'numChips' chips for 'duration' micro-seconds: a new key every 60 to 200 ms, held 30 to 150 ms.
+  Typing(int numChips, double duration) {
+    double time = 20000;
+    while (time < duration) {
+      int chip = nextRandom() % numChips;
+      int pin = nextRandom() % 8;
+      double hold = 30000 + nextRandom() % 120000;
+      if (!isPressed(chip, pin, time)) {
+        m_edges.push_back(Edge{ time, chip, pin, true });
+        m_edges.push_back(Edge{ time + hold, chip, pin, false });
+      }
+      time += 60000 + nextRandom() % 140000;
+    }
+    std::stable_sort(m_edges.begin(), m_edges.end(), [](const Edge& a, const Edge& b) { return a.m_time < b.m_time; });
+  }
+
+  /// Whether the switch on 'pin' of 'chip' is pressed at 'time'.
+  bool isPressed(int chip, int pin, double time) const {
+    bool pressed = false;
+    for (const Edge& edge : m_edges) {
+      if (edge.m_time > time) break;
+      if (edge.m_chip == chip && edge.m_pin == pin) pressed = edge.m_isPressed;
+    }
+    return pressed;
+  }
+
+  /// The pins of 'chip' that are pressed at 'time', as a bitmask.
+  uint8_t pressed(int chip, double time) const {
+    uint8_t pins = 0;
+    for (int pin = 0; pin < 8; ++pin) {
+      if (isPressed(chip, pin, time)) pins |= 1 << pin;
+    }
+    return pins;
+  }
+
+  const std::vector<Edge>& edges() const { return m_edges; }
+
+private:
+  std::vector<Edge> m_edges;
+};
+
+/// The I2C bus and the chips on it, with the simulated time. The chips are numbered by their port in board.h.
+class Bus {
+public:
+  Bus(const Typing& typing, std::vector<Fault> faults, int recreatePulses)
+    : m_now(0), m_bitTime(1e6 / s_board.m_i2cFrequency), m_typing(typing), m_faults(faults), m_recreatePulses(recreatePulses), m_stuckPulses(0) {
+    for (int chip = 0; chip < MAX_CHIPS; ++chip) {
+      powerOn(chip);
+      m_readTimes[chip] = 0;
+    }
+  }
+
+  double now() const { return m_now; }
+  void wait(double time) { m_now += time; }
+
+  /// Set the clock of the bus to 'hz'.
+  void setFrequency(int hz) { m_bitTime = 1e6 / hz; }
+
+  /// Write 'length' bytes to 'chip', -1 if no chip has the address, like mbed::I2C::write(). Return 0 on success.
+  int write(int chip, const uint8_t* data, int length) {
+    if (!start(chip, length)) return 1;
+    m_pointer[chip] = data[0];
+    for (int i = 1; i < length; ++i) {
+      if (m_pointer[chip] < NUM_REGISTERS && m_pointer[chip] != REGISTER_GPIO) m_registers[chip][m_pointer[chip]] = data[i];
+      m_pointer[chip]++;
+    }
+
+    // The pins read the switches again once they are inputs with pull-ups, as the backend sets them up.
+    bool isSetUp = m_registers[chip][REGISTER_IODIR] == 0xFF && m_registers[chip][REGISTER_IPOL] == 0 && m_registers[chip][REGISTER_GPPU] == 0xFF;
+    if (isSetUp && !m_isSetUp[chip]) m_setUpTimes[chip].push_back(m_now);
+    m_isSetUp[chip] = isSetUp;
+    return 0;
+  }
+
+  /// Read 'length' bytes from 'chip' from the register pointer set by the last write, like mbed::I2C::read(). Return 0 on success.
+  int read(int chip, uint8_t* data, int length) {
+    if (!start(chip, length)) return 1;
+    for (int i = 0; i < length; ++i) {
+      uint8_t reg = m_pointer[chip]++;
+      if (reg != REGISTER_GPIO) {
+        data[i] = reg < NUM_REGISTERS ? m_registers[chip][reg] : 0;
+        continue;
+      }
+
+      // The data is sampled at the end of the transfer. Pressed switches pull their pin low, released ones are pulled up or float.
+      uint8_t pullups = m_registers[chip][REGISTER_GPPU];
+      uint8_t floating = ~pullups & nextRandom();
+      data[i] = (~m_typing.pressed(chip, m_now) & (pullups | floating)) ^ m_registers[chip][REGISTER_IPOL];
+      m_readTimes[chip] = m_now;
+    }
+    return 0;
+  }
+
+  /// Delete and create again the I2C peripheral.
+  void recreate() {
+    m_now += RECREATE_TIME;
+    pulse(m_recreatePulses);
+  }
+
+  /// Pulse SCL 9 times then send a stop, so that a chip holding SDA finishes its byte.
+  void clear() {
+    m_now += TRANSFER_OVERHEAD + 10 * m_bitTime;
+    pulse(9);
+  }
+
+  /// Time of the last read of the GPIO register of 'chip'.
+  double readTime(int chip) const { return m_readTimes[chip]; }
+
+  /// First time from 'from' at which the backend set up the registers of 'chip', -1 if never.
+  double setUpTime(int chip, double from) const {
+    for (double time : m_setUpTimes[chip]) {
+      if (time >= from) return time;
+    }
+    return -1;
+  }
+
+private:
+  /// Set the registers of 'chip' to their power-on values.
+  void powerOn(int chip) {
+    memset(m_registers[chip], 0, sizeof(m_registers[chip]));
+    m_registers[chip][REGISTER_IODIR] = 0xFF;
+    m_pointer[chip] = 0;
+    m_isSetUp[chip] = false;
+  }
+
+  /// 'count' pulses of SCL.
+  void pulse(int count) {
+    m_stuckPulses = std::max(0, m_stuckPulses - count);
+  }
+
+  /// Take effect of the faults that started, and return the one of 'kind' active on 'chip', if any.
+  const Fault* activeFault(FaultKind kind, int chip) {
+    const Fault* active = nullptr;
+    for (Fault& fault : m_faults) {
+      if (fault.m_start > m_now) continue;
+      if (!fault.m_applied) {
+        fault.m_applied = true;
+        if (fault.m_kind == FAULT_STUCK_SDA) m_stuckPulses = 1 + nextRandom() % 9;
+        if (fault.m_kind == FAULT_POWER_LOSS) powerOn(fault.m_chip);
+      }
+      if (fault.m_kind == kind && fault.m_chip == chip && m_now < fault.m_end) active = &fault;
+    }
+    return active;
+  }
+
+  /// Spend the time of a transfer of 'length' bytes after the address to 'chip'. Return false if the transfer fails.
+  bool start(int chip, int length) {
+    m_now += TRANSFER_OVERHEAD;
+    activeFault(FAULT_NACK, chip);
+
+    // No start condition can be sent while SDA is held low.
+    if (m_stuckPulses > 0) {
+      m_now += m_bitTime;
+      return false;
+    }
+
+    // Start and address byte.
+    m_now += 10 * m_bitTime;
+    if (chip < 0 || activeFault(FAULT_NACK, chip) != nullptr || activeFault(FAULT_POWER_LOSS, chip) != nullptr) {
+      m_now += m_bitTime;
+      return false;
+    }
+
+    // Data bytes and stop. TimedI2c gives up on the transfer after I2C_TRANSFER_TIMEOUT.
+    const Fault* stretch = activeFault(FAULT_STRETCH, chip);
+    double stretchTime = stretch != nullptr ? stretch->m_parameter : 0;
+    double transferTime = (length + 1) * stretchTime + length * 9 * m_bitTime + m_bitTime;
+    if (11 * m_bitTime + transferTime > I2C_TRANSFER_TIMEOUT) {
+      m_now += I2C_TRANSFER_TIMEOUT - 11 * m_bitTime;
+      return false;
+    }
+    m_now += transferTime;
+    return true;
+  }
+
+  double m_now;
+  double m_bitTime;
+  const Typing& m_typing;
+  std::vector<Fault> m_faults;
+  int m_recreatePulses;
+
+  /// Remaining SCL pulses before a stuck SDA is released, 0 if SDA is free.
+  int m_stuckPulses;
+
+  uint8_t m_registers[MAX_CHIPS][NUM_REGISTERS];
+  uint8_t m_pointer[MAX_CHIPS];
+  double m_readTimes[MAX_CHIPS];
+
+  /// Whether the registers of each chip are set up by the backend, and the times they were set up since the start of the run.
+  bool m_isSetUp[MAX_CHIPS];
+  std::vector<double> m_setUpTimes[MAX_CHIPS];
+};
+
+/// The bus of the current run.
+static Bus* s_bus = nullptr;
+
+/// The pins of the bus, as named by mbed.
+enum PinName { p8 = 8, p9 = 9 };
+
+/// Called by the driver on a fatal error, like mbed's error().
+static void error(const char* message) {
+  fprintf(stderr, "error: %s", message);
+  exit(1);
+}
+
+/// A handle on the simulated bus with the interface of mbed's I2C. Creating one is creating the I2C peripheral again.
+class SimI2c {
+public:
+  SimI2c(PinName, PinName) {
+    s_bus->recreate();
+  }
+
+  void frequency(int hz) {
+    s_bus->setFrequency(hz);
+  }
+
+  int write(int address, const char* data, int length, bool = false) {
+    return s_bus->write(chip(address), reinterpret_cast<const uint8_t*>(data), length);
+  }
+
+  int read(int address, char* data, int length, bool = false) {
+    return s_bus->read(chip(address), reinterpret_cast<uint8_t*>(data), length);
+  }
+
+private:
+  /// Port of the chip at the 8 bits I2C address 'address', or -1 if there is none.
+  static int chip(int address) {
+    if ((address >> 1 & 0xF8) != 0x20) return -1;
+    for (int port = 0; port < MAX_CHIPS; ++port) {
+      if (s_board.m_mcp23008Addresses[port] == (address >> 1 & 7)) return port;
+    }
+    return -1;
+  }
+};
+
+#define I2C_BUS SimI2c
+
+#include "../arduino_keyboard/MCP23008.cpp"
+#include "../arduino_keyboard/i2cClock.cpp"
+#include "../arduino_keyboard/inputMcp23008.cpp"
+
+// The globals of the firmware used by the backend, without the rest of their modules.
+namespace PerfImpl {
+uint32_t s_counters[Perf::NUM_COUNTERS];
+uint32_t s_histograms[Perf::NUM_HISTOGRAMS][PERF_HISTOGRAM_BUCKETS];
+uint32_t s_maximums[Perf::NUM_HISTOGRAMS];
+}
+
+namespace RecorderImpl {
+Ring s_ring;
+}
+
+namespace SettingsImpl {
+uint32_t s_values[Settings::NUM_SETTINGS];
+}
+
+namespace DeadlineImpl {
+volatile Deadline::Stage s_stage;
+volatile int8_t s_chip;
+}
+
+unsigned long micros() {
+  return (unsigned long)s_bus->now();
+}
+
+/// Number of frames scanned by the verify strategy.
+static uint32_t s_verifiedFrames = 0;
+
+/// MCP23008::reset(), set_input_pins() and set_pullups(), as resetI2C() of inputMcp23008.cpp does for each chip.
+static void setUp(MCP23008& mcp) {
+  mcp.reset();
+  mcp.set_input_pins(MCP23008::Pin_All);
+  mcp.set_pullups(MCP23008::Pin_All);
+}
+
+/// Scan every chip with 'strategy' into 'pressed', as InputBackend::scan() does. Return false if the frame is lost.
+static bool scan(Strategy strategy, InputFrame& pressed) {
+  using namespace InputMcp23008Impl;
+
+  if (strategy == STRATEGY_CURRENT) return InputBackend::scan(pressed);
+
+  pressed = 0;
+  for (int port = 0; port < MAX_CHIPS; ++port) {
+    MCP23008& mcp = s_mcps[port];
+    uint8_t pins = mcp.read_inputs();
+    if (mcp.isError()) {
+      if (strategy == STRATEGY_REINIT) {
+        resetI2C();
+        return false;
+      }
+
+      s_bus->clear();
+      setUp(mcp);
+      pins = mcp.read_inputs();
+      if (mcp.isError()) return false;
+    }
+    pressed |= InputFrame(uint8_t(~pins)) << (8 * port);
+  }
+
+  // A chip that lost power reads its floating pins without error, only its registers tell.
+  if (strategy == STRATEGY_VERIFY) {
+    MCP23008& mcp = s_mcps[s_verifiedFrames++ % MAX_CHIPS];
+    if (mcp.get_pullups() != 0xFF || mcp.isError()) {
+      s_bus->clear();
+      setUp(mcp);
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Results of one run.
+struct Result {
+  int m_frames;
+  int m_lost;
+  int m_wrong;
+  int m_missed;
+  double m_recovery;
+  double m_scanTime;
+};
+
+/// A scan and what it read.
+struct Frame {
+  bool m_isOk;
+  bool m_isCorrect;
+  double m_start;
+  double m_end;
+  double m_times[MAX_CHIPS];
+  uint8_t m_pressed[MAX_CHIPS];
+};
+
+/// Set up the backend on 'bus' at 'frequency', as InputBackend::init() does at startup.
+static void init(Bus& bus, double frequency) {
+  s_bus = &bus;
+  SettingsImpl::s_values[Settings::SETTING_I2C_FREQUENCY] = uint32_t(frequency);
+  InputBackend::init();
+  s_verifiedFrames = 0;
+}
+
+/// End of the first 'count' consecutive correct frames of 'frames' that start from 'from', -1 if there are none. A lost or wrong frame starts the count again.
+static double recoveredTime(const std::vector<Frame>& frames, double from, int count) {
+  int correct = 0;
+  for (const Frame& frame : frames) {
+    if (frame.m_start < from) continue;
+    correct = frame.m_isOk && frame.m_isCorrect ? correct + 1 : 0;
+    if (correct == count) return frame.m_end;
+  }
+  return -1;
+}
+
+/// Run the scan loop for 'duration' micro-seconds with 'strategy'.
+static Result run(Strategy strategy, double frequency, double duration, const Typing& typing, const std::vector<Fault>& faults, int recreatePulses, int recoveredFrames) {
+  InputFrame pressed;
+
+  // The period of the scan loop on the same bus without faults. A recovery can take many times a scan, so the frames lost are counted in these periods rather than in failed scans.
+  double period = 0;
+  {
+    Bus cleanBus(typing, std::vector<Fault>(), recreatePulses);
+    init(cleanBus, frequency);
+    double start = cleanBus.now();
+    scan(strategy, pressed);
+    period = cleanBus.now() - start + LOOP_TIME;
+  }
+
+  Bus bus(typing, faults, recreatePulses);
+  init(bus, frequency);
+
+  Result result = {};
+  std::vector<Frame> frames;
+  int succeeded = 0;
+  double scanTotal = 0;
+  double begin = bus.now();
+  while (bus.now() < duration) {
+    Frame frame = {};
+    frame.m_start = bus.now();
+    frame.m_isOk = scan(strategy, pressed);
+    frame.m_end = bus.now();
+
+    if (frame.m_isOk) {
+      succeeded++;
+      scanTotal += frame.m_end - frame.m_start;
+      frame.m_isCorrect = true;
+      for (int chip = 0; chip < MAX_CHIPS; ++chip) {
+        frame.m_times[chip] = bus.readTime(chip);
+        frame.m_pressed[chip] = uint8_t(pressed >> (8 * chip));
+        if (frame.m_pressed[chip] != typing.pressed(chip, frame.m_times[chip])) frame.m_isCorrect = false;
+      }
+      if (!frame.m_isCorrect) result.m_wrong++;
+    }
+    frames.push_back(frame);
+    bus.wait(LOOP_TIME);
+  }
+  result.m_frames = int((bus.now() - begin) / period);
+  result.m_lost = std::max(0, result.m_frames - succeeded);
+  result.m_scanTime = scanTotal / std::max(1, succeeded);
+
+  // An edge is seen if a successful frame read the new state of its switch before the next edge of the switch.
+  const std::vector<Edge>& edges = typing.edges();
+  for (size_t i = 0; i < edges.size(); ++i) {
+    const Edge& edge = edges[i];
+    if (edge.m_time >= duration) break;
+    double next = duration;
+    for (size_t j = i + 1; j < edges.size(); ++j) {
+      if (edges[j].m_chip == edge.m_chip && edges[j].m_pin == edge.m_pin) {
+        next = edges[j].m_time;
+        break;
+      }
+    }
+
+    bool seen = false;
+    for (const Frame& frame : frames) {
+      double time = frame.m_times[edge.m_chip];
+      if (!frame.m_isOk || time < edge.m_time || time >= next) continue;
+      if (((frame.m_pressed[edge.m_chip] >> edge.m_pin & 1) != 0) == edge.m_isPressed) {
+        seen = true;
+        break;
+      }
+    }
+    if (!seen) result.m_missed++;
+  }
+
+  // Recovery is measured from the time the chip could answer again. A chip that lost power is only read right once the backend set up its registers again, the frames are
+  // counted from the next one.
+  for (const Fault& fault : faults) {
+    double from = fault.m_kind == FAULT_STUCK_SDA ? fault.m_start : fault.m_end;
+    double setUp = fault.m_kind == FAULT_POWER_LOSS ? bus.setUpTime(fault.m_chip, fault.m_start) : from;
+    double recovered = setUp < 0 ? -1 : recoveredTime(frames, std::max(from, setUp), recoveredFrames);
+    if (recovered < 0 || result.m_recovery < 0) {
+      result.m_recovery = -1;
+    } else {
+      result.m_recovery = std::max(result.m_recovery, recovered - from);
+    }
+  }
+  return result;
+}
+
+/// Read a schedule of faults. Return false on error.
+static bool readSchedule(const char* path, std::vector<Fault>& faults) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    perror(path);
+    return false;
+  }
+
+  char line[256];
+  for (int number = 1; fgets(line, sizeof(line), file) != nullptr; ++number) {
+    if (line[0] == '#' || line[0] == '\n') continue;
+
+    char kind[32];
+    int chip;
+    double start, duration, parameter = 200;
+    if (sscanf(line, "%31s %d %lf %lf %lf", kind, &chip, &start, &duration, &parameter) < 4 || chip < 0 || chip >= MAX_CHIPS) {
+      fprintf(stderr, "%s:%d: expected \"<kind> <chip> <start ms> <duration ms> [parameter]\"\n", path, number);
+      fclose(file);
+      return false;
+    }
+
+    int k = 0;
+    while (k < NUM_FAULT_KINDS && strcmp(kind, s_faultNames[k]) != 0) ++k;
+    if (k == NUM_FAULT_KINDS) {
+      fprintf(stderr, "%s:%d: unknown fault %s\n", path, number, kind);
+      fclose(file);
+      return false;
+    }
+    faults.push_back(Fault{ FaultKind(k), chip, start * 1000, (start + duration) * 1000, parameter, false });
+  }
+  fclose(file);
+  return true;
+}
+
+/// Parse a list of numbers separated by commas. Return the number of values.
+static int parseList(const char* text, double* values, int maxValues) {
+  int count = 0;
+  for (const char* p = text; *p != 0 && count < maxValues;) {
+    values[count++] = atof(p);
+    p = strchr(p, ',');
+    if (p == nullptr) break;
+    ++p;
+  }
+  return count;
+}
+
+int main(int argc, char** argv) {
+  double frequencies[MAX_FREQUENCIES] = { 100000, 400000, 1000000 };
+  int numFrequencies = 3;
+  double duration = 2000000;
+  const char* schedulePath = nullptr;
+  int recreatePulses = 1;
+  int recoveredFrames = 10;
+  uint32_t seed = 1;
+
+  for (int arg = 1; arg < argc; arg += 2) {
+    const char* option = argv[arg];
+    const char* value = arg + 1 < argc ? argv[arg + 1] : nullptr;
+    if (value == nullptr) {
+      fprintf(stderr, "usage: %s [--freq <list>] [--duration <ms>] [--schedule <file>] [--recreate-pulses <n>] [--recovered <n>] [--seed <n>]\n", argv[0]);
+      return 2;
+    }
+    if (strcmp(option, "--freq") == 0) {
+      numFrequencies = parseList(value, frequencies, MAX_FREQUENCIES);
+    } else if (strcmp(option, "--duration") == 0) {
+      duration = atof(value) * 1000;
+    } else if (strcmp(option, "--schedule") == 0) {
+      schedulePath = value;
+    } else if (strcmp(option, "--recreate-pulses") == 0) {
+      recreatePulses = atoi(value);
+    } else if (strcmp(option, "--recovered") == 0) {
+      recoveredFrames = std::max(atoi(value), 1);
+    } else if (strcmp(option, "--seed") == 0) {
+      seed = strtoul(value, nullptr, 0);
+    } else {
+      fprintf(stderr, "unknown option %s\n", option);
+      return 2;
+    }
+  }
+
+  // Without a schedule, each kind of fault is injected alone on chip 1, from a quarter of the run for 50 ms. The power loss is a brown-out, which no transfer notices.
+  std::vector<std::vector<Fault>> scenarios;
+  std::vector<const char*> scenarioNames;
+  if (schedulePath != nullptr) {
+    std::vector<Fault> faults;
+    if (!readSchedule(schedulePath, faults)) return 1;
+    scenarios.push_back(faults);
+    scenarioNames.push_back(schedulePath);
+  } else {
+    for (int kind = 0; kind < NUM_FAULT_KINDS; ++kind) {
+      double start = duration / 4;
+      double end = kind == FAULT_POWER_LOSS ? start : start + 50000;
+      scenarios.push_back({ Fault{ FaultKind(kind), 1 % MAX_CHIPS, start, end, 200, false } });
+      scenarioNames.push_back(s_faultNames[kind]);
+    }
+  }
+
+  s_random = seed * 2654435761u + 1;
+  Typing typing(MAX_CHIPS, duration);
+
+  printf("%-12s %-10s %8s %7s %6s %6s %7s %10s %9s\n", "faults", "strategy", "freq", "frames", "lost", "wrong", "missed", "recovery", "scan");
+  for (size_t scenario = 0; scenario < scenarios.size(); ++scenario) {
+    for (int f = 0; f < numFrequencies; ++f) {
+      for (int strategy = 0; strategy < NUM_STRATEGIES; ++strategy) {
+        // Same floating pins and stuck bytes for every strategy.
+        s_random = seed * 2654435761u + 7;
+        Result result = run(Strategy(strategy), frequencies[f], duration, typing, scenarios[scenario], recreatePulses, recoveredFrames);
+
+        char recovery[16];
+        if (result.m_recovery < 0) {
+          snprintf(recovery, sizeof(recovery), "never");
+        } else {
+          snprintf(recovery, sizeof(recovery), "%.0fus", result.m_recovery);
+        }
+        printf("%-12s %-10s %8.0f %7d %6d %6d %7d %10s %7.0fus\n", scenarioNames[scenario], s_strategyNames[strategy], frequencies[f], result.m_frames, result.m_lost, result.m_wrong,
+               result.m_missed, recovery, result.m_scanTime);
+      }
+    }
+  }
+  return 0;
+}
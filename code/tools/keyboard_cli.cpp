@@ -0,0 +1,381 @@
+// Command line tool to talk to the keyboard control channel from Linux, through hidraw.
+//
+// Build: g++ -O2 -o keyboard_cli keyboard_cli.cpp
+// Usage: keyboard_cli /dev/hidrawN <command> [arguments]
+//
+// Commands:
+//   ping                 Check that the firmware answers.
+//   counters             Print every performance counter.
+//   histograms           Print every performance histogram.
+//   reset-perf           Clear the performance counters and histograms.
+//   settings             Print every runtime setting with its allowed range.
+//   set <name> <value>   Change a runtime setting.
+//   save-settings        Store the current settings in the flash of the keyboard, so that they survive a restart.
+//   telemetry            Print the per-key health counters.
+//   keymap-info          Print which keymap is active.
+//   keymap-load <file>   Load a keymap image made by keymap_compiler.
+//   heatmap              Print the presses of each key, for each layer combination that was used.
+//   recorder [live]      Print the post-mortem trace saved after the last reset, or the trace of the current run, as a timeline.
+
+#include "../arduino_keyboard/config.h"
+#include "../arduino_keyboard/controlProtocol.h"
+
+#include <fcntl.h>
+#include <linux/hidraw.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+/// Handle to the hidraw device.
+static int s_device = -1;
+
+/// Read a little endian integer.
+static uint32_t read32(const uint8_t* data) {
+  return data[0] | (data[1] << 8) | (data[2] << 16) | (uint32_t(data[3]) << 24);
+}
+
+/// Read a little endian integer.
+static uint16_t read16(const uint8_t* data) {
+  return data[0] | (data[1] << 8);
+}
+
+/// Write a little endian integer.
+static void write32(uint8_t* data, uint32_t value) {
+  data[0] = value;
+  data[1] = value >> 8;
+  data[2] = value >> 16;
+  data[3] = value >> 24;
+}
+
+/// Send 'request' and wait for the answer of the same command. Return the status of the answer, or -1 on error.
+/// The keyboard only answers when idle, so a timeout can happen while typing.
+static int transact(const uint8_t* request, uint8_t* answer) {
+  uint8_t report[1 + CONTROL_REPORT_SIZE];
+  report[0] = CONTROL_REPORT_ID;
+  memcpy(report + 1, request, CONTROL_REPORT_SIZE);
+  if (write(s_device, report, sizeof(report)) != (ssize_t)sizeof(report)) {
+    perror("write");
+    return -1;
+  }
+
+  // Input reports of the keyboard itself are received on the same device, skip them.
+  for (;;) {
+    pollfd fd = { s_device, POLLIN, 0 };
+    if (poll(&fd, 1, 1000) <= 0) {
+      fprintf(stderr, "no answer from the keyboard\n");
+      return -1;
+    }
+
+    uint8_t buffer[64];
+    ssize_t length = read(s_device, buffer, sizeof(buffer));
+    if (length < 0) {
+      perror("read");
+      return -1;
+    }
+    if (length >= 1 + CONTROL_REPORT_SIZE && buffer[0] == CONTROL_REPORT_ID && buffer[1] == request[0]) {
+      memcpy(answer, buffer + 1, CONTROL_REPORT_SIZE);
+      return answer[1];
+    }
+  }
+}
+
+/// Send a request made of a command and up to two byte arguments.
+static int transact(uint8_t command, uint8_t* answer, uint8_t arg0 = 0, uint8_t arg1 = 0) {
+  uint8_t request[CONTROL_REPORT_SIZE] = { command, arg0, arg1 };
+  return transact(request, answer);
+}
+
+static int ping() {
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  if (transact(CONTROL_PING, answer) != CONTROL_OK) return 1;
+  printf("protocol version %d\n", answer[2]);
+  return answer[2] == CONTROL_PROTOCOL_VERSION ? 0 : 1;
+}
+
+static int counters() {
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  for (int index = 0; transact(CONTROL_READ_COUNTER, answer, index) == CONTROL_OK; ++index) {
+    printf("%-24s %u\n", (const char*)answer + 6, read32(answer + 2));
+  }
+  return 0;
+}
+
+static int histograms() {
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  for (int index = 0; transact(CONTROL_HISTOGRAM_INFO, answer, index) == CONTROL_OK; ++index) {
+    int numBuckets = answer[6];
+    printf("%s (max %u)\n", (const char*)answer + 7, read32(answer + 2));
+
+    for (int first = 0; first < numBuckets;) {
+      if (transact(CONTROL_READ_HISTOGRAM, answer, index, first) != CONTROL_OK) return 1;
+      int count = answer[2];
+      for (int i = 0; i < count; ++i) {
+        int bucket = first + i;
+        uint32_t value = read32(answer + 3 + 4 * i);
+        if (value == 0) continue;
+        if (bucket == 0) {
+          printf("  %10s %u\n", "0", value);
+        } else {
+          printf("  %10u %u\n", 1u << (bucket - 1), value);
+        }
+      }
+      first += count;
+    }
+  }
+  return 0;
+}
+
+static int resetPerf() {
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  return transact(CONTROL_RESET_PERF, answer) == CONTROL_OK ? 0 : 1;
+}
+
+static int settings() {
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  for (int index = 0; transact(CONTROL_GET_SETTING, answer, index) == CONTROL_OK; ++index) {
+    printf("%-24s %u [%u, %u]\n", (const char*)answer + 14, read32(answer + 2), read32(answer + 6), read32(answer + 10));
+  }
+  return 0;
+}
+
+static int set(const char* name, const char* value) {
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  for (int index = 0; transact(CONTROL_GET_SETTING, answer, index) == CONTROL_OK; ++index) {
+    if (strcmp((const char*)answer + 14, name) != 0) continue;
+
+    uint8_t request[CONTROL_REPORT_SIZE] = { CONTROL_SET_SETTING, uint8_t(index) };
+    write32(request + 2, strtoul(value, nullptr, 0));
+    if (transact(request, answer) != CONTROL_OK) {
+      fprintf(stderr, "value rejected by the keyboard\n");
+      return 1;
+    }
+    return 0;
+  }
+  fprintf(stderr, "unknown setting %s\n", name);
+  return 1;
+}
+
+static int saveSettings() {
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  if (transact(CONTROL_SAVE_SETTINGS, answer) != CONTROL_OK) {
+    fprintf(stderr, "the keyboard could not write its flash\n");
+    return 1;
+  }
+  return 0;
+}
+
+static int telemetry() {
+  // Each read returns the next page and wraps around after the last key. Read pages until we are back to the first one we got.
+  uint8_t entries[256][8];
+  int numKeys = 0;
+  int start = -1;
+  for (;;) {
+    uint8_t report[1 + TELEMETRY_PAGE_SIZE];
+    report[0] = TELEMETRY_REPORT_ID;
+    if (ioctl(s_device, HIDIOCGFEATURE(sizeof(report)), report) < 0) {
+      perror("HIDIOCGFEATURE");
+      return 1;
+    }
+
+    int firstKey = report[1];
+    int count = report[2];
+    if (firstKey == start || count == 0) break;
+    if (start < 0) start = firstKey;
+
+    for (int i = 0; i < count && firstKey + i < 256; ++i) {
+      memcpy(entries[firstKey + i], report + 3 + 8 * i, 8);
+    }
+    if (firstKey + count > numKeys) numKeys = firstKey + count;
+  }
+
+  printf("%4s %8s %8s %12s %12s\n", "key", "presses", "bounces", "min_bounce", "longest_hold");
+  for (int key = 0; key < numKeys; ++key) {
+    const uint8_t* entry = entries[key];
+    uint16_t minBounce = read16(entry + 4);
+    printf("%4d %8u %8u ", key, read16(entry), read16(entry + 2));
+    if (minBounce == 0xFFFF) {
+      printf("%12s", "-");
+    } else {
+      printf("%10uus", minBounce);
+    }
+    printf(" %10ums\n", read16(entry + 6));
+  }
+  return 0;
+}
+
+static int keymapInfo() {
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  if (transact(CONTROL_KEYMAP_INFO, answer) != CONTROL_OK) return 1;
+  uint32_t sequence = read32(answer + 2);
+  if (sequence == 0) {
+    printf("active keymap: compiled-in\n");
+  } else {
+    printf("active keymap: image #%u\n", sequence);
+  }
+  printf("image version %u, %u bytes\n", read16(answer + 6), read32(answer + 8));
+  return 0;
+}
+
+static int keymapLoad(const char* path) {
+  uint8_t image[16384];
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    perror(path);
+    return 1;
+  }
+  size_t size = fread(image, 1, sizeof(image), file);
+  fclose(file);
+
+  // Check that the keyboard expects an image of this size, the version is checked by the keyboard on commit.
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  if (transact(CONTROL_KEYMAP_INFO, answer) != CONTROL_OK) return 1;
+  if (read32(answer + 8) != size) {
+    fprintf(stderr, "%s is %zu bytes, the keyboard expects %u bytes\n", path, size, read32(answer + 8));
+    return 1;
+  }
+
+  for (size_t offset = 0; offset < size; offset += CONTROL_KEYMAP_CHUNK_SIZE) {
+    size_t length = size - offset < CONTROL_KEYMAP_CHUNK_SIZE ? size - offset : CONTROL_KEYMAP_CHUNK_SIZE;
+    uint8_t request[CONTROL_REPORT_SIZE] = { CONTROL_KEYMAP_WRITE, uint8_t(offset), uint8_t(offset >> 8), uint8_t(length) };
+    memcpy(request + 4, image + offset, length);
+    if (transact(request, answer) != CONTROL_OK) {
+      fprintf(stderr, "write rejected at offset %zu\n", offset);
+      return 1;
+    }
+  }
+
+  if (transact(CONTROL_KEYMAP_COMMIT, answer) != CONTROL_OK) {
+    fprintf(stderr, "image rejected by the keyboard\n");
+    return 1;
+  }
+  return keymapInfo();
+}
+
+static int heatmap() {
+  static const int numKeys = NUM_LINES * NUM_COLUMNS;
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  for (int mask = 0;; ++mask) {
+    uint32_t presses[numKeys];
+    for (int first = 0; first < numKeys;) {
+      int status = transact(CONTROL_READ_HEATMAP, answer, mask, first);
+      // The end of the layer combinations is reported as an invalid argument.
+      if (status == CONTROL_INVALID_ARGUMENT && first == 0) return 0;
+      if (status != CONTROL_OK) return 1;
+      int count = answer[2];
+      for (int i = 0; i < count; ++i) presses[first + i] = read32(answer + 3 + 4 * i);
+      first += count;
+    }
+
+    // Only print the layer combinations that were used.
+    uint32_t total = 0;
+    for (int key = 0; key < numKeys; ++key) total += presses[key];
+    if (total == 0) continue;
+
+    printf("layer mask %d: %u presses\n", mask, total);
+    for (int line = 0; line < NUM_LINES; ++line) {
+      for (int column = 0; column < NUM_COLUMNS; ++column) {
+        printf("%7u", presses[line * NUM_COLUMNS + column]);
+      }
+      printf("\n");
+    }
+  }
+}
+
+/// Print the trace entry of 'type', 'key' and 'value', see Recorder::Type.
+static void printEntry(uint8_t type, uint8_t key, uint16_t value) {
+  int line = key / NUM_COLUMNS;
+  int column = key % NUM_COLUMNS;
+  switch (type) {
+    case 1: printf("boot, %u resets since power on\n", value); break;
+    case 2: printf("key %d,%d %s\n", line, column, value ? "pressed" : "released"); break;
+    case 3: printf("key %d,%d %s DROPPED, event queue full\n", line, column, value ? "pressed" : "released"); break;
+    case 4: printf("key %d,%d bounce of %uus cancelled\n", line, column, value); break;
+    case 5: printf("key %d,%d tap, held %ums\n", line, column, value); break;
+    case 6:
+      if (value == 0xFFFF) {
+        printf("key %d,%d hold, another key pressed\n", line, column);
+      } else {
+        printf("key %d,%d hold, held %ums\n", line, column, value);
+      }
+      break;
+    case 7: printf("I2C reset, chip %u in error\n", key); break;
+    case 8: printf("report sent, layer mask %u\n", key); break;
+    case 9: {
+      static const char* const stages[] = { "idle", "usb", "scan", "events", "maintenance" };
+      printf("STALL in stage %s", key < 5 ? stages[key] : "unknown");
+      if (value != 0xFFFF) printf(", reading chip %u", value);
+      printf("\n");
+      break;
+    }
+    default: printf("unknown entry %u (key %u, value %u)\n", type, key, value); break;
+  }
+}
+
+static int recorder(bool live) {
+  uint8_t answer[CONTROL_REPORT_SIZE];
+  uint8_t request[CONTROL_REPORT_SIZE] = { CONTROL_READ_RECORDER, uint8_t(live ? 1 : 0) };
+  if (transact(request, answer) != CONTROL_OK) return 1;
+  uint32_t resets = read32(answer + 2);
+  int size = read16(answer + 6);
+  if (size == 0) {
+    printf("no %s trace\n", live ? "live" : "saved");
+    return 0;
+  }
+  printf("%s trace, %d entries, %u resets since power on when it started\n", live ? "live" : "saved", size, resets);
+
+  // The times are printed relative to the first entry. micros() wraps around, so add the differences between consecutive entries.
+  uint32_t previousTime = 0;
+  uint64_t elapsed = 0;
+  for (int first = 0; first < size;) {
+    request[2] = uint8_t(first);
+    request[3] = uint8_t(first >> 8);
+    if (transact(request, answer) != CONTROL_OK) return 1;
+    int count = answer[8];
+    // Nothing is returned past the end of the trace, which happens if the live trace was restarted meanwhile.
+    if (count == 0) break;
+
+    for (int i = 0; i < count; ++i) {
+      const uint8_t* entry = answer + 9 + 8 * i;
+      uint32_t time = read32(entry);
+      if (first + i > 0) elapsed += uint32_t(time - previousTime);
+      previousTime = time;
+      printf("%12.3fms  ", elapsed / 1000.0);
+      printEntry(entry[4], entry[5], read16(entry + 6));
+    }
+    first += count;
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s /dev/hidrawN ping|counters|histograms|reset-perf|settings|set <name> <value>|save-settings|telemetry|keymap-info|keymap-load <file>|heatmap|recorder [live]\n", argv[0]);
+    return 2;
+  }
+
+  s_device = open(argv[1], O_RDWR);
+  if (s_device < 0) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  const char* command = argv[2];
+  if (strcmp(command, "ping") == 0) return ping();
+  if (strcmp(command, "counters") == 0) return counters();
+  if (strcmp(command, "histograms") == 0) return histograms();
+  if (strcmp(command, "reset-perf") == 0) return resetPerf();
+  if (strcmp(command, "settings") == 0) return settings();
+  if (strcmp(command, "set") == 0 && argc == 5) return set(argv[3], argv[4]);
+  if (strcmp(command, "save-settings") == 0) return saveSettings();
+  if (strcmp(command, "telemetry") == 0) return telemetry();
+  if (strcmp(command, "keymap-info") == 0) return keymapInfo();
+  if (strcmp(command, "keymap-load") == 0 && argc == 4) return keymapLoad(argv[3]);
+  if (strcmp(command, "heatmap") == 0) return heatmap();
+  if (strcmp(command, "recorder") == 0) return recorder(argc == 4 && strcmp(argv[3], "live") == 0);
+
+  fprintf(stderr, "unknown command %s\n", command);
+  return 2;
+}
@@ -0,0 +1,55 @@
+// Turn the compiled-in keymap of keyConfig.h into a keymap image, to be loaded with "keyboard_cli /dev/hidrawN keymap-load <file>".
+//
+// Build: g++ -O2 -o keymap_compiler keymap_compiler.cpp
+// Usage: keymap_compiler <output file>
+//
+// The layers of keyConfig.h are flattened into a table per combination of active layers, the image format is described by KeymapImage in keymap.h. The keymap is compiled for the host, so this relies on the host having the same struct layout as the firmware, which the static_asserts of keymap.h check.
+
+#include "../arduino_keyboard/keyConfig.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/// Compute the CRC-32 of 'size' bytes of 'data', same as Storage::crc32().
+static uint32_t crc32(const void* data, uint32_t size) {
+  const uint8_t* bytes = (const uint8_t*)data;
+  uint32_t crc = ~0u;
+  for (uint32_t i = 0; i < size; ++i) {
+    crc ^= bytes[i];
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s <output file>\n", argv[0]);
+    return 2;
+  }
+
+  static KeymapImage image;
+  KeymapTables& tables = image.m_tables;
+  Keymap::flatten(s_layers, sizeof(s_layers) / sizeof(Layer), tables);
+  memcpy(tables.m_immuneToReset, immuneToReset, sizeof(tables.m_immuneToReset));
+  memcpy(tables.m_onRelease, onRelease, sizeof(tables.m_onRelease));
+  memcpy(tables.m_layerKeys, s_layerKeys, sizeof(tables.m_layerKeys));
+  memcpy(tables.m_layerActivations, s_layerActivations, sizeof(tables.m_layerActivations));
+  image.m_header = KeymapHeader{ KEYMAP_MAGIC, KEYMAP_VERSION, NUM_LINES, NUM_COLUMNS, sizeof(KeymapImage), crc32(&tables, sizeof(tables)), 0 };
+
+  FILE* file = fopen(argv[1], "wb");
+  if (file == nullptr) {
+    perror(argv[1]);
+    return 1;
+  }
+  bool ok = fwrite(&image, sizeof(image), 1, file) == 1;
+  ok = fclose(file) == 0 && ok;
+  if (!ok) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  printf("wrote %zu bytes to %s\n", sizeof(image), argv[1]);
+  return 0;
+}
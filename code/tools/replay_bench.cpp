@@ -0,0 +1,294 @@
+// Replay traces of switch edges through the event processing of the sketch on Linux, and print its throughput, the reports it sent and the latency of the keys.
+//
+// Build: g++ -O2 -I../tests/host -DFLASH_EMULATION=1 -DINPUT_BACKEND=2 -o replay_bench replay_bench.cpp ../tests/host/sketch.cpp
+// Usage: replay_bench [options] [<trace file>...]
+//
+// Options:
+//   --scan <us>      Time between two scans of the switches, in micro-seconds (REPLAY_SCAN_PERIOD by default).
+//   --repeat <n>     Number of times each trace is replayed, one second apart (REPLAY_REPEAT for the reference traces, 1 for the trace files by default).
+//   --write <dir>    Write the reference traces of Replay in <dir>, as <name>.trace files, and exit.
+//
+// Without trace files, the reference traces and the random traces of Replay are replayed, and their digests are checked against Replay::referenceDigest() and
+// Replay::fuzzDigest() as REPLAY_LOG does on the keyboard. Build with -DTYPING_STREAK_TIME=150000 to check the digests of the typing streak.
+//
+// A trace file has one edge per line, sorted by time: "<time> <line> <column> press|release", where the time is in micro-seconds from the start of the trace. Empty lines
+// and lines starting with '#' are skipped. Traces recorded on a keyboard or written by other tools can be replayed this way.
+//
+// A trace file can also list the characters it should type, one "typed <hex>" line each, with the modifiers in the high byte and the key code in the low byte, as
+// tools/corpus_trace.cpp writes them with --trace-dir. When the trace is replayed once, what it typed is compared with them as REPLAY_LOG does for the corpus traces, with the compiled-in keymap.
+//
+// The traces run through the host build of the sketch, see ../tests/host/sketch.h: the edges are queued with their exact time and processEvents() runs at every scan,
+// with the default settings and from a keyboard that did not learn anything. For each trace it prints:
+//   edges          Edges fed to the event queue.
+//   events         Events processed, including the ones debounced.
+//   reports        Keyboard states built by sendCurrentKeyPress(), and the USB reports polled by the host for them.
+//   cpu            Time spent in processEvents() on this computer, per event and as events per second. Only compare it between runs on the same computer.
+//   latency        Time from an edge to the keyboard state it produced, under the virtual clock: the median and the 99th percentile, as the bound of their bucket of
+//                  HISTOGRAM_KEY_LATENCY, and the maximum. tap_latency is the median time from the press of an "on release" key to its tap.
+//   streak         Keys tapped at their press by a typing streak, and those of them that were meant to select their layer, see TYPING_STREAK_TIME.
+//   dropped        Edges lost because the event queue was full.
+//   digest         Digest of the distinct states, see Replay.
+// and for the traces listing their characters:
+//   typed          Keys typed as expected, out of the characters of the trace.
+//   missing        Characters that were not typed.
+//   extra          Keys typed that are not the next characters, searched up to REPLAY_CORPUS_LOOKAHEAD characters ahead.
+//   aligned        Fewest characters missing and keys extra that explain what was typed, from the longest common subsequence of both. Missing and extra above are those
+//                  of REPLAY_LOG on the keyboard, which can count a single extra key as several missing and extra ones.
+//   queue_max      Largest number of events waiting in the queue after a scan.
+
+#include "../tests/host/sketch.h"
+#include "../arduino_keyboard/perf.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/// A trace read from a file, which owns its edges.
+struct TraceFile {
+  char m_name[64];
+  std::vector<TraceEdge> m_edges;
+  /// The characters that the trace should type, empty if they are not given.
+  std::vector<uint16_t> m_typed;
+};
+
+/// What a trace typed compared with its characters.
+struct TypedStats {
+  /// As counted by replayCheckTyped() of arduino_keyboard.ino.
+  uint32_t m_typed;
+  uint32_t m_missing;
+  uint32_t m_extra;
+  /// Characters and keys left out of the longest common subsequence of the characters and the keys typed: the fewest keys lost and added that explain what was typed.
+  uint32_t m_alignedMissing;
+  uint32_t m_alignedExtra;
+};
+
+/// Read the trace file at 'path' into 'trace'. Return false, after printing why, if it cannot be read.
+static bool readTrace(const char* path, TraceFile& trace) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    perror(path);
+    return false;
+  }
+
+  // The name of the trace is the name of the file, without its directory and extension.
+  const char* name = strrchr(path, '/');
+  snprintf(trace.m_name, sizeof(trace.m_name), "%s", name != nullptr ? name + 1 : path);
+  char* extension = strrchr(trace.m_name, '.');
+  if (extension != nullptr) *extension = 0;
+
+  char line[256];
+  int number = 0;
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    ++number;
+    if (line[0] == '#' || line[strspn(line, " \t\r\n")] == 0) continue;
+
+    unsigned typed;
+    if (strncmp(line, "typed ", 6) == 0) {
+      if (sscanf(line + 6, "%x", &typed) != 1 || typed > 0xFFFF) {
+        fprintf(stderr, "%s:%d: expected \"typed <hex>\"\n", path, number);
+        fclose(file);
+        return false;
+      }
+      trace.m_typed.push_back(uint16_t(typed));
+      continue;
+    }
+
+    unsigned long time;
+    int keyLine, keyColumn;
+    char edge[16];
+    if (sscanf(line, "%lu %d %d %15s", &time, &keyLine, &keyColumn, edge) != 4 || keyLine < 0 || keyLine >= NUM_LINES || keyColumn < 0 || keyColumn >= NUM_COLUMNS
+        || (strcmp(edge, "press") != 0 && strcmp(edge, "release") != 0) || (!trace.m_edges.empty() && time < trace.m_edges.back().m_time)) {
+      fprintf(stderr, "%s:%d: expected \"<time> <line> <column> press|release\" after the previous edge\n", path, number);
+      fclose(file);
+      return false;
+    }
+    trace.m_edges.push_back(TraceEdge{ uint32_t(time), Pos{ int8_t(keyLine), int8_t(keyColumn) }, strcmp(edge, "press") == 0 });
+  }
+  fclose(file);
+
+  if (trace.m_edges.empty() || trace.m_edges.size() > 0xFFFF) {
+    fprintf(stderr, "%s: a trace has 1 to 65535 edges\n", path);
+    return false;
+  }
+  return true;
+}
+
+/// Write 'trace' in the file '<directory>/<name>.trace'. Return false, after printing why, if it cannot be written.
+static bool writeTrace(const char* directory, const Trace& trace) {
+  char path[512];
+  snprintf(path, sizeof(path), "%s/%s.trace", directory, trace.m_name);
+  FILE* file = fopen(path, "w");
+  if (file == nullptr) {
+    perror(path);
+    return false;
+  }
+
+  fprintf(file, "# %s: <time in micro-seconds> <line> <column> press|release\n", trace.m_name);
+  for (int i = 0; i < trace.m_numEdges; ++i) {
+    const TraceEdge& edge = trace.m_edges[i];
+    fprintf(file, "%u %d %d %s\n", edge.m_time, edge.m_pos.m_line, edge.m_pos.m_column, edge.m_isPressed ? "press" : "release");
+  }
+  fclose(file);
+  return true;
+}
+
+/// Compare the keys that appear in 'states', each one since the previous one, with the characters 'typed'.
+static TypedStats checkTyped(const std::vector<HostSketch::State>& states, const std::vector<uint16_t>& typed) {
+  std::vector<uint16_t> keys;
+  uint8_t last[KEYBOARD_STATE_SIZE] = {};
+  for (const HostSketch::State& state : states) {
+    for (int i = 1; i <= 6; ++i) {
+      uint8_t key = state.m_data[i];
+      if (key != 0 && memchr(last + 1, key, 6) == nullptr) keys.push_back((state.m_data[0] << 8) | key);
+    }
+    memcpy(last, state.m_data, sizeof(last));
+  }
+
+  // Like replayCheckTyped(): a key that is not the next character is searched a few characters ahead, if found the characters skipped were missing, otherwise it is an
+  // extra key. An extra key matching a frequent character a few characters ahead, like a space, counts these characters as missing and then as extra.
+  TypedStats stats = { 0, 0, 0, 0, 0 };
+  size_t next = 0;
+  for (uint16_t key : keys) {
+    size_t skipped = 0;
+    while (skipped < REPLAY_CORPUS_LOOKAHEAD && next + skipped < typed.size() && typed[next + skipped] != key) ++skipped;
+
+    if (skipped < REPLAY_CORPUS_LOOKAHEAD && next + skipped < typed.size()) {
+      stats.m_typed++;
+      stats.m_missing += skipped;
+      next += skipped + 1;
+    } else {
+      stats.m_extra++;
+    }
+  }
+  stats.m_missing += typed.size() - next;
+
+  // Length of the longest common subsequence, one row of the table at a time.
+  std::vector<uint32_t> previous(keys.size() + 1, 0), current(keys.size() + 1, 0);
+  for (size_t i = 0; i < typed.size(); ++i) {
+    for (size_t j = 0; j < keys.size(); ++j) {
+      current[j + 1] = typed[i] == keys[j] ? previous[j] + 1 : std::max(previous[j + 1], current[j]);
+    }
+    previous.swap(current);
+  }
+  stats.m_alignedMissing = typed.size() - previous[keys.size()];
+  stats.m_alignedExtra = keys.size() - previous[keys.size()];
+  return stats;
+}
+
+/// Upper bound of the bucket of the histogram 'h' holding the value at 'fraction' of its values, in the same unit as the values.
+static uint32_t percentile(Perf::Histogram h, double fraction) {
+  uint32_t total = 0;
+  for (int i = 0; i < PERF_HISTOGRAM_BUCKETS; ++i) total += Perf::bucket(h, i);
+
+  uint32_t seen = 0;
+  for (int i = 0; i < PERF_HISTOGRAM_BUCKETS; ++i) {
+    seen += Perf::bucket(h, i);
+    if (total > 0 && seen >= fraction * total) return i == 0 ? 0 : (1u << i) - 1;
+  }
+  return Perf::maximum(h);
+}
+
+/// Replay 'trace' 'repeat' times and print its results. 'expectedDigest' is checked unless it is 0, and what a single replay typed is compared with 'typed' unless it is
+/// empty. Return false if the digest differs or if keys were lost or added.
+static bool run(const Trace& trace, int repeat, unsigned long scanPeriod, uint32_t expectedDigest, const std::vector<uint16_t>& typed) {
+  Perf::reset();
+  std::vector<HostSketch::State> states;
+  HostSketch::ReplayStats stats = HostSketch::replay(trace, repeat, scanPeriod, true, states);
+
+  uint8_t last[KEYBOARD_STATE_SIZE] = {};
+  uint32_t digest = HostSketch::digest(states, last, 0);
+  uint32_t events = Perf::counter(Perf::COUNTER_EVENTS_PROCESSED);
+  printf("replay %s: edges=%u events=%u reports=%u usb_reports=%u cpu=%lluus ns_per_event=%llu events_per_s=%llu latency_p50<=%uus latency_p99<=%uus "
+         "latency_max=%uus tap_latency_p50<=%uus streak_taps=%u streak_misfires=%u dropped=%u digest=%08X",
+         trace.m_name, stats.m_edges, events, Perf::counter(Perf::COUNTER_REPORTS_SENT), Perf::counter(Perf::COUNTER_USB_REPORTS),
+         (unsigned long long)(stats.m_cpuTime / 1000), (unsigned long long)(events > 0 ? stats.m_cpuTime / events : 0),
+         (unsigned long long)(stats.m_cpuTime > 0 ? events * 1000000000ULL / stats.m_cpuTime : 0), percentile(Perf::HISTOGRAM_KEY_LATENCY, 0.5),
+         percentile(Perf::HISTOGRAM_KEY_LATENCY, 0.99), Perf::maximum(Perf::HISTOGRAM_KEY_LATENCY), percentile(Perf::HISTOGRAM_TAP_LATENCY, 0.5),
+         Perf::counter(Perf::COUNTER_STREAK_TAPS), Perf::counter(Perf::COUNTER_STREAK_MISFIRES), Perf::counter(Perf::COUNTER_EVENTS_DROPPED), digest);
+
+  if (!typed.empty() && repeat == 1) {
+    TypedStats typedStats = checkTyped(states, typed);
+    printf(" typed=%u/%zu missing=%u extra=%u aligned_missing=%u aligned_extra=%u queue_max=%u %s\n", typedStats.m_typed, typed.size(), typedStats.m_missing,
+           typedStats.m_extra, typedStats.m_alignedMissing, typedStats.m_alignedExtra, Perf::maximum(Perf::HISTOGRAM_QUEUE_DEPTH),
+           typedStats.m_missing == 0 && typedStats.m_extra == 0 ? "ok" : "DEGRADED");
+    return typedStats.m_missing == 0 && typedStats.m_extra == 0;
+  }
+  if (expectedDigest == 0) {
+    printf("\n");
+    return true;
+  }
+  printf(digest == expectedDigest ? " ok\n" : " DIFFERS from %08X\n", expectedDigest);
+  return digest == expectedDigest;
+}
+
+int main(int argc, char** argv) {
+  unsigned long scanPeriod = REPLAY_SCAN_PERIOD;
+  int repeat = 0;
+  const char* writeDirectory = nullptr;
+  std::vector<const char*> paths;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--scan") == 0 && i + 1 < argc) {
+      scanPeriod = strtoul(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+      repeat = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--write") == 0 && i + 1 < argc) {
+      writeDirectory = argv[++i];
+    } else if (argv[i][0] != '-') {
+      paths.push_back(argv[i]);
+    } else {
+      fprintf(stderr, "usage: %s [--scan <us>] [--repeat <n>] [--write <dir>] [<trace file>...]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (scanPeriod == 0) {
+    fprintf(stderr, "the scan period must not be 0\n");
+    return 2;
+  }
+
+  if (writeDirectory != nullptr) {
+    for (int id = 0; id < Replay::NUM_TRACES; ++id) {
+      if (!writeTrace(writeDirectory, Replay::trace(Replay::TraceId(id)))) return 1;
+    }
+    return 0;
+  }
+
+  HostSketch::setup();
+
+  if (paths.empty()) {
+    // The digests are for the default scan period and number of repetitions.
+    bool isReference = scanPeriod == REPLAY_SCAN_PERIOD && (repeat == 0 || repeat == REPLAY_REPEAT);
+    bool ok = true;
+    for (int id = 0; id < Replay::NUM_TRACES; ++id) {
+      uint32_t expectedDigest = isReference ? Replay::referenceDigest(Replay::TraceId(id)) : 0;
+      ok = run(Replay::trace(Replay::TraceId(id)), repeat > 0 ? repeat : REPLAY_REPEAT, scanPeriod, expectedDigest, {}) && ok;
+    }
+
+    // The random traces are summarized in a single digest, as in replayAll() of arduino_keyboard.ino.
+    static TraceEdge edges[REPLAY_FUZZ_EDGES];
+    uint8_t last[KEYBOARD_STATE_SIZE] = {};
+    uint32_t digest = 0;
+    for (uint32_t seed = 1; seed <= REPLAY_FUZZ_TRACES; ++seed) {
+      uint16_t numEdges = Replay::generate(seed, edges, REPLAY_FUZZ_EDGES);
+      std::vector<HostSketch::State> states;
+      HostSketch::replay(Trace{ "fuzz", edges, numEdges }, 1, scanPeriod, true, states);
+      digest = HostSketch::digest(states, last, digest);
+    }
+    printf("replay fuzz: digest=%08X", digest);
+    if (scanPeriod == REPLAY_SCAN_PERIOD) {
+      printf(digest == Replay::fuzzDigest() ? " ok" : " DIFFERS from %08X", Replay::fuzzDigest());
+      ok = digest == Replay::fuzzDigest() && ok;
+    }
+    printf("\n");
+    return ok ? 0 : 1;
+  }
+
+  bool ok = true;
+  for (const char* path : paths) {
+    TraceFile file;
+    if (!readTrace(path, file)) return 1;
+    ok = run(Trace{ file.m_name, file.m_edges.data(), uint16_t(file.m_edges.size()) }, repeat > 0 ? repeat : 1, scanPeriod, 0, file.m_typed) && ok;
+  }
+  return ok ? 0 : 1;
+}
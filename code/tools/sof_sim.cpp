@@ -0,0 +1,170 @@
+// Simulate the main loop of the sketch against the frames and the polls of a USB host on Linux, to measure how long the reports wait for the poll with and without SOF_SYNC.
+//
+// Build: g++ -O2 -I../tests/host -DFLASH_EMULATION=1 -DINPUT_BACKEND=2 -o sof_sim sof_sim.cpp ../tests/host/sketch.cpp
+//        g++ -O2 -I../tests/host -DFLASH_EMULATION=1 -DINPUT_BACKEND=2 -DSOF_SYNC=0 -o sof_sim_off sof_sim.cpp ../tests/host/sketch.cpp
+// Usage: sof_sim [options]
+//
+// Options:
+//   --scan <us>      Duration of a scan of the switches, in micro-seconds (230 by default, an I2C scan of the MCP backends at 1 MHz).
+//   --phase <us>     Time of the polls of the host after each start of frame, in micro-seconds (300 by default).
+//   --jitter <us>    Largest random shift of each poll from its phase, in micro-seconds (0 by default). The poll of a frame may come after the start of the next one:
+//                    with --phase 998 --jitter 5 the polls are spread around the start of frame.
+//   --seconds <n>    Simulated time, in seconds (20 by default).
+//   --seed <n>       Seed of the random key taps and jitter (1 by default).
+//
+// The host build of the sketch, see ../tests/host/sketch.h, runs loop() under a virtual clock: each scan takes --scan micro-seconds, and the waits of FrameSync::align()
+// move the clock. The host sends a start of frame every milli-second and polls the keyboard endpoint once per frame. One letter is tapped at a time, at random times.
+// It prints:
+//   taps          Key presses, and the number of them that reached the host.
+//   latency       Time from the press of a key to the poll that took its report, in micro-seconds, averaged and at most. It includes the debounce time.
+//   report_wait   Time from a keyboard report being handed to the endpoint to the poll that took it, in micro-seconds, averaged and at most. This is what SOF_SYNC shortens:
+//                 the age of the last scan before the poll.
+//   sof           Scans delayed to end just before a poll, and those of them that still ended after it, see SOF_SYNC.
+//   poll_phase    The phase of the polls estimated by FrameSync, which should be --phase. Only with SOF_SYNC.
+
+#include "../tests/host/sketch.h"
+#include "../arduino_keyboard/frameSync.h"
+#include "../arduino_keyboard/perf.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/// Length of a full speed USB frame, in micro-seconds.
+static const unsigned long FRAME_LENGTH = 1000;
+
+/// Options of the simulation.
+static unsigned long s_phase = 300;
+static unsigned long s_jitter = 0;
+static uint32_t s_random = 1;
+
+/// Next start of frame, next poll and the start of the frame it belongs to, and the number of the next frame.
+static unsigned long s_nextFrame = FRAME_LENGTH;
+static unsigned long s_nextPoll = 0, s_pollFrame = 0;
+static uint16_t s_frameNumber = 1;
+
+/// Next change of the switches: the key pressed, or none, at 's_nextEdge'.
+static unsigned long s_nextEdge = 0;
+static bool s_isPressed = false;
+
+/// Time of the press whose report did not reach the host yet, 0 if there is none.
+static unsigned long s_pressTime = 0;
+
+/// No key is pressed in the last second of the simulation, so that every press reaches the host.
+static unsigned long s_lastPress = 0;
+
+/// States received by the host, and the results.
+static std::vector<HostSketch::State> s_states;
+static uint32_t s_taps = 0, s_received = 0, s_reports = 0;
+static uint64_t s_latencyTotal = 0, s_waitTotal = 0;
+static unsigned long s_latencyMax = 0, s_waitMax = 0;
+
+/// Uniform random number in [0, 'range'), from a xorshift32 generator like Replay::generate().
+static unsigned long nextRandom(unsigned long range) {
+  s_random ^= s_random << 13;
+  s_random ^= s_random >> 17;
+  s_random ^= s_random << 5;
+  return range == 0 ? 0 : s_random % range;
+}
+
+/// Time of the poll of the frame starting at 'frameTime'.
+static unsigned long pollTime(unsigned long frameTime) {
+  return frameTime + s_phase - s_jitter + nextRandom(2 * s_jitter + 1);
+}
+
+/// Play the frames, the polls and the key taps between 'from' and 'to', see HostSketch::setClockListener().
+static void onClock(unsigned long, unsigned long to) {
+  for (;;) {
+    unsigned long next = s_nextFrame;
+    if (long(s_nextPoll - next) < 0) next = s_nextPoll;
+    if (long(s_nextEdge - next) < 0) next = s_nextEdge;
+    if (long(next - to) > 0) return;
+    HostSketch::setNow(next);
+
+    if (next == s_nextEdge) {
+      // A letter of the middle of the keyboard, tapped for 40 to 120 milli-seconds, then 50 to 200 milli-seconds before the next one.
+      s_isPressed = !s_isPressed && next < s_lastPress;
+      if (s_isPressed) {
+        int line = 1 + nextRandom(3);
+        int column = 1 + nextRandom(10);
+        HostSketch::setInputs(InputFrame(1) << (column * NUM_LINES + line));
+        s_pressTime = next;
+        s_taps++;
+        s_nextEdge = next + 40000 + nextRandom(80000);
+      } else {
+        HostSketch::setInputs(0);
+        s_nextEdge = next + 50000 + nextRandom(150000);
+      }
+    } else if (next == s_nextFrame) {
+      HostSketch::startOfFrame(s_frameNumber++);
+      s_nextFrame += FRAME_LENGTH;
+    } else {
+      size_t count = s_states.size();
+      if (HostSketch::pollOnce(s_states) && s_states.size() > count) {
+        const HostSketch::State& state = s_states.back();
+        unsigned long wait = next - state.m_time;
+        s_reports++;
+        s_waitTotal += wait;
+        if (wait > s_waitMax) s_waitMax = wait;
+
+        // Only one key is pressed at a time, the first report with a key is the one of the last press.
+        if (s_pressTime != 0 && state.m_data[1] != 0) {
+          unsigned long latency = next - s_pressTime;
+          s_received++;
+          s_latencyTotal += latency;
+          if (latency > s_latencyMax) s_latencyMax = latency;
+          s_pressTime = 0;
+        }
+      }
+      s_pollFrame += FRAME_LENGTH;
+      s_nextPoll = pollTime(s_pollFrame);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  unsigned long scanTime = 230;
+  unsigned long seconds = 20;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--scan") == 0 && i + 1 < argc) {
+      scanTime = strtoul(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--phase") == 0 && i + 1 < argc) {
+      s_phase = strtoul(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--jitter") == 0 && i + 1 < argc) {
+      s_jitter = strtoul(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+      seconds = strtoul(argv[++i], nullptr, 0);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      s_random = strtoul(argv[++i], nullptr, 0);
+    } else {
+      fprintf(stderr, "usage: %s [--scan <us>] [--phase <us>] [--jitter <us>] [--seconds <n>] [--seed <n>]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (scanTime == 0 || seconds < 2 || s_phase >= FRAME_LENGTH || s_jitter > s_phase || 2 * s_jitter >= FRAME_LENGTH || s_random == 0) {
+    fprintf(stderr, "the scan must take some time, the simulation at least 2 seconds, the polls must keep their order: jitter <= phase < %lu and jitter < %lu, and the seed must not be 0\n",
+            FRAME_LENGTH, FRAME_LENGTH / 2);
+    return 2;
+  }
+
+  HostSketch::setup();
+  HostSketch::setScanTime(scanTime);
+  HostSketch::setClockListener(&onClock);
+  s_nextPoll = pollTime(0);
+  s_nextEdge = 100000 + nextRandom(100000);
+  s_lastPress = (seconds - 1) * 1000000;
+  Perf::reset();
+
+  while (HostSketch::now() < seconds * 1000000) HostSketch::loop();
+
+  printf("sof_sync=%d scan=%luus phase=%luus jitter=%luus: taps=%u received=%u latency_avg=%lluus latency_max=%luus report_wait_avg=%lluus report_wait_max=%luus "
+         "sof_aligned=%u sof_late=%u",
+         SOF_SYNC, scanTime, s_phase, s_jitter, s_taps, s_received, (unsigned long long)(s_received > 0 ? s_latencyTotal / s_received : 0), s_latencyMax,
+         (unsigned long long)(s_reports > 0 ? s_waitTotal / s_reports : 0), s_waitMax, Perf::counter(Perf::COUNTER_SOF_ALIGNED), Perf::counter(Perf::COUNTER_SOF_LATE));
+#if SOF_SYNC
+  printf(" poll_phase=%luus", FrameSync::pollPhase());
+#endif
+  printf("\n");
+  return s_received == s_taps ? 0 : 1;
+}
@@ -0,0 +1,206 @@
+// Both ends of the split keyboard link of splitProtocol.h, on a Linux serial port.
+//
+// Build: g++ -O2 -o split_link split_link.cpp
+// Usage: split_link primary <tty>
+//        split_link secondary <tty> [corrupt one byte out of N]
+//
+// "primary" prints the state changes received from a secondary half, and the link counters when stopped with Ctrl-D.
+// "secondary" reads commands on its standard input and sends them as frames:
+//   p <pin>   Press a pin.
+//   r <pin>   Release a pin.
+//   t <pin>   Press then release a pin.
+//
+// To test the protocol without hardware, create a pty pair with:
+//   socat -d -d pty,raw,echo=0 pty,raw,echo=0
+// and run one end on each of the two ptys it prints. With a USB serial adapter, the primary end can also listen to a real secondary half.
+
+#include "../arduino_keyboard/splitProtocol.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/// Same as in config.h.
+static const unsigned long HEARTBEAT_TIME = 10000;
+static const unsigned long TIMEOUT = 50000;
+
+/// Handle to the serial port.
+static int s_tty = -1;
+
+/// Current time in micro-seconds.
+static unsigned long now() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec * 1000000UL + time.tv_nsec / 1000;
+}
+
+/// Open 'path' as a raw serial port at the baud rate of the firmware.
+static bool openTty(const char* path) {
+  s_tty = open(path, O_RDWR | O_NOCTTY);
+  if (s_tty < 0) {
+    perror(path);
+    return false;
+  }
+
+  termios options;
+  if (tcgetattr(s_tty, &options) == 0) {
+    cfmakeraw(&options);
+    cfsetspeed(&options, B1000000);
+    tcsetattr(s_tty, TCSANOW, &options);
+  }
+  return true;
+}
+
+/// Print the pins that differ between 'before' and 'after'.
+static void printChanges(uint32_t before, uint32_t after) {
+  for (int pin = 0; pin < 32; ++pin) {
+    uint32_t bit = 1u << pin;
+    if ((before ^ after) & bit) printf("pin %d %s\n", pin, (after & bit) ? "pressed" : "released");
+  }
+  fflush(stdout);
+}
+
+static int primary() {
+  SplitDecoder decoder;
+  uint8_t sequence = 0;
+  uint32_t pressed = 0;
+  bool linkUp = false;
+  bool resyncPending = false;
+  uint32_t crcErrors = 0;
+  unsigned long lastFrame = 0;
+  unsigned long lastResync = 0;
+  unsigned long frames = 0, lostFrames = 0, timeouts = 0;
+
+  for (;;) {
+    pollfd fds[2] = { { s_tty, POLLIN, 0 }, { 0, POLLIN, 0 } };
+    poll(fds, 2, 1);
+
+    // Stop on end of input.
+    if (fds[1].revents) {
+      char line[64];
+      if (fgets(line, sizeof(line), stdin) == nullptr) break;
+    }
+
+    // As Split::receive(): the full state is asked again until it comes.
+    uint8_t buffer[64];
+    ssize_t length = fds[0].revents ? read(s_tty, buffer, sizeof(buffer)) : 0;
+    for (ssize_t i = 0; i < length; ++i) {
+      SplitFrame frame;
+      if (!decoder.push(buffer[i], frame)) continue;
+      frames++;
+      lastFrame = now();
+
+      if (frame.m_changed == SPLIT_ALL_PINS) {
+        if (!linkUp) printf("link up\n");
+        linkUp = true;
+        resyncPending = false;
+      } else if (!linkUp) {
+        resyncPending = true;
+      } else if (frame.m_sequence != uint8_t(sequence + 1)) {
+        lostFrames += uint8_t(frame.m_sequence - sequence - 1);
+        resyncPending = true;
+      }
+      sequence = frame.m_sequence;
+
+      uint32_t next = (pressed & ~frame.m_changed) | (frame.m_pressed & frame.m_changed);
+      if (linkUp) printChanges(pressed, next);
+      pressed = next;
+    }
+    if (decoder.m_crcErrors > crcErrors) resyncPending = true;
+    crcErrors = decoder.m_crcErrors;
+
+    if (linkUp && now() - lastFrame > TIMEOUT) {
+      printf("link down\n");
+      printChanges(pressed, 0);
+      timeouts++;
+      linkUp = false;
+    }
+
+    if ((resyncPending || !linkUp) && now() - lastResync >= HEARTBEAT_TIME) {
+      uint8_t request = SPLIT_RESYNC;
+      if (write(s_tty, &request, 1) != 1) perror("write");
+      lastResync = now();
+    }
+  }
+
+  printf("frames=%lu crc_errors=%u lost_frames=%lu timeouts=%lu\n", frames, decoder.m_crcErrors, lostFrames, timeouts);
+  return 0;
+}
+
+static int secondary(unsigned long corruption) {
+  uint8_t sequence = 0;
+  uint32_t pressed = 0;
+  uint32_t sent = 0;
+  unsigned long lastFrame = 0;
+  unsigned long numBytes = 0;
+
+  for (;;) {
+    pollfd fds[2] = { { s_tty, POLLIN, 0 }, { 0, POLLIN, 0 } };
+    poll(fds, 2, 1);
+
+    bool full = false;
+    if (fds[0].revents) {
+      uint8_t buffer[64];
+      ssize_t length = read(s_tty, buffer, sizeof(buffer));
+      for (ssize_t i = 0; i < length; ++i) {
+        if (buffer[i] == SPLIT_RESYNC) full = true;
+      }
+    }
+
+    // A tap is sent as two frames, like two scans of the firmware.
+    uint32_t released = 0;
+    if (fds[1].revents) {
+      char line[64];
+      if (fgets(line, sizeof(line), stdin) == nullptr) break;
+
+      char command;
+      int pin;
+      if (sscanf(line, " %c %d", &command, &pin) != 2 || pin < 0 || pin >= 32) {
+        fprintf(stderr, "expected: p|r|t <pin>\n");
+        continue;
+      }
+      if (command == 'p' || command == 't') pressed |= 1u << pin;
+      if (command == 'r') pressed &= ~(1u << pin);
+      if (command == 't') released = 1u << pin;
+    }
+
+    for (int i = 0; i < 2; ++i) {
+      // As Split::send(): the heartbeats carry the full state.
+      uint32_t changed = full || (pressed == sent && now() - lastFrame >= HEARTBEAT_TIME) ? SPLIT_ALL_PINS : pressed ^ sent;
+      if (changed != 0) {
+        uint8_t data[SPLIT_FRAME_SIZE];
+        splitEncode(SplitFrame{ ++sequence, changed, pressed }, data);
+        for (uint8_t& byte : data) {
+          if (corruption != 0 && ++numBytes % corruption == 0) byte ^= 0x10;
+        }
+        if (write(s_tty, data, sizeof(data)) != (ssize_t)sizeof(data)) perror("write");
+        sent = pressed;
+        lastFrame = now();
+        full = false;
+      }
+
+      if (released == 0) break;
+      pressed &= ~released;
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s primary|secondary <tty> [corrupt one byte out of N]\n", argv[0]);
+    return 2;
+  }
+  if (!openTty(argv[2])) return 1;
+
+  if (strcmp(argv[1], "primary") == 0) return primary();
+  if (strcmp(argv[1], "secondary") == 0) return secondary(argc > 3 ? strtoul(argv[3], nullptr, 0) : 0);
+
+  fprintf(stderr, "unknown role %s\n", argv[1]);
+  return 2;
+}
@@ -0,0 +1,441 @@
+// Run the host build of the sketch on Linux, hand its reports to a virtual keyboard on /dev/uhid, and measure the latency from a switch edge to the input event seen by applications.
+//
+// Build: g++ -O2 -I../tests/host -DFLASH_EMULATION=1 -DINPUT_BACKEND=2 -o uhid_latency uhid_latency.cpp ../tests/host/sketch.cpp
+// Usage: uhid_latency [options]    (needs write access to /dev/uhid, usually root)
+//
+// Options:
+//   --count <n>       Number of letters tapped (200 by default).
+//   --interval <us>   Time between two edges of the switches (30000 by default). Below DEBOUNCE_MAX_TIME, a tap may be taken for a bounce once the debounce
+//                     of its switch has learned a longer time.
+//   --timeout <us>    Time after which a report that produced no input event is counted as lost (100000 by default).
+//   --media           Also tap volume up then volume down after each letter, holding the key of the function layer, so that the media reports are measured too.
+//   --dry-run         Do not create the virtual device: the latencies end at the poll of each report instead of its input event. Runs without /dev/uhid.
+//   --verbose         Print the latencies of each report.
+//
+// The sketch runs on the clock of the host, see HostSketch::setRealClock(): its loop() scans the switches set by this tool, so the reports go through the real debounce,
+// layers and KeyboardOutput. The tool plays the USB host: a start of frame every milli-second, each followed by a poll of the keyboard endpoint. Each report polled is
+// written to the virtual device, which uses the report descriptor of the firmware from reportDescriptor.h. The kernel parses the descriptor like the one of the real keyboard,
+// so a change of the descriptor (more keys, other usages) can be checked here before it is flashed.
+// The input devices created by the kernel are grabbed, so that the keys tapped do not reach the desktop. Each report is matched with the MSC_SCAN event of the first usage
+// it changes. All the times are in CLOCK_MONOTONIC, the clock of std::chrono::steady_clock that micros() of the host build uses. It prints, for each start point:
+//   switch_edge     From the edge of a switch to the input event of the first report after it: debounce, event processing, wait for the poll and the kernel.
+//   report_submit   From a report being handed to the USB endpoint to its input event: the wait for the poll and the kernel.
+//   uhid_write      From the write of a report to /dev/uhid to its input event: the kernel alone.
+// The USB transfer itself is not emulated, it adds up to a frame on the real keyboard, and the loop() of the host is much faster than the scans of the keyboard.
+
+#include "../tests/host/sketch.h"
+#include "../arduino_keyboard/reportDescriptor.h"
+
+#include <algorithm>
+#include <deque>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/input.h>
+#include <linux/uhid.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+/// Vendor and product of the real keyboard, see KeyboardHID.
+static const uint32_t VENDOR_ID = 0x1235;
+static const uint32_t PRODUCT_ID = 0x0050;
+
+/// Largest number of input devices created by the kernel for the virtual device, one per application collection at most.
+static const int MAX_EVENT_DEVICES = 8;
+
+/// Usage page of the keys and of the media keys, as found in the MSC_SCAN events.
+static const uint32_t SCAN_KEYS = 0x70000;
+static const uint32_t SCAN_CONSUMER = 0xC0000;
+
+/// Usages of the bits of the media report, in the order of the report descriptor.
+static const uint32_t MEDIA_USAGES[] = { 0xB5, 0xB6, 0xB7, 0xCD, 0xE2, 0xE9, 0xEA };
+
+/// Length of a full speed USB frame, in micro-seconds.
+static const int64_t FRAME_LENGTH = 1000;
+
+/// Switches tapped, see keyConfig.h: the key of the function layer, and volume up and down in that layer.
+static const Pos POS_FUNCTION = Pos{ 4, 6 };
+static const Pos POS_VOLUME_UP = Pos{ 1, 6 };
+static const Pos POS_VOLUME_DOWN = Pos{ 2, 6 };
+
+/// Handle to /dev/uhid, -1 with --dry-run.
+static int s_uhid = -1;
+
+/// The input devices of the virtual device.
+static int s_events[MAX_EVENT_DEVICES];
+static int s_numEvents = 0;
+
+/// Name of the virtual device, unique to this process.
+static char s_name[64];
+
+/// CLOCK_MONOTONIC minus micros() of the sketch, in micro-seconds.
+static int64_t s_clockOffset = 0;
+
+/// An edge of a switch, at 'm_time' micro-seconds after the start of the taps.
+struct Edge {
+  int64_t m_time;
+  Pos m_pos;
+  bool m_isPressed;
+};
+
+/// A report written to the virtual device, waiting for the MSC_SCAN event 'm_scan'. The times are in CLOCK_MONOTONIC, 'm_edge' is -1 if the report is not the first after an edge.
+struct Pending {
+  uint32_t m_scan;
+  int64_t m_edge;
+  int64_t m_submit;
+  int64_t m_write;
+};
+
+/// Current time in CLOCK_MONOTONIC, in micro-seconds.
+static int64_t now() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return int64_t(time.tv_sec) * 1000000 + time.tv_nsec / 1000;
+}
+
+/// Time of the sketch 'time', from micros(), in CLOCK_MONOTONIC. micros() wraps after 71 minutes, far longer than a run.
+static int64_t monotonic(unsigned long time) {
+  return int64_t(time) + s_clockOffset;
+}
+
+static bool writeEvent(const uhid_event& event) {
+  if (write(s_uhid, &event, sizeof(event)) != (ssize_t)sizeof(event)) {
+    perror("write /dev/uhid");
+    return false;
+  }
+  return true;
+}
+
+/// Answer the requests of the kernel. The feature and output reports are not emulated: GET_REPORT fails and SET_REPORT is ignored.
+static void processUhid() {
+  uhid_event event;
+  while (read(s_uhid, &event, sizeof(event)) > 0) {
+    uhid_event answer;
+    memset(&answer, 0, sizeof(answer));
+    if (event.type == UHID_GET_REPORT) {
+      answer.type = UHID_GET_REPORT_REPLY;
+      answer.u.get_report_reply.id = event.u.get_report.id;
+      answer.u.get_report_reply.err = EIO;
+      writeEvent(answer);
+    } else if (event.type == UHID_SET_REPORT) {
+      answer.type = UHID_SET_REPORT_REPLY;
+      answer.u.set_report_reply.id = event.u.set_report.id;
+      writeEvent(answer);
+    }
+  }
+}
+
+static bool create() {
+  s_uhid = open("/dev/uhid", O_RDWR | O_CLOEXEC | O_NONBLOCK);
+  if (s_uhid < 0) {
+    perror("/dev/uhid");
+    return false;
+  }
+
+  snprintf(s_name, sizeof(s_name), "arduino_keyboard uhid %d", getpid());
+  uhid_event event;
+  memset(&event, 0, sizeof(event));
+  event.type = UHID_CREATE2;
+  strncpy((char*)event.u.create2.name, s_name, sizeof(event.u.create2.name) - 1);
+  event.u.create2.rd_size = sizeof(s_reportDescriptor);
+  memcpy(event.u.create2.rd_data, s_reportDescriptor, sizeof(s_reportDescriptor));
+  event.u.create2.bus = BUS_USB;
+  event.u.create2.vendor = VENDOR_ID;
+  event.u.create2.product = PRODUCT_ID;
+  return writeEvent(event);
+}
+
+static void destroy() {
+  for (int i = 0; i < s_numEvents; ++i) close(s_events[i]);
+  uhid_event event;
+  memset(&event, 0, sizeof(event));
+  event.type = UHID_DESTROY;
+  writeEvent(event);
+  close(s_uhid);
+}
+
+/// Open and grab the input devices that the kernel created for the virtual device. Return false if there are none after a second.
+static bool openEventDevices() {
+  for (int attempt = 0; attempt < 50 && s_numEvents == 0; ++attempt) {
+    processUhid();
+    usleep(20000);
+
+    DIR* directory = opendir("/dev/input");
+    if (directory == nullptr) {
+      perror("/dev/input");
+      return false;
+    }
+    while (dirent* entry = readdir(directory)) {
+      if (strncmp(entry->d_name, "event", 5) != 0 || s_numEvents == MAX_EVENT_DEVICES) continue;
+
+      char path[300];
+      snprintf(path, sizeof(path), "/dev/input/%s", entry->d_name);
+      int device = open(path, O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+      if (device < 0) continue;
+
+      // The kernel adds a suffix to the name when it creates one device per application collection.
+      char name[256] = "";
+      ioctl(device, EVIOCGNAME(sizeof(name)), name);
+      if (strncmp(name, s_name, strlen(s_name)) != 0) {
+        close(device);
+        continue;
+      }
+
+      int clock = CLOCK_MONOTONIC;
+      if (ioctl(device, EVIOCSCLOCKID, &clock) < 0 || ioctl(device, EVIOCGRAB, 1) < 0) {
+        perror(path);
+        close(device);
+        continue;
+      }
+      printf("using %s (%s)\n", path, name);
+      s_events[s_numEvents++] = device;
+    }
+    closedir(directory);
+  }
+
+  if (s_numEvents == 0) fprintf(stderr, "the kernel created no input device for %s\n", s_name);
+  return s_numEvents > 0;
+}
+
+/// The MSC_SCAN value of the first usage that 'report' changes from 'previous', the last report with the same ID, or 0 if it changes none.
+static uint32_t changedUsage(const std::vector<uint8_t>& report, const std::vector<uint8_t>& previous) {
+  if (report[0] == REPORT_ID_KEYBOARD && report.size() == 9) {
+    // The modifiers are the usages 0xE0 to 0xE7, one bit each, then the keys pressed are listed in 6 bytes.
+    uint8_t modifiers = report[1] ^ previous[1];
+    for (int bit = 0; bit < 8; ++bit) {
+      if (modifiers & (1 << bit)) return SCAN_KEYS | (0xE0 + bit);
+    }
+    for (int i = 3; i < 9; ++i) {
+      if (report[i] != 0 && std::find(previous.begin() + 3, previous.end(), report[i]) == previous.end()) return SCAN_KEYS | report[i];
+      if (previous[i] != 0 && std::find(report.begin() + 3, report.end(), previous[i]) == report.end()) return SCAN_KEYS | previous[i];
+    }
+  } else if (report[0] == REPORT_ID_VOLUME && report.size() == 2) {
+    uint8_t bits = report[1] ^ previous[1];
+    for (int bit = 0; bit < 7; ++bit) {
+      if (bits & (1 << bit)) return SCAN_CONSUMER | MEDIA_USAGES[bit];
+    }
+  }
+  return 0;
+}
+
+/// Latencies of the reports from one start point, in micro-seconds.
+struct Latencies {
+  const char* m_name;
+  std::vector<int64_t> m_values = {};
+  int m_lost = 0;
+
+  void add(int64_t start, int64_t end, bool verbose) {
+    if (verbose) printf(" %s=%lldus", m_name, (long long)(end - start));
+    m_values.push_back(end - start);
+  }
+
+  void print() {
+    printf("%-14s %7zu %5d", m_name, m_values.size(), m_lost);
+    if (m_values.empty()) {
+      printf("\n");
+      return;
+    }
+    std::sort(m_values.begin(), m_values.end());
+    int64_t total = 0;
+    for (int64_t value : m_values) total += value;
+    printf(" %7lld %7lld %7lld %7lld %7lld\n", (long long)m_values.front(), (long long)(total / int64_t(m_values.size())), (long long)m_values[m_values.size() / 2],
+           (long long)m_values[m_values.size() * 99 / 100], (long long)m_values.back());
+  }
+};
+
+static Latencies s_edges{ "switch_edge" };
+static Latencies s_reports{ "report_submit" };
+static Latencies s_writes{ "uhid_write" };
+
+/// Reports written and waiting for their input event, oldest first.
+static std::deque<Pending> s_pending;
+
+/// Record the latencies of 'pending', whose input event came at 'end'.
+static void resolve(const Pending& pending, int64_t end, bool verbose) {
+  if (verbose) printf("scan 0x%05x:", pending.m_scan);
+  if (pending.m_edge >= 0) s_edges.add(pending.m_edge, end, verbose);
+  s_reports.add(pending.m_submit, end, verbose);
+  if (s_uhid >= 0) s_writes.add(pending.m_write, end, verbose);
+  if (verbose) printf("\n");
+}
+
+/// Read the input events, match them with the reports waiting for them, and count the reports waiting for longer than 'timeout' as lost.
+static void readEvents(int64_t timeout, bool verbose) {
+  if (s_uhid < 0) return;
+
+  processUhid();
+  for (int i = 0; i < s_numEvents; ++i) {
+    input_event input;
+    while (read(s_events[i], &input, sizeof(input)) == (ssize_t)sizeof(input)) {
+      if (input.type != EV_MSC || input.code != MSC_SCAN) continue;
+
+      // Other events are ignored, e.g. the EV_KEY events that follow each MSC_SCAN.
+      auto pending = std::find_if(s_pending.begin(), s_pending.end(), [&](const Pending& p) { return p.m_scan == uint32_t(input.value); });
+      if (pending == s_pending.end()) continue;
+      resolve(*pending, int64_t(input.input_event_sec) * 1000000 + input.input_event_usec, verbose);
+      s_pending.erase(pending);
+    }
+  }
+
+  int64_t time = now();
+  while (!s_pending.empty() && time - s_pending.front().m_write > timeout) {
+    if (verbose) printf("scan 0x%05x: lost\n", s_pending.front().m_scan);
+    if (s_pending.front().m_edge >= 0) s_edges.m_lost++;
+    s_reports.m_lost++;
+    s_writes.m_lost++;
+    s_pending.pop_front();
+  }
+}
+
+/// Write 'report' to the virtual device, and wait for its input event. 'edge' is the time of the edge it is the first report after, or -1.
+static void writeReport(const std::vector<uint8_t>& report, int64_t edge, int64_t submit, uint32_t scan, bool verbose) {
+  Pending pending = { scan, edge, submit, now() };
+  if (s_uhid < 0) {
+    // Without the virtual device the poll is the end.
+    resolve(pending, pending.m_write, verbose);
+    return;
+  }
+
+  uhid_event event;
+  memset(&event, 0, sizeof(event));
+  event.type = UHID_INPUT2;
+  event.u.input2.size = report.size();
+  memcpy(event.u.input2.data, report.data(), report.size());
+  if (writeEvent(event)) s_pending.push_back(pending);
+}
+
+int main(int argc, char** argv) {
+  int count = 200;
+  int64_t interval = 30000;
+  int64_t timeout = 100000;
+  bool media = false;
+  bool dryRun = false;
+  bool verbose = false;
+
+  for (int arg = 1; arg < argc; ++arg) {
+    const char* option = argv[arg];
+    const char* value = arg + 1 < argc ? argv[arg + 1] : nullptr;
+    if (strcmp(option, "--media") == 0) {
+      media = true;
+    } else if (strcmp(option, "--dry-run") == 0) {
+      dryRun = true;
+    } else if (strcmp(option, "--verbose") == 0) {
+      verbose = true;
+    } else if (value == nullptr) {
+      fprintf(stderr, "usage: %s [--count <n>] [--interval <us>] [--timeout <us>] [--media] [--dry-run] [--verbose]\n", argv[0]);
+      return 2;
+    } else if (strcmp(option, "--count") == 0) {
+      count = atoi(value);
+      ++arg;
+    } else if (strcmp(option, "--interval") == 0) {
+      interval = atoll(value);
+      ++arg;
+    } else if (strcmp(option, "--timeout") == 0) {
+      timeout = atoll(value);
+      ++arg;
+    } else {
+      fprintf(stderr, "unknown option %s\n", option);
+      return 2;
+    }
+  }
+  if (count <= 0 || interval < 2 * FRAME_LENGTH) {
+    fprintf(stderr, "the count must be positive and the interval at least %lld us\n", (long long)(2 * FRAME_LENGTH));
+    return 2;
+  }
+
+  // The letters of the top two lines in turn, see keyConfig.h, then optionally the media keys.
+  std::vector<Edge> edges;
+  int64_t time = 0;
+  auto tap = [&](Pos pos) {
+    edges.push_back(Edge{ time, pos, true });
+    edges.push_back(Edge{ time + interval, pos, false });
+    time += 2 * interval;
+  };
+  for (int i = 0; i < count; ++i) {
+    tap(Pos{ int8_t(1 + i / 10 % 2), int8_t(1 + i % 10) });
+    if (media) {
+      edges.push_back(Edge{ time, POS_FUNCTION, true });
+      time += interval;
+      tap(POS_VOLUME_UP);
+      tap(POS_VOLUME_DOWN);
+      edges.push_back(Edge{ time, POS_FUNCTION, false });
+      time += interval;
+    }
+  }
+
+  if (!dryRun) {
+    if (!create()) return 1;
+    if (!openEventDevices()) {
+      destroy();
+      return 1;
+    }
+  }
+
+  HostSketch::setRealClock(true);
+  HostSketch::setup();
+  s_clockOffset = now() - int64_t(HostSketch::now());
+
+  // The state of the switches, the edge whose first report has not been polled yet, and the last report of each ID.
+  InputFrame inputs = 0;
+  int64_t edgeTime = -1;
+  std::vector<uint8_t> lastKeyboard = { REPORT_ID_KEYBOARD, 0, 0, 0, 0, 0, 0, 0, 0 };
+  std::vector<uint8_t> lastMedia = { REPORT_ID_VOLUME, 0 };
+  std::vector<uint8_t> report;
+  uint16_t frameNumber = 0;
+
+  // The keyboard sees frames for a while before the first tap, as after it is plugged.
+  int64_t start = now() + 100 * FRAME_LENGTH;
+  int64_t nextFrame = now();
+  size_t next = 0;
+  for (;;) {
+    int64_t current = now();
+    if (next == edges.size() && s_pending.empty() && current - (start + time) > timeout) break;
+
+    if (next < edges.size() && current >= start + edges[next].m_time) {
+      const Edge& edge = edges[next++];
+      InputFrame bit = InputFrame(1) << (edge.m_pos.m_column * NUM_LINES + edge.m_pos.m_line);
+      inputs = edge.m_isPressed ? inputs | bit : inputs & ~bit;
+      HostSketch::setInputs(inputs);
+      edgeTime = current;
+    }
+
+    // A full speed host polls the keyboard endpoint once per frame.
+    if (current >= nextFrame) {
+      HostSketch::startOfFrame(++frameNumber);
+      nextFrame += FRAME_LENGTH;
+
+      unsigned long submitTime;
+      if (HostSketch::pollReport(report, submitTime)) {
+        std::vector<uint8_t>& last = report[0] == REPORT_ID_VOLUME ? lastMedia : lastKeyboard;
+        uint32_t scan = last.size() == report.size() ? changedUsage(report, last) : 0;
+        if (scan != 0) {
+          writeReport(report, edgeTime, monotonic(submitTime), scan, verbose);
+          edgeTime = -1;
+        }
+        last = report;
+      }
+    }
+
+    HostSketch::loop();
+    readEvents(timeout, verbose);
+  }
+
+  printf("%-14s %7s %5s %7s %7s %7s %7s %7s\n", dryRun ? "to_poll" : "to_event", "reports", "lost", "min_us", "avg_us", "p50_us", "p99_us", "max_us");
+  s_edges.print();
+  s_reports.print();
+  if (!dryRun) {
+    s_writes.print();
+    destroy();
+  }
+
+  // Each tap is a press and a release, each of them must be reported.
+  size_t expected = edges.size() - (media ? 2 * count : 0);
+  if (s_edges.m_values.size() != expected) fprintf(stderr, "%zu edges reported out of %zu\n", s_edges.m_values.size(), expected);
+  return s_reports.m_lost == 0 && s_edges.m_values.size() == expected ? 0 : 1;
+}